@@ -0,0 +1,98 @@
+//! @file benchmarks/AdaptiveSamplingBenchmark.cpp
+//! @brief Samples, transmissions and reconstruction error of adaptive sampling on a replayed trace.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+//!
+//! Usage: AdaptiveSamplingBenchmark [trace.csv]
+//! The trace is the 1 Hz ground truth (see ReplayTrace.h). The sensor only
+//! sees the trace at the instants it chooses to sample; the broker's
+//! step-hold reconstruction is compared against every ground-truth second.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "BenchmarkUtil.h"
+#include "ReplayTrace.h"
+#include "jenlib/measurement/AdaptiveSampling.h"
+#include "jenlib/measurement/SendOnDelta.h"
+
+namespace {
+
+using jenlib::ble::ReadingMsg;
+
+struct Result {
+    std::uint32_t samples{0};
+    std::uint32_t sent{0};
+    std::uint32_t max_temp_error{0};
+    double mean_temp_error{0.0};
+    std::uint32_t p99_temp_error{0};
+};
+
+Result replay(const std::vector<ReadingMsg>& truth, std::uint32_t max_interval_ms, bool send_on_delta) {
+    const bool adaptive = max_interval_ms > 1000;
+    jenlib::measurement::AdaptiveSampler sampler({1000, max_interval_ms, 10, 50});
+    jenlib::measurement::SendOnDeltaFilter filter({10, 50, 300000});
+    Result result;
+
+    // Broker view: the last reading received, held until the next
+    std::int16_t held = 0;
+    std::vector<std::uint32_t> errors;
+    errors.reserve(truth.size());
+    std::uint64_t next_sample_ms = 0;
+    for (const auto& reading : truth) {
+        if (reading.offset_ms >= next_sample_ms) {
+            ++result.samples;
+            if (!send_on_delta || filter.should_send(reading)) {
+                ++result.sent;
+                held = reading.temperature_c_centi;
+            }
+            // Drift-free schedule: the next sample is due one interval after this one was due
+            next_sample_ms += adaptive ? sampler.update(reading) : 1000;
+        }
+        errors.push_back(static_cast<std::uint32_t>(std::abs(reading.temperature_c_centi - held)));
+    }
+
+    std::uint64_t sum = 0;
+    for (std::uint32_t error : errors) {
+        sum += error;
+    }
+    result.mean_temp_error = static_cast<double>(sum) / errors.size();
+    std::sort(errors.begin(), errors.end());
+    result.max_temp_error = errors.back();
+    result.p99_temp_error = errors[errors.size() * 99 / 100];
+    return result;
+}
+
+void print(const char* name, const Result& result, std::size_t seconds) {
+    std::printf("%-26s samples %6u (%5.1f%%)  sent %6u (%5.1f%%)  temp error mean %.2f p99 %u max %u centi\n",
+                name, result.samples, 100.0 * result.samples / seconds, result.sent,
+                100.0 * result.sent / seconds, result.mean_temp_error, result.p99_temp_error,
+                result.max_temp_error);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const auto truth = argc > 1 ? jenlib::bench::load_trace(argv[1]) : jenlib::bench::synthetic_trace();
+    if (truth.empty()) {
+        std::fprintf(stderr, "no readings in trace\n");
+        return 1;
+    }
+    print("fixed 1 s", replay(truth, 1000, false), truth.size());
+    print("fixed 1 s + send-on-delta", replay(truth, 1000, true), truth.size());
+    print("adaptive 1-10 s", replay(truth, 10000, false), truth.size());
+    print("adaptive 1-10 s + s-o-d", replay(truth, 10000, true), truth.size());
+    print("adaptive 1-60 s", replay(truth, 60000, false), truth.size());
+    print("adaptive 1-60 s + s-o-d", replay(truth, 60000, true), truth.size());
+
+    jenlib::measurement::AdaptiveSampler sampler({1000, 60000, 10, 50});
+    std::size_t i = 0;
+    std::uint32_t sink = 0;
+    jenlib::bench::report("AdaptiveSampler::update", jenlib::bench::ns_per_iteration(10000000, [&](std::uint64_t) {
+        sink += sampler.update(truth[i]);
+        i = (i + 1) % truth.size();
+    }), "ns/reading");
+    jenlib::bench::do_not_optimize(sink);
+    return 0;
+}
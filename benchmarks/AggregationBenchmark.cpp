@@ -0,0 +1,165 @@
+//! @file benchmarks/AggregationBenchmark.cpp
+//! @brief Upload volume and CPU cost of broker-side aggregation and downsampling.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+//!
+//! Replays a day of 1 Hz readings and compares what the broker would upload:
+//! every reading, one summary per bucket (count, min, max, mean and variance
+//! of both channels), or a bounded number of points per hour from the min/max
+//! and LTTB downsamplers. Downsampled series are scored by the largest
+//! temperature error of linear interpolation between the kept points.
+//!
+//! Usage: AggregationBenchmark [trace.csv]
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <vector>
+#include "BenchmarkUtil.h"
+#include "ReplayTrace.h"
+#include "jenlib/measurement/Aggregates.h"
+#include "jenlib/measurement/Downsample.h"
+#include "jenlib/state/BrokerStateMachine.h"
+
+namespace {
+
+using jenlib::ble::ReadingMsg;
+using jenlib::measurement::SeriesPoint;
+using jenlib::measurement::SeriesSpan;
+
+constexpr std::uint32_t kWindowMs = 3600 * 1000;  // Upload window for the downsamplers
+constexpr std::size_t kSummaryBytes = 32;          // start, count, then min, max, mean, variance per channel
+constexpr std::size_t kPointBytes = 8;             // offset, temperature, humidity
+
+std::size_t reading_bytes(const ReadingMsg& reading) {
+    jenlib::ble::BlePayload payload;
+    ReadingMsg::serialize(reading, payload);
+    return payload.size;
+}
+
+//! @brief Largest temperature error of linear interpolation through @p kept, against every original point.
+std::uint32_t max_error(const std::vector<SeriesPoint>& original, const std::vector<SeriesPoint>& kept) {
+    float worst = 0.0f;
+    std::size_t k = 0;
+    for (const auto& point : original) {
+        while (k + 1 < kept.size() && kept[k + 1].offset_ms <= point.offset_ms) {
+            ++k;
+        }
+        float estimate = kept[k].temperature_c_centi;
+        if (k + 1 < kept.size() && kept[k + 1].offset_ms > kept[k].offset_ms) {
+            const float t = static_cast<float>(point.offset_ms - kept[k].offset_ms) /
+                            static_cast<float>(kept[k + 1].offset_ms - kept[k].offset_ms);
+            estimate += t * static_cast<float>(kept[k + 1].temperature_c_centi - kept[k].temperature_c_centi);
+        }
+        worst = std::max(worst, std::abs(estimate - static_cast<float>(point.temperature_c_centi)));
+    }
+    return static_cast<std::uint32_t>(worst + 0.5f);
+}
+
+//! @brief Downsample each upload window separately, as the broker would before each upload.
+template <typename Downsampler>
+std::vector<SeriesPoint> per_window(const std::vector<SeriesPoint>& points, Downsampler&& downsample) {
+    std::vector<SeriesPoint> kept;
+    std::size_t begin = 0;
+    while (begin < points.size()) {
+        const std::uint32_t window_end = points[begin].offset_ms - points[begin].offset_ms % kWindowMs + kWindowMs;
+        std::size_t end = begin;
+        while (end < points.size() && points[end].offset_ms < window_end) {
+            ++end;
+        }
+        downsample(SeriesSpan{points.data() + begin, end - begin}, std::back_inserter(kept));
+        begin = end;
+    }
+    return kept;
+}
+
+void report_volume(const char* name, std::size_t items, std::size_t bytes, std::size_t raw_bytes,
+                   std::uint32_t error) {
+    std::printf("%-28s %8zu items %9zu bytes %7.1fx smaller", name, items, bytes,
+                static_cast<double>(raw_bytes) / static_cast<double>(bytes));
+    if (error != UINT32_MAX) {
+        std::printf("   max error %u centi", error);
+    }
+    std::printf("\n");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const auto trace = argc > 1 ? jenlib::bench::load_trace(argv[1]) : jenlib::bench::synthetic_trace();
+    if (trace.empty()) {
+        std::fprintf(stderr, "no readings in trace\n");
+        return 1;
+    }
+    std::vector<SeriesPoint> points;
+    for (const auto& reading : trace) {
+        points.push_back(SeriesPoint{reading.offset_ms, reading.temperature_c_centi, reading.humidity_bp});
+    }
+
+    // Upload volume for one trace
+    const std::size_t raw_bytes = trace.size() * reading_bytes(trace.front());
+    report_volume("every reading", trace.size(), raw_bytes, raw_bytes, 0);
+    for (const std::uint32_t bucket_ms : {60000u, 300000u, 3600000u}) {
+        jenlib::measurement::BucketedAggregates<4096> aggregates(bucket_ms);
+        for (const auto& reading : trace) {
+            aggregates.add(reading);
+        }
+        aggregates.flush();
+        char name[40];
+        std::snprintf(name, sizeof(name), "summary per %u s", bucket_ms / 1000);
+        report_volume(name, aggregates.size(), aggregates.size() * kSummaryBytes, raw_bytes, UINT32_MAX);
+    }
+    for (const std::size_t per_hour : {60u, 240u}) {
+        char name[40];
+        const auto min_max = per_window(points, [per_hour](const SeriesSpan& window, auto out) {
+            jenlib::measurement::downsample_min_max(window, per_hour / 2, out);
+        });
+        std::snprintf(name, sizeof(name), "min/max %zu points/h", per_hour);
+        report_volume(name, min_max.size(), min_max.size() * kPointBytes, raw_bytes, max_error(points, min_max));
+        const auto lttb = per_window(points, [per_hour](const SeriesSpan& window, auto out) {
+            jenlib::measurement::downsample_lttb(window, per_hour, out);
+        });
+        std::snprintf(name, sizeof(name), "LTTB %zu points/h", per_hour);
+        report_volume(name, lttb.size(), lttb.size() * kPointBytes, raw_bytes, max_error(points, lttb));
+    }
+
+    // CPU cost of the aggregation path
+    std::size_t i = 0;
+    jenlib::measurement::RunningStats stats;
+    jenlib::bench::report("RunningStats::add", jenlib::bench::ns_per_iteration(10000000, [&](std::uint64_t) {
+        stats.add(trace[i].temperature_c_centi);
+        i = (i + 1) % trace.size();
+    }), "ns/value");
+    jenlib::bench::do_not_optimize(stats);
+
+    jenlib::measurement::BucketedAggregates<16> aggregates(60000);
+    std::size_t drained = 0;
+    jenlib::bench::report("BucketedAggregates::add", jenlib::bench::ns_per_iteration(10000000, [&](std::uint64_t) {
+        if (i == 0) {
+            aggregates.clear();  // Offsets restart with the trace
+        }
+        aggregates.add(trace[i]);
+        drained += aggregates.size();
+        i = (i + 1) % trace.size();
+    }), "ns/reading");
+    jenlib::bench::do_not_optimize(drained);
+
+    jenlib::state::BrokerStateMachine broker;
+    broker.handle_start_command(trace.front().sender_id, trace.front().session_id);
+    const double handle_ns = jenlib::bench::ns_per_iteration(trace.size(), [&](std::uint64_t n) {
+        broker.handle_reading(trace[n].sender_id, trace[n]);
+    });
+    jenlib::bench::report("BrokerStateMachine::handle_reading", handle_ns, "ns/reading");
+
+    std::vector<SeriesPoint> out(points.size());
+    const SeriesSpan all{points.data(), points.size()};
+    jenlib::bench::report("downsample_min_max (to 1440)", jenlib::bench::ns_per_iteration(20, [&](std::uint64_t) {
+        jenlib::measurement::downsample_min_max(all, 720, out.begin());
+    }) / static_cast<double>(points.size()), "ns/input point");
+    jenlib::bench::report("downsample_lttb (to 1440)", jenlib::bench::ns_per_iteration(20, [&](std::uint64_t) {
+        jenlib::measurement::downsample_lttb(all, 1440, out.begin());
+    }) / static_cast<double>(points.size()), "ns/input point");
+    jenlib::bench::do_not_optimize(out);
+    return 0;
+}
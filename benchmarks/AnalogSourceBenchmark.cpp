@@ -0,0 +1,50 @@
+//! @file benchmarks/AnalogSourceBenchmark.cpp
+//! @brief Cost of sampling scripted analog sources through the native driver.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include <cstdint>
+#include <sstream>
+#include "BenchmarkUtil.h"
+#include "jenlib/gpio/drivers/NativeAnalogSources.h"
+#include "jenlib/gpio/drivers/NativeGpioDriver.h"
+
+namespace {
+
+constexpr std::uint64_t kSamples = 1000000;
+constexpr std::uint32_t kSamplePeriodUs = 1000;  // 1 kHz ADC
+constexpr std::uint8_t kAdcPin = 0;
+
+void run_source(const char* label, const jenlib::gpio::AnalogSource& source) {
+    jenlib::gpio::NativeGpioDriver driver;
+    driver.set_analog_read_resolution(12);
+    driver.set_pin_source(kAdcPin, &source);
+
+    std::uint32_t sum = 0;
+    jenlib::bench::report(label, jenlib::bench::ns_per_iteration(kSamples, [&](std::uint64_t) {
+        sum += driver.analog_read(kAdcPin);
+        driver.advance_time_us(kSamplePeriodUs);
+    }), "ns/sample");
+    jenlib::bench::do_not_optimize(sum);
+}
+
+}  // namespace
+
+int main() {
+    using jenlib::gpio::CsvSource;
+
+    run_source("analog_read sine 1 Hz", jenlib::gpio::SineSource(0.75f, 0.1f, 1.0f));
+    run_source("analog_read ramp 10 s", jenlib::gpio::RampSource(0.5f, 1.0f, 10000000000ull, true));
+    run_source("analog_read noise", jenlib::gpio::NoiseSource(0.75f, 0.005f));
+
+    std::ostringstream rows;
+    for (int ms = 0; ms < 60000; ms += 100) {
+        rows << ms << ',' << (0.7 + 0.0001 * (ms / 100)) << '\n';
+    }
+    std::istringstream in(rows.str());
+    CsvSource csv;
+    csv.load(in);
+    csv.set_loop(true);
+    run_source("analog_read csv replay (600 rows)", csv);
+    return 0;
+}
@@ -0,0 +1,62 @@
+//! @file benchmarks/BenchmarkUtil.h
+//! @brief Minimal timing helpers shared by the native benchmarks.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef BENCHMARKS_BENCHMARKUTIL_H_
+#define BENCHMARKS_BENCHMARKUTIL_H_
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace jenlib::bench {
+
+//! @brief Keep the optimizer from discarding a computed value.
+template <typename T>
+inline void do_not_optimize(const T& value) {
+    asm volatile("" : : "g"(&value) : "memory");
+}
+
+//! @brief Run @p fn @p iterations times and return nanoseconds per iteration.
+template <typename Fn>
+double ns_per_iteration(std::uint64_t iterations, Fn&& fn) {
+    const auto start = std::chrono::steady_clock::now();
+    for (std::uint64_t i = 0; i < iterations; ++i) {
+        fn(i);
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+    return static_cast<double>(ns) / static_cast<double>(iterations);
+}
+
+//! @brief Run @p fn @p iterations times and return CPU cycles per iteration.
+//! @details Uses the x86 time-stamp counter; returns a negative value where no
+//! cycle counter is available so callers can fall back to ns_per_iteration.
+template <typename Fn>
+double cycles_per_iteration(std::uint64_t iterations, Fn&& fn) {
+#if defined(__x86_64__) || defined(__i386__)
+    const std::uint64_t start = __rdtsc();
+    for (std::uint64_t i = 0; i < iterations; ++i) {
+        fn(i);
+    }
+    const std::uint64_t stop = __rdtsc();
+    return static_cast<double>(stop - start) / static_cast<double>(iterations);
+#else
+    (void)iterations;
+    (void)fn;
+    return -1.0;
+#endif
+}
+
+//! @brief Print one result row: name, value and unit.
+inline void report(const char* name, double value, const char* unit) {
+    std::printf("%-48s %12.2f %s\n", name, value, unit);
+}
+
+}  // namespace jenlib::bench
+
+#endif  // BENCHMARKS_BENCHMARKUTIL_H_
@@ -0,0 +1,85 @@
+//! @file benchmarks/BleProfilingBenchmark.cpp
+//! @brief Per-message cost of wrapping a BLE driver in ProfilingBleDriver.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+//!
+//! Broadcasts readings from kSensors sensors through an in-process
+//! NativeBleDriver, bare and wrapped, and through a MultiRadioBroker with a
+//! profiled radio polled after every batch. Each message is counted once
+//! outbound, once inbound and its callback is timed, so the difference is
+//! the full profiling cost on the broker path.
+
+#include <cstdio>
+#include <vector>
+#include "BenchmarkUtil.h"
+#include "jenlib/ble/MultiRadioBroker.h"
+#include "jenlib/ble/Roles.h"
+#include "jenlib/ble/drivers/NativeBleDriver.h"
+#include "jenlib/ble/drivers/ProfilingBleDriver.h"
+
+namespace {
+
+using jenlib::ble::DeviceId;
+using jenlib::ble::ReadingMsg;
+using jenlib::ble::SessionId;
+
+constexpr std::uint32_t kSensors = 32;
+constexpr std::uint64_t kMessages = 2000000;
+constexpr std::uint64_t kBatch = 64;  // Messages between broker polls
+
+double broadcast_all(jenlib::ble::BleDriver& driver, jenlib::ble::MultiRadioBroker* broker) {
+    std::vector<jenlib::ble::Sensor> sensors;
+    for (std::uint32_t s = 0; s < kSensors; ++s) {
+        sensors.emplace_back(DeviceId(0x100 + s), &driver);
+    }
+    return jenlib::bench::ns_per_iteration(kMessages, [&sensors, broker](std::uint64_t i) {
+        const std::uint32_t sensor = static_cast<std::uint32_t>(i % kSensors);
+        sensors[sensor].broadcast_reading(ReadingMsg{DeviceId(0x100 + sensor), SessionId(1),
+                                                     static_cast<std::uint32_t>(i / kSensors * 1000), 2100, 4000});
+        if (broker && i % kBatch == 0) {
+            broker->process_events();
+        }
+    });
+}
+
+}  // namespace
+
+int main() {
+    std::uint64_t received = 0;
+    const auto count = [&received](DeviceId, const ReadingMsg&) { ++received; };
+
+    jenlib::ble::NativeBleDriver bare(DeviceId(0));
+    bare.set_reading_callback(count);
+    bare.begin();
+    const double bare_ns = broadcast_all(bare, nullptr);
+
+    jenlib::ble::NativeBleDriver radio(DeviceId(0));
+    jenlib::ble::ProfilingBleDriver profiled(radio);
+    profiled.set_reading_callback(count);
+    profiled.begin();
+    const double profiled_ns = broadcast_all(profiled, nullptr);
+
+    jenlib::ble::NativeBleDriver broker_radio(DeviceId(0));
+    jenlib::ble::ProfilingBleDriver broker_profiled(broker_radio);
+    jenlib::ble::MultiRadioBroker broker;
+    broker.add_radio(broker_profiled);
+    broker.configure_callbacks(jenlib::ble::BleCallbacks{.on_reading = count});
+    broker.begin();
+    const double broker_ns = broadcast_all(broker_profiled, &broker);
+    jenlib::bench::do_not_optimize(received);
+
+    jenlib::bench::report("bare NativeBleDriver", bare_ns, "ns/message");
+    jenlib::bench::report("ProfilingBleDriver", profiled_ns, "ns/message");
+    jenlib::bench::report("profiling overhead", profiled_ns - bare_ns, "ns/message");
+    jenlib::bench::report("profiled radio under MultiRadioBroker", broker_ns, "ns/message");
+
+    const jenlib::ble::BleProfileSnapshot stats = broker_profiled.snapshot();
+    const jenlib::ble::BleCallbackTiming& reading = stats.callback(jenlib::ble::BleCallbackKind::Reading);
+    jenlib::bench::report("snapshot: inbound readings",
+                          static_cast<double>(stats.inbound.count(jenlib::ble::MessageType::Reading)), "messages");
+    jenlib::bench::report("snapshot: inbound bytes", static_cast<double>(stats.inbound.bytes), "bytes");
+    jenlib::bench::report("snapshot: reading callback p99 bound", reading.quantile_upper_us(0.99f), "us");
+    jenlib::bench::report("snapshot: reading callback max", reading.max_us, "us");
+    jenlib::bench::report("snapshot: poll calls", stats.poll.calls, "calls");
+    return 0;
+}
@@ -0,0 +1,157 @@
+//! @file benchmarks/BleReplayBenchmark.cpp
+//! @brief Cost of recording BLE traffic and broker ingest rate when a capture is replayed.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+//!
+//! Records kMessages readings from kSensors sensors through a
+//! RecordingBleDriver wrapped around an in-process NativeBleDriver, and
+//! compares the per-message cost with the bare driver. The capture is then
+//! replayed into a MultiRadioBroker as fast as possible, which is the
+//! ingest-throughput figure to track for regressions, and at real time over
+//! a synthetic kPacedSeconds trace, reporting how late records are delivered
+//! against their timestamps.
+//!
+//! Usage: BleReplayBenchmark [trace] (default /tmp/jenlib-replay-<pid>.jbtr, removed afterwards)
+
+#include <cstdio>
+
+#if !defined(ARDUINO) && !defined(ESP_PLATFORM)
+
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "BenchmarkUtil.h"
+#include "jenlib/ble/BleTrace.h"
+#include "jenlib/ble/MultiRadioBroker.h"
+#include "jenlib/ble/Roles.h"
+#include "jenlib/ble/drivers/NativeBleDriver.h"
+#include "jenlib/ble/drivers/RecordingBleDriver.h"
+#include "jenlib/ble/drivers/ReplayBleDriver.h"
+
+namespace {
+
+using jenlib::ble::BleTraceRecord;
+using jenlib::ble::DeviceId;
+using jenlib::ble::ReadingMsg;
+using jenlib::ble::SessionId;
+
+constexpr std::uint32_t kSensors = 32;
+constexpr std::uint64_t kMessages = 1000000;
+constexpr std::uint32_t kPacedSeconds = 2;
+constexpr std::uint32_t kPacedRate = 20000;  // Readings per second in the paced trace
+
+//! @brief Broadcast kMessages readings round-robin from kSensors sensors over @p driver.
+double broadcast_all(jenlib::ble::BleDriver& driver) {
+    std::vector<jenlib::ble::Sensor> sensors;
+    for (std::uint32_t s = 0; s < kSensors; ++s) {
+        sensors.emplace_back(DeviceId(0x100 + s), &driver);
+    }
+    return jenlib::bench::ns_per_iteration(kMessages, [&sensors](std::uint64_t i) {
+        const std::uint32_t sensor = static_cast<std::uint32_t>(i % kSensors);
+        sensors[sensor].broadcast_reading(ReadingMsg{DeviceId(0x100 + sensor), SessionId(1),
+                                                     static_cast<std::uint32_t>(i / kSensors * 1000), 2100, 4000});
+    });
+}
+
+double percentile(std::vector<std::uint64_t>& values, double fraction) {
+    if (values.empty()) {
+        return 0.0;
+    }
+    const std::size_t index = static_cast<std::size_t>(fraction * static_cast<double>(values.size() - 1));
+    std::nth_element(values.begin(), values.begin() + index, values.end());
+    return static_cast<double>(values[index]);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const std::string path = argc > 1 ? argv[1] : "/tmp/jenlib-replay-" + std::to_string(getpid()) + ".jbtr";
+    std::uint64_t received = 0;
+    const auto count = [&received](DeviceId, const ReadingMsg&) { ++received; };
+
+    jenlib::ble::NativeBleDriver bare(DeviceId(0));
+    bare.set_reading_callback(count);
+    bare.begin();
+    const double bare_ns = broadcast_all(bare);
+
+    jenlib::ble::NativeBleDriver radio(DeviceId(0));
+    jenlib::ble::BleTraceWriter writer;
+    if (!writer.open(path.c_str())) {
+        std::fprintf(stderr, "cannot create %s\n", path.c_str());
+        return 1;
+    }
+    jenlib::ble::RecordingBleDriver recorder(radio, writer);
+    recorder.set_reading_callback(count);
+    recorder.begin();
+    const double recorded_ns = broadcast_all(recorder);
+    writer.close();
+    jenlib::bench::report("bare NativeBleDriver", bare_ns, "ns/message");
+    jenlib::bench::report("RecordingBleDriver (advertise + delivery)", recorded_ns, "ns/message");
+    jenlib::bench::report("recording overhead", recorded_ns - bare_ns, "ns/message");
+
+    std::vector<BleTraceRecord> records;
+    const auto load_start = std::chrono::steady_clock::now();
+    jenlib::ble::load_ble_trace(path.c_str(), records);
+    const double load_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - load_start).count();
+    jenlib::bench::report("trace records", static_cast<double>(records.size()), "records");
+    jenlib::bench::report("trace load", static_cast<double>(records.size()) / load_s, "records/s");
+    if (argc <= 1) {
+        unlink(path.c_str());
+    }
+
+    jenlib::ble::ReplayBleDriver fast(DeviceId(0), std::move(records));
+    jenlib::ble::MultiRadioBroker broker;
+    broker.add_radio(fast);
+    received = 0;
+    broker.configure_callbacks(jenlib::ble::BleCallbacks{.on_reading = count});
+    broker.begin();
+    const auto replay_start = std::chrono::steady_clock::now();
+    while (!fast.finished()) {
+        broker.process_events();
+    }
+    const double replay_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - replay_start).count();
+    jenlib::bench::report("max-speed replay into MultiRadioBroker", static_cast<double>(received) / replay_s,
+                          "readings/s");
+
+    std::vector<BleTraceRecord> paced_records;
+    const std::uint64_t paced_count = static_cast<std::uint64_t>(kPacedSeconds) * kPacedRate;
+    for (std::uint64_t i = 0; i < paced_count; ++i) {
+        BleTraceRecord record;
+        record.time_us = i * 1000000 / kPacedRate;
+        record.device = DeviceId(0x100 + static_cast<std::uint32_t>(i % kSensors));
+        ReadingMsg::serialize(ReadingMsg{record.device, SessionId(1), static_cast<std::uint32_t>(i), 2100, 4000},
+                              record.payload);
+        paced_records.push_back(std::move(record));
+    }
+    jenlib::ble::ReplayBleDriver paced(DeviceId(0), std::move(paced_records), 1.0);
+    std::vector<std::uint64_t> lateness;
+    lateness.reserve(paced_count);
+    paced.set_reading_callback(
+        [&lateness, &paced](DeviceId, const ReadingMsg&) { lateness.push_back(paced.last_lateness_us()); });
+    paced.begin();
+    const auto paced_start = std::chrono::steady_clock::now();
+    while (!paced.finished()) {
+        paced.poll();
+        std::this_thread::yield();
+    }
+    const double paced_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - paced_start).count();
+    jenlib::bench::report("real-time replay duration", paced_s, "s");
+    jenlib::bench::report("real-time replay lateness p50", percentile(lateness, 0.50), "us");
+    jenlib::bench::report("real-time replay lateness p99", percentile(lateness, 0.99), "us");
+    jenlib::bench::report("real-time replay lateness max", percentile(lateness, 1.0), "us");
+    return 0;
+}
+
+#else
+
+int main() {
+    std::printf("BleReplayBenchmark needs a native build\n");
+    return 0;
+}
+
+#endif  // !ARDUINO && !ESP_PLATFORM
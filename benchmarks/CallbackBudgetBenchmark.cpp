@@ -0,0 +1,140 @@
+//! @file benchmarks/CallbackBudgetBenchmark.cpp
+//! @brief Measurement-timer lateness under a hot event handler, with and without pass budgets.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+//!
+//! Runs a sensor-style loop on a simulated clock for kSimulatedMs: every
+//! kBurstEveryMs a BLE burst queues kBurstEvents events whose handler costs
+//! kHandlerMs each, and a 100 ms measurement timer costs 1 ms. Each loop
+//! iteration processes events, then timers, then idles 1 ms. The benchmark
+//! reports how late the measurement timer fired, how many periods it missed
+//! and how long events waited, for several event pass budgets. A second part
+//! times the bookkeeping on the real clock.
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+#include "BenchmarkUtil.h"
+#include "jenlib/events/EventContext.h"
+#include "jenlib/time/TimerContext.h"
+#include "jenlib/time/drivers/NativeTimeDriver.h"
+
+namespace {
+
+using jenlib::events::Event;
+using jenlib::events::EventContext;
+using jenlib::events::EventType;
+
+constexpr std::uint32_t kSimulatedMs = 600000;
+constexpr std::uint32_t kBurstEveryMs = 500;
+constexpr std::uint32_t kBurstEvents = 25;
+constexpr std::uint32_t kHandlerMs = 4;
+constexpr std::uint32_t kMeasureMs = 100;
+
+//! @brief Clock that moves only when the simulation advances it
+class SimulatedClock : public jenlib::time::TimeDriver {
+ public:
+    std::uint32_t now() override { return now_ms; }
+    void delay(std::uint32_t delay_ms) override { now_ms += delay_ms; }
+    bool has_overflowed(std::uint32_t) noexcept override { return false; }
+    std::uint32_t time_difference(std::uint32_t current, std::uint32_t previous) noexcept override {
+        return current - previous;
+    }
+
+    std::uint32_t now_ms{0};
+};
+
+std::uint32_t percentile(std::vector<std::uint32_t> values, double p) {
+    if (values.empty()) {
+        return 0;
+    }
+    std::sort(values.begin(), values.end());
+    return values[static_cast<std::size_t>(p * static_cast<double>(values.size() - 1))];
+}
+
+void run(std::uint32_t pass_budget_ms) {
+    SimulatedClock clock;
+    EventContext events;
+    events.set_time_driver(&clock);
+    events.set_pass_budget_ms(pass_budget_ms);
+    jenlib::time::TimerContext timers(&clock);
+
+    std::vector<std::uint32_t> event_wait;
+    const auto handler = events.register_callback(EventType::kBleMessage, [&](const Event& event) {
+        event_wait.push_back(clock.now_ms - event.timestamp);
+        clock.delay(kHandlerMs);
+    });
+    events.set_callback_budget(handler, 2);
+
+    // Mirror the timer's schedule: it fires for the period it was due and skips periods that passed entirely
+    std::vector<std::uint32_t> lateness;
+    std::uint32_t due = kMeasureMs;
+    std::uint32_t pass_time = 0;
+    const auto measure = timers.schedule_callback(kMeasureMs, [&] {
+        lateness.push_back(clock.now_ms - due);
+        due += kMeasureMs;
+        while (due <= pass_time) {
+            due += kMeasureMs;
+        }
+        clock.delay(1);
+    }, true);
+    timers.set_callback_budget(measure, 2);
+
+    std::uint32_t next_burst = kBurstEveryMs / 2;
+    while (clock.now_ms < kSimulatedMs) {
+        if (clock.now_ms >= next_burst) {
+            for (std::uint32_t i = 0; i < kBurstEvents; ++i) {
+                events.dispatch_event(Event(EventType::kBleMessage, clock.now_ms, i));
+            }
+            next_burst += kBurstEveryMs;
+        }
+        events.process_events();
+        pass_time = clock.now_ms;
+        timers.process_timers();
+        clock.delay(1);
+    }
+
+    char name[64];
+    std::snprintf(name, sizeof(name), "pass budget %u ms: timer lateness p50", pass_budget_ms);
+    jenlib::bench::report(name, percentile(lateness, 0.5), "ms");
+    std::snprintf(name, sizeof(name), "pass budget %u ms: timer lateness p99", pass_budget_ms);
+    jenlib::bench::report(name, percentile(lateness, 0.99), "ms");
+    std::snprintf(name, sizeof(name), "pass budget %u ms: timer lateness max", pass_budget_ms);
+    jenlib::bench::report(name, percentile(lateness, 1.0), "ms");
+    std::snprintf(name, sizeof(name), "pass budget %u ms: missed timer periods", pass_budget_ms);
+    jenlib::bench::report(name, timers.get_missed_periods(), "periods");
+    std::snprintf(name, sizeof(name), "pass budget %u ms: event wait p99", pass_budget_ms);
+    jenlib::bench::report(name, percentile(event_wait, 0.99), "ms");
+    std::snprintf(name, sizeof(name), "pass budget %u ms: worst offender overruns", pass_budget_ms);
+    jenlib::bench::report(name, events.get_worst_offender().overruns, "calls");
+}
+
+}  // namespace
+
+int main() {
+    std::printf("%u s simulated, %u events of %u ms every %u ms, %u ms timer\n", kSimulatedMs / 1000,
+                kBurstEvents, kHandlerMs, kBurstEveryMs, kMeasureMs);
+    for (const std::uint32_t budget : {0u, 20u, 5u}) {
+        run(budget);
+    }
+
+    // Bookkeeping cost on the real clock: a trivial handler, 32 events per pass
+    jenlib::time::NativeTimeDriver native_clock;
+    for (const bool timed : {false, true}) {
+        EventContext events;
+        events.set_time_driver(timed ? &native_clock : nullptr);
+        events.set_pass_budget_ms(timed ? 10 : 0);
+        std::uint64_t sum = 0;
+        events.register_callback(EventType::kCustom, [&](const Event& event) { sum += event.data; });
+        const double ns = jenlib::bench::ns_per_iteration(200000, [&](std::uint64_t i) {
+            for (std::uint32_t e = 0; e < EventContext::kMaxEventQueueSize; ++e) {
+                events.dispatch_event(Event(EventType::kCustom, 0, static_cast<std::uint32_t>(i + e)));
+            }
+            events.process_events();
+        });
+        jenlib::bench::do_not_optimize(sum);
+        jenlib::bench::report(timed ? "dispatch + process, timed with budgets" : "dispatch + process, untimed",
+                              ns / EventContext::kMaxEventQueueSize, "ns/event");
+    }
+    return 0;
+}
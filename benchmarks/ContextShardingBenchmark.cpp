@@ -0,0 +1,136 @@
+//! @file benchmarks/ContextShardingBenchmark.cpp
+//! @brief Event throughput with one context per thread against a shared, locked dispatcher.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+//!
+//! Each worker dispatches events and processes them in full-queue batches,
+//! with a repeating timer polled every batch as a run loop would. Sharded
+//! runs give every worker its own EventContext and TimerContext; shared runs
+//! push every worker through the static EventDispatcher and Time behind one
+//! mutex, which is what thread-safe use of the static API requires. Workers
+//! are pinned round-robin to the available cores.
+
+#include <cstdio>
+
+#if defined(__linux__)
+
+#include <pthread.h>
+#include <sched.h>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "BenchmarkUtil.h"
+#include "jenlib/events/EventContext.h"
+#include "jenlib/events/EventDispatcher.h"
+#include "jenlib/time/Time.h"
+#include "jenlib/time/TimerContext.h"
+#include "jenlib/time/drivers/NativeTimeDriver.h"
+
+namespace {
+
+using jenlib::events::Event;
+using jenlib::events::EventContext;
+using jenlib::events::EventType;
+
+constexpr std::uint32_t kEventsPerWorker = 2000000;
+constexpr std::uint32_t kBatch = EventContext::kMaxEventQueueSize;
+
+jenlib::time::NativeTimeDriver clock_driver;
+
+void pin_to_core(std::size_t worker) {
+    const unsigned cores = std::thread::hardware_concurrency();
+    if (cores == 0) {
+        return;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(worker % cores, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+}
+
+void sharded_worker(std::size_t worker, std::uint64_t& handled) {
+    pin_to_core(worker);
+    EventContext events;
+    jenlib::time::TimerContext timers(&clock_driver);
+    std::uint64_t sum = 0;
+    events.register_callback(EventType::kCustom, [&sum](const Event& event) { sum += event.data; });
+    timers.schedule_callback(10, [&sum]() { ++sum; }, true);
+    for (std::uint32_t i = 0; i < kEventsPerWorker; i += kBatch) {
+        for (std::uint32_t j = 0; j < kBatch; ++j) {
+            events.dispatch_event(Event(EventType::kCustom, i, 1));
+        }
+        events.process_events();
+        timers.process_timers();
+    }
+    handled = sum;
+}
+
+void shared_worker(std::size_t worker, std::mutex& lock, std::uint64_t& handled) {
+    pin_to_core(worker);
+    for (std::uint32_t i = 0; i < kEventsPerWorker; i += kBatch) {
+        std::lock_guard<std::mutex> guard(lock);
+        for (std::uint32_t j = 0; j < kBatch; ++j) {
+            jenlib::events::EventDispatcher::dispatch_event(Event(EventType::kCustom, i, 1));
+        }
+        jenlib::events::EventDispatcher::process_events();
+        jenlib::time::Time::process_timers();
+    }
+    handled = kEventsPerWorker;
+}
+
+template <typename Worker>
+double run(std::size_t workers, Worker&& worker) {
+    std::vector<std::uint64_t> handled(workers, 0);
+    std::vector<std::thread> threads;
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t w = 0; w < workers; ++w) {
+        threads.emplace_back([&worker, &handled, w]() { worker(w, handled[w]); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::uint64_t total = 0;
+    for (const std::uint64_t count : handled) {
+        total += count;
+    }
+    jenlib::bench::do_not_optimize(total);
+    return static_cast<double>(workers) * kEventsPerWorker / seconds;
+}
+
+}  // namespace
+
+int main() {
+    jenlib::time::Time::setDriver(&clock_driver);
+    std::uint64_t shared_sum = 0;
+    jenlib::events::EventDispatcher::register_callback(EventType::kCustom,
+                                                       [&shared_sum](const Event& event) { shared_sum += event.data; });
+    jenlib::time::schedule_repeating_timer(10, [&shared_sum]() { ++shared_sum; });
+    std::mutex shared_lock;
+
+    std::printf("%u hardware threads\n", std::thread::hardware_concurrency());
+    std::printf("%-10s %18s %18s %18s %18s\n", "contexts", "sharded events/s", "per context", "shared events/s",
+                "per worker");
+    for (const std::size_t workers : {1, 2, 4, 8}) {
+        const double sharded = run(workers, [](std::size_t w, std::uint64_t& handled) { sharded_worker(w, handled); });
+        const double shared = run(workers, [&shared_lock](std::size_t w, std::uint64_t& handled) {
+            shared_worker(w, shared_lock, handled);
+        });
+        std::printf("%-10zu %18.0f %18.0f %18.0f %18.0f\n", workers, sharded, sharded / workers, shared,
+                    shared / workers);
+    }
+    jenlib::bench::do_not_optimize(shared_sum);
+    jenlib::time::Time::setDriver(nullptr);
+    return 0;
+}
+
+#else
+
+int main() {
+    std::printf("ContextShardingBenchmark needs Linux thread affinity\n");
+    return 0;
+}
+
+#endif  // __linux__
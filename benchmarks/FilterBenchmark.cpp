@@ -0,0 +1,69 @@
+//! @file benchmarks/FilterBenchmark.cpp
+//! @brief Per-sample cost of the fixed-point measurement filters.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include <array>
+#include <cstdint>
+#include "BenchmarkUtil.h"
+#include "jenlib/measurement/Filters.h"
+
+namespace {
+
+constexpr std::uint64_t kSamples = 2000000;
+constexpr std::size_t kBlock = 256;
+
+// Noisy temperature around 23.00 C in centi-degrees, with occasional spikes
+std::array<jenlib::measurement::Sample, kBlock> make_input() {
+    std::array<jenlib::measurement::Sample, kBlock> input{};
+    std::uint32_t state = 12345;
+    for (auto& sample : input) {
+        state = state * 1664525u + 1013904223u;
+        sample = 2300 + static_cast<std::int32_t>((state >> 24) % 41) - 20;
+        if ((state & 0x3Fu) == 0) {
+            sample += 500;
+        }
+    }
+    return input;
+}
+
+template <typename Filter>
+void run_filter(const char* label, Filter filter) {
+    const auto input = make_input();
+    jenlib::measurement::Sample sink = 0;
+
+    auto per_sample = [&](std::uint64_t i) {
+        sink += filter.update(input[i % kBlock]);
+    };
+    const double cycles = jenlib::bench::cycles_per_iteration(kSamples, per_sample);
+    if (cycles >= 0.0) {
+        jenlib::bench::report(label, cycles, "cycles/sample");
+    } else {
+        jenlib::bench::report(label, jenlib::bench::ns_per_iteration(kSamples, per_sample), "ns/sample");
+    }
+
+    std::array<jenlib::measurement::Sample, kBlock> output{};
+    char name[64];
+    std::snprintf(name, sizeof(name), "%s (process %zu)", label, kBlock);
+    jenlib::bench::report(name, jenlib::bench::ns_per_iteration(kSamples / kBlock, [&](std::uint64_t) {
+        filter.process(input.begin(), input.end(), output.begin());
+        jenlib::bench::do_not_optimize(output);
+    }) / static_cast<double>(kBlock), "ns/sample");
+    jenlib::bench::do_not_optimize(sink);
+}
+
+}  // namespace
+
+int main() {
+    using jenlib::measurement::ExponentialMovingAverage;
+    using jenlib::measurement::Kalman1D;
+    using jenlib::measurement::MedianFilter;
+    using jenlib::measurement::MovingAverage;
+
+    run_filter("moving average N=8", MovingAverage<8>{});
+    run_filter("EMA alpha=1/8", ExponentialMovingAverage<3>{});
+    run_filter("median N=5", MedianFilter<5>{});
+    run_filter("median N=9", MedianFilter<9>{});
+    run_filter("kalman 1D", Kalman1D(4, 400));
+    return 0;
+}
@@ -0,0 +1,65 @@
+//! @file benchmarks/GpioEdgeLatencyBenchmark.cpp
+//! @brief Cost of interrupt-fed edge monitoring versus polling digital_read.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include <array>
+#include <cstdint>
+#include "BenchmarkUtil.h"
+#include "jenlib/events/EventDispatcher.h"
+#include "jenlib/gpio/GpioEdgeMonitor.h"
+#include "jenlib/gpio/drivers/NativeGpioDriver.h"
+
+namespace {
+
+constexpr std::uint64_t kIterations = 200000;
+constexpr std::uint8_t kPinCount = 8;
+
+}  // namespace
+
+int main() {
+    using jenlib::bench::ns_per_iteration;
+    using jenlib::bench::report;
+    using jenlib::events::EventDispatcher;
+    using jenlib::events::EventType;
+    using jenlib::gpio::DigitalValue;
+
+    jenlib::gpio::NativeGpioDriver driver;
+    jenlib::gpio::GpioEdgeMonitor monitor(&driver);
+    for (std::uint8_t pin = 0; pin < kPinCount; ++pin) {
+        monitor.subscribe(pin, jenlib::gpio::InterruptEdge::CHANGE, 0);
+    }
+
+    std::uint64_t delivered = 0;
+    EventDispatcher::clear_all_callbacks();
+    EventDispatcher::register_callback(EventType::kGpioChange, [&](const jenlib::events::Event&) { ++delivered; });
+
+    // Idle main loop: nothing changed, how much does one pass cost?
+    report("monitor process() idle, 8 pins", ns_per_iteration(kIterations, [&](std::uint64_t i) {
+        monitor.process(static_cast<std::uint32_t>(i));
+    }), "ns/pass");
+
+    std::array<DigitalValue, kPinCount> last{};
+    report("polling digital_read idle, 8 pins", ns_per_iteration(kIterations, [&](std::uint64_t) {
+        for (std::uint8_t pin = 0; pin < kPinCount; ++pin) {
+            const DigitalValue level = driver.digital_read(pin);
+            if (level != last[pin]) {
+                last[pin] = level;
+                ++delivered;
+            }
+        }
+    }), "ns/pass");
+
+    // Edge to handler: inject, process and dispatch one change
+    report("edge -> kGpioChange callback", ns_per_iteration(kIterations, [&](std::uint64_t i) {
+        const auto now = static_cast<std::uint32_t>(i);
+        driver.inject_edge(static_cast<std::uint8_t>(i % kPinCount),
+                           (i / kPinCount) % 2 == 0 ? DigitalValue::HIGH : DigitalValue::LOW, now);
+        monitor.process(now);
+        EventDispatcher::process_events();
+    }), "ns/edge");
+
+    jenlib::bench::do_not_optimize(delivered);
+    EventDispatcher::clear_all_callbacks();
+    return 0;
+}
@@ -0,0 +1,135 @@
+//! @file benchmarks/HealthBenchmark.cpp
+//! @brief Wire size, cost and loss tolerance of delta-coded health heartbeats.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+//!
+//! Simulates kSensors sensors sending a heartbeat every 10 s for a day. Each
+//! sensor's counters drift the way a busy sensor's would: uptime climbs,
+//! evictions, drops and overruns arrive in rare bursts, retention fill wanders
+//! and the battery sags with ADC noise. Heartbeats cross a link that loses
+//! kLossPercent of them. For several keyframe intervals the benchmark reports
+//! bytes on air per heartbeat, against a fixed little-endian layout of the same
+//! fields, and the share of received heartbeats the broker could decode.
+
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "BenchmarkUtil.h"
+#include "jenlib/ble/Health.h"
+
+namespace {
+
+using jenlib::ble::BlePayload;
+using jenlib::ble::DeviceId;
+using jenlib::ble::HealthCounters;
+using jenlib::ble::HealthMsg;
+
+constexpr std::uint32_t kSensors = 32;
+constexpr std::uint32_t kBeats = 24 * 360;  // One day at 10 s
+constexpr std::uint32_t kLossPercent = 5;
+constexpr std::size_t kFixedLayoutSize = 1 + 5 + 1 + 4 * 4 + 2 * 2;  // Type, id, sequence, fields
+
+std::vector<HealthCounters> simulate(std::mt19937& rng) {
+    std::uniform_int_distribution<int> percent(0, 99);
+    std::uniform_int_distribution<int> noise(-3, 3);
+    std::vector<HealthCounters> beats(kBeats);
+    HealthCounters c;
+    c.battery_mv = 3300;
+    c.retention_permille = 100;
+    for (std::uint32_t i = 0; i < kBeats; ++i) {
+        c.uptime_s += 10;
+        if (percent(rng) < 2) c.event_evictions += 1 + percent(rng) % 20;
+        if (percent(rng) < 3) c.inbox_drops += 1 + percent(rng) % 5;
+        if (percent(rng) < 5) c.loop_overruns += 1;
+        if (percent(rng) < 20) c.retention_permille = static_cast<std::uint16_t>(50 + percent(rng) * 4);
+        if (i % 90 == 0) c.battery_mv -= 1;  // About 100 mV a day
+        HealthCounters reported = c;
+        reported.battery_mv = static_cast<std::uint16_t>(c.battery_mv + noise(rng));
+        beats[i] = reported;
+    }
+    return beats;
+}
+
+struct Result {
+    double bytes_per_beat{0};
+    double decodable_percent{0};
+};
+
+Result run(const std::vector<std::vector<HealthCounters>>& sensors, std::uint8_t keyframe_interval) {
+    std::mt19937 loss_rng(7);
+    std::uniform_int_distribution<std::uint32_t> percent(0, 99);
+    std::uint64_t bytes = 0;
+    std::uint64_t received = 0;
+    std::uint64_t applied = 0;
+    jenlib::ble::FleetHealth fleet;
+    for (std::uint32_t s = 0; s < kSensors; ++s) {
+        jenlib::ble::HealthEncoder encoder(keyframe_interval);
+        for (std::uint32_t i = 0; i < kBeats; ++i) {
+            const HealthMsg msg = encoder.next(DeviceId(s + 1), sensors[s][i]);
+            BlePayload payload;
+            HealthMsg::serialize(msg, payload);
+            bytes += payload.size;
+            if (percent(loss_rng) < kLossPercent) {
+                continue;
+            }
+            ++received;
+            applied += fleet.add(payload, i * 10000u);
+        }
+    }
+    Result r;
+    r.bytes_per_beat = static_cast<double>(bytes) / (static_cast<double>(kSensors) * kBeats);
+    r.decodable_percent = 100.0 * static_cast<double>(applied) / static_cast<double>(received);
+    return r;
+}
+
+}  // namespace
+
+int main() {
+    std::mt19937 rng(42);
+    std::vector<std::vector<HealthCounters>> sensors(kSensors);
+    for (auto& beats : sensors) {
+        beats = simulate(rng);
+    }
+
+    std::printf("%u sensors, %u heartbeats each, %u%% loss\n", kSensors, kBeats, kLossPercent);
+    jenlib::bench::report("fixed little-endian layout", static_cast<double>(kFixedLayoutSize), "bytes/heartbeat");
+    for (const std::uint8_t interval : {1, 4, 8, 16, 64}) {
+        const Result r = run(sensors, interval);
+        char name[64];
+        std::snprintf(name, sizeof(name), "keyframe every %u: size", interval);
+        jenlib::bench::report(name, r.bytes_per_beat, "bytes/heartbeat");
+        std::snprintf(name, sizeof(name), "keyframe every %u: decodable", interval);
+        jenlib::bench::report(name, r.decodable_percent, "% of received");
+    }
+
+    const std::vector<HealthCounters>& beats = sensors[0];
+    jenlib::ble::HealthEncoder encoder;
+    const double encode_ns = jenlib::bench::ns_per_iteration(kBeats, [&](std::uint64_t i) {
+        BlePayload payload;
+        HealthMsg::serialize(encoder.next(DeviceId(1), beats[i]), payload);
+        jenlib::bench::do_not_optimize(payload);
+    });
+    jenlib::bench::report("encode + serialize", encode_ns, "ns/heartbeat");
+
+    std::vector<BlePayload> wire(kBeats);
+    jenlib::ble::HealthEncoder wire_encoder;
+    for (std::uint32_t i = 0; i < kBeats; ++i) {
+        HealthMsg::serialize(wire_encoder.next(DeviceId(1), beats[i]), wire[i]);
+    }
+    jenlib::ble::FleetHealth fleet;
+    const double decode_ns = jenlib::bench::ns_per_iteration(kBeats, [&](std::uint64_t i) {
+        jenlib::bench::do_not_optimize(fleet.add(wire[i], static_cast<std::uint32_t>(i)));
+    });
+    jenlib::bench::report("deserialize + FleetHealth::add (1 sensor)", decode_ns, "ns/heartbeat");
+
+    jenlib::ble::FleetHealth full;
+    for (std::uint32_t s = 0; s < jenlib::ble::FleetHealth::kMaxSensors; ++s) {
+        full.add(HealthMsg{DeviceId(s + 1), 0, true, sensors[s % kSensors][0]}, 0);
+    }
+    const double summary_ns = jenlib::bench::ns_per_iteration(100000, [&](std::uint64_t i) {
+        jenlib::bench::do_not_optimize(full.summary(static_cast<std::uint32_t>(i), 60000));
+    });
+    jenlib::bench::report("FleetHealth::summary (32 sensors)", summary_ns, "ns");
+    jenlib::bench::report("FleetHealth state", sizeof(jenlib::ble::FleetHealth), "bytes");
+    return 0;
+}
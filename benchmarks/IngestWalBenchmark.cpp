@@ -0,0 +1,137 @@
+//! @file benchmarks/IngestWalBenchmark.cpp
+//! @brief Sustained ingest rate and added ack latency of the WAL under several commit policies.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+//!
+//! Sustained runs append readings from 32 sensors as fast as possible for
+//! about a second. Paced runs offer kPacedRate readings per second, call
+//! poll() between arrivals like a run loop, and time each reading from
+//! arrival to the commit that makes it durable, which is how long its
+//! receipt is held back. The log lives in the working directory so the
+//! numbers reflect that disk's fdatasync.
+
+#include <cstdio>
+
+#if defined(__linux__)
+
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+#include "BenchmarkUtil.h"
+#include "jenlib/storage/IngestWal.h"
+#include "jenlib/time/Time.h"
+#include "jenlib/time/drivers/NativeTimeDriver.h"
+
+namespace {
+
+using jenlib::ble::DeviceId;
+using jenlib::ble::ReadingMsg;
+using jenlib::ble::SessionId;
+using jenlib::storage::IngestWal;
+using jenlib::storage::WalCommitPolicy;
+using Clock = std::chrono::steady_clock;
+
+constexpr std::uint32_t kSensors = 32;
+constexpr std::uint32_t kPacedRate = 2000;  // Readings per second offered in paced runs
+constexpr std::uint32_t kPacedReadings = 2000;
+
+ReadingMsg make_reading(std::uint32_t i) {
+    return ReadingMsg{DeviceId(0x100 + i % kSensors), SessionId(7), i / kSensors * 1000, 2100, 4000};
+}
+
+double sustained(const std::string& path, WalCommitPolicy policy) {
+    unlink(path.c_str());
+    IngestWal wal(policy);
+    wal.open(path.c_str());
+    std::uint32_t appended = 0;
+    const auto start = Clock::now();
+    const auto deadline = start + std::chrono::seconds(1);
+    while (Clock::now() < deadline) {
+        for (std::uint32_t i = 0; i < 256; ++i) {
+            wal.append(make_reading(appended++));
+        }
+    }
+    wal.commit();
+    const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    wal.close();
+    return appended / seconds;
+}
+
+void paced(const std::string& path, WalCommitPolicy policy, double& p50_ms, double& p99_ms) {
+    unlink(path.c_str());
+    IngestWal wal(policy);
+    wal.open(path.c_str());
+    std::vector<Clock::time_point> arrivals;
+    std::vector<double> latencies_ms;
+    std::uint64_t commits = 0;
+    const auto settle = [&]() {
+        if (wal.commit_count() == commits) {
+            return;
+        }
+        commits = wal.commit_count();
+        const auto now = Clock::now();
+        for (const auto arrival : arrivals) {
+            latencies_ms.push_back(std::chrono::duration<double, std::milli>(now - arrival).count());
+        }
+        arrivals.clear();
+    };
+
+    const auto start = Clock::now();
+    const auto period = std::chrono::nanoseconds(1000000000 / kPacedRate);
+    for (std::uint32_t i = 0; i < kPacedReadings; ++i) {
+        const auto due = start + period * i;
+        while (Clock::now() < due) {
+            wal.poll();
+            settle();
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+        arrivals.push_back(Clock::now());
+        wal.append(make_reading(i));
+        settle();
+    }
+    while (!arrivals.empty()) {
+        wal.poll();
+        settle();
+    }
+    wal.close();
+    std::sort(latencies_ms.begin(), latencies_ms.end());
+    p50_ms = latencies_ms[latencies_ms.size() / 2];
+    p99_ms = latencies_ms[latencies_ms.size() * 99 / 100];
+}
+
+}  // namespace
+
+int main() {
+    jenlib::time::NativeTimeDriver clock;
+    jenlib::time::Time::setDriver(&clock);
+    const std::string path = "jenlib-ingest-bench-" + std::to_string(getpid()) + ".wal";
+
+    std::printf("%u sensors; paced runs offer %u readings/s\n", kSensors, kPacedRate);
+    std::printf("%-18s %16s %16s %16s\n", "policy", "sustained rec/s", "ack p50", "ack p99");
+    const WalCommitPolicy policies[] = {{1, 0}, {8, 2}, {64, 10}, {256, 20}, {1024, 50}};
+    for (const WalCommitPolicy& policy : policies) {
+        const double rate = sustained(path, policy);
+        double p50_ms = 0;
+        double p99_ms = 0;
+        paced(path, policy, p50_ms, p99_ms);
+        char name[32];
+        std::snprintf(name, sizeof(name), "%u rec / %u ms", policy.max_records, policy.max_delay_ms);
+        std::printf("%-18s %16.0f %13.2f ms %13.2f ms\n", name, rate, p50_ms, p99_ms);
+    }
+    unlink(path.c_str());
+    jenlib::time::Time::setDriver(nullptr);
+    return 0;
+}
+
+#else
+
+int main() {
+    std::printf("IngestWalBenchmark needs Linux\n");
+    return 0;
+}
+
+#endif  // __linux__
@@ -0,0 +1,150 @@
+//! @file benchmarks/LinkQualityBenchmark.cpp
+//! @brief Update cost and accuracy of per-session link-quality telemetry.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+//!
+//! Simulates kSensors sensors sampling at 1 Hz for kSeconds over a bursty
+//! link: a two-state (Gilbert-Elliott) channel that drops few readings when
+//! good and most when bad, plus a retransmitted copy of some readings and
+//! random delivery delay, occasionally long enough to arrive after newer
+//! readings. Every delivered reading
+//! goes through LinkQuality::add(). The estimates are compared with the
+//! simulator's ground truth, and the update cost is timed on its own.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "BenchmarkUtil.h"
+#include "jenlib/measurement/LinkQuality.h"
+
+namespace {
+
+using jenlib::measurement::LinkQuality;
+
+constexpr std::uint32_t kSensors = 1000;
+constexpr std::uint32_t kSeconds = 3600;
+constexpr std::uint32_t kIntervalMs = 1000;
+
+struct Delivery {
+    std::uint32_t offset_ms;
+    std::uint32_t arrival_ms;
+    bool copy;  // Retransmission of a reading already delivered
+};
+
+struct Truth {
+    std::uint32_t sent{0};
+    std::uint32_t delivered{0};
+    std::uint32_t longest_gap{0};
+    double jitter_ms{0.0};
+};
+
+//! @brief Deliveries of one sensor in arrival order, and what really happened.
+std::vector<Delivery> simulate(std::mt19937& rng, Truth& truth) {
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::exponential_distribution<double> delay(1.0 / 40.0);  // Mean 40 ms on top of 10 ms airtime
+    std::vector<Delivery> deliveries;
+    bool bad = false;
+    std::uint32_t streak = 0;
+    std::uint32_t first = 0;
+    std::uint32_t last = 0;
+    bool seen = false;
+    for (std::uint32_t slot = 0; slot < kSeconds; ++slot) {
+        bad = bad ? uniform(rng) > 0.2 : uniform(rng) < 0.01;  // Mean burst of 5 slots
+        const bool lost = uniform(rng) < (bad ? 0.8 : 0.02);
+        if (lost) {
+            ++streak;
+            continue;
+        }
+        if (seen && streak > truth.longest_gap) {
+            truth.longest_gap = streak;
+        }
+        if (!seen) {
+            first = slot;
+            seen = true;
+        }
+        streak = 0;
+        last = slot;
+        ++truth.delivered;
+        const std::uint32_t offset_ms = slot * kIntervalMs;
+        std::uint32_t latency_ms = 10 + static_cast<std::uint32_t>(delay(rng));
+        if (uniform(rng) < 0.01) {
+            // Held up long enough to arrive after newer readings
+            latency_ms += 1000 + static_cast<std::uint32_t>(2000.0 * uniform(rng));
+        }
+        deliveries.push_back({offset_ms, offset_ms + latency_ms, false});
+        if (uniform(rng) < 0.01) {
+            deliveries.push_back({offset_ms, offset_ms + latency_ms + 500, true});
+        }
+    }
+    truth.sent = last - first + 1;  // Expected counts run from the first to the newest reading heard
+    std::stable_sort(deliveries.begin(), deliveries.end(),
+                     [](const Delivery& a, const Delivery& b) { return a.arrival_ms < b.arrival_ms; });
+    // Ground-truth RFC 3550 jitter in doubles over the first copies, in arrival order
+    double jitter = 0.0;
+    const Delivery* previous = nullptr;
+    for (const Delivery& delivery : deliveries) {
+        if (delivery.copy) {
+            continue;
+        }
+        if (previous) {
+            const double d = (static_cast<double>(delivery.arrival_ms) - previous->arrival_ms) -
+                             (static_cast<double>(delivery.offset_ms) - previous->offset_ms);
+            jitter += (std::fabs(d) - jitter) / 16.0;
+        }
+        previous = &delivery;
+    }
+    truth.jitter_ms = jitter;
+    return deliveries;
+}
+
+}  // namespace
+
+int main() {
+    std::mt19937 rng(42);
+    std::vector<std::vector<Delivery>> sensors(kSensors);
+    std::vector<Truth> truths(kSensors);
+    std::size_t total = 0;
+    for (std::uint32_t s = 0; s < kSensors; ++s) {
+        sensors[s] = simulate(rng, truths[s]);
+        total += sensors[s].size();
+    }
+
+    std::vector<LinkQuality> links(kSensors, LinkQuality(kIntervalMs));
+    const auto start = std::chrono::steady_clock::now();
+    for (std::uint32_t s = 0; s < kSensors; ++s) {
+        for (const Delivery& delivery : sensors[s]) {
+            links[s].add(delivery.offset_ms, delivery.arrival_ms);
+        }
+    }
+    const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    double loss_error = 0.0;
+    double true_loss = 0.0;
+    double jitter_error = 0.0;
+    std::uint32_t gap_mismatches = 0;
+    std::uint64_t duplicates = 0;
+    std::uint64_t late = 0;
+    for (std::uint32_t s = 0; s < kSensors; ++s) {
+        const double truth_loss = 1.0 - static_cast<double>(truths[s].delivered) / truths[s].sent;
+        true_loss += truth_loss;
+        loss_error = std::fmax(loss_error, std::fabs(links[s].loss_ratio() - truth_loss));
+        jitter_error = std::fmax(jitter_error, std::fabs(links[s].jitter_ms() - truths[s].jitter_ms));
+        gap_mismatches += links[s].longest_gap() != truths[s].longest_gap;
+        duplicates += links[s].duplicates();
+        late += links[s].late();
+    }
+
+    std::printf("%u sensors, %u s at 1 Hz, %zu deliveries\n", kSensors, kSeconds, total);
+    jenlib::bench::report("LinkQuality::add", ns / static_cast<double>(total), "ns/reading");
+    jenlib::bench::report("state per sensor session", sizeof(LinkQuality), "bytes");
+    jenlib::bench::report("mean true loss", 100.0 * true_loss / kSensors, "%");
+    jenlib::bench::report("max loss-ratio error", 100.0 * loss_error, "percentage points");
+    jenlib::bench::report("max jitter error vs double-precision RFC 3550", jitter_error, "ms");
+    jenlib::bench::report("sessions with wrong longest gap", gap_mismatches, "sessions");
+    jenlib::bench::report("duplicates flagged", static_cast<double>(duplicates), "readings");
+    jenlib::bench::report("late (reordered) readings", static_cast<double>(late), "readings");
+    return 0;
+}
@@ -0,0 +1,153 @@
+//! @file benchmarks/MultiRadioBenchmark.cpp
+//! @brief Aggregate reading throughput of MultiRadioBroker with 1-4 simulated radios.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+//!
+//! Each simulated radio is a NativeBleDriver on its own shared-memory
+//! segment. A sensor thread per radio broadcasts readings through a
+//! driver-bound Sensor role, and the broker merges all radios on one thread.
+//! Unpaced runs measure what the broker can absorb. Paced runs cap each
+//! radio at kRadioRate readings per second, as airtime would, and measure
+//! how aggregate throughput grows with radios.
+
+#include <cstdio>
+
+#if defined(__linux__)
+
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <thread>
+#include <vector>
+#include "BenchmarkUtil.h"
+#include "jenlib/ble/MultiRadioBroker.h"
+#include "jenlib/ble/Roles.h"
+#include "jenlib/ble/drivers/NativeBleDriver.h"
+#include "jenlib/ble/drivers/ShmBleTransport.h"
+
+namespace {
+
+using jenlib::ble::DeviceId;
+using jenlib::ble::NativeBleDriver;
+using jenlib::ble::ShmBleTransport;
+
+constexpr std::uint32_t kSensorsPerRadio = 8;
+constexpr std::uint32_t kRadioRate = 50000;   // Readings per second per radio when paced
+constexpr std::uint32_t kPacedMessages = 50000;
+constexpr std::uint32_t kUnpacedMessages = 400000;
+
+std::string segment_name(std::size_t radio) {
+    return "/jenlib-multiradio-" + std::to_string(getpid()) + "-" + std::to_string(radio);
+}
+
+//! @brief Sensors sharing one radio, broadcasting round-robin until @p count readings are accepted.
+void sensor_thread(std::size_t radio, std::uint32_t count, bool paced) {
+    ShmBleTransport transport;
+    if (!transport.open(segment_name(radio).c_str(), false)) {
+        return;
+    }
+    NativeBleDriver driver(DeviceId(static_cast<std::uint32_t>(0x100 * (radio + 1))));
+    driver.set_transport(&transport);
+    driver.begin();
+
+    std::vector<jenlib::ble::Sensor> sensors;
+    for (std::uint32_t s = 0; s < kSensorsPerRadio; ++s) {
+        sensors.emplace_back(DeviceId(static_cast<std::uint32_t>(0x100 * (radio + 1) + s)), &driver);
+    }
+    constexpr std::uint32_t kBatch = 50;  // Readings per pacing slot
+    const auto slot = std::chrono::nanoseconds(1000000000ULL * kBatch / kRadioRate);
+    auto next_slot = std::chrono::steady_clock::now();
+    for (std::uint32_t i = 0; i < count; ++i) {
+        if (paced && i % kBatch == 0) {
+            std::this_thread::sleep_until(next_slot);
+            next_slot += slot;
+        }
+        jenlib::ble::Sensor& sensor = sensors[i % kSensorsPerRadio];
+        const jenlib::ble::ReadingMsg reading{DeviceId(static_cast<std::uint32_t>(0x100 * (radio + 1) +
+                                                                                 i % kSensorsPerRadio)),
+                                              jenlib::ble::SessionId(1), i, 2100, 4000};
+        // The driver drops on a full ring; resend so every reading is counted
+        std::uint64_t dropped = transport.dropped(DeviceId(0));
+        sensor.broadcast_reading(reading);
+        while (transport.dropped(DeviceId(0)) != dropped) {
+            std::this_thread::yield();
+            dropped = transport.dropped(DeviceId(0));
+            sensor.broadcast_reading(reading);
+        }
+    }
+}
+
+void run(std::size_t radio_count, bool paced) {
+    const std::uint32_t per_radio = paced ? kPacedMessages : kUnpacedMessages;
+    std::deque<ShmBleTransport> transports;
+    std::deque<NativeBleDriver> radios;
+    jenlib::ble::MultiRadioBroker broker;
+    std::uint64_t received = 0;
+    broker.configure_callbacks(jenlib::ble::BleCallbacks{
+        .on_reading = [&received](DeviceId, const jenlib::ble::ReadingMsg&) { ++received; },
+    });
+    for (std::size_t r = 0; r < radio_count; ++r) {
+        transports.emplace_back();
+        if (!transports.back().open(segment_name(r).c_str(), true)) {
+            std::fprintf(stderr, "shm_open failed\n");
+            return;
+        }
+        radios.emplace_back(DeviceId(0));
+        radios.back().set_transport(&transports.back());
+        transports.back().consume(DeviceId(0), [](const jenlib::ble::BlePayload&) {});  // Register the inbox
+        broker.add_radio(radios.back());
+    }
+    broker.begin();
+
+    const std::uint64_t expected = static_cast<std::uint64_t>(per_radio) * radio_count;
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> sensors;
+    for (std::size_t r = 0; r < radio_count; ++r) {
+        sensors.emplace_back(sensor_thread, r, per_radio, paced);
+    }
+    const auto deadline = start + std::chrono::seconds(60);
+    while (received < expected && std::chrono::steady_clock::now() < deadline) {
+        const std::uint64_t before = received;
+        broker.process_events();
+        if (received == before) {
+            std::this_thread::yield();  // Lets sensor threads run when they share a core
+        }
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    for (auto& thread : sensors) {
+        thread.join();
+    }
+    broker.end();
+    for (std::size_t r = 0; r < radio_count; ++r) {
+        ShmBleTransport::unlink(segment_name(r).c_str());
+    }
+
+    std::printf("%-8s %6zu radios %5zu sensors %10llu readings %12.0f readings/s\n", paced ? "paced" : "unpaced",
+                radio_count, broker.sensor_count(0) * radio_count, static_cast<unsigned long long>(received),
+                static_cast<double>(received) / seconds);
+}
+
+}  // namespace
+
+int main() {
+    std::printf("%u hardware threads, paced radios carry %u readings/s each\n", std::thread::hardware_concurrency(),
+                kRadioRate);
+    for (const bool paced : {false, true}) {
+        for (std::size_t radios = 1; radios <= jenlib::ble::MultiRadioBroker::kMaxRadios; ++radios) {
+            run(radios, paced);
+        }
+    }
+    return 0;
+}
+
+#else
+
+int main() {
+    std::printf("MultiRadioBenchmark needs the Linux shared-memory transport\n");
+    return 0;
+}
+
+#endif  // __linux__
@@ -0,0 +1,194 @@
+//! @file benchmarks/NativeReactorBenchmark.cpp
+//! @brief Idle CPU and wake-up latency of NativeReactor against a spin loop.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+//!
+//! The idle runs keep a 100 ms repeating timer and nothing else, once driven
+//! by a loop that polls the static services and once by the reactor, and
+//! report the CPU time each burns per wall-clock second. The latency runs
+//! send timestamped wake-ups from another thread, through a pipe and through
+//! a shared-memory transport ring, and report how long the reactor takes to
+//! run the callback.
+
+#include <cstdio>
+
+#if defined(__linux__)
+
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+#include "BenchmarkUtil.h"
+#include "jenlib/ble/Ble.h"
+#include "jenlib/ble/drivers/NativeBleDriver.h"
+#include "jenlib/ble/drivers/ShmBleTransport.h"
+#include "jenlib/events/EventDispatcher.h"
+#include "jenlib/events/NativeReactor.h"
+#include "jenlib/time/Time.h"
+#include "jenlib/time/drivers/NativeTimeDriver.h"
+
+namespace {
+
+using jenlib::events::NativeReactor;
+
+constexpr std::uint32_t kIdleRunMs = 1000;
+constexpr std::uint32_t kLatencySamples = 2000;
+
+std::uint64_t now_ns() {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+double cpu_seconds() {
+    rusage usage{};
+    getrusage(RUSAGE_THREAD, &usage);
+    return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+}
+
+void report_idle(const char* label, double cpu, std::uint32_t ticks, std::uint64_t loops) {
+    std::printf("%-28s cpu %6.2f %%  timer ticks %3u  loop passes %10llu\n", label, cpu * 100.0 * 1000.0 / kIdleRunMs,
+                ticks, static_cast<unsigned long long>(loops));
+}
+
+void idle_spin() {
+    jenlib::time::Time::clear_all_timers();
+    std::uint32_t ticks = 0;
+    jenlib::time::schedule_repeating_timer(100, [&ticks]() { ++ticks; });
+    const std::uint32_t end = jenlib::time::Time::now() + kIdleRunMs;
+    const double cpu_start = cpu_seconds();
+    std::uint64_t loops = 0;
+    while (jenlib::time::Time::now() < end) {
+        jenlib::time::Time::process_timers();
+        jenlib::events::EventDispatcher::process_events();
+        jenlib::ble::BLE::process_events();
+        ++loops;
+    }
+    report_idle("idle, spin loop", cpu_seconds() - cpu_start, ticks, loops);
+    jenlib::time::Time::clear_all_timers();
+}
+
+void idle_reactor() {
+    jenlib::time::Time::clear_all_timers();
+    NativeReactor reactor;
+    reactor.open();
+    std::uint32_t ticks = 0;
+    jenlib::time::schedule_repeating_timer(100, [&ticks]() { ++ticks; });
+    const std::uint32_t end = jenlib::time::Time::now() + kIdleRunMs;
+    const double cpu_start = cpu_seconds();
+    while (jenlib::time::Time::now() < end) {
+        reactor.run_once(static_cast<int>(end - jenlib::time::Time::now()));
+    }
+    report_idle("idle, reactor", cpu_seconds() - cpu_start, ticks, reactor.wakeups());
+    reactor.close();
+    jenlib::time::Time::clear_all_timers();
+}
+
+void report_latency(const char* label, std::vector<std::uint32_t>& latencies) {
+    if (latencies.empty()) {
+        return;
+    }
+    std::sort(latencies.begin(), latencies.end());
+    std::printf("%-28s %6zu wakes  latency p50 %7.2f us  p99 %8.2f us\n", label, latencies.size(),
+                latencies[latencies.size() / 2] / 1e3, latencies[latencies.size() * 99 / 100] / 1e3);
+}
+
+void pipe_latency() {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        return;
+    }
+    NativeReactor reactor;
+    reactor.open();
+    std::vector<std::uint32_t> latencies;
+    latencies.reserve(kLatencySamples);
+    reactor.add_fd(fds[0], EPOLLIN, [&](std::uint32_t) {
+        std::uint64_t stamp = 0;
+        if (read(fds[0], &stamp, sizeof(stamp)) == sizeof(stamp)) {
+            latencies.push_back(static_cast<std::uint32_t>(now_ns() - stamp));
+        }
+    });
+
+    std::thread writer([&]() {
+        for (std::uint32_t i = 0; i < kLatencySamples; ++i) {
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            const std::uint64_t stamp = now_ns();
+            jenlib::bench::do_not_optimize(write(fds[1], &stamp, sizeof(stamp)));
+        }
+    });
+    while (latencies.size() < kLatencySamples) {
+        reactor.run_once(1000);
+    }
+    writer.join();
+    reactor.close();
+    ::close(fds[0]);
+    ::close(fds[1]);
+    report_latency("pipe fd wake", latencies);
+}
+
+void transport_latency() {
+    const std::string name = "/jenlib-reactor-bench-" + std::to_string(getpid());
+    jenlib::ble::ShmBleTransport transport;
+    if (!transport.open(name.c_str(), true)) {
+        std::fprintf(stderr, "shm_open failed\n");
+        return;
+    }
+    jenlib::ble::NativeBleDriver driver(jenlib::ble::DeviceId(0));
+    driver.set_transport(&transport);
+    driver.begin();
+
+    // The low 32 bits of the send time ride in offset_ms; the wrapped difference is still exact
+    std::vector<std::uint32_t> latencies;
+    latencies.reserve(kLatencySamples);
+    driver.set_reading_callback([&](jenlib::ble::DeviceId, const jenlib::ble::ReadingMsg& msg) {
+        latencies.push_back(static_cast<std::uint32_t>(now_ns()) - msg.offset_ms);
+    });
+
+    NativeReactor reactor;
+    reactor.open();
+    reactor.watch_transport(transport, driver);
+    std::thread sender([&]() {
+        for (std::uint32_t i = 0; i < kLatencySamples; ++i) {
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            transport.send_in_place(jenlib::ble::DeviceId(0), [](jenlib::ble::BlePayload& slot) {
+                const jenlib::ble::ReadingMsg msg{jenlib::ble::DeviceId(1), jenlib::ble::SessionId(1),
+                                                  static_cast<std::uint32_t>(now_ns()), 2100, 4000};
+                return jenlib::ble::ReadingMsg::serialize(msg, slot);
+            });
+        }
+    });
+    const std::uint64_t deadline = now_ns() + 10ULL * 1000 * 1000 * 1000;
+    while (latencies.size() < kLatencySamples && now_ns() < deadline) {
+        reactor.run_once(100);
+    }
+    sender.join();
+    reactor.close();
+    jenlib::ble::ShmBleTransport::unlink(name.c_str());
+    report_latency("shm transport wake", latencies);
+}
+
+}  // namespace
+
+int main() {
+    jenlib::time::NativeTimeDriver time_driver;
+    jenlib::time::Time::setDriver(&time_driver);
+    idle_spin();
+    idle_reactor();
+    pipe_latency();
+    transport_latency();
+    jenlib::time::Time::setDriver(nullptr);
+    return 0;
+}
+
+#else
+
+int main() {
+    std::printf("NativeReactor is Linux-only\n");
+    return 0;
+}
+
+#endif  // __linux__
@@ -0,0 +1,95 @@
+//! @file benchmarks/OneWireBackendBenchmark.cpp
+//! @brief Per-byte CPU cost of the native OneWire backends.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include <array>
+#include <cstdint>
+#include "BenchmarkUtil.h"
+#include "jenlib/gpio/GPIO.h"
+#include "jenlib/gpio/drivers/NativeGpioDriver.h"
+#include "jenlib/onewire/OneWireBus.h"
+#include "jenlib/onewire/drivers/GpioOneWireBackend.h"
+#include "jenlib/onewire/drivers/NativeOneWireBackend.h"
+
+namespace {
+
+constexpr std::uint64_t kIterations = 200000;
+constexpr std::uint8_t kBusPin = 4;
+
+jenlib::gpio::NativeGpioDriver* g_traced_driver = nullptr;
+
+// Slot delays advance the driver's virtual clock so the trace shows bus time.
+void virtual_delay_us(std::uint32_t microseconds) {
+    g_traced_driver->advance_time_us(microseconds);
+}
+
+//! @brief Bus time and GPIO calls spent on one byte, from the driver trace.
+void run_trace(jenlib::gpio::NativeGpioDriver& driver) {
+    using jenlib::bench::report;
+
+    g_traced_driver = &driver;
+    jenlib::onewire::GpioOneWireBackend backend(kBusPin, &virtual_delay_us);
+    jenlib::onewire::OneWireBus bus(backend);
+    bus.begin();
+
+    driver.enable_trace(256);
+    bus.write_byte(0xA5);
+    const auto stats = driver.pin_stats(kBusPin);
+    report("gpio bit-bang bus time per byte", static_cast<double>(driver.virtual_time_ns()) / 1000.0, "us");
+    report("gpio bit-bang driver calls per byte",
+           static_cast<double>(stats.mode_calls + stats.write_calls + stats.read_calls), "calls");
+    driver.disable_trace();
+    g_traced_driver = nullptr;
+}
+
+template <typename Backend>
+void run_backend(const char* label, Backend& backend) {
+    using jenlib::bench::ns_per_iteration;
+    using jenlib::bench::report;
+    using jenlib::onewire::OneWireBus;
+
+    OneWireBus bus(backend);
+    bus.begin();
+
+    std::array<std::uint8_t, OneWireBus::kTransferChunkBytes> block{};
+    for (std::size_t i = 0; i < block.size(); ++i) {
+        block[i] = static_cast<std::uint8_t>(0x5A + i);
+    }
+
+    char name[64];
+    std::snprintf(name, sizeof(name), "%s write_byte", label);
+    report(name, ns_per_iteration(kIterations, [&](std::uint64_t i) {
+        bus.write_byte(static_cast<std::uint8_t>(i));
+    }), "ns/byte");
+
+    std::snprintf(name, sizeof(name), "%s write_bytes (8-byte chunks)", label);
+    report(name, ns_per_iteration(kIterations / block.size(), [&](std::uint64_t) {
+        bus.write_bytes(block.begin(), block.end());
+    }) / static_cast<double>(block.size()), "ns/byte");
+
+    std::snprintf(name, sizeof(name), "%s read_bytes (8-byte chunks)", label);
+    report(name, ns_per_iteration(kIterations / block.size(), [&](std::uint64_t) {
+        bus.read_bytes(block.begin(), block.end());
+        jenlib::bench::do_not_optimize(block);
+    }) / static_cast<double>(block.size()), "ns/byte");
+}
+
+}  // namespace
+
+int main() {
+    jenlib::gpio::NativeGpioDriver gpio_driver;
+    GPIO::setDriver(&gpio_driver);
+
+    jenlib::onewire::GpioOneWireBackend gpio_backend(kBusPin);
+    run_backend("gpio bit-bang", gpio_backend);
+
+    jenlib::onewire::NativeOneWireBackend loopback;
+    loopback.set_recording(false);
+    run_backend("native loopback", loopback);
+
+    run_trace(gpio_driver);
+
+    GPIO::setDriver(nullptr);
+    return 0;
+}
@@ -0,0 +1,69 @@
+//! @file benchmarks/PacketiserBenchmark.cpp
+//! @brief Bytes on air and codec throughput of the measurement packetiser.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include <cstdint>
+#include <vector>
+#include "BenchmarkUtil.h"
+#include "jenlib/measurement/MeasurementPacketiser.h"
+
+namespace {
+
+constexpr std::size_t kSeriesLength = 3600;  // One hour at 1 Hz
+constexpr std::uint64_t kRounds = 200;
+
+// Slow indoor drift with sensor noise in the last digit
+std::vector<jenlib::measurement::Measurement> make_history() {
+    std::vector<jenlib::measurement::Measurement> history;
+    std::uint32_t state = 7;
+    for (std::size_t i = 0; i < kSeriesLength; ++i) {
+        state = state * 1664525u + 1013904223u;
+        const float noise = static_cast<float>(static_cast<int>(state >> 29) - 4) * 0.01f;
+        const float drift = static_cast<float>(i) / 3600.0f;
+        history.push_back({static_cast<std::uint32_t>(i * 1000), 21.0f + drift + noise, 40.0f - drift + noise});
+    }
+    return history;
+}
+
+}  // namespace
+
+int main() {
+    using jenlib::ble::BlePayload;
+    using jenlib::bench::report;
+
+    const auto history = make_history();
+    const jenlib::measurement::MeasurementPacketiser packetiser;
+
+    std::size_t packets = 0;
+    std::size_t bytes = 0;
+    packetiser.packetise(history.begin(), history.end(), [&](BlePayload&& packet) {
+        ++packets;
+        bytes += packet.size;
+    });
+    report("single Measurement::serialize", 8.0, "bytes/measurement");
+    report("packetised", static_cast<double>(bytes) / kSeriesLength, "bytes/measurement");
+    report("packetised measurements per payload", static_cast<double>(kSeriesLength) / packets, "measurements");
+
+    report("encode", jenlib::bench::ns_per_iteration(kRounds, [&](std::uint64_t) {
+        packetiser.packetise(history.begin(), history.end(), [](BlePayload&& packet) {
+            jenlib::bench::do_not_optimize(packet);
+        });
+    }) / kSeriesLength, "ns/measurement");
+
+    std::vector<BlePayload> encoded;
+    packetiser.packetise(history.begin(), history.end(), [&](BlePayload&& packet) {
+        encoded.push_back(std::move(packet));
+    });
+    float sink = 0.0f;
+    report("decode", jenlib::bench::ns_per_iteration(kRounds, [&](std::uint64_t) {
+        for (const auto& packet : encoded) {
+            jenlib::measurement::MeasurementPacketReader reader(packet);
+            for (const auto& m : reader) {
+                sink += m.temperature_c;
+            }
+        }
+    }) / kSeriesLength, "ns/measurement");
+    jenlib::bench::do_not_optimize(sink);
+    return 0;
+}
@@ -0,0 +1,157 @@
+//! @file benchmarks/QuantileSketchBenchmark.cpp
+//! @brief Accuracy, memory and update cost of per-sensor quantile sketches for 10,000 sensors.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+//!
+//! Feeds one hour of synthetic 1 Hz readings from kSensors sensors into one
+//! ReadingQuantiles per sensor. Each sensor has its own baseline, a slow
+//! drift, noise and rare spikes. Per-sensor accuracy is the rank error of
+//! p50/p95/p99 temperature against exact quantiles for a sample of sensors.
+//! Fleet accuracy merges the sensors into four shard sketches, then merges
+//! the shards, and compares against an exact histogram of every reading.
+//!
+//! Usage: QuantileSketchBenchmark [sensors] (default 10000)
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "BenchmarkUtil.h"
+#include "jenlib/measurement/QuantileSketch.h"
+
+namespace {
+
+using jenlib::ble::DeviceId;
+using jenlib::ble::ReadingMsg;
+using jenlib::ble::SessionId;
+
+constexpr std::uint32_t kSeconds = 3600;
+constexpr std::size_t kSampleStride = 50;  // Every 50th sensor keeps its exact values
+constexpr float kQuantiles[] = {0.5f, 0.95f, 0.99f};
+
+struct Generator {
+    std::uint32_t state{12345};
+
+    std::uint32_t next() {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+
+    //! @brief Temperature of @p sensor at @p second, in centi-degrees.
+    std::int16_t temperature(std::size_t sensor, std::uint32_t second) {
+        const float base = 1800.0f + static_cast<float>((sensor * 7919) % 800);
+        const float drift = 150.0f * std::sin(static_cast<float>(second + sensor * 97) * 0.00175f);
+        const float noise = static_cast<float>(next() % 61) - 30.0f;
+        const float spike = next() % 2000 == 0 ? 500.0f : 0.0f;  // A door opening or a hand on the sensor
+        return static_cast<std::int16_t>(base + drift + noise + spike);
+    }
+
+    std::uint16_t humidity(std::size_t sensor) {
+        return static_cast<std::uint16_t>(3000 + (sensor * 104729) % 3000 + next() % 200);
+    }
+};
+
+//! @brief |rank of @p answer - q| as a fraction, against sorted exact values.
+double rank_error(const std::vector<std::int16_t>& sorted, std::int16_t answer, float q) {
+    const double n = static_cast<double>(sorted.size());
+    const double target = q * n;
+    const double below = static_cast<double>(std::lower_bound(sorted.begin(), sorted.end(), answer) - sorted.begin());
+    const double upto = static_cast<double>(std::upper_bound(sorted.begin(), sorted.end(), answer) - sorted.begin());
+    return target >= below && target <= upto ? 0.0 : std::min(std::fabs(below - target), std::fabs(upto - target)) / n;
+}
+
+//! @brief Same against a histogram of every value (index = value + 32768).
+double rank_error(const std::vector<std::uint64_t>& cumulative, std::int16_t answer, float q) {
+    const double n = static_cast<double>(cumulative.back());
+    const double target = q * n;
+    const std::size_t index = static_cast<std::size_t>(answer + 32768);
+    const double below = index ? static_cast<double>(cumulative[index - 1]) : 0.0;
+    const double upto = static_cast<double>(cumulative[index]);
+    return target >= below && target <= upto ? 0.0 : std::min(std::fabs(below - target), std::fabs(upto - target)) / n;
+}
+
+template <std::size_t K>
+void run(std::size_t sensors) {
+    using Quantiles = jenlib::measurement::ReadingQuantiles<K>;
+    std::vector<Quantiles> sketches(sensors);
+    std::vector<std::vector<std::int16_t>> exact((sensors + kSampleStride - 1) / kSampleStride);
+    std::vector<std::uint64_t> histogram(65536, 0);
+    std::vector<ReadingMsg> second_batch(sensors);
+    Generator generator;
+
+    double update_s = 0.0;
+    for (std::uint32_t second = 0; second < kSeconds; ++second) {
+        for (std::size_t s = 0; s < sensors; ++s) {
+            const std::int16_t temperature = generator.temperature(s, second);
+            second_batch[s] = ReadingMsg{DeviceId(static_cast<std::uint32_t>(s)), SessionId(1), second * 1000,
+                                         temperature, generator.humidity(s)};
+            ++histogram[static_cast<std::size_t>(temperature + 32768)];
+            if (s % kSampleStride == 0) {
+                exact[s / kSampleStride].push_back(temperature);
+            }
+        }
+        const auto start = std::chrono::steady_clock::now();
+        for (std::size_t s = 0; s < sensors; ++s) {
+            sketches[s].add(second_batch[s]);
+        }
+        update_s += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Per-sensor accuracy on the sampled sensors
+    double worst[3] = {0.0, 0.0, 0.0};
+    double total[3] = {0.0, 0.0, 0.0};
+    std::size_t serialized = 0;
+    std::vector<std::uint8_t> image(Quantiles::kMaxSerializedSize);
+    for (std::size_t i = 0; i < exact.size(); ++i) {
+        std::sort(exact[i].begin(), exact[i].end());
+        const auto& sketch = sketches[i * kSampleStride].temperature_c_centi;
+        for (std::size_t q = 0; q < 3; ++q) {
+            const double error = rank_error(exact[i], sketch.quantile(kQuantiles[q]), kQuantiles[q]);
+            worst[q] = std::max(worst[q], error);
+            total[q] += error;
+        }
+        serialized += sketches[i * kSampleStride].serialize(image.data(), image.size());
+    }
+
+    // Fleet accuracy: sensors into four shards, shards into one
+    const auto merge_start = std::chrono::steady_clock::now();
+    jenlib::measurement::QuantileSketch<K> shards[4];
+    for (std::size_t s = 0; s < sensors; ++s) {
+        shards[s % 4].merge(sketches[s].temperature_c_centi);
+    }
+    jenlib::measurement::QuantileSketch<K> fleet;
+    for (const auto& shard : shards) {
+        fleet.merge(shard);
+    }
+    const double merge_us = std::chrono::duration<double>(std::chrono::steady_clock::now() - merge_start).count() *
+                            1e6 / static_cast<double>(sensors + 4);
+    for (std::size_t i = 1; i < histogram.size(); ++i) {
+        histogram[i] += histogram[i - 1];
+    }
+
+    std::printf("K=%-4zu %6zu B/sensor %5zu B serialized %6.1f ns/reading %6.1f us/merge | sensor rank error "
+                "mean/max p50 %.3f/%.3f p95 %.3f/%.3f p99 %.3f/%.3f | fleet p50 %.4f p95 %.4f p99 %.4f\n",
+                K, sizeof(Quantiles), serialized / exact.size(),
+                update_s * 1e9 / (static_cast<double>(sensors) * kSeconds), merge_us,
+                total[0] / exact.size(), worst[0], total[1] / exact.size(), worst[1], total[2] / exact.size(),
+                worst[2], rank_error(histogram, fleet.quantile(0.5f), 0.5f),
+                rank_error(histogram, fleet.quantile(0.95f), 0.95f),
+                rank_error(histogram, fleet.quantile(0.99f), 0.99f));
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t sensors = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000;
+    std::printf("%zu sensors, %u readings each (1 Hz for an hour); errors are fractions of the count\n", sensors,
+                kSeconds);
+    run<32>(sensors);
+    run<64>(sensors);
+    run<128>(sensors);
+    run<256>(sensors);
+    return 0;
+}
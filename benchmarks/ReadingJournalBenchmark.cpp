@@ -0,0 +1,110 @@
+//! @file benchmarks/ReadingJournalBenchmark.cpp
+//! @brief Append throughput and recovery time of the reading journal on an mmap file.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+//!
+//! Fills journals of increasing size with readings, then measures how long
+//! open() takes to recover them (header scan plus tail page) against a full
+//! replay of every record. Page cache is left warm; cold-cache recovery
+//! additionally pays one read per sector header. Sync cost is measured per
+//! batch of appends, as a sensor would sync between connection events.
+//!
+//! Usage: ReadingJournalBenchmark [max MiB] (default 256; try 4096 on a roomy disk)
+
+#include <cstdio>
+
+#if defined(__linux__)
+
+#include <unistd.h>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include "BenchmarkUtil.h"
+#include "jenlib/storage/ReadingJournal.h"
+#include "jenlib/storage/drivers/MmapJournalStorage.h"
+
+namespace {
+
+using jenlib::ble::DeviceId;
+using jenlib::ble::ReadingMsg;
+using jenlib::ble::SessionId;
+using jenlib::storage::MmapJournalStorage;
+using jenlib::storage::ReadingJournal;
+
+constexpr std::size_t kSectorSize = 4096;
+constexpr std::uint32_t kSyncBatch = 64;
+
+double seconds_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void run(const std::string& path, std::size_t mebibytes) {
+    const std::size_t sectors = mebibytes * 1024 * 1024 / kSectorSize;
+    unlink(path.c_str());
+    MmapJournalStorage storage(kSectorSize, sectors);
+    if (!storage.open(path.c_str())) {
+        std::fprintf(stderr, "cannot map %s\n", path.c_str());
+        return;
+    }
+    ReadingJournal journal(storage);
+    journal.open();
+
+    // Leave the last page free so the journal is full but not refusing
+    const std::uint64_t records = static_cast<std::uint64_t>(sectors - 1) * journal.records_per_page();
+    auto start = std::chrono::steady_clock::now();
+    for (std::uint64_t i = 0; i < records; ++i) {
+        journal.append(ReadingMsg{DeviceId(0x10), SessionId(7), static_cast<std::uint32_t>(i), 2100, 4000});
+    }
+    const double append_s = seconds_since(start);
+    storage.sync();
+
+    // Synced appends on a small batch, as a sensor would commit between connection events
+    ReadingJournal tail(storage);
+    tail.open();
+    start = std::chrono::steady_clock::now();
+    for (std::uint32_t i = 0; i < kSyncBatch * 16; ++i) {
+        tail.append(ReadingMsg{DeviceId(0x10), SessionId(8), i, 2100, 4000});
+        if ((i + 1) % kSyncBatch == 0) {
+            tail.sync();
+        }
+    }
+    const double synced_us = seconds_since(start) * 1e6 / (kSyncBatch * 16);
+
+    start = std::chrono::steady_clock::now();
+    ReadingJournal recovered(storage);
+    recovered.open();
+    const double recover_ms = seconds_since(start) * 1e3;
+
+    start = std::chrono::steady_clock::now();
+    const std::size_t replayed = recovered.replay(SessionId(7), [](const ReadingMsg&) { return true; });
+    const double replay_ms = seconds_since(start) * 1e3;
+
+    std::printf("%6zu MiB %11llu records %10.2f M appends/s %9.2f us/append synced every %u %9.2f ms recover "
+                "%9.1f ms replay (%zu)\n",
+                mebibytes, static_cast<unsigned long long>(records), records / append_s / 1e6, synced_us,
+                kSyncBatch, recover_ms, replay_ms, replayed);
+    storage.close();
+    unlink(path.c_str());
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t max_mebibytes = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 256;
+    const std::string path = "/tmp/jenlib-journal-bench-" + std::to_string(getpid());
+    std::printf("%zu-byte sectors, %zu-byte records\n", kSectorSize, ReadingJournal::kRecordSize);
+    for (std::size_t mebibytes = 16; mebibytes <= max_mebibytes; mebibytes *= 4) {
+        run(path, mebibytes);
+    }
+    return 0;
+}
+
+#else
+
+int main() {
+    std::printf("ReadingJournalBenchmark needs the Linux mmap backend\n");
+    return 0;
+}
+
+#endif  // __linux__
@@ -0,0 +1,62 @@
+//! @file benchmarks/ReplayTrace.h
+//! @brief Recorded or synthetic 1 Hz reading traces for replay benchmarks.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef BENCHMARKS_REPLAYTRACE_H_
+#define BENCHMARKS_REPLAYTRACE_H_
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "jenlib/ble/Messages.h"
+#include "jenlib/measurement/Measurement.h"
+
+namespace jenlib::bench {
+
+//! @brief Load a recording with rows "offset_ms,temperature_c,humidity_pct".
+inline std::vector<jenlib::ble::ReadingMsg> load_trace(const char* path) {
+    std::vector<jenlib::ble::ReadingMsg> trace;
+    std::ifstream in(path);
+    std::string line;
+    while (std::getline(in, line)) {
+        unsigned long offset = 0;
+        float temp = 0.0f;
+        float hum = 0.0f;
+        if (std::sscanf(line.c_str(), "%lu,%f,%f", &offset, &temp, &hum) == 3) {
+            trace.push_back(jenlib::ble::ReadingMsg{{}, {}, static_cast<std::uint32_t>(offset),
+                                                    jenlib::measurement::temperature_to_centi(temp),
+                                                    jenlib::measurement::humidity_to_basis_points(hum)});
+        }
+    }
+    return trace;
+}
+
+//! @brief 24 h at 1 Hz: diurnal swing, HVAC cycling, sensor noise and a door opening every 2 h.
+inline std::vector<jenlib::ble::ReadingMsg> synthetic_trace() {
+    std::vector<jenlib::ble::ReadingMsg> trace;
+    std::uint32_t state = 99;
+    for (std::uint32_t s = 0; s < 24 * 3600; ++s) {
+        state = state * 1664525u + 1013904223u;
+        const double hours = s / 3600.0;
+        double temp = 21.0 + 1.5 * std::sin((hours - 9.0) * 3.14159265 / 12.0) + 0.2 * std::sin(s / 900.0);
+        double hum = 40.0 - 5.0 * std::sin((hours - 9.0) * 3.14159265 / 12.0);
+        temp += (static_cast<int>(state >> 29) - 4) * 0.01;
+        if (s % 7200 < 120) {  // Door open: sudden drop, recovering over two minutes
+            temp -= 0.8 * (1.0 - (s % 7200) / 120.0);
+            hum += 3.0 * (1.0 - (s % 7200) / 120.0);
+        }
+        trace.push_back(jenlib::ble::ReadingMsg{{}, {}, s * 1000u,
+                                                jenlib::measurement::temperature_to_centi(static_cast<float>(temp)),
+                                                jenlib::measurement::humidity_to_basis_points(
+                                                    static_cast<float>(hum))});
+    }
+    return trace;
+}
+
+}  // namespace jenlib::bench
+
+#endif  // BENCHMARKS_REPLAYTRACE_H_
@@ -0,0 +1,180 @@
+//! @file benchmarks/RuntimeBenchmark.cpp
+//! @brief Loop latency under bursty BLE traffic: hand-written loop versus Runtime with bounded phases.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+//!
+//! Runs a broker-style loop on a simulated clock for kSimulatedMs. Messages
+//! arrive in bursts of kBurstMessages every kBurstEveryMs; taking one off the
+//! radio costs kIntakeMs and dispatches an event whose handler costs kHandlerMs.
+//! A 100 ms measurement timer costs 1 ms. The hand-written loop drains the
+//! event queue, the radio and the timers in turn; the Runtime runs timers first
+//! and alternates bounded BLE intake and event slices. The benchmark reports
+//! iteration length, measurement-timer lateness and how long messages waited
+//! to be handled. A second part times the Runtime's own overhead on the real
+//! clock.
+
+#include <algorithm>
+#include <cstdio>
+#include <deque>
+#include <vector>
+#include "BenchmarkUtil.h"
+#include "jenlib/events/EventContext.h"
+#include "jenlib/events/Runtime.h"
+#include "jenlib/time/TimerContext.h"
+#include "jenlib/time/drivers/NativeTimeDriver.h"
+
+namespace {
+
+using jenlib::events::Event;
+using jenlib::events::EventContext;
+using jenlib::events::EventType;
+using jenlib::events::PhaseConfig;
+using jenlib::events::Runtime;
+
+constexpr std::uint32_t kSimulatedMs = 600000;
+constexpr std::uint32_t kBurstEveryMs = 1000;
+constexpr std::uint32_t kBurstMessages = 40;
+constexpr std::uint32_t kIntakeMs = 1;
+constexpr std::uint32_t kHandlerMs = 2;
+constexpr std::uint32_t kMeasureMs = 100;
+
+//! @brief Clock that moves only when the simulation advances it
+class SimulatedClock : public jenlib::time::TimeDriver {
+ public:
+    std::uint32_t now() override { return now_ms; }
+    void delay(std::uint32_t delay_ms) override { now_ms += delay_ms; }
+    bool has_overflowed(std::uint32_t) noexcept override { return false; }
+    std::uint32_t time_difference(std::uint32_t current, std::uint32_t previous) noexcept override {
+        return current - previous;
+    }
+
+    std::uint32_t now_ms{0};
+};
+
+std::uint32_t percentile(std::vector<std::uint32_t> values, double p) {
+    if (values.empty()) {
+        return 0;
+    }
+    std::sort(values.begin(), values.end());
+    return values[static_cast<std::size_t>(p * static_cast<double>(values.size() - 1))];
+}
+
+PhaseConfig limits(std::size_t max_items, std::uint32_t budget_ms, std::uint8_t priority) {
+    PhaseConfig config;
+    config.max_items = max_items;
+    config.budget_ms = budget_ms;
+    config.priority = priority;
+    return config;
+}
+
+void run(bool use_runtime) {
+    SimulatedClock clock;
+    EventContext events;
+    events.set_time_driver(&clock);
+    jenlib::time::TimerContext timers(&clock);
+
+    // Radio inbox of arrival times
+    std::deque<std::uint32_t> radio;
+    const auto intake = [&](std::size_t max_messages) {
+        std::size_t taken = 0;
+        for (; taken < max_messages && !radio.empty(); ++taken) {
+            const std::uint32_t arrived = radio.front();
+            radio.pop_front();
+            clock.delay(kIntakeMs);
+            events.dispatch_event(Event(EventType::kBleMessage, arrived, 0));
+        }
+        return taken;
+    };
+
+    std::vector<std::uint32_t> message_wait;
+    events.register_callback(EventType::kBleMessage, [&](const Event& event) {
+        clock.delay(kHandlerMs);
+        message_wait.push_back(clock.now_ms - event.timestamp);
+    });
+
+    // Mirror the timer's schedule: it fires for the period it was due and skips periods that passed entirely
+    std::vector<std::uint32_t> lateness;
+    std::uint32_t due = kMeasureMs;
+    std::uint32_t pass_time = 0;
+    timers.schedule_callback(kMeasureMs, [&] {
+        lateness.push_back(clock.now_ms - due);
+        due += kMeasureMs;
+        while (due <= pass_time) {
+            due += kMeasureMs;
+        }
+        clock.delay(1);
+    }, true);
+
+    Runtime runtime(&clock);
+    runtime.add_phase("timers", [&](const PhaseConfig& c) {
+        pass_time = clock.now_ms;
+        timers.set_pass_budget_ms(c.budget_ms);
+        return timers.process_timers(c.max_items);
+    }, limits(jenlib::time::kNoPassLimit, 0, 0));
+    runtime.add_phase("ble", [&](const PhaseConfig& c) { return intake(c.max_items); }, limits(4, 0, 1));
+    runtime.add_events(events, limits(4, 10, 1));
+
+    std::vector<std::uint32_t> iteration;
+    std::uint32_t next_burst = kBurstEveryMs / 2;
+    while (clock.now_ms < kSimulatedMs) {
+        if (clock.now_ms >= next_burst) {
+            for (std::uint32_t i = 0; i < kBurstMessages; ++i) {
+                radio.push_back(clock.now_ms);
+            }
+            next_burst += kBurstEveryMs;
+        }
+        const std::uint32_t start = clock.now_ms;
+        if (use_runtime) {
+            runtime.run_once();
+        } else {
+            events.process_events();
+            intake(jenlib::time::kNoPassLimit);
+            pass_time = clock.now_ms;
+            timers.process_timers();
+        }
+        iteration.push_back(clock.now_ms - start);
+        clock.delay(1);
+    }
+
+    const char* label = use_runtime ? "Runtime" : "hand-written loop";
+    char name[64];
+    std::snprintf(name, sizeof(name), "%s: iteration p99", label);
+    jenlib::bench::report(name, percentile(iteration, 0.99), "ms");
+    std::snprintf(name, sizeof(name), "%s: iteration max", label);
+    jenlib::bench::report(name, percentile(iteration, 1.0), "ms");
+    std::snprintf(name, sizeof(name), "%s: timer lateness max", label);
+    jenlib::bench::report(name, percentile(lateness, 1.0), "ms");
+    std::snprintf(name, sizeof(name), "%s: missed timer periods", label);
+    jenlib::bench::report(name, timers.get_missed_periods(), "periods");
+    std::snprintf(name, sizeof(name), "%s: message wait p50", label);
+    jenlib::bench::report(name, percentile(message_wait, 0.5), "ms");
+    std::snprintf(name, sizeof(name), "%s: message wait p99", label);
+    jenlib::bench::report(name, percentile(message_wait, 0.99), "ms");
+}
+
+}  // namespace
+
+int main() {
+    std::printf("%u s simulated, %u messages every %u ms (%u ms intake + %u ms handler each), %u ms timer\n",
+                kSimulatedMs / 1000, kBurstMessages, kBurstEveryMs, kIntakeMs, kHandlerMs, kMeasureMs);
+    run(false);
+    run(true);
+
+    // Runtime overhead on the real clock with idle phases, against calling the same steps directly
+    jenlib::time::NativeTimeDriver native_clock;
+    EventContext events;
+    jenlib::time::TimerContext timers(&native_clock);
+    timers.schedule_callback(60000, [] {}, true);
+    const double direct_ns = jenlib::bench::ns_per_iteration(1000000, [&](std::uint64_t) {
+        jenlib::bench::do_not_optimize(events.process_events() + timers.process_timers());
+    });
+    jenlib::bench::report("direct calls, idle", direct_ns, "ns/iteration");
+    Runtime runtime(&native_clock);
+    runtime.add_timers(timers, limits(jenlib::time::kNoPassLimit, 0, 0));
+    runtime.add_events(events, limits(8, 10, 1));
+    const double runtime_ns = jenlib::bench::ns_per_iteration(1000000, [&](std::uint64_t) {
+        jenlib::bench::do_not_optimize(runtime.run_once());
+    });
+    jenlib::bench::report("Runtime::run_once, idle", runtime_ns, "ns/iteration");
+    return 0;
+}
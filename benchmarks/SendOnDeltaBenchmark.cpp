@@ -0,0 +1,67 @@
+//! @file benchmarks/SendOnDeltaBenchmark.cpp
+//! @brief Messages sent and reconstruction error of send-on-delta on a replayed trace.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+//!
+//! Usage: SendOnDeltaBenchmark [trace.csv]
+//! The optional trace has rows "offset_ms,temperature_c,humidity_pct" sampled at
+//! the sensor interval. Without one, a synthetic 24 h office trace is replayed.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "BenchmarkUtil.h"
+#include "ReplayTrace.h"
+#include "jenlib/measurement/SendOnDelta.h"
+
+namespace {
+
+using jenlib::ble::ReadingMsg;
+
+void run(const std::vector<ReadingMsg>& trace, const jenlib::measurement::SendOnDeltaConfig& config) {
+    jenlib::measurement::SendOnDeltaFilter filter(config);
+    jenlib::measurement::StepHoldSeries<1> held;  // Broker only needs the latest value to replay
+    std::uint32_t max_temp_error = 0;
+    std::uint32_t max_hum_error = 0;
+    for (const auto& reading : trace) {
+        if (filter.should_send(reading)) {
+            held.append(reading);
+        }
+        jenlib::measurement::SeriesPoint point{};
+        held.value_at(reading.offset_ms, point);
+        max_temp_error = std::max<std::uint32_t>(max_temp_error,
+            static_cast<std::uint32_t>(std::abs(reading.temperature_c_centi - point.temperature_c_centi)));
+        max_hum_error = std::max<std::uint32_t>(max_hum_error,
+            static_cast<std::uint32_t>(std::abs(reading.humidity_bp - point.humidity_bp)));
+    }
+    std::printf("deadband %3u centi / %3u bp, heartbeat %5u s: %6u of %6zu sent (%5.1f%%), "
+                "max error %u centi / %u bp\n",
+                config.temperature_deadband_centi, config.humidity_deadband_bp, config.max_silence_ms / 1000,
+                filter.sent_count(), trace.size(), 100.0 * filter.sent_count() / trace.size(),
+                max_temp_error, max_hum_error);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const auto trace = argc > 1 ? jenlib::bench::load_trace(argv[1]) : jenlib::bench::synthetic_trace();
+    if (trace.empty()) {
+        std::fprintf(stderr, "no readings in trace\n");
+        return 1;
+    }
+    run(trace, {0, 0, 0});  // Send on any change
+    run(trace, {5, 25, 300000});
+    run(trace, {10, 50, 300000});
+    run(trace, {25, 100, 600000});
+
+    jenlib::measurement::SendOnDeltaFilter filter({10, 50, 300000});
+    std::size_t i = 0;
+    bool sink = false;
+    jenlib::bench::report("should_send", jenlib::bench::ns_per_iteration(10000000, [&](std::uint64_t) {
+        sink ^= filter.should_send(trace[i]);
+        i = (i + 1) % trace.size();
+    }), "ns/reading");
+    jenlib::bench::do_not_optimize(sink);
+    return 0;
+}
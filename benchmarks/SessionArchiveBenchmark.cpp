@@ -0,0 +1,222 @@
+//! @file benchmarks/SessionArchiveBenchmark.cpp
+//! @brief Write rate, compression, query latency and compaction cost of the session archive.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+//!
+//! Archives kSensors sensors reporting once a second for a number of days,
+//! with temperature and humidity on slow random walks. Point queries ask for
+//! one second of one sensor, range queries for 24 hours. Resident pages are
+//! counted with mincore() after evicting the segments from the page cache,
+//! so they show how much of the archive one cold point query touches.
+//! Compaction is timed on an archive flushed every minute, as a broker that
+//! archives on every upload would leave it.
+//!
+//! Usage: SessionArchiveBenchmark [days] (default 2)
+
+#include <cstdio>
+
+#if defined(__linux__)
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+#include "BenchmarkUtil.h"
+#include "jenlib/storage/SessionArchive.h"
+
+namespace {
+
+using jenlib::ble::DeviceId;
+using jenlib::ble::ReadingMsg;
+using jenlib::ble::SessionId;
+using jenlib::storage::ArchiveReader;
+using jenlib::storage::ArchiveRow;
+using jenlib::storage::ArchiveWriter;
+
+constexpr std::uint32_t kSensors = 32;
+constexpr std::uint64_t kStartMs = 1700000000000ull;
+constexpr std::uint64_t kDayMs = 24ull * 3600 * 1000;
+constexpr std::size_t kRawRowBytes = 16;  // sender, session, offset, temperature, humidity
+
+double seconds_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+std::vector<std::string> segment_files(const std::string& directory) {
+    std::vector<std::string> files;
+    if (DIR* dir = opendir(directory.c_str())) {
+        while (const dirent* entry = readdir(dir)) {
+            if (std::string(entry->d_name).rfind("segment-", 0) == 0) {
+                files.push_back(directory + "/" + entry->d_name);
+            }
+        }
+        closedir(dir);
+    }
+    return files;
+}
+
+void remove_archive(const std::string& directory) {
+    for (const auto& file : segment_files(directory)) {
+        unlink(file.c_str());
+    }
+    rmdir(directory.c_str());
+}
+
+//! @brief Total bytes of the archive and how many of its pages are in the page cache.
+std::uint64_t archive_pages(const std::string& directory, std::uint64_t& resident, bool evict) {
+    const std::size_t page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    std::uint64_t total = 0;
+    resident = 0;
+    for (const auto& file : segment_files(directory)) {
+        const int fd = open(file.c_str(), O_RDONLY);
+        struct stat info {};
+        fstat(fd, &info);
+        const std::size_t size = static_cast<std::size_t>(info.st_size);
+        if (evict) {
+            posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        }
+        void* base = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        std::vector<unsigned char> in_core((size + page - 1) / page);
+        if (base != MAP_FAILED && mincore(base, size, in_core.data()) == 0) {
+            for (const unsigned char bit : in_core) {
+                resident += bit & 1;
+            }
+        }
+        if (base != MAP_FAILED) {
+            munmap(base, size);
+        }
+        close(fd);
+        total += in_core.size();
+    }
+    return total;
+}
+
+//! @brief Write @p days of readings, flushing every @p flush_rows rows per sensor (0 = only full blocks).
+std::uint64_t write_archive(const std::string& directory, std::uint32_t days, std::uint32_t flush_rows) {
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<int> step(-2, 2);
+    std::vector<std::int16_t> temperature(kSensors, 2100);
+    std::vector<std::uint16_t> humidity(kSensors, 4000);
+    const std::uint32_t seconds = days * 24 * 3600;
+    ArchiveWriter writer;
+    writer.open(directory);
+    for (std::uint32_t second = 0; second < seconds; ++second) {
+        for (std::uint32_t sensor = 0; sensor < kSensors; ++sensor) {
+            temperature[sensor] = static_cast<std::int16_t>(temperature[sensor] + step(rng));
+            humidity[sensor] = static_cast<std::uint16_t>(humidity[sensor] + step(rng));
+            writer.add(kStartMs, ReadingMsg{DeviceId(sensor + 1), SessionId(1), second * 1000, temperature[sensor],
+                                            humidity[sensor]});
+        }
+        if (flush_rows && (second + 1) % flush_rows == 0) {
+            writer.flush();
+        }
+    }
+    writer.close();
+    return static_cast<std::uint64_t>(seconds) * kSensors;
+}
+
+//! @brief Mean microseconds per query over @p count random windows of @p width_ms.
+double query_us(const ArchiveReader& reader, std::uint32_t days, std::uint64_t width_ms, std::uint32_t count,
+                std::uint64_t& rows) {
+    std::mt19937 rng(2);
+    std::uniform_int_distribution<std::uint64_t> at(0, days * kDayMs - width_ms);
+    std::uniform_int_distribution<std::uint32_t> sensor(1, kSensors);
+    rows = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (std::uint32_t i = 0; i < count; ++i) {
+        const std::uint64_t from_ms = kStartMs + at(rng) / 1000 * 1000;
+        std::int64_t sum = 0;
+        rows += reader.query(DeviceId(sensor(rng)), from_ms, from_ms + width_ms, [&sum](const ArchiveRow& row) {
+            sum += row.temperature_c_centi;
+            return true;
+        });
+        jenlib::bench::do_not_optimize(sum);
+    }
+    return seconds_since(start) * 1e6 / count;
+}
+
+void run_queries(const std::string& directory, std::uint32_t days, const char* label) {
+    ArchiveReader reader;
+    reader.open(directory);
+    reader.scan([](const ArchiveRow&) { return true; });  // Warm: cold faults are measured separately
+    std::uint64_t rows = 0;
+    const double point = query_us(reader, days, 0, 20000, rows);
+    const double range = query_us(reader, days, kDayMs, 50, rows);
+    std::printf("%-12s %6zu blocks %10.2f us point query %10.2f ms 24 h query (%llu rows)\n", label,
+                reader.block_count(), point, range / 1e3, static_cast<unsigned long long>(rows / 50));
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const std::uint32_t days = argc > 1 ? static_cast<std::uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 2;
+    const std::string directory = "/tmp/jenlib-archive-bench-" + std::to_string(getpid());
+    std::printf("%u sensors at 1 Hz for %u days, %zu rows per block, index every %zu rows\n", kSensors, days,
+                jenlib::storage::archive::kBlockRows, jenlib::storage::archive::kIndexStride);
+
+    remove_archive(directory);
+    auto start = std::chrono::steady_clock::now();
+    const std::uint64_t rows = write_archive(directory, days, 0);
+    const double write_s = seconds_since(start);
+    std::uint64_t resident = 0;
+    const std::uint64_t pages = archive_pages(directory, resident, true);
+    const double bytes = static_cast<double>(pages) * static_cast<double>(sysconf(_SC_PAGESIZE));
+    std::printf("write        %10.2f M rows/s %8.2f bytes/row %8.1fx smaller than raw %zu-byte rows\n",
+                rows / write_s / 1e6, bytes / rows, rows * kRawRowBytes / bytes, kRawRowBytes);
+
+    // One cold point query: how much of the archive it faults in
+    {
+        ArchiveReader reader;
+        start = std::chrono::steady_clock::now();
+        reader.open(directory);
+        const double open_ms = seconds_since(start) * 1e3;
+        start = std::chrono::steady_clock::now();
+        const std::size_t found = reader.query(DeviceId(kSensors / 2), kStartMs + days * kDayMs / 2,
+                                               kStartMs + days * kDayMs / 2, [](const ArchiveRow&) { return true; });
+        const double cold_us = seconds_since(start) * 1e6;
+        archive_pages(directory, resident, false);
+        std::printf("cold query   %10.2f ms open %10.2f us query (%zu row) %llu of %llu pages resident\n", open_ms,
+                    cold_us, found, static_cast<unsigned long long>(resident), static_cast<unsigned long long>(pages));
+    }
+
+    run_queries(directory, days, "full blocks");
+    {
+        ArchiveReader reader;
+        reader.open(directory);
+        start = std::chrono::steady_clock::now();
+        std::int64_t sum = 0;
+        const std::size_t scanned = reader.scan([&sum](const ArchiveRow& row) {
+            sum += row.humidity_bp;
+            return true;
+        });
+        jenlib::bench::do_not_optimize(sum);
+        std::printf("full scan    %10.2f M rows/s (%zu rows)\n", scanned / seconds_since(start) / 1e6, scanned);
+    }
+    remove_archive(directory);
+
+    write_archive(directory, days, 60);
+    run_queries(directory, days, "fragmented");
+    start = std::chrono::steady_clock::now();
+    jenlib::storage::compact_archive(directory);
+    const double compact_s = seconds_since(start);
+    std::printf("compaction   %10.2f s (%10.2f M rows/s)\n", compact_s, rows / compact_s / 1e6);
+    run_queries(directory, days, "compacted");
+    remove_archive(directory);
+    return 0;
+}
+
+#else
+
+int main() {
+    std::printf("SessionArchiveBenchmark needs Linux mmap\n");
+    return 0;
+}
+
+#endif  // __linux__
@@ -0,0 +1,120 @@
+//! @file benchmarks/SessionSnapshotBenchmark.cpp
+//! @brief Cost of session snapshots and the reconnect-to-first-reading they save.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+//!
+//! Measures snapshot encode/decode, file store save/load with and without
+//! fsync, and the CPU cost of the resume path at boot. Reconnect latency is
+//! counted in link messages from connection to the first reading the broker
+//! accepts, for a fresh handshake and for a restored session, and converted
+//! to time at typical BLE connection intervals (one message per interval).
+
+#include <cstdio>
+
+#if !defined(ARDUINO) && !defined(ESP_PLATFORM) && defined(__unix__)
+
+#include <unistd.h>
+#include <cstdint>
+#include <string>
+#include "BenchmarkUtil.h"
+#include "jenlib/ble/Messages.h"
+#include "jenlib/state/BrokerStateMachine.h"
+#include "jenlib/state/SensorStateMachine.h"
+#include "jenlib/state/SessionSnapshot.h"
+#include "jenlib/storage/drivers/FileSnapshotStore.h"
+#include "jenlib/time/Time.h"
+#include "jenlib/time/drivers/NativeTimeDriver.h"
+
+namespace {
+
+using jenlib::ble::DeviceId;
+using jenlib::ble::SessionId;
+using jenlib::state::SessionSnapshot;
+
+constexpr DeviceId kSensor(0x10);
+constexpr DeviceId kBroker(0xB0);
+constexpr SessionId kSession(7);
+
+//! @brief Messages on the link from connection until the broker accepts a reading.
+std::uint32_t messages_to_first_reading(const SessionSnapshot* snapshot) {
+    jenlib::state::BrokerStateMachine broker;
+    broker.handle_start_command(kSensor, kSession);
+
+    jenlib::state::SensorStateMachine sensor;
+    if (snapshot) {
+        sensor.restore(*snapshot);
+    }
+    sensor.handle_connection_change(true);
+    std::uint32_t messages = 0;
+    if (!sensor.is_session_active()) {
+        ++messages;  // Broker -> sensor StartBroadcast
+        sensor.handle_start_broadcast(kBroker, jenlib::ble::StartBroadcastMsg{kBroker, kSession});
+    }
+    const jenlib::ble::ReadingMsg reading{kSensor, sensor.get_current_session_id(), 0, 2100, 4000};
+    if (sensor.should_broadcast(reading)) {
+        ++messages;  // Sensor -> broker reading
+    }
+    return broker.handle_reading(kSensor, reading) ? messages : 0;
+}
+
+}  // namespace
+
+int main() {
+    jenlib::time::NativeTimeDriver clock;
+    jenlib::time::Time::setDriver(&clock);
+
+    SessionSnapshot snapshot;
+    snapshot.session_id = kSession;
+    snapshot.broker_id = kBroker;
+    snapshot.measurement_interval_ms = 1000;
+    snapshot.session_offset_ms = 123400;
+    snapshot.next_measurement_offset_ms = 124000;
+    SessionSnapshot::Buffer buffer{};
+
+    std::printf("Snapshot: %zu bytes\n", SessionSnapshot::kEncodedSize);
+    jenlib::bench::report("encode", jenlib::bench::ns_per_iteration(1000000, [&](std::uint64_t) {
+        SessionSnapshot::serialize(snapshot, buffer);
+        jenlib::bench::do_not_optimize(buffer);
+    }), "ns");
+    jenlib::bench::report("decode", jenlib::bench::ns_per_iteration(1000000, [&](std::uint64_t) {
+        SessionSnapshot decoded;
+        jenlib::bench::do_not_optimize(SessionSnapshot::deserialize(buffer.data(), buffer.size(), decoded));
+    }), "ns");
+
+    const std::string path = "/tmp/jenlib-snapshot-bench-" + std::to_string(getpid());
+    jenlib::storage::FileSnapshotStore synced(path, true);
+    jenlib::storage::FileSnapshotStore unsynced(path, false);
+    jenlib::bench::report("file save (fsync)", jenlib::bench::ns_per_iteration(200, [&](std::uint64_t) {
+        SessionSnapshot::save(synced, snapshot);
+    }) / 1000.0, "us");
+    jenlib::bench::report("file save (no fsync)", jenlib::bench::ns_per_iteration(5000, [&](std::uint64_t) {
+        SessionSnapshot::save(unsynced, snapshot);
+    }) / 1000.0, "us");
+    jenlib::bench::report("file load + restore", jenlib::bench::ns_per_iteration(5000, [&](std::uint64_t) {
+        SessionSnapshot loaded;
+        jenlib::state::SensorStateMachine sensor;
+        jenlib::bench::do_not_optimize(SessionSnapshot::load(unsynced, loaded) && sensor.restore(loaded));
+    }) / 1000.0, "us");
+    unsynced.clear();
+
+    const std::uint32_t handshake = messages_to_first_reading(nullptr);
+    const std::uint32_t resumed = messages_to_first_reading(&snapshot);
+    std::printf("\nReconnect to first accepted reading\n");
+    std::printf("%-12s %9s %12s %12s %12s\n", "path", "messages", "@7.5 ms", "@30 ms", "@100 ms");
+    for (const auto& [name, messages] : {std::pair<const char*, std::uint32_t>{"handshake", handshake},
+                                         std::pair<const char*, std::uint32_t>{"snapshot", resumed}}) {
+        std::printf("%-12s %9u %9.1f ms %9.1f ms %9.1f ms\n", name, messages, messages * 7.5, messages * 30.0,
+                    messages * 100.0);
+    }
+    jenlib::time::Time::setDriver(nullptr);
+    return 0;
+}
+
+#else
+
+int main() {
+    std::printf("SessionSnapshotBenchmark needs a native POSIX build\n");
+    return 0;
+}
+
+#endif  // native POSIX
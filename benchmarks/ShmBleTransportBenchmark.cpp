@@ -0,0 +1,176 @@
+//! @file benchmarks/ShmBleTransportBenchmark.cpp
+//! @brief Cross-process throughput and latency of ShmBleTransport.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+//!
+//! A forked child produces timestamped messages into the broker's ring; the
+//! parent consumes them either by busy polling or by sleeping on the futex.
+//! Burst runs measure messages per second; paced runs (one message every
+//! 100 us) measure one-way latency without queueing. A last, single-process
+//! run times the NativeBleDriver path on top of the transport: a sensor
+//! advertise() and the broker poll() that dispatches it to a Reading callback.
+
+#include <cstdio>
+
+#if defined(__linux__)
+
+#include <sys/wait.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include "BenchmarkUtil.h"
+#include "jenlib/ble/Messages.h"
+#include "jenlib/ble/drivers/NativeBleDriver.h"
+#include "jenlib/ble/drivers/ShmBleTransport.h"
+
+namespace {
+
+using jenlib::ble::BlePayload;
+using jenlib::ble::DeviceId;
+using jenlib::ble::ShmBleTransport;
+
+std::uint64_t now_ns() {
+    // steady_clock is CLOCK_MONOTONIC on Linux, so timestamps compare across processes
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void produce(const char* name, std::uint32_t count, std::uint64_t pace_ns) {
+    ShmBleTransport transport;
+    if (!transport.open(name, false)) {
+        _exit(1);
+    }
+    std::uint64_t next_send = now_ns();
+    for (std::uint32_t i = 0; i < count; ++i) {
+        const std::uint64_t now = now_ns();
+        if (pace_ns > 0 && now < next_send) {
+            // Sleep rather than spin so a consumer sharing the core can run
+            std::this_thread::sleep_for(std::chrono::nanoseconds(next_send - now));
+        }
+        next_send += pace_ns;
+        // Serialised straight into the shared slot
+        while (!transport.send_in_place(DeviceId(0), [i](BlePayload& slot) {
+            const std::uint64_t stamp = now_ns();
+            return slot.append_u32le(i) && slot.append_u32le(static_cast<std::uint32_t>(stamp)) &&
+                   slot.append_u32le(static_cast<std::uint32_t>(stamp >> 32));
+        })) {
+            std::this_thread::yield();  // Ring full
+        }
+    }
+    _exit(0);
+}
+
+void run(const char* label, std::uint32_t count, std::uint64_t pace_ns, bool sleep_on_futex) {
+    const std::string name = "/jenlib-bench-" + std::to_string(getpid());
+    ShmBleTransport transport;
+    if (!transport.open(name.c_str(), true)) {
+        std::fprintf(stderr, "shm_open failed\n");
+        return;
+    }
+    transport.consume(DeviceId(0), [](const BlePayload&) {});  // Register the ring before the producer starts
+
+    const pid_t child = fork();
+    if (child == 0) {
+        produce(name.c_str(), count, pace_ns);
+    }
+
+    std::vector<std::uint32_t> latencies;
+    latencies.reserve(count);
+    std::uint64_t first_stamp = 0;
+    std::uint64_t last_receive = 0;
+    while (latencies.size() < count) {
+        if (sleep_on_futex && !transport.wait(DeviceId(0), 1000)) {
+            break;
+        }
+        const std::size_t handled = transport.consume(DeviceId(0), [&](const BlePayload& payload) {
+            std::size_t i = 0;
+            std::uint32_t seq = 0;
+            std::uint32_t lo = 0;
+            std::uint32_t hi = 0;
+            jenlib::ble::read_u32le(payload, i, seq);
+            jenlib::ble::read_u32le(payload, i, lo);
+            jenlib::ble::read_u32le(payload, i, hi);
+            const std::uint64_t stamp = (static_cast<std::uint64_t>(hi) << 32) | lo;
+            last_receive = now_ns();
+            if (seq == 0) {
+                first_stamp = stamp;
+            }
+            latencies.push_back(static_cast<std::uint32_t>(last_receive - stamp));
+        });
+        if (handled == 0 && !sleep_on_futex) {
+            std::this_thread::yield();  // Lets the producer run when both share a core
+        }
+    }
+    waitpid(child, nullptr, 0);
+    ShmBleTransport::unlink(name.c_str());
+
+    if (latencies.empty()) {
+        return;
+    }
+    const double seconds = static_cast<double>(last_receive - first_stamp) / 1e9;
+    std::sort(latencies.begin(), latencies.end());
+    std::printf("%-28s %9zu msgs %12.0f msgs/s  latency p50 %7.2f us  p99 %8.2f us\n", label, latencies.size(),
+                latencies.size() / seconds, latencies[latencies.size() / 2] / 1e3,
+                latencies[latencies.size() * 99 / 100] / 1e3);
+}
+
+void run_driver(std::uint32_t rounds) {
+    const std::string name = "/jenlib-bench-driver-" + std::to_string(getpid());
+    ShmBleTransport transport;
+    if (!transport.open(name.c_str(), true)) {
+        std::fprintf(stderr, "shm_open failed\n");
+        return;
+    }
+    jenlib::ble::NativeBleDriver sensor(DeviceId(0x10));
+    jenlib::ble::NativeBleDriver broker(DeviceId(0));
+    sensor.set_transport(&transport);
+    broker.set_transport(&transport);
+    std::uint64_t readings = 0;
+    broker.set_reading_callback([&readings](DeviceId, const jenlib::ble::ReadingMsg& msg) {
+        readings += msg.offset_ms;
+    });
+    sensor.begin();
+    broker.begin();
+
+    // Half a ring per round so no send is refused
+    constexpr std::uint32_t kBatch = ShmBleTransport::kRingSlots / 2;
+    jenlib::ble::ReadingMsg reading{DeviceId(0x10), jenlib::ble::SessionId(1), 0, 2100, 4000};
+    const auto round = [&](std::uint64_t) {
+        for (std::uint32_t i = 0; i < kBatch; ++i) {
+            BlePayload payload;
+            reading.offset_ms = i;
+            jenlib::ble::ReadingMsg::serialize(reading, payload);
+            sensor.advertise(DeviceId(0x10), std::move(payload));
+        }
+        broker.poll();
+    };
+    round(0);  // Warm up and claim the rings
+    const double ns = jenlib::bench::ns_per_iteration(rounds, round) / kBatch;
+    jenlib::bench::do_not_optimize(readings);
+    ShmBleTransport::unlink(name.c_str());
+    jenlib::bench::report("driver advertise + poll, in process", ns, "ns/msg");
+    jenlib::bench::report("driver inbox drops", broker.inbox_drops() + sensor.inbox_drops(), "msgs");
+}
+
+}  // namespace
+
+int main() {
+    run("burst, busy poll", 2000000, 0, false);
+    run("burst, futex wait", 2000000, 0, true);
+    run("paced 100 us, busy poll", 50000, 100000, false);
+    run("paced 100 us, futex wait", 50000, 100000, true);
+    run_driver(20000);
+    return 0;
+}
+
+#else
+
+int main() {
+    std::printf("ShmBleTransport is Linux-only\n");
+    return 0;
+}
+
+#endif  // __linux__
@@ -0,0 +1,38 @@
+//! @file benchmarks/Tmp36Benchmark.cpp
+//! @brief ADC code to wire centi-degrees: float formula versus lookup table.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include <cstdint>
+#include "BenchmarkUtil.h"
+#include "jenlib/measurement/Measurement.h"
+#include "jenlib/sensors/Tmp36.h"
+
+namespace {
+
+constexpr std::uint64_t kSamples = 10000000;
+
+// The conversion applications used before the driver existed
+std::int16_t float_path(std::uint16_t code) {
+    const float volts = (static_cast<float>(code) / 4095.0f) * 3.3f;
+    return jenlib::measurement::temperature_to_centi((volts - 0.5f) * 100.0f);
+}
+
+}  // namespace
+
+int main() {
+    using Sensor = jenlib::sensors::Tmp36<12, 3300, 4>;
+    std::int32_t sink = 0;
+
+    jenlib::bench::report("float volts -> temperature_to_centi", jenlib::bench::ns_per_iteration(kSamples,
+        [&](std::uint64_t i) { sink += float_path(static_cast<std::uint16_t>(i & 0xFFFu)); }), "ns/sample");
+    jenlib::bench::report("Tmp36 LUT centi_from_code", jenlib::bench::ns_per_iteration(kSamples,
+        [&](std::uint64_t i) { sink += Sensor::centi_from_code(static_cast<std::uint16_t>(i & 0xFFFu)); }),
+        "ns/sample");
+    jenlib::bench::report("Tmp36 LUT centi_from_sum (16x)", jenlib::bench::ns_per_iteration(kSamples,
+        [&](std::uint64_t i) { sink += Sensor::centi_from_sum(static_cast<std::uint32_t>(i & 0xFFFFu)); }),
+        "ns/sample");
+
+    jenlib::bench::do_not_optimize(sink);
+    return 0;
+}
@@ -8,6 +8,7 @@
 #include <jenlib/ble/Ids.h>
 #include <jenlib/ble/Messages.h>
 #include <jenlib/events/EventDispatcher.h>
+#include <jenlib/events/Runtime.h>
 #include <jenlib/time/Time.h>
 #include <jenlib/state/SensorStateMachine.h>
 #include <jenlib/measurement/Measurement.h>
@@ -25,6 +26,10 @@ static jenlib::gpio::ArduinoGpioDriver gpio_driver;
 static jenlib::ble::ArduinoBleDriver ble_driver;
 static jenlib::time::ArduinoTimeDriver time_driver;
 
+//! @section Main loop
+//! @brief Runs timers first, then takes turns between BLE intake and event handling, a few items at a time
+static jenlib::events::Runtime runtime(&time_driver);
+
 //! @section State machine
 //! @brief Sensor state machine manages the lifecycle from disconnected -> waiting -> running
 //! @details The state machine ensures proper state transitions and validates operations
@@ -83,13 +88,16 @@ void setup() {
     event_dispatcher.register_callback(
         jenlib::events::EventType::kTimeTick,
         handle_time_tick_event);
+
+    // Bound each phase so a burst of BLE traffic cannot delay the measurement timer
+    runtime.add_timers(jenlib::time::Time::default_context(), {jenlib::time::kNoPassLimit, 0, 0});
+    runtime.add_ble_intake(ble_driver, {8, 0, 1});
+    runtime.add_events(event_dispatcher.default_context(), {8, 10, 1});
 }
 
 void loop() {
     // Process all event systems
-    event_dispatcher.process_events();
-    sensor.process_events();
-    jenlib::time::Time::process_timers();
+    runtime.run_once();
 
     // Process state machine events
     // The state machine handles its own event processing internally
@@ -190,6 +198,8 @@ void start_measurement_session(const jenlib::ble::StartBroadcastMsg& msg) {
 
     // Configure state machine with session parameters
     sensor_state_machine.set_measurement_interval_ms(1000);  // 1 second interval
+    // Skip readings within 0.1 °C and 0.5 % of the last one sent, with a heartbeat every minute
+    sensor_state_machine.set_send_on_delta_reporting({10, 50, 60000});
 
     // Schedule first measurement immediately
     take_and_broadcast_reading();
@@ -223,8 +233,10 @@ void take_and_broadcast_reading() {
         .humidity_bp = jenlib::measurement::humidity_to_basis_points(humidity_pct)
     };
 
-    // Broadcast the reading
-    sensor.broadcast_reading(reading_msg);
+    // Broadcast the reading unless send-on-delta holds it back
+    if (sensor_state_machine.should_broadcast(reading_msg)) {
+        sensor.broadcast_reading(reading_msg);
+    }
 }
 
 //! @section Implementations of mock sensor reading functions
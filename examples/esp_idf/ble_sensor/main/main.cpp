@@ -7,6 +7,7 @@
 #include <jenlib/ble/Ids.h>
 #include <jenlib/ble/Messages.h>
 #include <jenlib/events/EventDispatcher.h>
+#include <jenlib/events/Runtime.h>
 #include <jenlib/time/Time.h>
 #include <jenlib/state/SensorStateMachine.h>
 #include <jenlib/measurement/Measurement.h>
@@ -96,12 +97,17 @@ void sensor_task(void* pvParameters) {
 
     ESP_LOGI(TAG, "Sensor initialized successfully");
 
+    // Timers first, then BLE intake and event handling take turns; each phase is bounded
+    // so a burst of BLE traffic cannot delay the measurement timer
+    jenlib::events::Runtime runtime(&time_driver);
+    runtime.add_timers(jenlib::time::Time::default_context(), {jenlib::time::kNoPassLimit, 0, 0});
+    runtime.add_ble_intake(ble_driver, {8, 0, 1});
+    runtime.add_events(event_dispatcher.default_context(), {8, 10, 1});
+
     // Main loop
     while (true) {
         // Process all event systems
-        event_dispatcher.process_events();
-        sensor.process_events();
-        jenlib::time::Time::process_timers();
+        runtime.run_once();
 
         // Process state machine events
         // The state machine handles its own event processing internally
@@ -217,6 +223,8 @@ void start_measurement_session(const jenlib::ble::StartBroadcastMsg& msg) {
 
     // Configure state machine with session parameters
     sensor_state_machine.set_measurement_interval_ms(1000);  // 1 second interval
+    // Skip readings within 0.1 °C and 0.5 % of the last one sent, with a heartbeat every minute
+    sensor_state_machine.set_send_on_delta_reporting({10, 50, 60000});
 
     // Schedule first measurement immediately
     take_and_broadcast_reading();
@@ -251,7 +259,10 @@ void take_and_broadcast_reading() {
         .humidity_bp = jenlib::measurement::humidity_to_basis_points(humidity_pct)
     };
 
-    // Broadcast the reading
+    // Broadcast the reading unless send-on-delta holds it back
+    if (!sensor_state_machine.should_broadcast(reading_msg)) {
+        return;
+    }
     sensor.broadcast_reading(reading_msg);
 
     ESP_LOGI(TAG, "Broadcasted reading: temp=%.1f°C, humidity=%.1f%%",
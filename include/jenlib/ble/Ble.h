@@ -18,7 +18,8 @@ namespace jenlib::ble {
 //! This keeps serialization and transport at the edges of the system.
 //! Applications set a `BleDriver`, then call these helpers to emit
 //! typed messages without worrying about framing. All functions are
-//! no-ops when no driver is configured.
+//! no-ops when no driver is configured. The send helpers also take an
+//! explicit driver, for hosts with more than one radio.
 class BLE {
  public:
     static void set_driver(BleDriver *driver) { driver_ = driver; }
@@ -28,42 +29,100 @@ class BLE {
     //! @param device_id The ID of the device to start broadcasting.
     //! @param msg The message to send.
     static void send_start(DeviceId device_id, const StartBroadcastMsg &msg) {
-        if (!driver_) {
+        send_start(driver_, device_id, msg);
+    }
+
+    //! @brief Send a start message through a specific driver.
+    //! @param driver Radio to send through; no-op if null.
+    static void send_start(BleDriver *driver, DeviceId device_id, const StartBroadcastMsg &msg) {
+        if (!driver) {
             return;
         }
         BlePayload p;
         if (!StartBroadcastMsg::serialize(msg, p)) {
             return;
         }
-        driver_->send_to(device_id, std::move(p));
+        driver->send_to(device_id, std::move(p));
     }
 
     //! @brief Broadcast a sensor reading.
     //! @param sender_id The ID of the device sending the message.
     //! @param msg The message to send.
     static void broadcast_reading(DeviceId sender_id, const ReadingMsg &msg) {
-        if (!driver_) {
+        broadcast_reading(driver_, sender_id, msg);
+    }
+
+    //! @brief Broadcast a sensor reading through a specific driver.
+    //! @param driver Radio to send through; no-op if null.
+    static void broadcast_reading(BleDriver *driver, DeviceId sender_id, const ReadingMsg &msg) {
+        if (!driver) {
             return;
         }
         BlePayload p;
         if (!ReadingMsg::serialize(msg, p)) {
             return;
         }
-        driver_->advertise(sender_id, std::move(p));
+        driver->advertise(sender_id, std::move(p));
+    }
+
+    //! @brief Broadcast a health heartbeat.
+    //! @param sender_id The ID of the device sending the message.
+    //! @param msg The message to send.
+    static void broadcast_health(DeviceId sender_id, const HealthMsg &msg) {
+        broadcast_health(driver_, sender_id, msg);
+    }
+
+    //! @brief Broadcast a health heartbeat through a specific driver.
+    //! @param driver Radio to send through; no-op if null.
+    static void broadcast_health(BleDriver *driver, DeviceId sender_id, const HealthMsg &msg) {
+        if (!driver) {
+            return;
+        }
+        BlePayload p;
+        if (!HealthMsg::serialize(msg, p)) {
+            return;
+        }
+        driver->advertise(sender_id, std::move(p));
     }
 
     //! @brief Send a receipt message to a device.
     //! @param device_id The ID of the device to send the message to.
     //! @param msg The message to send.
     static void send_receipt(DeviceId device_id, const ReceiptMsg &msg) {
-        if (!driver_) {
+        send_receipt(driver_, device_id, msg);
+    }
+
+    //! @brief Send a receipt message through a specific driver.
+    //! @param driver Radio to send through; no-op if null.
+    static void send_receipt(BleDriver *driver, DeviceId device_id, const ReceiptMsg &msg) {
+        if (!driver) {
             return;
         }
         BlePayload p;
         if (!ReceiptMsg::serialize(msg, p)) {
             return;
         }
-        driver_->send_to(device_id, std::move(p));
+        driver->send_to(device_id, std::move(p));
+    }
+
+    //! @brief Send adaptive sampling bounds to a device.
+    //! @param device_id The ID of the device to send the message to.
+    //! @param msg The message to send.
+    static void send_sampling_config(DeviceId device_id, const SamplingConfigMsg &msg) {
+        send_sampling_config(driver_, device_id, msg);
+    }
+
+    //! @brief Send adaptive sampling bounds through a specific driver.
+    //! @param driver Radio to send through; no-op if null.
+    static void send_sampling_config(BleDriver *driver, DeviceId device_id, const SamplingConfigMsg &msg) {
+        if (!driver) {
+            return;
+        }
+        BlePayload p;
+        if (!SamplingConfigMsg::serialize(msg, p)) {
+            return;
+        }
+        driver->send_to(device_id, std::move(p));
     }
 
     //! @brief Poll next received payload for a local device.
@@ -118,6 +177,9 @@ class BLE {
     static void set_receipt_callback(ReceiptCallback cb) {
         if (driver_) driver_->set_receipt_callback(std::move(cb));
     }
+    static void set_sampling_config_callback(SamplingConfigCallback cb) {
+        if (driver_) driver_->set_sampling_config_callback(std::move(cb));
+    }
     static void set_message_callback(BleMessageCallback cb) {
         if (driver_) driver_->set_message_callback(std::move(cb));
     }
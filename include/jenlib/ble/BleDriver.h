@@ -6,6 +6,7 @@
 #ifndef INCLUDE_JENLIB_BLE_BLEDRIVER_H_
 #define INCLUDE_JENLIB_BLE_BLEDRIVER_H_
 
+#include <cstddef>  //!< For size_t
 #include <cstdint>  //!< For uint8_t
 #include <functional>  //!< For function callbacks
 #include <initializer_list>
@@ -18,6 +19,7 @@ namespace jenlib::ble {
 struct StartBroadcastMsg;
 struct ReadingMsg;
 struct ReceiptMsg;
+struct SamplingConfigMsg;
 
 //! @brief Callback function type for received BLE messages.
 //! @param sender_id The device ID that sent the message.
@@ -28,6 +30,7 @@ using BleMessageCallback = std::function<void(DeviceId sender_id, const BlePaylo
 using StartBroadcastCallback = std::function<void(DeviceId sender_id, const StartBroadcastMsg& msg)>;
 using ReadingCallback = std::function<void(DeviceId sender_id, const ReadingMsg& msg)>;
 using ReceiptCallback = std::function<void(DeviceId sender_id, const ReceiptMsg& msg)>;
+using SamplingConfigCallback = std::function<void(DeviceId sender_id, const SamplingConfigMsg& msg)>;
 
 //! @brief Connection state callback function type.
 //! @param connected true if connected, false if disconnected.
@@ -39,7 +42,8 @@ enum class BleCallbackKind : std::uint8_t {
     StartBroadcast,
     Reading,
     Receipt,
-    Generic
+    Generic,
+    SamplingConfig
 };
 
 //! @brief Aggregate callbacks for one-shot configuration
@@ -49,6 +53,7 @@ struct BleCallbacks {
     ReadingCallback on_reading{};
     ReceiptCallback on_receipt{};
     BleMessageCallback on_generic{};
+    SamplingConfigCallback on_sampling_config{};
 };
 
 //! @brief Abstract transport for BLE messaging in this library.
@@ -95,6 +100,25 @@ class BleDriver {
     //! @brief Process BLE events (call regularly in main loop).
     virtual void poll() = 0;
 
+    //! @brief Process at most @p max_messages received messages, leaving the rest for a later call.
+    //! @return Messages handled. Drivers that cannot bound their intake run poll() and return 0.
+    virtual std::size_t poll_limited(std::size_t max_messages) {
+        (void)max_messages;
+        poll();
+        return 0;
+    }
+
+    //! @brief Payloads waiting to be returned by receive() for a local device.
+    //! @return 0 for drivers that keep no inbox.
+    virtual std::size_t inbox_depth(DeviceId self_id) {
+        (void)self_id;
+        return 0;
+    }
+
+    //! @brief Received payloads discarded because an inbox was full, since begin() (wraps).
+    //! @return 0 for drivers that never drop.
+    virtual std::uint32_t inbox_drops() const { return 0; }
+
     //! @brief Set callback function for received messages.
     //! @param callback Function to call when a message is received.
     virtual void set_message_callback(BleMessageCallback callback) = 0;
@@ -114,6 +138,10 @@ class BleDriver {
     //! @param callback Function to call when a Receipt message is received.
     virtual void set_receipt_callback(ReceiptCallback callback) = 0;
 
+    //! @brief Set callback for SamplingConfig messages.
+    //! @param callback Function to call when a SamplingConfig message is received.
+    virtual void set_sampling_config_callback(SamplingConfigCallback callback) = 0;
+
     //! @brief Remove all type-specific callbacks.
     virtual void clear_type_specific_callbacks() = 0;
 
@@ -0,0 +1,102 @@
+//! @file include/jenlib/ble/BleTrace.h
+//! @brief Capture format for recorded BLE traffic (native builds).
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_BLE_BLETRACE_H_
+#define INCLUDE_JENLIB_BLE_BLETRACE_H_
+
+#if !defined(ARDUINO) && !defined(ESP_PLATFORM)
+
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <vector>
+#include "jenlib/ble/Ids.h"
+#include "jenlib/ble/Payload.h"
+
+namespace jenlib::ble {
+
+//! @brief Which way a traced payload travelled, seen from the recording driver.
+enum class BleTraceDirection : std::uint8_t {
+    kInbound = 0,    //!< Delivered to a callback, heard from device (DeviceId(0) when unknown)
+    kReceived = 1,   //!< Returned by receive() polled as device
+    kAdvertise = 2,  //!< Broadcast by this side as device
+    kSendTo = 3      //!< Sent by this side to device
+};
+
+//! @brief One captured payload.
+struct BleTraceRecord {
+    std::uint64_t time_us{0};  //!< Microseconds since the capture started
+    BleTraceDirection direction{BleTraceDirection::kInbound};
+    DeviceId device;
+    BlePayload payload;
+};
+
+//! @brief Microsecond clock used to timestamp and pace traces.
+using BleTraceClock = std::function<std::uint64_t()>;
+
+//! @brief Monotonic microseconds from std::chrono::steady_clock.
+std::uint64_t steady_clock_us();
+
+//! @brief Appends records to a capture file.
+//! @details The file is an 8-byte header ("JBTR", version, reserved) then
+//! one record per payload: time_us (u64), direction (u8), device (u32),
+//! length (u8) and the payload bytes, all little-endian. Writes are
+//! buffered by stdio; close() or flush() makes them visible.
+class BleTraceWriter {
+ public:
+    BleTraceWriter() = default;
+    ~BleTraceWriter() { close(); }
+    BleTraceWriter(const BleTraceWriter&) = delete;
+    BleTraceWriter& operator=(const BleTraceWriter&) = delete;
+
+    //! @brief Create or truncate @p path and write the header.
+    bool open(const char* path);
+
+    //! @brief Append one record.
+    bool write(std::uint64_t time_us, BleTraceDirection direction, DeviceId device, const BlePayload& payload);
+
+    //! @brief Push buffered records to the file.
+    bool flush();
+
+    //! @brief Flush and close.
+    void close();
+
+    //! @brief Records written since open().
+    std::uint64_t records_written() const { return records_; }
+
+ private:
+    std::FILE* file_{nullptr};
+    std::uint64_t records_{0};
+};
+
+//! @brief Reads a capture file record by record.
+class BleTraceReader {
+ public:
+    BleTraceReader() = default;
+    ~BleTraceReader() { close(); }
+    BleTraceReader(const BleTraceReader&) = delete;
+    BleTraceReader& operator=(const BleTraceReader&) = delete;
+
+    //! @brief Open @p path and check its header.
+    bool open(const char* path);
+
+    //! @brief Read the next record.
+    //! @return false at the end of the file or on a truncated record.
+    bool next(BleTraceRecord& out);
+
+    void close();
+
+ private:
+    std::FILE* file_{nullptr};
+};
+
+//! @brief Read a whole capture into memory, e.g. for ReplayBleDriver.
+bool load_ble_trace(const char* path, std::vector<BleTraceRecord>& out);
+
+}  // namespace jenlib::ble
+
+#endif  // !ARDUINO && !ESP_PLATFORM
+
+#endif  // INCLUDE_JENLIB_BLE_BLETRACE_H_
@@ -0,0 +1,163 @@
+//! @file include/jenlib/ble/Health.h
+//! @brief Delta coding of sensor health heartbeats and fleet-wide aggregation.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_BLE_HEALTH_H_
+#define INCLUDE_JENLIB_BLE_HEALTH_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "jenlib/ble/Ids.h"
+#include "jenlib/ble/Messages.h"
+#include "jenlib/ble/Payload.h"
+
+namespace jenlib::ble {
+
+//! @brief Sensor side: turns successive counter samples into HealthMsg heartbeats.
+//! @details
+//! The first heartbeat, every keyframe_interval-th one after it and the one
+//! after request_keyframe() carry absolute values. The rest carry the
+//! difference to the previous heartbeat. A lost delta leaves the receiver
+//! unsynchronised until the next keyframe, so the interval bounds how long a
+//! single loss hides the sensor's health.
+//!
+//! @par Usage Example:
+//! @code
+//! jenlib::ble::HealthEncoder encoder;
+//! // every 10 s
+//! sensor.broadcast_health(encoder.next(sensor_id, jenlib::state::sample_health(sources, Time::now())));
+//! @endcode
+class HealthEncoder {
+ public:
+    //! @brief Heartbeats per keyframe unless configured otherwise.
+    static constexpr std::uint8_t kDefaultKeyframeInterval = 8;
+
+    //! @brief Constructor.
+    //! @param keyframe_interval Heartbeats per keyframe; 0 or 1 sends only keyframes.
+    explicit HealthEncoder(std::uint8_t keyframe_interval = kDefaultKeyframeInterval)
+        : keyframe_interval_(keyframe_interval) {}
+
+    //! @brief Build the next heartbeat for @p sample and remember it as the new base.
+    HealthMsg next(DeviceId sender_id, const HealthCounters& sample);
+
+    //! @brief Make the next heartbeat a keyframe.
+    void request_keyframe() { since_keyframe_ = 0; }
+
+ private:
+    HealthCounters previous_{};
+    std::uint8_t keyframe_interval_;
+    std::uint8_t sequence_{0};
+    std::uint8_t since_keyframe_{0};  //!< Heartbeats since the last keyframe; 0 forces one
+};
+
+//! @brief Receiver side: rebuilds one sensor's absolute counters from its heartbeats.
+//! @details A rebooted sensor starts over at sequence 0 with a keyframe. A
+//! keyframe whose uptime is below the last known one is taken as such a
+//! restart: it becomes the new baseline and the sequence jump is not counted
+//! as lost heartbeats.
+class HealthDecoder {
+ public:
+    //! @brief Apply a heartbeat.
+    //! @return true if values() now reflects @p msg; false for a repeated
+    //!         heartbeat or a delta that arrived while unsynchronised.
+    bool apply(const HealthMsg& msg);
+
+    //! @brief Forget all state; the next keyframe synchronises again.
+    void reset() { *this = HealthDecoder{}; }
+
+    //! @brief Latest absolute counters (valid once synced() has been true).
+    const HealthCounters& values() const { return values_; }
+
+    //! @brief Whether values() is current, i.e. no delta was lost since the last keyframe.
+    bool synced() const { return synced_; }
+
+    //! @brief Heartbeats applied.
+    std::uint32_t heartbeats() const { return heartbeats_; }
+
+    //! @brief Heartbeats missing from the sequence numbers.
+    std::uint32_t lost() const { return lost_; }
+
+    //! @brief Times a lost delta dropped synchronisation.
+    std::uint32_t resyncs() const { return resyncs_; }
+
+    //! @brief Sensor restarts detected from a keyframe's lower uptime.
+    std::uint32_t restarts() const { return restarts_; }
+
+ private:
+    HealthCounters values_{};
+    std::uint8_t last_sequence_{0};
+    bool seen_{false};
+    bool synced_{false};
+    std::uint32_t heartbeats_{0};
+    std::uint32_t lost_{0};
+    std::uint32_t resyncs_{0};
+    std::uint32_t restarts_{0};
+};
+
+//! @brief Fleet-wide view of sensor health at the broker.
+//! @details Totals cover synced sensors that are not stale; a stale sensor
+//! is one not heard from within the caller's threshold.
+struct FleetHealthSummary {
+    std::uint32_t sensors{0};          //!< Sensors tracked
+    std::uint32_t stale{0};            //!< Not heard from within the threshold
+    std::uint32_t unsynced{0};         //!< Waiting for a keyframe
+    std::uint64_t event_evictions{0};  //!< Sum over reporting sensors
+    std::uint64_t inbox_drops{0};      //!< Sum over reporting sensors
+    std::uint64_t loop_overruns{0};    //!< Sum over reporting sensors
+    std::uint32_t heartbeats_lost{0};  //!< Sum of HealthDecoder::lost()
+    std::uint32_t restarts{0};         //!< Sum of HealthDecoder::restarts()
+    std::uint16_t max_retention_permille{0};  //!< Fullest retention buffer
+    DeviceId fullest_sensor{0};               //!< Sensor with max_retention_permille
+    std::uint16_t min_battery_mv{0};          //!< Lowest battery (0 if none reported)
+    DeviceId weakest_sensor{0};               //!< Sensor with min_battery_mv
+};
+
+//! @brief Broker side: one HealthDecoder per sensor, plus a fleet summary.
+class FleetHealth {
+ public:
+    //! @brief Maximum sensors tracked.
+    static constexpr std::size_t kMaxSensors = 32;
+
+    //! @brief Apply a heartbeat from the sensor named in it.
+    //! @return false if the sensor table is full or the decoder rejected it.
+    bool add(const HealthMsg& msg, std::uint32_t now_ms);
+
+    //! @brief Apply a raw payload if it is a Health message (a sender shim is skipped).
+    //! @return false if the payload is not a valid heartbeat or was rejected.
+    bool add(const BlePayload& payload, std::uint32_t now_ms);
+
+    //! @brief Decoder of a sensor, or nullptr if it never reported.
+    const HealthDecoder* sensor(DeviceId id) const;
+
+    //! @brief Time a sensor's last heartbeat arrived, or 0 if it never reported.
+    std::uint32_t last_seen_ms(DeviceId id) const;
+
+    //! @brief Stop tracking a sensor.
+    //! @return false if it was not tracked.
+    bool forget(DeviceId id);
+
+    //! @brief Number of sensors tracked.
+    std::size_t size() const;
+
+    //! @brief Aggregate the fleet as of @p now_ms.
+    FleetHealthSummary summary(std::uint32_t now_ms, std::uint32_t stale_after_ms) const;
+
+ private:
+    struct Entry {
+        DeviceId id;
+        bool active{false};
+        std::uint32_t last_seen_ms{0};
+        HealthDecoder decoder;
+    };
+
+    Entry* find(DeviceId id);
+    const Entry* find(DeviceId id) const;
+
+    std::array<Entry, kMaxSensors> entries_{};
+};
+
+}  // namespace jenlib::ble
+
+#endif  // INCLUDE_JENLIB_BLE_HEALTH_H_
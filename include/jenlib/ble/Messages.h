@@ -6,6 +6,7 @@
 #ifndef INCLUDE_JENLIB_BLE_MESSAGES_H_
 #define INCLUDE_JENLIB_BLE_MESSAGES_H_
 
+#include <cstddef>
 #include <cstdint>
 #include "jenlib/ble/Payload.h"
 #include "jenlib/ble/Ids.h"
@@ -23,6 +24,8 @@ enum class MessageType : std::uint8_t {
     StartBroadcast = 0x01,
     Reading        = 0x02,
     Receipt        = 0x03,
+    SamplingConfig = 0x04,
+    Health         = 0x05,
 };
 
 //! @brief Broker to Sensor command to begin a measurement session.
@@ -36,6 +39,8 @@ struct StartBroadcastMsg {
 
     static bool serialize(const StartBroadcastMsg &msg, BlePayload &out);
     static bool deserialize(const BlePayload &buf, StartBroadcastMsg &out);
+    //! @brief Parse the bytes in [first, last), e.g. a received payload past the sender shim.
+    static bool deserialize(BlePayload::const_iterator first, BlePayload::const_iterator last, StartBroadcastMsg &out);
 };
 
 //! @brief Sensor to Broker measurement payload.
@@ -52,6 +57,8 @@ struct ReadingMsg {
 
     static bool serialize(const ReadingMsg &msg, BlePayload &out);
     static bool deserialize(const BlePayload &buf, ReadingMsg &out);
+    //! @brief Parse the bytes in [first, last), e.g. a received payload past the sender shim.
+    static bool deserialize(BlePayload::const_iterator first, BlePayload::const_iterator last, ReadingMsg &out);
 };
 
 //! @brief Broker to Sensor acknowledgement of received readings.
@@ -64,6 +71,65 @@ struct ReceiptMsg {
 
     static bool serialize(const ReceiptMsg &msg, BlePayload &out);
     static bool deserialize(const BlePayload &buf, ReceiptMsg &out);
+    //! @brief Parse the bytes in [first, last), e.g. a received payload past the sender shim.
+    static bool deserialize(BlePayload::const_iterator first, BlePayload::const_iterator last, ReceiptMsg &out);
+};
+
+//! @brief Broker to Sensor bounds for adaptive sampling.
+//!
+//! Sensors that adapt their measurement interval keep it within
+//! ["min_interval_ms", "max_interval_ms"]. A sensor accepts the bounds while
+//! waiting for a session, or while running the matching "SessionId".
+struct SamplingConfigMsg {
+    SessionId session_id;            //!<  session identifier
+    std::uint32_t min_interval_ms;   //!<  shortest interval the sensor may use
+    std::uint32_t max_interval_ms;   //!<  longest interval the sensor may use
+
+    static bool serialize(const SamplingConfigMsg &msg, BlePayload &out);
+    static bool deserialize(const BlePayload &buf, SamplingConfigMsg &out);
+    //! @brief Parse the bytes in [first, last), e.g. a received payload past the sender shim.
+    static bool deserialize(BlePayload::const_iterator first, BlePayload::const_iterator last, SamplingConfigMsg &out);
+};
+
+//! @brief Internal pressure counters a sensor reports in its heartbeat.
+//!
+//! Counters only grow (and wrap at 2^32); gauges move both ways. Retention is
+//! the fill of the on-device reading buffer in permille (0..1000) and battery
+//! is in millivolts, so every field stays an integer.
+struct HealthCounters {
+    std::uint32_t uptime_s{0};            //!<  seconds since boot
+    std::uint32_t event_evictions{0};     //!<  events evicted from a full queue
+    std::uint32_t inbox_drops{0};         //!<  BLE payloads dropped by a full inbox
+    std::uint32_t loop_overruns{0};       //!<  timer periods missed by a late loop
+    std::uint16_t retention_permille{0};  //!<  retention buffer fill (0..1000)
+    std::uint16_t battery_mv{0};          //!<  battery voltage in millivolts
+
+    static constexpr std::size_t kFieldCount = 6;  //!<  fields on the wire
+};
+
+//! @brief Sensor to Broker periodic health heartbeat.
+//!
+//! A keyframe carries absolute values; any other heartbeat carries the
+//! difference to the previous one (modulo the field width), so a quiet sensor
+//! sends little more than its id. "sequence" increments per heartbeat and lets
+//! the receiver notice a lost delta and wait for the next keyframe. Build and
+//! apply these with HealthEncoder and HealthDecoder (jenlib/ble/Health.h).
+//!
+//! Layout after the type and id: sequence, a flags byte (bit 7 keyframe, bit i
+//! set when field i is nonzero), then one LEB128 varint per nonzero field.
+//! Gauge deltas are zigzag-encoded 16-bit differences.
+struct HealthMsg {
+    DeviceId sender_id;         //!<  sensor id
+    std::uint8_t sequence{0};   //!<  heartbeat number, wraps at 256
+    bool keyframe{false};       //!<  true when "values" are absolute
+    HealthCounters values;      //!<  absolute values or per-field differences
+
+    static constexpr std::size_t kMaxSize = 1 + 5 + 2 + 4 * 5 + 2 * 3;  //!<  worst-case wire size
+
+    static bool serialize(const HealthMsg &msg, BlePayload &out);
+    static bool deserialize(const BlePayload &buf, HealthMsg &out);
+    //! @brief Parse the bytes in [first, last), e.g. a received payload past the sender shim.
+    static bool deserialize(BlePayload::const_iterator first, BlePayload::const_iterator last, HealthMsg &out);
 };
 
 }  //  namespace jenlib::ble
@@ -0,0 +1,190 @@
+//! @file include/jenlib/ble/MultiRadioBroker.h
+//! @brief Broker facade that spreads sensors across several BLE drivers.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_BLE_MULTIRADIOBROKER_H_
+#define INCLUDE_JENLIB_BLE_MULTIRADIOBROKER_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "jenlib/ble/BleDriver.h"
+#include "jenlib/ble/Health.h"
+#include "jenlib/ble/Ids.h"
+#include "jenlib/ble/Messages.h"
+#include "jenlib/measurement/LinkQuality.h"
+#include "jenlib/time/Time.h"
+
+namespace jenlib::ble {
+
+//! @brief Broker that balances sensors across several radios and merges what they hear.
+//! @details
+//! Each sensor is pinned to one radio: the least loaded one when the broker
+//! first sends it a StartBroadcast, or the one it was heard on if it speaks
+//! first. Later start and receipt messages for that sensor go out on the same
+//! radio. If a sensor is heard on a different radio it moves there, so
+//! receipts follow it.
+//!
+//! The callbacks passed to configure_callbacks() are installed on every
+//! radio, so readings from all radios arrive as one stream. process_events()
+//! polls the radios in turn on the calling thread. Callbacks therefore never
+//! run concurrently, as long as each driver dispatches from poll().
+//!
+//! Each sensor's readings also feed a LinkQuality for its current session,
+//! reset whenever the sensor's readings carry a new session id. Arrival
+//! times come from jenlib::time::Time::now(). link_quality() exposes the
+//! counters so receipt, retransmission and radio assignment policies can
+//! use the measured loss and jitter. Each sensor is scored on its own grid:
+//! the broker-wide expected interval by default, its longest interval once
+//! send_sampling_config() has bounded it, and its heartbeat once
+//! set_send_on_delta() says it suppresses unchanged readings.
+//!
+//! Health heartbeats arrive through the generic callback. When one is
+//! configured, the broker feeds every Health message into fleet_health()
+//! before passing the payload on; brokers that drain radios with receive()
+//! call record_health() themselves.
+//!
+//! @par Usage Example:
+//! @code
+//! jenlib::ble::NativeBleDriver radio_a(jenlib::ble::DeviceId(0));
+//! jenlib::ble::NativeBleDriver radio_b(jenlib::ble::DeviceId(0));
+//! jenlib::ble::MultiRadioBroker broker;
+//! broker.add_radio(radio_a);
+//! broker.add_radio(radio_b);
+//! jenlib::ble::BleCallbacks callbacks;
+//! callbacks.on_reading = store_reading;
+//! broker.configure_callbacks(callbacks);
+//! broker.begin();
+//! broker.send_start(sensor_id, start_msg);  // Picks the radio with fewer sensors
+//! while (running) {
+//!     broker.process_events();
+//! }
+//! @endcode
+class MultiRadioBroker {
+ public:
+    //! @brief Maximum radios one broker drives.
+    static constexpr std::size_t kMaxRadios = 4;
+
+    //! @brief Maximum sensors tracked across all radios.
+    static constexpr std::size_t kMaxSensors = 32;
+
+    //! @brief Radio index returned for a sensor with no radio.
+    static constexpr std::size_t kNoRadio = kMaxRadios;
+
+    MultiRadioBroker() = default;
+    MultiRadioBroker(const MultiRadioBroker&) = delete;  // Radios hold callbacks bound to this instance
+    MultiRadioBroker& operator=(const MultiRadioBroker&) = delete;
+
+    //! @brief Add a radio; it must outlive the broker.
+    //! @return false if kMaxRadios are already in use.
+    bool add_radio(BleDriver& radio);
+
+    //! @brief Number of radios added.
+    std::size_t radio_count() const { return radio_count_; }
+
+    //! @brief Radio by index, or nullptr if out of range.
+    BleDriver* radio(std::size_t index) const { return index < radio_count_ ? radios_[index] : nullptr; }
+
+    //! @brief Begin every radio.
+    //! @return true if all radios started.
+    bool begin();
+
+    //! @brief End every radio.
+    void end();
+
+    //! @brief Install the callbacks on every radio.
+    void configure_callbacks(const BleCallbacks& cbs);
+
+    //! @brief Command a sensor to start broadcasting, assigning it a radio if it has none.
+    //! @return false if there is no radio or the sensor table is full.
+    bool send_start(DeviceId sensor, const StartBroadcastMsg& msg);
+
+    //! @brief Acknowledge readings on the radio the sensor is assigned to.
+    //! @return false if the sensor has no radio.
+    bool send_receipt(DeviceId sensor, const ReceiptMsg& msg);
+
+    //! @brief Send adaptive sampling bounds on the radio the sensor is assigned to.
+    //! @details The sensor's link quality is scored from then on with at least
+    //! one reading per max_interval_ms.
+    //! @return false if the sensor has no radio.
+    bool send_sampling_config(DeviceId sensor, const SamplingConfigMsg& msg);
+
+    //! @brief Forget a sensor so its radio slot can be reused.
+    //! @return false if the sensor was not assigned.
+    bool release(DeviceId sensor);
+
+    //! @brief Radio index a sensor is assigned to, or kNoRadio.
+    std::size_t radio_for(DeviceId sensor) const;
+
+    //! @brief Sensors assigned to a radio.
+    std::size_t sensor_count(std::size_t radio) const;
+
+    //! @brief Readings received on a radio since it was added.
+    std::uint32_t readings_received(std::size_t radio) const { return radio < kMaxRadios ? readings_[radio] : 0; }
+
+    //! @brief Link quality of a sensor's current session, or nullptr if the sensor is not assigned.
+    const jenlib::measurement::LinkQuality* link_quality(DeviceId sensor) const;
+
+    //! @brief Sampling interval assumed for sensors' link quality (default 1000 ms).
+    //! @details Applies from their newest reading on to tracked sensors on a fixed
+    //! cadence, and to sensors added later.
+    void set_expected_interval_ms(std::uint32_t interval_ms);
+
+    //! @brief Tell link tracking whether @p sensor reports on delta.
+    //! @details Suppressed readings are not lost: while enabled, the sensor is
+    //! scored on slots of @p max_silence_ms, its heartbeat. A heartbeat of 0
+    //! promises nothing, so loss is not tracked.
+    //! @return false if the sensor is not assigned.
+    bool set_send_on_delta(DeviceId sensor, bool enabled, std::uint32_t max_silence_ms = 0);
+
+    //! @brief Health heartbeats from all radios, per sensor and as a fleet summary.
+    const FleetHealth& fleet_health() const { return fleet_health_; }
+
+    //! @brief Feed a received payload to fleet_health() if it is a Health message.
+    //! @return true if it was a heartbeat the fleet view accepted.
+    bool record_health(const BlePayload& payload) { return fleet_health_.add(payload, jenlib::time::Time::now()); }
+
+    //! @brief Poll every radio once.
+    void process_events();
+
+ private:
+    struct Assignment {
+        DeviceId sensor;
+        std::uint8_t radio{0};
+        bool active{false};
+        SessionId session;
+        jenlib::measurement::LinkQuality link;
+        std::uint32_t sampling_max_ms{0};  // Longest adaptive interval; 0 while the sensor samples at a fixed rate
+        std::uint32_t heartbeat_ms{0};     // Send-on-delta heartbeat, used while send_on_delta is set
+        bool send_on_delta{false};
+    };
+
+    //! @brief Wrap the user callbacks for one radio so readings are counted and sensors learned.
+    void install_callbacks(std::size_t radio);
+
+    //! @brief Record that @p sensor is reachable on @p radio.
+    //! @return The sensor's entry, or nullptr if the sensor table is full.
+    Assignment* assign(DeviceId sensor, std::size_t radio);
+
+    //! @brief Point a sensor's link quality at the grid its reporting mode guarantees.
+    void update_link_cadence(Assignment& entry);
+
+    //! @brief Radio with the fewest sensors (lowest index on ties).
+    std::size_t least_loaded_radio() const;
+
+    Assignment* find(DeviceId sensor);
+    const Assignment* find(DeviceId sensor) const;
+
+    std::array<BleDriver*, kMaxRadios> radios_{};
+    std::size_t radio_count_{0};
+    std::array<Assignment, kMaxSensors> assignments_{};
+    std::array<std::uint32_t, kMaxRadios> readings_{};
+    BleCallbacks callbacks_{};
+    std::uint32_t expected_interval_ms_{1000};
+    FleetHealth fleet_health_{};
+};
+
+}  // namespace jenlib::ble
+
+#endif  // INCLUDE_JENLIB_BLE_MULTIRADIOBROKER_H_
@@ -16,6 +16,11 @@ namespace jenlib::ble {
 //! @details Chosen to fit typical ATT MTU values while leaving headroom.
 constexpr std::size_t kMaxPayload = 64u;
 
+//! @brief First byte of a payload that carries the native driver's sender shim.
+constexpr std::uint8_t kSenderIdMarker = 0xFF;
+//! @brief Shim length: the marker plus the 4-byte LE sender id.
+constexpr std::size_t kSenderHeaderSize = 5u;
+
 //! @brief Fixed-size buffer with helpers for LE encoding/decoding.
 struct BlePayload {
     std::array<std::uint8_t, kMaxPayload> bytes{};
@@ -165,6 +170,12 @@ inline bool read_i16le(BlePayload::const_iterator &it, BlePayload::const_iterato
     return true;
 }
 
+//! @brief Index of the message type byte, skipping a sender shim if present.
+//! @details Message types start at 0x01, so the marker never opens a message itself.
+inline std::size_t message_offset(const BlePayload &p) {
+    return (p.size > kSenderHeaderSize && p.bytes[0] == kSenderIdMarker) ? kSenderHeaderSize : 0u;
+}
+
 }  //  namespace jenlib::ble
 
 
@@ -8,6 +8,7 @@
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <utility>
 #include "jenlib/ble/Payload.h"
 
@@ -21,10 +22,12 @@ struct PayloadBuffer {
     iterator write_it = payloads.begin();
     iterator read_it = payloads.begin();
     std::size_t count = 0;
+    std::uint32_t dropped = 0;  //!< Pushes refused because the buffer was full (wraps)
 
-    //! @brief Push a payload into the buffer; returns false if full.
+    //! @brief Push a payload into the buffer; returns false (and counts a drop) if full.
     bool push(BlePayload payload) {
         if (full()) {
+            ++dropped;
             return false;
         }
         *write_it = std::move(payload);
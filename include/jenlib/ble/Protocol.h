@@ -29,7 +29,8 @@ enum class Role : std::uint8_t {
 enum class OpCode : std::uint8_t {
     StartBroadcast = 0x01,  //!< Broker→Sensor: start a session
     Reading        = 0x02,  //!< Sensor→Broker: a measurement reading
-    Receipt        = 0x03   //!< Broker→Sensor: receipt/ack for readings
+    Receipt        = 0x03,  //!< Broker→Sensor: receipt/ack for readings
+    SamplingConfig = 0x04   //!< Broker→Sensor: adaptive sampling interval bounds
 };
 
 //! @namespace jenlib::ble::protocol::limits
@@ -61,6 +62,7 @@ namespace jenlib::ble::protocol::contract {
 inline constexpr bool kStartBroadcastBrokerToSensor = true;
 inline constexpr bool kReadingSensorToBroker = true;
 inline constexpr bool kReceiptBrokerToSensor = true;
+inline constexpr bool kSamplingConfigBrokerToSensor = true;
 }
 
 }  // namespace jenlib::ble::protocol
@@ -34,6 +34,7 @@
 //!     .on_start = callback_start,
 //!     .on_receipt = callback_receipt,
 //!     .on_generic = callback_generic,
+//!     .on_sampling_config = callback_sampling_config,
 //! });
 //!
 //! // Start BLE and process events
@@ -75,63 +76,94 @@
 namespace jenlib::ble {
 
 //! @brief Simple Sensor application facade.
+//! @details Uses the driver set with BLE::set_driver unless bound to one at construction.
 class Sensor {
  public:
-    explicit Sensor(DeviceId self_id) : self_id_(self_id) {}
+    //! @param self_id Identity this sensor broadcasts as.
+    //! @param driver Radio to use; nullptr follows BLE::driver().
+    explicit Sensor(DeviceId self_id, BleDriver* driver = nullptr) : self_id_(self_id), driver_(driver) {}
 
     //! @brief Start BLE (forwards to driver).
-    bool begin() { return BLE::begin(); }
+    bool begin() { return driver() ? driver()->begin() : false; }
 
     //! @brief Stop BLE (forwards to driver).
-    void end() { BLE::end(); }
+    void end() { if (driver()) driver()->end(); }
 
     //! @brief Configure callbacks once.
     void configure_callbacks(const BleCallbacks& cbs) {
-        if (cbs.on_connection) BLE::set_connection_callback(cbs.on_connection);
-        if (cbs.on_start) BLE::set_start_broadcast_callback(cbs.on_start);
-        if (cbs.on_receipt) BLE::set_receipt_callback(cbs.on_receipt);
-        if (cbs.on_generic) BLE::set_message_callback(cbs.on_generic);
+        BleDriver* radio = driver();
+        if (!radio) return;
+        if (cbs.on_connection) radio->set_connection_callback(cbs.on_connection);
+        if (cbs.on_start) radio->set_start_broadcast_callback(cbs.on_start);
+        if (cbs.on_receipt) radio->set_receipt_callback(cbs.on_receipt);
+        if (cbs.on_sampling_config) radio->set_sampling_config_callback(cbs.on_sampling_config);
+        if (cbs.on_generic) radio->set_message_callback(cbs.on_generic);
         // Reading callback is typically not used on sensors (incoming), so omitted intentionally
     }
 
     //! @brief Broadcast a reading.
     void broadcast_reading(const ReadingMsg& msg) {
-        BLE::broadcast_reading(self_id_, msg);
+        BLE::broadcast_reading(driver(), self_id_, msg);
+    }
+
+    //! @brief Broadcast a health heartbeat.
+    void broadcast_health(const HealthMsg& msg) {
+        BLE::broadcast_health(driver(), self_id_, msg);
     }
 
     //! @brief Process events (call in loop).
-    void process_events() { BLE::process_events(); }
+    void process_events() { if (driver()) driver()->poll(); }
+
+    //! @brief The driver in use: the bound one, else BLE::driver().
+    BleDriver* driver() const { return driver_ ? driver_ : BLE::driver(); }
 
  private:
     DeviceId self_id_;
+    BleDriver* driver_;
 };
 
 //! @brief Simple Broker application facade.
+//! @details Uses the driver set with BLE::set_driver unless bound to one at construction.
+//! @see MultiRadioBroker for a broker spread across several radios
 class Broker {
  public:
-    Broker() = default;
+    //! @param driver Radio to use; nullptr follows BLE::driver().
+    explicit Broker(BleDriver* driver = nullptr) : driver_(driver) {}
 
-    bool begin() { return BLE::begin(); }
-    void end() { BLE::end(); }
+    bool begin() { return driver() ? driver()->begin() : false; }
+    void end() { if (driver()) driver()->end(); }
 
     void configure_callbacks(const BleCallbacks& cbs) {
-        if (cbs.on_connection) BLE::set_connection_callback(cbs.on_connection);
-        if (cbs.on_reading) BLE::set_reading_callback(cbs.on_reading);
-        if (cbs.on_generic) BLE::set_message_callback(cbs.on_generic);
+        BleDriver* radio = driver();
+        if (!radio) return;
+        if (cbs.on_connection) radio->set_connection_callback(cbs.on_connection);
+        if (cbs.on_reading) radio->set_reading_callback(cbs.on_reading);
+        if (cbs.on_generic) radio->set_message_callback(cbs.on_generic);
         // Start/Receipt are typically outgoing for broker; omit to reduce confusion
     }
 
     //! @brief Command a sensor to start broadcasting (assigns a session).
     void send_start(DeviceId sensor, const StartBroadcastMsg& msg) {
-        BLE::send_start(sensor, msg);
+        BLE::send_start(driver(), sensor, msg);
     }
 
     //! @brief Acknowledge received readings up to an offset in a session.
     void send_receipt(DeviceId sensor, const ReceiptMsg& msg) {
-        BLE::send_receipt(sensor, msg);
+        BLE::send_receipt(driver(), sensor, msg);
+    }
+
+    //! @brief Send adaptive sampling interval bounds to a sensor.
+    void send_sampling_config(DeviceId sensor, const SamplingConfigMsg& msg) {
+        BLE::send_sampling_config(driver(), sensor, msg);
     }
 
-    void process_events() { BLE::process_events(); }
+    void process_events() { if (driver()) driver()->poll(); }
+
+    //! @brief The driver in use: the bound one, else BLE::driver().
+    BleDriver* driver() const { return driver_ ? driver_ : BLE::driver(); }
+
+ private:
+    BleDriver* driver_;
 };
 
 }  // namespace jenlib::ble
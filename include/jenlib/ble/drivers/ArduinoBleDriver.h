@@ -74,6 +74,9 @@ class ArduinoBleDriver : public BleDriver {
     //! @pre Driver initialized. Call regularly in main loop.
     void poll() override;
 
+    //! @brief Payloads dropped because the receive buffer was full.
+    std::uint32_t inbox_drops() const override { return received_payloads_.dropped; }
+
     //! @brief Set callback function for received messages.
     //! @param callback Function to call when a message is received.
     //! @pre Driver initialized.
@@ -98,6 +101,11 @@ class ArduinoBleDriver : public BleDriver {
     //! @pre Driver initialized.
     void set_receipt_callback(ReceiptCallback callback) override;
 
+    //! @brief Set callback function for SamplingConfig messages.
+    //! @param callback Function to call when a SamplingConfig message is received.
+    //! @pre Driver initialized.
+    void set_sampling_config_callback(SamplingConfigCallback callback) override;
+
     //! @brief Remove all type-specific callbacks.
     //! @pre Driver initialized.
     void clear_type_specific_callbacks() override;
@@ -165,6 +173,7 @@ class ArduinoBleDriver : public BleDriver {
     StartBroadcastCallback start_broadcast_callback_;  //!<  Callback for StartBroadcast messages.
     ReadingCallback reading_callback_;  //!<  Callback for Reading messages.
     ReceiptCallback receipt_callback_;  //!<  Callback for Receipt messages.
+    SamplingConfigCallback sampling_config_callback_;  //!<  Callback for SamplingConfig messages.
     ConnectionCallback connection_callback_;  //!<  Callback for connection state changes.
 
     // ArduinoBLE service/characteristics are defined as function-local statics in the .cpp.
@@ -58,6 +58,9 @@ class EspIdfBleDriver : public BleDriver {
     //! @brief Poll for BLE events.
     void poll() override;
 
+    //! @brief Payloads dropped because the receive buffer was full.
+    std::uint32_t inbox_drops() const override { return received_payloads_.dropped; }
+
     //! @brief Set generic message callback.
     void set_message_callback(BleMessageCallback callback) override;
 
@@ -73,6 +76,9 @@ class EspIdfBleDriver : public BleDriver {
     //! @brief Set receipt callback.
     void set_receipt_callback(ReceiptCallback callback) override;
 
+    //! @brief Set sampling config callback.
+    void set_sampling_config_callback(SamplingConfigCallback callback) override;
+
     //! @brief Clear all type-specific callbacks.
     void clear_type_specific_callbacks() override;
 
@@ -99,6 +105,7 @@ class EspIdfBleDriver : public BleDriver {
     StartBroadcastCallback start_broadcast_callback_;
     ReadingCallback reading_callback_;
     ReceiptCallback receipt_callback_;
+    SamplingConfigCallback sampling_config_callback_;
     ConnectionCallback connection_callback_;
 
     // ESP-IDF BLE specific
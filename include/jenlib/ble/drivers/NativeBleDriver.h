@@ -0,0 +1,131 @@
+//! @file include/jenlib/ble/drivers/NativeBleDriver.h
+//! @brief Native (container-friendly) BLE driver using in-memory queues (UDP-like).
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_BLE_DRIVERS_NATIVEBLEDRIVER_H_
+#define INCLUDE_JENLIB_BLE_DRIVERS_NATIVEBLEDRIVER_H_
+
+#if !defined(ARDUINO) && !defined(ESP_PLATFORM)
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include "jenlib/ble/BleDriver.h"
+#include "jenlib/ble/Ids.h"
+#include "jenlib/ble/Payload.h"
+
+namespace jenlib::ble {
+
+class ShmBleTransport;
+
+//! @class NativeBleDriver
+//! @brief Native BLE driver implementation.
+//! @details Uses in-memory queues for broadcast and point-to-point messaging.
+//! Queues are bounded to prevent memory exhaustion in resource-constrained environments.
+//! When queues are full, oldest messages are dropped to maintain system stability.
+//!
+//! With a ShmBleTransport attached (Linux only), outgoing messages go to the
+//! destination's ring in shared memory instead, so drivers in different
+//! processes on the same host can talk to each other. poll() then drains this
+//! device's ring and dispatches each message in place.
+class NativeBleDriver : public BleDriver {
+ public:
+    //! @brief Constructor.
+    //! @param local_device_id Local device identifier for this instance.
+    explicit NativeBleDriver(DeviceId local_device_id) : local_device_id_(local_device_id), initialized_(false) {}
+
+    //! @brief Initialize the BLE driver and establish connections (Arduino-friendly).
+    //! @return true if initialization succeeded, false otherwise.
+    bool begin() override;
+
+    //! @brief Cleanup BLE driver resources and close connections (Arduino-friendly).
+    void end() override;
+
+    //! @brief Check if the driver is connected and ready for communication.
+    //! @return true if connected and ready, false otherwise.
+    bool is_connected() const override { return initialized_; }
+
+    //! @brief Get the local device identifier for this driver instance.
+    //! @return The device ID that identifies this driver instance.
+    DeviceId get_local_device_id() const override { return local_device_id_; }
+
+    void advertise(DeviceId device_id, BlePayload payload) override;
+    void send_to(DeviceId device_id, BlePayload payload) override;
+    bool receive(DeviceId self_id, BlePayload &out_payload) override;
+
+    //! @brief Dispatch messages waiting in the shared-memory ring, if a transport is attached.
+    //! @details Without a transport, messages are delivered as they are sent and this is a no-op.
+    void poll() override;
+
+    //! @brief Dispatch at most @p max_messages from the shared-memory ring; the rest stay in the ring.
+    std::size_t poll_limited(std::size_t max_messages) override;
+
+    std::size_t inbox_depth(DeviceId self_id) override;
+
+    //! @brief Oldest messages dropped from full inboxes, plus sends refused by a full shared-memory ring.
+    std::uint32_t inbox_drops() const override { return inbox_drops_.load(std::memory_order_relaxed); }
+
+    void set_message_callback(BleMessageCallback callback) override { message_callback_ = std::move(callback); }
+    void clear_message_callback() override { message_callback_ = nullptr; }
+    void set_start_broadcast_callback(StartBroadcastCallback callback) override {
+        start_broadcast_callback_ = std::move(callback);
+    }
+    void set_reading_callback(ReadingCallback callback) override { reading_callback_ = std::move(callback); }
+    void set_receipt_callback(ReceiptCallback callback) override { receipt_callback_ = std::move(callback); }
+    void set_sampling_config_callback(SamplingConfigCallback callback) override {
+        sampling_config_callback_ = std::move(callback);
+    }
+    void clear_type_specific_callbacks() override;
+    void set_connection_callback(ConnectionCallback callback) override {
+        connection_callback_ = std::move(callback);
+    }
+    void clear_connection_callback() override { connection_callback_ = nullptr; }
+
+    //! @brief Route messages through shared memory instead of in-process queues.
+    //! @param transport Open transport that outlives the driver, or nullptr to detach.
+    void set_transport(ShmBleTransport* transport) noexcept { transport_ = transport; }
+
+ private:
+    //! @brief Append the sender shim header and then @p payload to @p out.
+    //! @return false if the result does not fit in a payload.
+    static bool append_with_sender(BlePayload& out, DeviceId sender_id, const BlePayload& payload);
+
+    //! @brief Send a payload towards a destination device.
+    //! @post With a transport the payload is in the destination's ring; otherwise it was delivered locally.
+    void enqueue(DeviceId dest, BlePayload payload);
+
+    //! @brief Hand a received payload to callbacks, or queue it for receive().
+    //! @note Swallows exceptions on the queue operations.
+    //!       I am willing to accept this as a failure mode for BLE which is
+    //!       inherently unreliable.
+    void deliver(DeviceId dest, const BlePayload& payload);
+
+    //! @brief Extract sender ID from payload if it contains the sender marker.
+    static DeviceId extract_sender_id(const BlePayload& payload);
+
+    //! @brief Try to handle the message in [first, last) with type-specific callbacks.
+    bool try_type_specific_callbacks(DeviceId sender_id, BlePayload::const_iterator first,
+                                     BlePayload::const_iterator last);
+
+    DeviceId local_device_id_;  //!< Local device identifier.
+    bool initialized_;  //!< Initialization state.
+    ShmBleTransport* transport_{nullptr};  //!< Optional cross-process transport.
+    BleMessageCallback message_callback_;  //!< Callback for received messages.
+    StartBroadcastCallback start_broadcast_callback_;  //!< Callback for StartBroadcast messages.
+    ReadingCallback reading_callback_;  //!< Callback for Reading messages.
+    ReceiptCallback receipt_callback_;  //!< Callback for Receipt messages.
+    SamplingConfigCallback sampling_config_callback_;  //!< Callback for SamplingConfig messages.
+    ConnectionCallback connection_callback_;  //!< Callback for connection state changes.
+    std::unordered_map<std::uint32_t, std::deque<BlePayload>> inbox_;  //!< Inbox for received payloads.
+    std::mutex mutex_;  //!< Mutex for inbox.
+    std::atomic<std::uint32_t> inbox_drops_{0};  //!< Payloads dropped by full inboxes or rings.
+};
+
+}  // namespace jenlib::ble
+
+#endif  // !ARDUINO && !ESP_PLATFORM
+
+#endif  // INCLUDE_JENLIB_BLE_DRIVERS_NATIVEBLEDRIVER_H_
@@ -0,0 +1,148 @@
+//! @file include/jenlib/ble/drivers/ProfilingBleDriver.h
+//! @brief Decorator that counts the traffic of another BLE driver and times its callbacks.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_BLE_DRIVERS_PROFILINGBLEDRIVER_H_
+#define INCLUDE_JENLIB_BLE_DRIVERS_PROFILINGBLEDRIVER_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "jenlib/ble/BleDriver.h"
+#include "jenlib/ble/Messages.h"
+
+namespace jenlib::ble {
+
+//! @brief Microsecond clock used to time callbacks; wrap-around is fine.
+using ProfilingClock = std::uint32_t (*)();
+
+//! @brief Monotonic microseconds from the platform timer (esp_timer, micros() or steady_clock).
+std::uint32_t platform_clock_us();
+
+//! @brief Message and byte counts for one direction.
+struct BleTrafficCounters {
+    //! @brief Slots in by_type: 0 for unrecognised payloads, then one per MessageType value.
+    static constexpr std::size_t kTypeSlots = 6;
+
+    std::uint32_t messages{0};
+    std::uint64_t bytes{0};
+    std::array<std::uint32_t, kTypeSlots> by_type{};
+
+    //! @brief Messages of one type.
+    std::uint32_t count(MessageType type) const {
+        const auto slot = static_cast<std::size_t>(type);
+        return slot < kTypeSlots ? by_type[slot] : 0;
+    }
+};
+
+//! @brief Execution-time histogram for one callback kind.
+//! @details Bucket 0 counts calls under 1 us; bucket i counts [2^(i-1), 2^i) us
+//! and the last bucket everything from 2^(kBuckets-2) us (about 16 ms) up.
+struct BleCallbackTiming {
+    static constexpr std::size_t kBuckets = 16;
+
+    std::uint32_t calls{0};
+    std::uint64_t total_us{0};
+    std::uint32_t max_us{0};
+    std::array<std::uint32_t, kBuckets> histogram{};
+
+    //! @brief Record one call.
+    void add(std::uint32_t elapsed_us);
+
+    //! @brief Upper bound of the bucket holding the @p fraction quantile, in microseconds.
+    //! @return 0 without calls; max_us when the quantile falls in the last bucket.
+    std::uint32_t quantile_upper_us(float fraction) const;
+};
+
+//! @brief Everything ProfilingBleDriver has measured since construction or reset().
+struct BleProfileSnapshot {
+    //! @brief Slots in callbacks: one per BleCallbackKind, in declaration order.
+    static constexpr std::size_t kCallbackKinds = 6;
+
+    BleTrafficCounters outbound;  //!< advertise() and send_to()
+    BleTrafficCounters inbound;   //!< Delivered to callbacks or returned by receive()
+    std::array<BleCallbackTiming, kCallbackKinds> callbacks{};
+    BleCallbackTiming poll;       //!< Whole poll() calls, callbacks included
+    std::uint32_t inbox_depth{0};       //!< Depth at the last sample
+    std::uint32_t inbox_high_water{0};  //!< Deepest inbox sampled
+
+    //! @brief Timing of one callback kind.
+    const BleCallbackTiming& callback(BleCallbackKind kind) const {
+        return callbacks[static_cast<std::size_t>(kind)];
+    }
+};
+
+//! @class ProfilingBleDriver
+//! @brief Forwards every call to an inner driver while counting messages, bytes and callback time.
+//! @details
+//! Outbound and inbound traffic is counted per message type from the first
+//! payload byte; the native sender shim is skipped. Callbacks are wrapped so
+//! each call is timed into a log2 histogram. The inbox is sampled through
+//! BleDriver::inbox_depth() after every poll() (for the local device) and on
+//! every receive() (for the polled device), so the high-water mark reflects
+//! the deepest backlog the broker loop actually saw.
+//!
+//! Counters are plain integers: send and poll from one thread, as
+//! MultiRadioBroker does, and take snapshots from that thread as well.
+//!
+//! @par Usage Example:
+//! @code
+//! jenlib::ble::ProfilingBleDriver profiled(adapter);
+//! broker.add_radio(profiled);
+//! ...
+//! const jenlib::ble::BleProfileSnapshot stats = profiled.snapshot();
+//! report(stats.inbound.count(jenlib::ble::MessageType::Reading),
+//!        stats.callback(jenlib::ble::BleCallbackKind::Reading).quantile_upper_us(0.99f));
+//! @endcode
+class ProfilingBleDriver : public BleDriver {
+ public:
+    //! @param inner Driver doing the real work; must outlive the decorator.
+    //! @param clock Microsecond clock used for callback timing.
+    explicit ProfilingBleDriver(BleDriver& inner, ProfilingClock clock = platform_clock_us)
+        : inner_(inner), clock_(clock) {}
+    ProfilingBleDriver(const ProfilingBleDriver&) = delete;  // Inner callbacks are bound to this instance
+    ProfilingBleDriver& operator=(const ProfilingBleDriver&) = delete;
+
+    bool begin() override { return inner_.begin(); }
+    void end() override { inner_.end(); }
+    bool is_connected() const override { return inner_.is_connected(); }
+    DeviceId get_local_device_id() const override { return inner_.get_local_device_id(); }
+
+    void advertise(DeviceId device_id, BlePayload payload) override;
+    void send_to(DeviceId device_id, BlePayload payload) override;
+    bool receive(DeviceId self_id, BlePayload &out_payload) override;
+    void poll() override;
+    std::size_t poll_limited(std::size_t max_messages) override;
+    std::size_t inbox_depth(DeviceId self_id) override { return inner_.inbox_depth(self_id); }
+    std::uint32_t inbox_drops() const override { return inner_.inbox_drops(); }
+
+    void set_message_callback(BleMessageCallback callback) override;
+    void clear_message_callback() override { inner_.clear_message_callback(); }
+    void set_start_broadcast_callback(StartBroadcastCallback callback) override;
+    void set_reading_callback(ReadingCallback callback) override;
+    void set_receipt_callback(ReceiptCallback callback) override;
+    void set_sampling_config_callback(SamplingConfigCallback callback) override;
+    void clear_type_specific_callbacks() override { inner_.clear_type_specific_callbacks(); }
+    void set_connection_callback(ConnectionCallback callback) override;
+    void clear_connection_callback() override { inner_.clear_connection_callback(); }
+
+    //! @brief Copy of the counters gathered so far.
+    BleProfileSnapshot snapshot() const { return stats_; }
+
+    //! @brief Zero every counter, e.g. after reporting an interval.
+    void reset() { stats_ = BleProfileSnapshot{}; }
+
+ private:
+    void count(BleTrafficCounters& counters, const BlePayload& payload);
+    void count(BleTrafficCounters& counters, MessageType type, std::size_t bytes);
+    void sample_inbox(DeviceId device);
+
+    BleDriver& inner_;
+    ProfilingClock clock_;
+    BleProfileSnapshot stats_{};
+};
+
+}  // namespace jenlib::ble
+
+#endif  // INCLUDE_JENLIB_BLE_DRIVERS_PROFILINGBLEDRIVER_H_
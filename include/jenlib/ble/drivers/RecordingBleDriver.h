@@ -0,0 +1,88 @@
+//! @file include/jenlib/ble/drivers/RecordingBleDriver.h
+//! @brief Decorator that captures the traffic of another BLE driver (native builds).
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_BLE_DRIVERS_RECORDINGBLEDRIVER_H_
+#define INCLUDE_JENLIB_BLE_DRIVERS_RECORDINGBLEDRIVER_H_
+
+#if !defined(ARDUINO) && !defined(ESP_PLATFORM)
+
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include "jenlib/ble/BleDriver.h"
+#include "jenlib/ble/BleTrace.h"
+
+namespace jenlib::ble {
+
+//! @class RecordingBleDriver
+//! @brief Forwards every call to an inner driver and writes each payload to a trace.
+//! @details
+//! advertise() and send_to() are recorded as outbound. Typed callbacks are
+//! wrapped so the message they receive is serialized again and recorded as
+//! kInbound with its sender; the generic callback records the payload it is
+//! given. Payloads returned by receive() are recorded as kReceived. Times are
+//! microseconds since begin(), taken from an injectable clock.
+//!
+//! @par Usage Example:
+//! @code
+//! jenlib::ble::BleTraceWriter trace;
+//! trace.open("gateway.jbtr");
+//! jenlib::ble::RecordingBleDriver recorder(radio, trace);
+//! broker.add_radio(recorder);  // Then replay with ReplayBleDriver
+//! @endcode
+class RecordingBleDriver : public BleDriver {
+ public:
+    //! @param inner Driver doing the real work; must outlive the decorator.
+    //! @param trace Open writer; must outlive the decorator.
+    //! @param clock Microsecond clock used for timestamps.
+    RecordingBleDriver(BleDriver& inner, BleTraceWriter& trace, BleTraceClock clock = steady_clock_us)
+        : inner_(inner), trace_(trace), clock_(std::move(clock)) {}
+    RecordingBleDriver(const RecordingBleDriver&) = delete;  // Inner callbacks are bound to this instance
+    RecordingBleDriver& operator=(const RecordingBleDriver&) = delete;
+
+    bool begin() override;
+    void end() override { inner_.end(); }
+    bool is_connected() const override { return inner_.is_connected(); }
+    DeviceId get_local_device_id() const override { return inner_.get_local_device_id(); }
+
+    void advertise(DeviceId device_id, BlePayload payload) override;
+    void send_to(DeviceId device_id, BlePayload payload) override;
+    bool receive(DeviceId self_id, BlePayload &out_payload) override;
+    void poll() override { inner_.poll(); }
+    std::size_t poll_limited(std::size_t max_messages) override { return inner_.poll_limited(max_messages); }
+    std::size_t inbox_depth(DeviceId self_id) override { return inner_.inbox_depth(self_id); }
+    std::uint32_t inbox_drops() const override { return inner_.inbox_drops(); }
+
+    void set_message_callback(BleMessageCallback callback) override;
+    void clear_message_callback() override { inner_.clear_message_callback(); }
+    void set_start_broadcast_callback(StartBroadcastCallback callback) override;
+    void set_reading_callback(ReadingCallback callback) override;
+    void set_receipt_callback(ReceiptCallback callback) override;
+    void set_sampling_config_callback(SamplingConfigCallback callback) override;
+    void clear_type_specific_callbacks() override { inner_.clear_type_specific_callbacks(); }
+    void set_connection_callback(ConnectionCallback callback) override {
+        inner_.set_connection_callback(std::move(callback));
+    }
+    void clear_connection_callback() override { inner_.clear_connection_callback(); }
+
+    //! @brief Records that could not be written, e.g. because the disk is full.
+    std::uint64_t write_errors() const { return write_errors_; }
+
+ private:
+    void record(BleTraceDirection direction, DeviceId device, const BlePayload& payload);
+
+    BleDriver& inner_;
+    BleTraceWriter& trace_;
+    BleTraceClock clock_;
+    std::uint64_t start_us_{0};
+    std::uint64_t write_errors_{0};
+    std::mutex mutex_;  //!< Senders and the polling thread may record concurrently.
+};
+
+}  // namespace jenlib::ble
+
+#endif  // !ARDUINO && !ESP_PLATFORM
+
+#endif  // INCLUDE_JENLIB_BLE_DRIVERS_RECORDINGBLEDRIVER_H_
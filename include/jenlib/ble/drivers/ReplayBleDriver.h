@@ -0,0 +1,143 @@
+//! @file include/jenlib/ble/drivers/ReplayBleDriver.h
+//! @brief Driver that feeds a captured trace back into a broker (native builds).
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_BLE_DRIVERS_REPLAYBLEDRIVER_H_
+#define INCLUDE_JENLIB_BLE_DRIVERS_REPLAYBLEDRIVER_H_
+
+#if !defined(ARDUINO) && !defined(ESP_PLATFORM)
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "jenlib/ble/BleDriver.h"
+#include "jenlib/ble/BleTrace.h"
+
+namespace jenlib::ble {
+
+//! @class ReplayBleDriver
+//! @brief Replays the inbound records of a trace, as fast as possible or on a scaled clock.
+//! @details
+//! poll() delivers kInbound records the way NativeBleDriver does: typed
+//! callbacks first, then the generic callback, then the inbox read by
+//! receive(local id). kReceived records go straight to the inbox of the
+//! device they were polled as. Outbound records are the other side's
+//! traffic and are skipped; anything the broker sends is counted and dropped.
+//!
+//! With speed 0 each poll() delivers up to batch records regardless of their
+//! timestamps. Otherwise a record is due once speed * (now - begin()) reaches
+//! its timestamp, so 1.0 is real time and 10.0 ten times faster.
+//!
+//! @par Usage Example:
+//! @code
+//! std::vector<jenlib::ble::BleTraceRecord> records;
+//! jenlib::ble::load_ble_trace("gateway.jbtr", records);
+//! jenlib::ble::ReplayBleDriver replay(jenlib::ble::DeviceId(0), std::move(records));
+//! broker.add_radio(replay);
+//! broker.begin();
+//! while (!replay.finished()) {
+//!     broker.process_events();
+//! }
+//! @endcode
+class ReplayBleDriver : public BleDriver {
+ public:
+    //! @brief Records delivered per poll() when replaying as fast as possible.
+    static constexpr std::size_t kDefaultBatch = 64;
+
+    //! @param local_device_id Identity reported by get_local_device_id().
+    //! @param records Trace in timestamp order, e.g. from load_ble_trace().
+    //! @param speed Replay rate relative to the capture; 0 replays as fast as possible.
+    //! @param clock Microsecond clock used for pacing.
+    ReplayBleDriver(DeviceId local_device_id, std::vector<BleTraceRecord> records, double speed = 0.0,
+                    BleTraceClock clock = steady_clock_us)
+        : local_device_id_(local_device_id), records_(std::move(records)), speed_(speed), clock_(std::move(clock)) {}
+
+    //! @brief Start the replay clock from the first record.
+    bool begin() override;
+    void end() override;
+    bool is_connected() const override { return initialized_; }
+    DeviceId get_local_device_id() const override { return local_device_id_; }
+
+    void advertise(DeviceId device_id, BlePayload payload) override;
+    void send_to(DeviceId device_id, BlePayload payload) override;
+    bool receive(DeviceId self_id, BlePayload &out_payload) override;
+
+    //! @brief Deliver the records that are due.
+    void poll() override;
+
+    //! @brief Deliver at most @p max_messages of the records that are due.
+    std::size_t poll_limited(std::size_t max_messages) override;
+
+    std::size_t inbox_depth(DeviceId self_id) override;
+    std::uint32_t inbox_drops() const override { return inbox_drops_; }
+
+    void set_message_callback(BleMessageCallback callback) override { message_callback_ = std::move(callback); }
+    void clear_message_callback() override { message_callback_ = nullptr; }
+    void set_start_broadcast_callback(StartBroadcastCallback callback) override {
+        start_broadcast_callback_ = std::move(callback);
+    }
+    void set_reading_callback(ReadingCallback callback) override { reading_callback_ = std::move(callback); }
+    void set_receipt_callback(ReceiptCallback callback) override { receipt_callback_ = std::move(callback); }
+    void set_sampling_config_callback(SamplingConfigCallback callback) override {
+        sampling_config_callback_ = std::move(callback);
+    }
+    void clear_type_specific_callbacks() override;
+    void set_connection_callback(ConnectionCallback callback) override {
+        connection_callback_ = std::move(callback);
+    }
+    void clear_connection_callback() override { connection_callback_ = nullptr; }
+
+    //! @brief Records delivered per poll() when speed is 0.
+    void set_batch(std::size_t batch) { batch_ = batch == 0 ? 1 : batch; }
+
+    //! @brief Start over from the first record; the clock restarts on the next begin().
+    void rewind();
+
+    //! @brief True once every record has been consumed.
+    bool finished() const { return next_ == records_.size(); }
+
+    //! @brief Records delivered to callbacks or the inbox so far.
+    std::uint64_t replayed() const { return replayed_; }
+
+    //! @brief Messages the broker sent while replaying.
+    std::uint64_t sent() const { return sent_; }
+
+    //! @brief How late the most recently delivered record was against the scaled clock, in microseconds.
+    //! @details Always 0 when replaying as fast as possible.
+    std::uint64_t last_lateness_us() const { return last_lateness_us_; }
+
+ private:
+    void deliver(const BleTraceRecord& record);
+    bool try_type_specific_callbacks(DeviceId sender_id, const BlePayload& payload);
+    void push_inbox(DeviceId device, const BlePayload& payload);
+
+    DeviceId local_device_id_;
+    std::vector<BleTraceRecord> records_;
+    double speed_;
+    BleTraceClock clock_;
+    std::size_t batch_{kDefaultBatch};
+    std::size_t next_{0};
+    std::uint64_t start_us_{0};
+    std::uint64_t replayed_{0};
+    std::uint64_t sent_{0};
+    std::uint64_t last_lateness_us_{0};
+    bool initialized_{false};
+    BleMessageCallback message_callback_;
+    StartBroadcastCallback start_broadcast_callback_;
+    ReadingCallback reading_callback_;
+    ReceiptCallback receipt_callback_;
+    SamplingConfigCallback sampling_config_callback_;
+    ConnectionCallback connection_callback_;
+    std::unordered_map<std::uint32_t, std::deque<BlePayload>> inbox_;
+    std::uint32_t inbox_drops_{0};
+};
+
+}  // namespace jenlib::ble
+
+#endif  // !ARDUINO && !ESP_PLATFORM
+
+#endif  // INCLUDE_JENLIB_BLE_DRIVERS_REPLAYBLEDRIVER_H_
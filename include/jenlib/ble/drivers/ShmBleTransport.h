@@ -0,0 +1,221 @@
+//! @file include/jenlib/ble/drivers/ShmBleTransport.h
+//! @brief Cross-process BLE message transport over POSIX shared memory (Linux).
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_BLE_DRIVERS_SHMBLETRANSPORT_H_
+#define INCLUDE_JENLIB_BLE_DRIVERS_SHMBLETRANSPORT_H_
+
+#if defined(__linux__) && !defined(ARDUINO) && !defined(ESP_PLATFORM)
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "jenlib/ble/Ids.h"
+#include "jenlib/ble/Payload.h"
+
+namespace jenlib::ble {
+
+//! @brief Layout of the shared segment; identical in every process that maps it.
+namespace shm {
+constexpr std::uint32_t kMagic = 0x454C424Au;  //!< "JBLE" once the creator has initialised the segment.
+constexpr std::uint32_t kVersion = 1;          //!< Bumped whenever the layout changes.
+constexpr std::size_t kMaxDevices = 32;        //!< Rings (one per receiving device) in a segment.
+constexpr std::size_t kRingSlots = 256;        //!< Messages per ring; a power of two.
+
+static_assert((kRingSlots & (kRingSlots - 1)) == 0, "kRingSlots must be a power of two");
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "shared rings need address-free atomics");
+static_assert(std::atomic<std::uint32_t>::is_always_lock_free, "shared rings need address-free atomics");
+
+//! @brief One message slot; the sequence number says who may touch the payload.
+struct Slot {
+    std::atomic<std::uint64_t> sequence;  //!< pos: free for producer; pos + 1: ready for consumer.
+    BlePayload payload;
+};
+
+//! @brief Bounded multi-producer, single-consumer ring owned by one receiving device.
+struct alignas(64) Ring {
+    enum : std::uint32_t { kFree = 0, kClaiming = 1, kReady = 2 };
+
+    std::atomic<std::uint32_t> state;                  //!< Claim state of this ring in the device table.
+    std::uint32_t device_id;                           //!< Receiving device, valid once kReady.
+    alignas(64) std::atomic<std::uint64_t> enqueue_pos;  //!< Next position producers claim.
+    alignas(64) std::atomic<std::uint64_t> dequeue_pos;  //!< Next position the consumer reads.
+    std::atomic<std::uint64_t> dropped;                //!< Messages refused because the ring was full.
+    alignas(64) std::atomic<std::uint32_t> wake_seq;   //!< Futex word, bumped on every publish.
+    std::atomic<std::uint32_t> waiters;                //!< Consumers sleeping on wake_seq.
+    alignas(64) Slot slots[kRingSlots];
+};
+
+//! @brief Whole shared segment.
+struct Segment {
+    std::atomic<std::uint32_t> magic;
+    std::uint32_t version;
+    Ring rings[kMaxDevices];
+};
+}  // namespace shm
+
+//! @brief Per-device message rings in POSIX shared memory.
+//! @details
+//! Every receiving device owns one ring in a named segment (shm_open). Any
+//! process that maps the segment may produce into any ring; only the owning
+//! device consumes from it. Producers claim slots lock-free with a CAS on the
+//! ring's enqueue position and publish them through a per-slot sequence
+//! number, so there is no lock to be held by a process that dies.
+//!
+//! Payloads are written straight into the slot by send_in_place() and read
+//! straight out of it by consume(), so a message crosses processes without
+//! being copied in between. A consumer with nothing to do sleeps on a futex
+//! in the ring; producers only make the wake-up syscall when someone sleeps.
+//!
+//! A full ring refuses new messages (counted in dropped()) rather than
+//! overwriting old ones, since producers cannot safely reclaim a slot the
+//! consumer may be reading. A producer killed between claiming and publishing
+//! a slot stalls that ring.
+//!
+//! @par Usage Example:
+//! @code
+//! // Broker process
+//! jenlib::ble::ShmBleTransport transport;
+//! transport.open("/jenlib-ble", true);
+//! jenlib::ble::NativeBleDriver broker(jenlib::ble::DeviceId(0));
+//! broker.set_transport(&transport);
+//! broker.begin();
+//! while (running) {
+//!     transport.wait(jenlib::ble::DeviceId(0), 100);
+//!     broker.poll();  // Dispatches to the registered callbacks
+//! }
+//!
+//! // Fleet simulator process
+//! jenlib::ble::ShmBleTransport transport;
+//! transport.open("/jenlib-ble", false);
+//! sensor.set_transport(&transport);
+//! sensor.advertise(sensor_id, std::move(reading_payload));
+//! @endcode
+class ShmBleTransport {
+ public:
+    static constexpr std::size_t kMaxDevices = shm::kMaxDevices;  //!< Receiving devices per segment.
+    static constexpr std::size_t kRingSlots = shm::kRingSlots;    //!< Capacity of each device's ring.
+
+    ShmBleTransport() = default;
+    ~ShmBleTransport();
+    ShmBleTransport(const ShmBleTransport&) = delete;
+    ShmBleTransport& operator=(const ShmBleTransport&) = delete;
+
+    //! @brief Map a named segment.
+    //! @param name POSIX shared memory name, e.g. "/jenlib-ble".
+    //! @param create true to create and initialise it if it does not exist yet.
+    //! @return false if the segment could not be opened or has an incompatible layout.
+    bool open(const char* name, bool create);
+
+    //! @brief Unmap the segment; the segment itself persists until unlink().
+    void close();
+
+    //! @brief Remove a named segment; processes that still map it are unaffected.
+    static bool unlink(const char* name);
+
+    //! @brief Whether a segment is mapped.
+    bool is_open() const noexcept { return segment_ != nullptr; }
+
+    //! @brief Serialise a message directly into a slot of the destination's ring.
+    //! @param dest Receiving device.
+    //! @param fill Callable `bool(BlePayload&)` that writes the message; the payload starts empty.
+    //! @return false if the ring is full, the device table is full, or fill returned false.
+    template <typename Fill>
+    bool send_in_place(DeviceId dest, Fill&& fill) {
+        shm::Ring* ring = ring_for(dest, true);
+        std::uint64_t pos = 0;
+        shm::Slot* slot = ring ? reserve(*ring, pos) : nullptr;
+        if (!slot) {
+            return false;
+        }
+        slot->payload.size = 0;
+        const bool filled = fill(slot->payload);
+        if (!filled) {
+            slot->payload.size = 0;  // Published empty and skipped by the consumer
+        }
+        publish(*ring, *slot, pos);
+        return filled;
+    }
+
+    //! @brief Copy a serialised message into the destination's ring.
+    bool send(DeviceId dest, const BlePayload& payload);
+
+    //! @brief Hand waiting messages for @p self to @p fn in place, oldest first.
+    //! @param fn Callable `void(const BlePayload&)`; the reference is only valid during the call.
+    //! @param max_messages Upper bound on messages handled in this call.
+    //! @return Number of messages handled.
+    template <typename Fn>
+    std::size_t consume(DeviceId self, Fn&& fn, std::size_t max_messages = kRingSlots) {
+        shm::Ring* ring = ring_for(self, true);
+        if (!ring) {
+            return 0;
+        }
+        std::size_t handled = 0;
+        while (handled < max_messages) {
+            const std::uint64_t pos = ring->dequeue_pos.load(std::memory_order_relaxed);
+            shm::Slot& slot = ring->slots[pos & (kRingSlots - 1)];
+            if (slot.sequence.load(std::memory_order_acquire) != pos + 1) {
+                break;
+            }
+            if (slot.payload.size > 0) {
+                fn(static_cast<const BlePayload&>(slot.payload));
+                ++handled;
+            }
+            slot.sequence.store(pos + kRingSlots, std::memory_order_release);
+            ring->dequeue_pos.store(pos + 1, std::memory_order_relaxed);
+        }
+        return handled;
+    }
+
+    //! @brief Copy out the oldest waiting message for @p self.
+    bool receive(DeviceId self, BlePayload& out);
+
+    //! @brief Sleep until a message for @p self is waiting or the timeout expires.
+    //! @return true if a message is waiting.
+    bool wait(DeviceId self, std::uint32_t timeout_ms);
+
+    //! @brief Messages refused for @p dest because its ring was full.
+    std::uint64_t dropped(DeviceId dest) const;
+
+    //! @brief Messages claimed in @p dest's ring and not yet consumed.
+    std::size_t pending(DeviceId dest) const;
+
+ private:
+    //! @brief Find the ring of a device, claiming a free one if @p create.
+    shm::Ring* ring_for(DeviceId device, bool create) const;
+
+    //! @brief Claim the next slot of a ring; nullptr if the ring is full.
+    static shm::Slot* reserve(shm::Ring& ring, std::uint64_t& pos) noexcept {
+        pos = ring.enqueue_pos.load(std::memory_order_relaxed);
+        for (;;) {
+            shm::Slot& slot = ring.slots[pos & (kRingSlots - 1)];
+            const std::uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::int64_t>(sequence - pos);
+            if (diff == 0) {
+                if (ring.enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    return &slot;
+                }
+            } else if (diff < 0) {
+                ring.dropped.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            } else {
+                pos = ring.enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    //! @brief Make a filled slot visible to the consumer and wake it if it sleeps.
+    static void publish(shm::Ring& ring, shm::Slot& slot, std::uint64_t pos) noexcept;
+
+    //! @brief Whether the consumer has nothing to read.
+    static bool empty(const shm::Ring& ring) noexcept;
+
+    shm::Segment* segment_{nullptr};
+};
+
+}  // namespace jenlib::ble
+
+#endif  // __linux__ && !ARDUINO && !ESP_PLATFORM
+
+#endif  // INCLUDE_JENLIB_BLE_DRIVERS_SHMBLETRANSPORT_H_
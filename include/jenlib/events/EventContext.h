@@ -0,0 +1,231 @@
+//! @file include/jenlib/events/EventContext.h
+//! @brief Instantiable event queue and callback registry
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_EVENTS_EVENTCONTEXT_H_
+#define INCLUDE_JENLIB_EVENTS_EVENTCONTEXT_H_
+
+#include <array>
+#include <cstddef>
+#include <utility>
+#include "jenlib/events/EventTypes.h"
+#include "jenlib/time/TimeDriver.h"
+#include "jenlib/time/TimeTypes.h"
+
+namespace jenlib::events {
+
+//! @brief Result of the event enqueue operation
+enum class EventEnqueueResult : std::uint8_t {
+    Enqueued,
+    EnqueuedWithEviction
+};
+
+//! @brief Hook run after every dispatch_event, e.g. to wake a sleeping run loop
+//! @details Plain function pointer so it can be set from C-style platform code
+using DispatchHook = void (*)(void* context);
+
+//! @brief Event queue and callback registry owned by one run loop
+//! @details
+//! Holds everything EventDispatcher used to keep in static members. Contexts
+//! share no state, so a native broker can run one per core, each driven by
+//! its own thread, without locking. A single context is not thread-safe.
+//! EventDispatcher forwards to a process-wide default context.
+//!
+//! @par Usage Example:
+//! @code
+//! // One context per worker thread
+//! void worker() {
+//!     jenlib::events::EventContext events;
+//!     events.register_callback(jenlib::events::EventType::kCustom, handle_custom);
+//!     while (running) {
+//!         events.dispatch_event(next_event());
+//!         events.process_events();
+//!     }
+//! }
+//! @endcode
+class EventContext {
+ public:
+    //! @brief Maximum number of callbacks (static allocation)
+    static constexpr std::size_t kMaxCallbacks = 16;
+
+    //! @brief Maximum event queue size
+    static constexpr std::size_t kMaxEventQueueSize = 32;
+
+    EventContext() { reset(); }
+    EventContext(const EventContext&) = delete;
+    EventContext& operator=(const EventContext&) = delete;
+
+    //! @brief Register a callback for a specific event type
+    //! @param event_type The type of event to register for
+    //! @param callback The callback function to invoke
+    //! @return EventId for unregistering the callback, or kInvalidEventId on failure
+    EventId register_callback(EventType event_type, EventCallback callback);
+
+    //! @brief Unregister a callback by event ID
+    //! @param event_id The ID returned from register_callback
+    //! @return true if successfully unregistered, false if not found
+    bool unregister_callback(EventId event_id);
+
+    //! @brief Unregister all callbacks for a specific event type
+    //! @param event_type The event type to clear callbacks for
+    //! @return Number of callbacks removed
+    std::size_t unregister_callbacks(EventType event_type);
+
+    //! @brief Dispatch an event to the processing queue
+    //! @param event The event to dispatch
+    //! @param[out] evicted_event Optional pointer to keep track of the evicted event
+    //! @return Result of the enqueue operation
+    EventEnqueueResult dispatch_event(const Event& event, Event* evicted_event = nullptr);
+
+    //! @brief Install a hook that runs after every dispatch_event
+    //! @param hook Function to call, or nullptr to remove the hook
+    //! @param context Passed unchanged to the hook
+    void set_dispatch_hook(DispatchHook hook, void* context = nullptr);
+
+    //! @brief Get the number of events waiting to be processed
+    std::size_t get_pending_event_count() const { return queue_size_; }
+
+    //! @brief Get the number of queued events evicted by a full queue since reset (wraps)
+    std::uint32_t get_evicted_count() const { return evicted_count_; }
+
+    //! @brief Process the events pending when called, oldest first
+    //! @param max_callbacks Most callbacks to invoke in this call; events that would exceed it stay queued
+    //! @return Number of callbacks invoked
+    //! @details An event's callbacks all run in the same call, and the first event always
+    //!          runs, even if it has more than @p max_callbacks callbacks. Events dispatched
+    //!          by a callback wait for the next call. With a pass budget set, stops once
+    //!          the budget is spent and leaves the rest queued.
+    std::size_t process_events(std::size_t max_callbacks = jenlib::time::kNoPassLimit);
+
+    //! @brief Set the clock used to time callbacks; without one, budgets never trip
+    void set_time_driver(jenlib::time::TimeDriver* driver) noexcept { driver_ = driver; }
+
+    //! @brief Get the clock used to time callbacks, or nullptr if none set
+    jenlib::time::TimeDriver* time_driver() const noexcept { return driver_; }
+
+    //! @brief Set how long one call of a callback may run before it counts as an overrun
+    //! @param event_id The ID returned from register_callback
+    //! @param budget_ms Allowed run time in driver milliseconds; 0 removes the budget
+    //! @return true if the callback is registered
+    bool set_callback_budget(EventId event_id, std::uint32_t budget_ms);
+
+    //! @brief Get execution statistics of a registered callback
+    //! @return true if the callback is registered
+    bool get_callback_stats(EventId event_id, jenlib::time::CallbackStats& stats) const;
+
+    //! @brief Get the registered callback with the most overruns, then the longest call; id 0 if none has run
+    jenlib::time::CallbackStats get_worst_offender() const;
+
+    //! @brief Get the number of budget overruns across all callbacks since reset (wraps)
+    std::uint32_t get_overrun_count() const { return overrun_count_; }
+
+    //! @brief Zero every callback's statistics and the overrun and deferral counts, keeping budgets
+    void reset_callback_stats();
+
+    //! @brief Bound the time one process_events() call spends running callbacks
+    //! @param budget_ms Pass budget in driver milliseconds; 0 (the default) drains the queue
+    //! @details At least one event is handled per pass, with all of its callbacks.
+    void set_pass_budget_ms(std::uint32_t budget_ms) { pass_budget_ms_ = budget_ms; }
+
+    //! @brief Get the number of process_events() calls cut short by the pass budget or callback limit (wraps)
+    std::uint32_t get_deferred_passes() const { return deferred_passes_; }
+
+    //! @brief Get the number of registered callbacks for an event type
+    std::size_t get_callback_count(EventType event_type) const;
+
+    //! @brief Get the total number of registered callbacks
+    std::size_t get_total_callback_count() const;
+
+    //! @brief Clear all registered callbacks and pending events
+    void clear_all_callbacks();
+
+    //! @brief Return to the freshly constructed state, including event ID numbering
+    //! @details The time driver and pass budget are configuration and stay set.
+    void reset();
+
+ private:
+    //! @brief Internal callback entry structure
+    struct CallbackEntry {
+        EventId id;
+        EventType type;
+        EventCallback callback;
+        bool active;
+        jenlib::time::CallbackStats stats;
+
+        CallbackEntry() : id(kInvalidEventId), type(EventType::kCustom), callback(nullptr), active(false) {}
+
+        CallbackEntry(EventId callback_id, EventType event_type, EventCallback cb)
+            : id(callback_id), type(event_type), callback(std::move(cb)), active(true) {
+            stats.id = callback_id;
+        }
+
+        void clear() {
+            id = kInvalidEventId;
+            type = EventType::kCustom;
+            callback = nullptr;
+            active = false;
+            stats = jenlib::time::CallbackStats{};
+        }
+    };
+
+    //! @brief Get the next available event ID
+    EventId get_next_event_id();
+
+    //! @brief Find an available callback slot
+    CallbackEntry* find_available_slot();
+
+    //! @brief Find callback entry by ID
+    CallbackEntry* find_callback_entry(EventId event_id);
+    const CallbackEntry* find_callback_entry(EventId event_id) const;
+
+    //! @brief Run one callback and account for its duration
+    //! @param[in,out] last_tick Driver time the callback started; set to the time it finished
+    void run_callback(CallbackEntry& entry, const Event& event, std::uint32_t& last_tick);
+
+    //! @brief Driver milliseconds from @p from to @p to, or 0 without a driver
+    std::uint32_t elapsed(std::uint32_t from, std::uint32_t to) const;
+
+    //! @brief Current driver time, or 0 without a driver
+    std::uint32_t clock_now() const { return driver_ ? driver_->now() : 0; }
+
+    //! @brief Next available event ID
+    EventId next_event_id_{1};
+
+    //! @brief Callback storage (no dynamic allocation)
+    std::array<CallbackEntry, kMaxCallbacks> callbacks_{};
+
+    //! @brief Event queue for pending events (circular buffer)
+    std::array<Event, kMaxEventQueueSize> event_queue_{};
+
+    //! @brief Current queue size
+    std::size_t queue_size_{0};
+
+    //! @brief Current queue head index
+    std::size_t queue_head_{0};
+
+    //! @brief Events evicted from a full queue
+    std::uint32_t evicted_count_{0};
+
+    //! @brief Clock for callback budgets
+    jenlib::time::TimeDriver* driver_{nullptr};
+
+    //! @brief Callback budget overruns since reset
+    std::uint32_t overrun_count_{0};
+
+    //! @brief Time limit for one process_events() call; 0 for none
+    std::uint32_t pass_budget_ms_{0};
+
+    //! @brief Passes cut short by pass_budget_ms_ or the event limit
+    std::uint32_t deferred_passes_{0};
+
+    //! @brief Hook run after each dispatch
+    DispatchHook dispatch_hook_{nullptr};
+
+    //! @brief Context for the dispatch hook
+    void* dispatch_hook_context_{nullptr};
+};
+
+}  // namespace jenlib::events
+
+#endif  // INCLUDE_JENLIB_EVENTS_EVENTCONTEXT_H_
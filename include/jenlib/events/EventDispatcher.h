@@ -6,8 +6,8 @@
 #ifndef INCLUDE_JENLIB_EVENTS_EVENTDISPATCHER_H_
 #define INCLUDE_JENLIB_EVENTS_EVENTDISPATCHER_H_
 
-#include <array>
-#include <utility>
+#include <cstddef>
+#include "jenlib/events/EventContext.h"
 #include "jenlib/events/EventTypes.h"
 
 //! @namespace jenlib::events
@@ -58,18 +58,12 @@
 //! @see jenlib::events::EventTypes for event type definitions
 namespace jenlib::events {
 
-//! @brief Result of the event enqueue operation
-enum class EventEnqueueResult : std::uint8_t {
-    Enqueued,
-    EnqueuedWithEviction
-};
-
-
 //! @brief Event dispatcher for managing and processing events
 //! @details
 //! Provides a centralized event system for the jenlib library.
-//! Supports event registration, dispatch, and processing with thread-safe
-//! operations where supported by the platform.
+//! Every call forwards to a process-wide default EventContext; code that
+//! needs more than one queue, e.g. one per worker thread, uses EventContext
+//! instances directly.
 class EventDispatcher {
  public:
     //! @brief Register a callback for a specific event type
@@ -95,6 +89,14 @@ class EventDispatcher {
     //! @return Result of the enqueue operation
     static EventEnqueueResult dispatch_event(const Event& event, Event* evicted_event = nullptr);
 
+    //! @brief Install a hook that runs after every dispatch_event
+    //! @param hook Function to call, or nullptr to remove the hook
+    //! @param context Passed unchanged to the hook
+    static void set_dispatch_hook(DispatchHook hook, void* context = nullptr);
+
+    //! @brief Get the number of events waiting to be processed
+    static std::size_t get_pending_event_count() { return default_context().get_pending_event_count(); }
+
     //! @brief Process all pending events in the queue
     //! @return Number of events processed
     static std::size_t process_events();
@@ -118,121 +120,12 @@ class EventDispatcher {
     //! @brief Initialize the event dispatcher (called automatically on first use)
     static void initialize();
 
- private:
-    //! @brief Internal callback entry structure
-    struct CallbackEntry {
-        EventId id;
-        EventType type;
-        EventCallback callback;
-        bool active;
-
-        CallbackEntry() : id(kInvalidEventId), type(EventType::kCustom), callback(nullptr), active(false) {}
-
-        CallbackEntry(EventId callback_id, EventType event_type, EventCallback cb)
-            : id(callback_id), type(event_type), callback(std::move(cb)), active(true) {}
-
-        void clear() {
-            id = kInvalidEventId;
-            type = EventType::kCustom;
-            callback = nullptr;
-            active = false;
-        }
-    };
-
-    //! @brief Get the next available event ID
-    static EventId get_next_event_id();
-
-    //! @brief Find an available callback slot
-    static CallbackEntry* find_available_slot();
-
-    //! @brief Find callback entry by ID
-    static CallbackEntry* find_callback_entry(EventId event_id);
+    //! @brief The context behind the static API
+    static EventContext& default_context();
 
+ private:
     //! @brief Internal initialization flag
     static bool initialized_;
-
-    //! @brief Next available event ID
-    static EventId next_event_id_;
-
-    //! @brief Maximum number of callbacks (static allocation)
-    static constexpr std::size_t kMaxCallbacks = 16;
-
-    //! @brief Maximum event queue size
-    static constexpr std::size_t kMaxEventQueueSize = 32;
-
-    //! @brief Static callback storage (no dynamic allocation)
-    static std::array<CallbackEntry, kMaxCallbacks> callbacks_;
-
-    //! @brief Event queue for pending events (circular buffer)
-    static std::array<Event, kMaxEventQueueSize> event_queue_;
-
-    //! @brief Current queue size
-    static std::size_t queue_size_;
-
-    //! @brief Current queue head index
-    static std::size_t queue_head_;
-
-    //! @brief Circular buffer iterator for events
-    class CircularBufferIterator {
-     public:
-        using iterator_category = std::forward_iterator_tag;
-        using value_type = Event;
-        using difference_type = std::ptrdiff_t;
-        using pointer = Event*;
-        using reference = Event&;
-
-        CircularBufferIterator(std::array<Event, kMaxEventQueueSize>& buffer,
-                              std::size_t head, std::size_t size, std::size_t pos)
-            : buffer_(buffer), head_(head), size_(size), pos_(pos) {}
-
-        reference operator*() const {
-            return buffer_[(head_ + pos_) % kMaxEventQueueSize];
-        }
-
-        pointer operator->() const {
-            return &buffer_[(head_ + pos_) % kMaxEventQueueSize];
-        }
-
-        CircularBufferIterator& operator++() {
-            ++pos_;
-            return *this;
-        }
-
-        CircularBufferIterator operator++(int) {
-            CircularBufferIterator temp = *this;
-            ++pos_;
-            return temp;
-        }
-
-        bool operator==(const CircularBufferIterator& other) const {
-            return pos_ == other.pos_;
-        }
-
-        bool operator!=(const CircularBufferIterator& other) const {
-            return pos_ != other.pos_;
-        }
-
-     private:
-        std::array<Event, kMaxEventQueueSize>& buffer_;
-        std::size_t head_;
-        std::size_t size_;
-        std::size_t pos_;
-    };
-
-    //! @brief Get begin iterator for event queue
-    static CircularBufferIterator event_queue_begin();
-
-    //! @brief Get end iterator for event queue
-    static CircularBufferIterator event_queue_end();
-
-    //! @brief Get range for event queue (for range-based for loops)
-    static auto event_queue_range() {
-        struct Range {
-            CircularBufferIterator begin() const { return EventDispatcher::event_queue_begin(); }
-            CircularBufferIterator end() const { return EventDispatcher::event_queue_end(); }
-        };
-        return Range{};
-    }
 };
 
 }  // namespace jenlib::events
@@ -0,0 +1,151 @@
+//! @file include/jenlib/events/NativeReactor.h
+//! @brief Blocking run loop for native Linux builds (epoll, timerfd, eventfd).
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_EVENTS_NATIVEREACTOR_H_
+#define INCLUDE_JENLIB_EVENTS_NATIVEREACTOR_H_
+
+#if defined(__linux__) && !defined(ARDUINO) && !defined(ESP_PLATFORM)
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include "jenlib/ble/Ids.h"
+#include "jenlib/events/EventContext.h"
+#include "jenlib/time/TimerContext.h"
+
+namespace jenlib::ble {
+class BleDriver;
+class ShmBleTransport;
+}  // namespace jenlib::ble
+
+namespace jenlib::events {
+
+//! @brief Replaces the spin loop around the static services with a thread that sleeps until there is work.
+//! @details
+//! Each call to run_once() processes due timers and pending events, then
+//! blocks in epoll_wait until one of these is ready:
+//! - the timerfd, armed for the earliest Time deadline;
+//! - the eventfd, written by wake() and by EventDispatcher::dispatch_event
+//!   while the reactor sleeps;
+//! - any file descriptor added with add_fd();
+//! - a watched ShmBleTransport ring, bridged to an eventfd by a helper
+//!   thread that sleeps on the ring's futex. On readiness the reactor polls
+//!   the driver reading that ring, so it dispatches the messages.
+//!
+//! Dispatches made by callbacks on the reactor thread do not make syscalls;
+//! the reactor just skips the sleep while events are pending.
+//!
+//! By default the reactor drives the static EventDispatcher and Time. Given
+//! its own EventContext and TimerContext it drives those instead, so a
+//! sharded broker can run one reactor per thread, each watching its own radio.
+//!
+//! @par Usage Example:
+//! @code
+//! jenlib::events::NativeReactor reactor;
+//! reactor.open();
+//! reactor.watch_transport(transport, driver);
+//! jenlib::time::schedule_repeating_timer(1000, report_status);
+//! reactor.run();  // Returns after reactor.stop() from a signal handler or another thread
+//! @endcode
+class NativeReactor {
+ public:
+    //! @brief Callback for a ready file descriptor; receives the epoll event mask.
+    using FdCallback = std::function<void(std::uint32_t events)>;
+
+    //! @brief Maximum file descriptors watched through add_fd().
+    static constexpr std::size_t kMaxSources = 16;
+
+    //! @brief Drive the default contexts behind EventDispatcher and Time.
+    NativeReactor();
+
+    //! @brief Drive the given contexts; both must outlive the reactor.
+    NativeReactor(EventContext& events, jenlib::time::TimerContext& timers);
+
+    ~NativeReactor();
+    NativeReactor(const NativeReactor&) = delete;
+    NativeReactor& operator=(const NativeReactor&) = delete;
+
+    //! @brief Create the epoll, timer and wake descriptors and hook the event context.
+    //! @return false if a descriptor could not be created.
+    bool open();
+
+    //! @brief Stop any transport bridge, close the descriptors and unhook the event context.
+    void close();
+
+    //! @brief Whether open() succeeded.
+    bool is_open() const noexcept { return epoll_fd_ >= 0; }
+
+    //! @brief Watch a file descriptor.
+    //! @param fd Descriptor owned by the caller; it must stay open until remove_fd().
+    //! @param events epoll event mask, e.g. EPOLLIN.
+    //! @param callback Run on the reactor thread when the descriptor is ready.
+    //! @return false if the table is full or epoll refused the descriptor.
+    bool add_fd(int fd, std::uint32_t events, FdCallback callback);
+
+    //! @brief Stop watching a file descriptor.
+    bool remove_fd(int fd);
+
+    //! @brief Wake on messages for @p driver in a shared-memory transport and poll it on arrival.
+    //! @details Only one transport can be watched; it and the driver must outlive the reactor.
+    //! @param transport Ring the driver reads from.
+    //! @param driver Driver polled on the reactor thread; its local device id selects the inbox.
+    bool watch_transport(jenlib::ble::ShmBleTransport& transport, jenlib::ble::BleDriver& driver);
+
+    //! @brief Make a blocked run_once() return; safe from any thread.
+    void wake() noexcept;
+
+    //! @brief Process due work, sleep until more arrives, then process it.
+    //! @param timeout_ms Longest sleep, or -1 to sleep until there is work.
+    //! @return Number of timer callbacks, event callbacks and ready descriptors handled.
+    std::size_t run_once(int timeout_ms = -1);
+
+    //! @brief Call run_once() until stop().
+    void run();
+
+    //! @brief Make run() return; safe from any thread.
+    void stop() noexcept;
+
+    //! @brief Number of times epoll_wait returned (for idle diagnostics).
+    std::uint64_t wakeups() const noexcept { return wakeups_; }
+
+ private:
+    struct Source {
+        int fd{-1};
+        FdCallback callback;
+    };
+    struct TransportBridge;
+
+    //! @brief Dispatch hook: wake the reactor if it is asleep.
+    static void on_dispatch(void* context);
+
+    //! @brief Run due timers and pending events.
+    std::size_t process_services();
+
+    //! @brief Arm the timerfd for the next Time deadline.
+    //! @return true if a timer is already due and the reactor must not sleep.
+    bool arm_timer();
+
+    EventContext& events_;
+    jenlib::time::TimerContext& timers_;
+    int epoll_fd_{-1};
+    int timer_fd_{-1};
+    int wake_fd_{-1};
+    bool timer_armed_{false};
+    std::uint32_t armed_deadline_ms_{0};
+    std::array<Source, kMaxSources> sources_{};
+    std::unique_ptr<TransportBridge> bridge_;
+    std::atomic<bool> sleeping_{false};
+    std::atomic<bool> running_{false};
+    std::uint64_t wakeups_{0};
+};
+
+}  // namespace jenlib::events
+
+#endif  // __linux__ && !ARDUINO && !ESP_PLATFORM
+
+#endif  // INCLUDE_JENLIB_EVENTS_NATIVEREACTOR_H_
@@ -0,0 +1,174 @@
+//! @file include/jenlib/events/Runtime.h
+//! @brief Cooperative main loop with ordered, bounded phases and per-phase profiling.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_EVENTS_RUNTIME_H_
+#define INCLUDE_JENLIB_EVENTS_RUNTIME_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include "jenlib/ble/BleDriver.h"
+#include "jenlib/events/EventContext.h"
+#include "jenlib/time/TimeDriver.h"
+#include "jenlib/time/TimeTypes.h"
+#include "jenlib/time/TimerContext.h"
+
+namespace jenlib::events {
+
+//! @brief Handle for a phase added to a Runtime
+using PhaseId = std::uint8_t;
+
+//! @brief Returned when a phase could not be added
+constexpr PhaseId kInvalidPhaseId = 0xFF;
+
+//! @brief Limits and ordering for one phase
+struct PhaseConfig {
+    std::size_t max_items{jenlib::time::kNoPassLimit};  //!< Event callbacks, timers or messages handled per pass
+    std::uint32_t budget_ms{0};                         //!< Time for one pass; 0 for none
+    std::uint8_t priority{0};                           //!< Lower runs first; equal priorities take turns going first
+};
+
+//! @brief One pass of one phase, as passed to the profiling hook
+struct PhaseSample {
+    PhaseId id{kInvalidPhaseId};
+    const char* name{nullptr};
+    std::size_t items{0};         //!< What the phase reported handling
+    std::uint32_t started_ms{0};  //!< Driver time the pass started
+    std::uint32_t elapsed_ms{0};
+};
+
+//! @brief Accumulated statistics for one phase
+struct PhaseStats {
+    jenlib::time::CallbackStats timing;  //!< calls counts passes; overruns are passes over the phase budget
+    std::uint64_t items{0};              //!< Items handled across all passes
+    std::uint32_t idle_passes{0};        //!< Passes that handled nothing
+};
+
+//! @brief Runs the application's loop phases in priority order, each bounded per pass.
+//! @details
+//! Replaces the hand-written loop() that drains the event queue, polls the
+//! radio and fires timers in a fixed order with no bounds. Each phase gets a
+//! PhaseConfig:
+//! - max_items caps the items handled in one pass, in the unit the phase
+//!   reports: event callbacks invoked, timers fired or BLE messages handled.
+//!   Whatever is left waits for the next run_once();
+//! - budget_ms becomes the context's pass budget for event and timer phases
+//!   (see EventContext::set_pass_budget_ms) and is monitored for every phase;
+//! - priority orders the phases. Phases of equal priority take turns going
+//!   first, so BLE intake and event processing share the loop fairly.
+//!
+//! Loop latency is then bounded by the phases' limits rather than by how much
+//! traffic arrived. Every pass is timed with the runtime's TimeDriver (so in
+//! milliseconds); the statistics and an optional profiling hook show which
+//! phase the loop spends its time in.
+//!
+//! @par Usage Example:
+//! @code
+//! jenlib::events::Runtime runtime(jenlib::time::Time::getDriver());
+//!
+//! void setup() {
+//!     runtime.add_timers(jenlib::time::Time::default_context(), {jenlib::time::kNoPassLimit, 5, 0});
+//!     runtime.add_ble_intake(*sensor.driver(), {8, 0, 1});
+//!     runtime.add_events(jenlib::events::EventDispatcher::default_context(), {8, 10, 1});
+//! }
+//!
+//! void loop() {
+//!     runtime.run_once();
+//! }
+//! @endcode
+class Runtime {
+ public:
+    //! @brief One pass of a phase; returns the number of items it handled
+    using PhaseStep = std::function<std::size_t(const PhaseConfig& config)>;
+
+    //! @brief Called after every phase pass
+    using ProfileHook = std::function<void(const PhaseSample& sample)>;
+
+    //! @brief Maximum number of phases
+    static constexpr std::size_t kMaxPhases = 8;
+
+    //! @param clock Clock for phase timing; nullptr disables timing and budgets
+    explicit Runtime(jenlib::time::TimeDriver* clock);
+
+    //! @brief Add a phase with its own step function
+    //! @param name Label for profiling; must outlive the runtime (e.g. a string literal)
+    //! @return The phase's ID, or kInvalidPhaseId if all kMaxPhases are in use
+    PhaseId add_phase(const char* name, PhaseStep step, const PhaseConfig& config);
+
+    //! @brief Add a phase that processes @p events; items are callbacks invoked
+    //! @details max_items bounds the callbacks, so an event with several subscribers uses
+    //!          several items. Gives the context the runtime's clock if it has none, so its
+    //!          callbacks are timed.
+    PhaseId add_events(EventContext& events, const PhaseConfig& config);
+
+    //! @brief Add a phase that fires due timers in @p timers; items are timers fired
+    PhaseId add_timers(jenlib::time::TimerContext& timers, const PhaseConfig& config);
+
+    //! @brief Add a phase that polls @p radio with BleDriver::poll_limited(); items are messages handled
+    PhaseId add_ble_intake(jenlib::ble::BleDriver& radio, const PhaseConfig& config);
+
+    //! @brief Replace a phase's limits and priority
+    //! @return false if the phase does not exist
+    bool set_phase_config(PhaseId id, const PhaseConfig& config);
+
+    //! @brief Run every phase once, in priority order
+    //! @return Items handled across all phases
+    std::size_t run_once();
+
+    //! @brief Install a hook called after every phase pass; nullptr removes it
+    void set_profile_hook(ProfileHook hook) { profile_hook_ = std::move(hook); }
+
+    //! @brief Monitor whole iterations against @p budget_ms; 0 (the default) for none
+    void set_loop_budget_ms(std::uint32_t budget_ms) { loop_stats_.budget_ms = budget_ms; }
+
+    //! @brief Get a phase's statistics
+    //! @return false if the phase does not exist
+    bool get_phase_stats(PhaseId id, PhaseStats& out) const;
+
+    //! @brief Whole-iteration timing; calls counts run_once() calls
+    const jenlib::time::CallbackStats& get_loop_stats() const { return loop_stats_; }
+
+    //! @brief Get the number of phases
+    std::size_t get_phase_count() const { return phase_count_; }
+
+    //! @brief Zero the loop's and every phase's statistics, keeping configuration
+    void reset_stats();
+
+ private:
+    struct Phase {
+        const char* name{nullptr};
+        PhaseStep step;
+        PhaseConfig config;
+        PhaseStats stats;
+    };
+
+    //! @brief Rebuild order_ after phases are added or reprioritised
+    void sort_phases();
+
+    //! @brief Run one phase and account for it
+    //! @param[in,out] last_tick Driver time the pass started; set to the time it finished
+    std::size_t run_phase(PhaseId id, std::uint32_t& last_tick);
+
+    //! @brief Driver time, or 0 without a driver
+    std::uint32_t clock_now() const;
+
+    //! @brief Driver milliseconds from @p from to @p to, or 0 without a driver
+    std::uint32_t elapsed(std::uint32_t from, std::uint32_t to) const;
+
+    jenlib::time::TimeDriver* clock_;
+    std::array<Phase, kMaxPhases> phases_{};
+    std::size_t phase_count_{0};
+
+    //! @brief Phase IDs by priority, then insertion order
+    std::array<PhaseId, kMaxPhases> order_{};
+
+    jenlib::time::CallbackStats loop_stats_;
+    ProfileHook profile_hook_;
+};
+
+}  // namespace jenlib::events
+
+#endif  // INCLUDE_JENLIB_EVENTS_RUNTIME_H_
@@ -7,6 +7,7 @@
 #define INCLUDE_JENLIB_GPIO_GPIODRIVER_H_
 
 #include <cstdint>
+#include <jenlib/gpio/GpioEdgeRing.h>
 
 //! @namespace jenlib::gpio
 //! @brief Core GPIO driver interface and types for hardware abstraction.
@@ -59,6 +60,14 @@ HIGH,
 //! @brief Hardware-defined pin index; user creates mapping.
 using PinIndex = std::uint8_t;
 
+//! @enum InterruptEdge
+//! @brief Which transitions raise a pin interrupt.
+enum class InterruptEdge : std::uint8_t {
+RISING,
+FALLING,
+CHANGE,
+};
+
 class GpioDriver {
  public:
     virtual ~GpioDriver() = default;
@@ -105,6 +114,40 @@ class GpioDriver {
     //! Get current analog write resolution.
     //! @note This method is not implemented by the base class.
     virtual std::uint8_t get_analog_write_resolution() const noexcept = 0;
+
+    //! Subscribe to edges on a pin; edges land in the ring set by set_edge_ring().
+    //! @param pin The pin index.
+    //! @param edge Which transitions to record.
+    //! @return true if the driver armed the interrupt.
+    //! @note The base class has no interrupt support and returns false.
+    virtual bool attach_interrupt(PinIndex pin, InterruptEdge edge) noexcept {
+        (void)pin;
+        (void)edge;
+        return false;
+    }
+    //! Stop recording edges on a pin.
+    //! @param pin The pin index.
+    virtual void detach_interrupt(PinIndex pin) noexcept { (void)pin; }
+
+    //! Set the ring that interrupt handlers record edges into (nullptr to stop).
+    //! @param ring The ring; must outlive the subscriptions.
+    void set_edge_ring(GpioEdgeRing* ring) noexcept { edge_ring_ = ring; }
+    //! Get the ring edges are recorded into.
+    GpioEdgeRing* edge_ring() const noexcept { return edge_ring_; }
+
+ protected:
+    //! Record an edge; safe to call from interrupt context.
+    //! @param pin The pin that changed.
+    //! @param level The level after the edge.
+    //! @param timestamp_ms Driver clock at the edge.
+    void record_edge(PinIndex pin, DigitalValue level, std::uint32_t timestamp_ms) noexcept {
+        if (edge_ring_) {
+            edge_ring_->push(EdgeRecord{pin, level, timestamp_ms});
+        }
+    }
+
+ private:
+    GpioEdgeRing* edge_ring_{nullptr};  //!<  Destination for recorded edges.
 };
 
 //! @class Pin
@@ -0,0 +1,126 @@
+//! @file jenlib/gpio/GpioEdgeMonitor.h
+//! @brief Debounces interrupt edges and posts kGpioChange events.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_GPIO_GPIOEDGEMONITOR_H_
+#define INCLUDE_JENLIB_GPIO_GPIOEDGEMONITOR_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <jenlib/events/EventTypes.h>
+#include <jenlib/gpio/GpioDriver.h>
+#include <jenlib/gpio/GpioEdgeRing.h>
+
+namespace jenlib::gpio {
+
+//! @brief Decoded payload of a kGpioChange event.
+//! @details Packed into Event::data as pin (bits 0-7), level (bit 8) and the
+//! number of raw edges coalesced into the event (bits 16-31).
+struct GpioChange {
+    PinIndex pin;              //!< Pin that settled on a new level.
+    DigitalValue level;        //!< The new, debounced level.
+    std::uint16_t edge_count;  //!< Raw edges folded into this change.
+
+    //! @brief Pack into an Event::data word.
+    static std::uint32_t encode(const GpioChange& change) {
+        return static_cast<std::uint32_t>(change.pin) |
+               (change.level == DigitalValue::HIGH ? 0x100u : 0u) |
+               (static_cast<std::uint32_t>(change.edge_count) << 16);
+    }
+
+    //! @brief Unpack from a kGpioChange event.
+    static GpioChange decode(const jenlib::events::Event& event) {
+        return GpioChange{
+            static_cast<PinIndex>(event.data & 0xFFu),
+            (event.data & 0x100u) ? DigitalValue::HIGH : DigitalValue::LOW,
+            static_cast<std::uint16_t>(event.data >> 16)};
+    }
+};
+
+//! @brief Turns raw interrupt edges into debounced GPIO change events.
+//! @details
+//! Owns the @ref GpioEdgeRing the driver's interrupt handlers write into.
+//! Call process() from the main loop: it drains the ring in one pass,
+//! tracks the latest level per pin and, once a pin has been quiet for its
+//! debounce window, posts a single kGpioChange event through the
+//! EventDispatcher. On CHANGE subscriptions, bounces that return to the
+//! previous level are dropped; RISING and FALLING subscriptions only see
+//! edges to one level, so every settled burst posts an event.
+//!
+//! @par Usage Example:
+//! @code
+//! jenlib::gpio::GpioEdgeMonitor buttons(&gpio_driver);
+//! buttons.subscribe(2, jenlib::gpio::InterruptEdge::CHANGE, 20);
+//!
+//! void loop() {
+//!     buttons.process();
+//!     event_dispatcher.process_events();
+//! }
+//! @endcode
+class GpioEdgeMonitor {
+ public:
+    //! @brief Maximum number of pins that can be watched at once.
+    static constexpr std::size_t kMaxSubscriptions = 8;
+
+    //! @brief Constructor; installs the monitor's ring on the driver.
+    explicit GpioEdgeMonitor(GpioDriver* driver) noexcept;
+
+    //! @brief Detaches all pins and removes the ring from the driver.
+    ~GpioEdgeMonitor();
+
+    GpioEdgeMonitor(const GpioEdgeMonitor&) = delete;
+    GpioEdgeMonitor& operator=(const GpioEdgeMonitor&) = delete;
+
+    //! @brief Watch a pin.
+    //! @param pin The pin index.
+    //! @param edge Which transitions to record.
+    //! @param debounce_ms Quiet time before a new level is reported.
+    //! @return false if the table is full or the driver has no interrupt support.
+    bool subscribe(PinIndex pin, InterruptEdge edge, std::uint32_t debounce_ms);
+
+    //! @brief Stop watching a pin.
+    //! @return true if the pin was subscribed.
+    bool unsubscribe(PinIndex pin);
+
+    //! @brief Drain edges and post settled changes, using Time::now().
+    //! @return Number of kGpioChange events dispatched.
+    std::size_t process();
+
+    //! @brief Drain edges and post settled changes at an explicit time.
+    //! @param now_ms Current time on the driver's clock.
+    //! @return Number of kGpioChange events dispatched.
+    std::size_t process(std::uint32_t now_ms);
+
+    //! @brief Edges lost because the ring overflowed between process() calls.
+    std::uint32_t dropped_edges() const noexcept { return ring_.dropped(); }
+
+    //! @brief Total raw edges consumed so far.
+    std::uint32_t consumed_edges() const noexcept { return consumed_edges_; }
+
+ private:
+    //! @brief Per-pin debounce state.
+    struct Subscription {
+        PinIndex pin{0};
+        std::uint32_t debounce_ms{0};
+        std::uint32_t last_edge_ms{0};
+        DigitalValue stable_level{};
+        DigitalValue pending_level{};
+        std::uint16_t pending_edges{0};
+        InterruptEdge edge{InterruptEdge::CHANGE};
+        bool active{false};
+    };
+
+    //! @brief Find the active subscription for a pin.
+    Subscription* find(PinIndex pin);
+
+    GpioDriver* driver_;
+    GpioEdgeRing ring_;
+    std::array<Subscription, kMaxSubscriptions> subscriptions_{};
+    std::uint32_t consumed_edges_{0};
+};
+
+}  // namespace jenlib::gpio
+
+#endif  // INCLUDE_JENLIB_GPIO_GPIOEDGEMONITOR_H_
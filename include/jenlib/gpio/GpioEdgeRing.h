@@ -0,0 +1,84 @@
+//! @file jenlib/gpio/GpioEdgeRing.h
+//! @brief ISR-safe ring buffer of timestamped GPIO edges.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_GPIO_GPIOEDGERING_H_
+#define INCLUDE_JENLIB_GPIO_GPIOEDGERING_H_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace jenlib::gpio {
+
+enum class DigitalValue : std::uint8_t;
+using PinIndex = std::uint8_t;
+
+//! @brief One edge as seen by the interrupt handler.
+struct EdgeRecord {
+    PinIndex pin;                //!< Pin that changed.
+    DigitalValue level;          //!< Level after the edge.
+    std::uint32_t timestamp_ms;  //!< Driver clock at the edge.
+};
+
+//! @brief Single-producer/single-consumer ring for edges.
+//! @details
+//! The interrupt handler is the only producer and the main loop the only
+//! consumer, so two atomic indices are enough: no locks, no allocation.
+//! When full, new edges are dropped and counted rather than overwriting
+//! records the consumer may be reading.
+class GpioEdgeRing {
+ public:
+    //! @brief Ring capacity (power of two).
+    static constexpr std::size_t kCapacity = 64;
+
+    //! @brief Record an edge (call from ISR context).
+    //! @return false if the ring was full and the edge was dropped.
+    bool push(const EdgeRecord& record) noexcept {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        const std::size_t tail = tail_.load(std::memory_order_acquire);
+        if (head - tail >= kCapacity) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        records_[head % kCapacity] = record;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    //! @brief Move up to @p max_records edges into @p out (main loop only).
+    //! @return Number of edges copied.
+    std::size_t drain(EdgeRecord* out, std::size_t max_records) noexcept {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        const std::size_t head = head_.load(std::memory_order_acquire);
+        std::size_t count = head - tail;
+        if (count > max_records) {
+            count = max_records;
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = records_[(tail + i) % kCapacity];
+        }
+        tail_.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    //! @brief Number of edges waiting to be drained.
+    std::size_t size() const noexcept {
+        return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+    }
+
+    //! @brief Number of edges dropped because the ring was full.
+    std::uint32_t dropped() const noexcept { return dropped_.load(std::memory_order_relaxed); }
+
+ private:
+    std::array<EdgeRecord, kCapacity> records_{};
+    std::atomic<std::size_t> head_{0};
+    std::atomic<std::size_t> tail_{0};
+    std::atomic<std::uint32_t> dropped_{0};
+};
+
+}  // namespace jenlib::gpio
+
+#endif  // INCLUDE_JENLIB_GPIO_GPIOEDGERING_H_
@@ -6,6 +6,8 @@
 #ifndef INCLUDE_JENLIB_GPIO_DRIVERS_ARDUINOGPIODRIVER_H_
 #define INCLUDE_JENLIB_GPIO_DRIVERS_ARDUINOGPIODRIVER_H_
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include "jenlib/gpio/GpioDriver.h"
 
@@ -29,9 +31,27 @@ class ArduinoGpioDriver : public GpioDriver {
     std::uint8_t get_analog_read_resolution() const noexcept override;
     std::uint8_t get_analog_write_resolution() const noexcept override;
 
+    bool attach_interrupt(PinIndex pin, InterruptEdge edge) noexcept override;
+    void detach_interrupt(PinIndex pin) noexcept override;
+
+    //! @brief Maximum number of pins with an attached interrupt.
+    static constexpr std::size_t kMaxInterruptPins = 8;
+
  private:
+    //! @brief Record an edge for the pin bound to an interrupt slot.
+    void on_interrupt(std::size_t slot) noexcept;
+
+    //! @brief Plain-function ISR for slot @p Slot (attachInterrupt takes no context).
+    template <std::size_t Slot>
+    static void isr_trampoline();
+
     std::uint8_t analog_read_bits_{10};
     std::uint8_t analog_write_bits_{8};
+    std::array<PinIndex, kMaxInterruptPins> interrupt_pins_{};
+    std::array<bool, kMaxInterruptPins> interrupt_used_{};
+
+    //! @brief Driver that owns the interrupt slots (one GPIO driver per board).
+    static ArduinoGpioDriver* isr_owner_;
 };
 
 }  // namespace jenlib::gpio
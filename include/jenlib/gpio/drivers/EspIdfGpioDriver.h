@@ -53,7 +53,25 @@ class EspIdfGpioDriver : public GpioDriver {
     //! @brief Get the analog write resolution.
     std::uint8_t get_analog_write_resolution() const noexcept override;
 
+    //! @brief Attach an edge interrupt using the ESP-IDF GPIO ISR service.
+    bool attach_interrupt(PinIndex pin, InterruptEdge edge) noexcept override;
+
+    //! @brief Detach an edge interrupt.
+    void detach_interrupt(PinIndex pin) noexcept override;
+
  private:
+    //! @brief Per-pin ISR argument.
+    struct InterruptContext {
+        EspIdfGpioDriver* driver;
+        PinIndex pin;
+    };
+
+    //! @brief GPIO ISR service handler; records the edge into the ring.
+    static void isr_handler(void* arg);
+
+    bool isr_service_installed_ = false;
+    std::array<InterruptContext, GPIO_NUM_MAX> interrupt_contexts_{};
+
     std::uint8_t analog_read_bits_ = 12;   //!< ADC resolution in bits
     std::uint8_t analog_write_bits_ = 8;  //!< PWM resolution in bits
 
@@ -0,0 +1,114 @@
+//! @file jenlib/gpio/drivers/NativeAnalogSources.h
+//! @brief Scripted analog waveforms for the native GPIO driver.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_GPIO_DRIVERS_NATIVEANALOGSOURCES_H_
+#define INCLUDE_JENLIB_GPIO_DRIVERS_NATIVEANALOGSOURCES_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <vector>
+
+//! @namespace jenlib::gpio
+//! @brief GPIO namespace.
+namespace jenlib::gpio {
+
+//! @brief A voltage that varies with the native driver's virtual clock.
+//! @details Attach with NativeGpioDriver::set_pin_source(); analog_read and
+//! digital_read then sample the source at the driver's current virtual time.
+class AnalogSource {
+ public:
+    virtual ~AnalogSource() = default;
+
+    //! @brief Voltage at a point in virtual time.
+    //! @param time_ns Virtual time in nanoseconds.
+    virtual float voltage_at(std::uint64_t time_ns) const = 0;
+};
+
+//! @brief offset + amplitude * sin(2*pi*frequency*t + phase).
+class SineSource : public AnalogSource {
+ public:
+    SineSource(float offset_volts, float amplitude_volts, float frequency_hz, float phase_rad = 0.0f) noexcept
+        : offset_volts_(offset_volts), amplitude_volts_(amplitude_volts),
+          frequency_hz_(frequency_hz), phase_rad_(phase_rad) {}
+
+    float voltage_at(std::uint64_t time_ns) const override;
+
+ private:
+    float offset_volts_;
+    float amplitude_volts_;
+    float frequency_hz_;
+    float phase_rad_;
+};
+
+//! @brief Linear ramp from start to end over a duration, then held (or repeated).
+class RampSource : public AnalogSource {
+ public:
+    RampSource(float start_volts, float end_volts, std::uint64_t duration_ns, bool repeat = false) noexcept
+        : start_volts_(start_volts), end_volts_(end_volts), duration_ns_(duration_ns), repeat_(repeat) {}
+
+    float voltage_at(std::uint64_t time_ns) const override;
+
+ private:
+    float start_volts_;
+    float end_volts_;
+    std::uint64_t duration_ns_;
+    bool repeat_;
+};
+
+//! @brief Uniform noise of +/- amplitude around a mean.
+//! @details The value is a hash of (seed, time), so a given virtual time always
+//! reads the same voltage regardless of how often or in what order it is sampled.
+class NoiseSource : public AnalogSource {
+ public:
+    NoiseSource(float mean_volts, float amplitude_volts, std::uint64_t seed = 1) noexcept
+        : mean_volts_(mean_volts), amplitude_volts_(amplitude_volts), seed_(seed) {}
+
+    float voltage_at(std::uint64_t time_ns) const override;
+
+ private:
+    float mean_volts_;
+    float amplitude_volts_;
+    std::uint64_t seed_;
+};
+
+//! @brief Replays recorded "time_ms,volts" rows with zero-order hold.
+//! @details Rows must be in ascending time. Blank lines and lines starting
+//! with '#' or a non-numeric header are skipped. Before the first row the
+//! first voltage is returned; after the last row the last voltage is held,
+//! or the recording loops if enabled.
+class CsvSource : public AnalogSource {
+ public:
+    //! @brief One recorded sample.
+    struct Sample {
+        std::uint64_t time_ns;
+        float volts;
+    };
+
+    //! @brief Parse rows from a stream, replacing any loaded samples.
+    //! @return false if a row is malformed, out of order or nothing was loaded.
+    bool load(std::istream& in);
+
+    //! @brief Parse rows from a file.
+    //! @return false if the file cannot be opened or parsed.
+    bool load_file(const std::string& path);
+
+    //! @brief Loop the recording instead of holding the last value.
+    void set_loop(bool loop) noexcept { loop_ = loop; }
+
+    //! @brief Loaded samples.
+    const std::vector<Sample>& samples() const noexcept { return samples_; }
+
+    float voltage_at(std::uint64_t time_ns) const override;
+
+ private:
+    std::vector<Sample> samples_{};
+    bool loop_{false};
+};
+
+}  // namespace jenlib::gpio
+
+#endif  // INCLUDE_JENLIB_GPIO_DRIVERS_NATIVEANALOGSOURCES_H_
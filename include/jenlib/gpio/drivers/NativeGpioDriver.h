@@ -7,14 +7,56 @@
 #define INCLUDE_JENLIB_GPIO_DRIVERS_NATIVEGPIODRIVER_H_
 
 #include <jenlib/gpio/GpioDriver.h>
+#include <jenlib/gpio/drivers/NativeAnalogSources.h>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
 #include <unordered_map>  // OK for desktop; NativeGpioDriver doesn't run on Arduino
+#include <vector>
 
 //! @namespace jenlib::gpio
 //! @brief GPIO namespace.
 namespace jenlib::gpio {
 
+//! @enum GpioTraceOp
+//! @brief Driver call captured in a GPIO trace.
+enum class GpioTraceOp : std::uint8_t {
+    kSetMode,
+    kDigitalWrite,
+    kDigitalRead,
+    kAnalogWrite,
+    kAnalogRead,
+};
+
+//! @brief One traced driver call.
+struct GpioTraceRecord {
+    std::uint64_t timestamp_ns;  //!< Virtual time of the call.
+    PinIndex pin;                //!< Pin addressed.
+    GpioTraceOp op;              //!< Which call.
+    std::uint16_t value;         //!< Mode, level or analog code (written or returned).
+};
+
+//! @brief Per-pin call counters collected while tracing.
+struct GpioPinStats {
+    std::uint32_t mode_calls{0};
+    std::uint32_t write_calls{0};
+    std::uint32_t read_calls{0};
+    std::uint32_t analog_calls{0};
+    std::uint32_t toggles{0};  //!< Changes of the driven digital level.
+};
+
 //! @class NativeGpioDriver
 //! @brief Native GPIO driver.
+//! @details
+//! Tracing is opt-in: enable_trace() preallocates a record buffer and every
+//! mode/write/read call is then stamped with a virtual clock. The clock only
+//! moves when the caller advances it (e.g. from a protocol's delay hook) or by
+//! the configured per-call cost, so traces are deterministic. export_vcd()
+//! writes the driven levels as a Value Change Dump for GTKWave.
+//!
+//! The same virtual clock drives scripted analog sources: a pin with an
+//! @ref AnalogSource attached reads the source's voltage at the current
+//! virtual time, through the usual resolution and reference scaling.
 class NativeGpioDriver : public GpioDriver {
  public:
         //! @brief Set the reference voltage.
@@ -41,46 +83,58 @@ class NativeGpioDriver : public GpioDriver {
         void set_pin_voltage(PinIndex pin, float volts) noexcept {
             pin_voltage_volts_[pin] = volts;
         }
+        //! @brief Drive a pin from a scripted waveform.
+        //! @details Takes precedence over set_pin_voltage() until cleared.
+        //! @param pin The pin index.
+        //! @param source Waveform owned by the caller; nullptr detaches it.
+        void set_pin_source(PinIndex pin, const AnalogSource* source) noexcept {
+            if (source) {
+                pin_sources_[pin] = source;
+            } else {
+                pin_sources_.erase(pin);
+            }
+        }
 
         void set_pin_mode(PinIndex pin, PinMode mode) noexcept override {
             pin_modes_[pin] = mode;
+            if (tracing_) {
+                trace_call(pin, GpioTraceOp::kSetMode, static_cast<std::uint16_t>(mode));
+            }
         }
 
         void digital_write(PinIndex pin, DigitalValue value) noexcept override {
+            if (tracing_) {
+                auto it = digital_values_.find(pin);
+                const DigitalValue previous = it != digital_values_.end() ? it->second : DigitalValue::LOW;
+                if (previous != value) {
+                    ++pin_stats_[pin].toggles;
+                }
+                trace_call(pin, GpioTraceOp::kDigitalWrite, static_cast<std::uint16_t>(value));
+            }
             digital_values_[pin] = value;
         }
 
         DigitalValue digital_read(PinIndex pin) noexcept override {
-            auto vit = pin_voltage_volts_.find(pin);
-            if (vit != pin_voltage_volts_.end()) {
-                const float threshold = reference_voltage_volts_ * digital_threshold_ratio_;
-                return vit->second >= threshold ? DigitalValue::HIGH : DigitalValue::LOW;
+            const DigitalValue value = sample_digital(pin);
+            if (tracing_) {
+                trace_call(pin, GpioTraceOp::kDigitalRead, static_cast<std::uint16_t>(value));
             }
-            auto it = digital_values_.find(pin);
-            return it != digital_values_.end() ? it->second : DigitalValue::LOW;
+            return value;
         }
 
         void analog_write(PinIndex pin, std::uint16_t value) noexcept override {
             analog_values_[pin] = value;
+            if (tracing_) {
+                trace_call(pin, GpioTraceOp::kAnalogWrite, value);
+            }
         }
 
         std::uint16_t analog_read(PinIndex pin) noexcept override {
-            auto vit = pin_voltage_volts_.find(pin);
-            if (vit != pin_voltage_volts_.end()) {
-                const std::uint16_t max_code =
-                    static_cast<std::uint16_t>((1u << analog_read_bits_) - 1u);
-                float volts = vit->second;
-                if (volts < 0.0f) volts = 0.0f;
-                if (volts > reference_voltage_volts_) volts = reference_voltage_volts_;
-                const float ratio = reference_voltage_volts_ > 0.0f
-                                       ? (volts / reference_voltage_volts_)
-                                       : 0.0;
-                const unsigned int code = static_cast<unsigned int>(
-                    ratio * static_cast<float>(max_code) + 0.5f);
-                return static_cast<std::uint16_t>(code);
+            const std::uint16_t value = sample_analog(pin);
+            if (tracing_) {
+                trace_call(pin, GpioTraceOp::kAnalogRead, value);
             }
-            auto it = analog_values_.find(pin);
-            return it != analog_values_.end() ? it->second : 0;
+            return value;
         }
 
         void set_analog_read_resolution(std::uint8_t bits) noexcept override {
@@ -99,15 +153,176 @@ class NativeGpioDriver : public GpioDriver {
             return analog_write_bits_;
         }
 
+        bool attach_interrupt(PinIndex pin, InterruptEdge edge) noexcept override {
+            interrupt_edges_[pin] = edge;
+            return true;
+        }
+
+        void detach_interrupt(PinIndex pin) noexcept override {
+            interrupt_edges_.erase(pin);
+        }
+
+        //! @brief Simulate an external signal edge on a pin.
+        //! @details Drives the pin to @p level and, if an interrupt is attached
+        //! for that transition, records the edge as the ISR would.
+        //! @param pin The pin index.
+        //! @param level The level after the edge.
+        //! @param timestamp_ms Virtual time of the edge.
+        void inject_edge(PinIndex pin, DigitalValue level, std::uint32_t timestamp_ms) noexcept {
+            const DigitalValue previous = sample_digital(pin);
+            digital_values_[pin] = level;
+            pin_voltage_volts_.erase(pin);
+            pin_sources_.erase(pin);
+            if (previous == level) {
+                return;
+            }
+            auto it = interrupt_edges_.find(pin);
+            if (it == interrupt_edges_.end()) {
+                return;
+            }
+            const bool rising = level == DigitalValue::HIGH;
+            if (it->second == InterruptEdge::CHANGE ||
+                (it->second == InterruptEdge::RISING && rising) ||
+                (it->second == InterruptEdge::FALLING && !rising)) {
+                record_edge(pin, level, timestamp_ms);
+            }
+        }
+
+        //! @brief Start recording driver calls.
+        //! @details Clears any previous trace and statistics and resets the virtual clock.
+        //! @param capacity Records to preallocate; calls beyond it are counted but not stored.
+        void enable_trace(std::size_t capacity) {
+            trace_.clear();
+            trace_.reserve(capacity);
+            trace_capacity_ = capacity;
+            trace_dropped_ = 0;
+            pin_stats_.clear();
+            virtual_time_ns_ = 0;
+            tracing_ = true;
+        }
+
+        //! @brief Stop recording; the captured trace stays available.
+        void disable_trace() noexcept { tracing_ = false; }
+
+        //! @brief Whether calls are currently being recorded.
+        bool is_tracing() const noexcept { return tracing_; }
+
+        //! @brief Recorded calls, oldest first.
+        const std::vector<GpioTraceRecord>& trace() const noexcept { return trace_; }
+
+        //! @brief Calls not stored because the trace buffer was full.
+        std::size_t trace_dropped() const noexcept { return trace_dropped_; }
+
+        //! @brief Advance the virtual clock, e.g. from a bit-banged protocol's delay hook.
+        void advance_time_us(std::uint32_t microseconds) noexcept {
+            virtual_time_ns_ += static_cast<std::uint64_t>(microseconds) * 1000u;
+        }
+
+        //! @brief Advance the virtual clock in nanoseconds.
+        void advance_time_ns(std::uint64_t nanoseconds) noexcept { virtual_time_ns_ += nanoseconds; }
+
+        //! @brief Virtual time charged to every traced call (default 0).
+        void set_call_cost_ns(std::uint32_t nanoseconds) noexcept { call_cost_ns_ = nanoseconds; }
+
+        //! @brief Current virtual time in nanoseconds.
+        std::uint64_t virtual_time_ns() const noexcept { return virtual_time_ns_; }
+
+        //! @brief Call counters for a pin since enable_trace().
+        GpioPinStats pin_stats(PinIndex pin) const {
+            auto it = pin_stats_.find(pin);
+            return it != pin_stats_.end() ? it->second : GpioPinStats{};
+        }
+
+        //! @brief Driven-level toggles per second of virtual time.
+        //! @return 0 when no virtual time has elapsed.
+        double toggles_per_second(PinIndex pin) const;
+
+        //! @brief Write the trace as a Value Change Dump (1 ns timescale).
+        //! @details One wire per traced pin: the written level while the pin is an
+        //! output, 1/0 for pull-up/pull-down inputs and z for floating inputs.
+        //! @param out Destination stream.
+        void export_vcd(std::ostream& out) const;
+
  private:
+        //! @brief Stamp and store one call.
+        void trace_call(PinIndex pin, GpioTraceOp op, std::uint16_t value) {
+            GpioPinStats& stats = pin_stats_[pin];
+            switch (op) {
+                case GpioTraceOp::kSetMode: ++stats.mode_calls; break;
+                case GpioTraceOp::kDigitalWrite: ++stats.write_calls; break;
+                case GpioTraceOp::kDigitalRead: ++stats.read_calls; break;
+                case GpioTraceOp::kAnalogWrite:
+                case GpioTraceOp::kAnalogRead: ++stats.analog_calls; break;
+            }
+            if (trace_.size() < trace_capacity_) {
+                trace_.push_back(GpioTraceRecord{virtual_time_ns_, pin, op, value});
+            } else {
+                ++trace_dropped_;
+            }
+            virtual_time_ns_ += call_cost_ns_;
+        }
+
+        //! @brief Analog voltage on a pin, from its source or set_pin_voltage().
+        //! @return false if the pin has no analog voltage and falls back to stored values.
+        bool pin_voltage(PinIndex pin, float& volts) const {
+            auto sit = pin_sources_.find(pin);
+            if (sit != pin_sources_.end()) {
+                volts = sit->second->voltage_at(virtual_time_ns_);
+                return true;
+            }
+            auto vit = pin_voltage_volts_.find(pin);
+            if (vit != pin_voltage_volts_.end()) {
+                volts = vit->second;
+                return true;
+            }
+            return false;
+        }
+
+        DigitalValue sample_digital(PinIndex pin) const noexcept {
+            float volts = 0.0f;
+            if (pin_voltage(pin, volts)) {
+                const float threshold = reference_voltage_volts_ * digital_threshold_ratio_;
+                return volts >= threshold ? DigitalValue::HIGH : DigitalValue::LOW;
+            }
+            auto it = digital_values_.find(pin);
+            return it != digital_values_.end() ? it->second : DigitalValue::LOW;
+        }
+
+        std::uint16_t sample_analog(PinIndex pin) const noexcept {
+            float volts = 0.0f;
+            if (pin_voltage(pin, volts)) {
+                const std::uint16_t max_code =
+                    static_cast<std::uint16_t>((1u << analog_read_bits_) - 1u);
+                if (volts < 0.0f) volts = 0.0f;
+                if (volts > reference_voltage_volts_) volts = reference_voltage_volts_;
+                const float ratio = reference_voltage_volts_ > 0.0f
+                                       ? (volts / reference_voltage_volts_)
+                                       : 0.0;
+                const unsigned int code = static_cast<unsigned int>(
+                    ratio * static_cast<float>(max_code) + 0.5f);
+                return static_cast<std::uint16_t>(code);
+            }
+            auto it = analog_values_.find(pin);
+            return it != analog_values_.end() ? it->second : 0;
+        }
+
         std::unordered_map<PinIndex, PinMode> pin_modes_{};
         std::unordered_map<PinIndex, DigitalValue> digital_values_{};
         std::unordered_map<PinIndex, std::uint16_t> analog_values_{};
         std::unordered_map<PinIndex, float> pin_voltage_volts_{};
+        std::unordered_map<PinIndex, const AnalogSource*> pin_sources_{};
+        std::unordered_map<PinIndex, InterruptEdge> interrupt_edges_{};
         std::uint8_t analog_read_bits_{10};
         std::uint8_t analog_write_bits_{8};
         float reference_voltage_volts_{3.3f};
         float digital_threshold_ratio_{0.5f};
+        bool tracing_{false};
+        std::vector<GpioTraceRecord> trace_{};
+        std::size_t trace_capacity_{0};
+        std::size_t trace_dropped_{0};
+        std::unordered_map<PinIndex, GpioPinStats> pin_stats_{};
+        std::uint64_t virtual_time_ns_{0};
+        std::uint32_t call_cost_ns_{0};
 };
 
 }  // namespace jenlib::gpio
@@ -0,0 +1,98 @@
+//! @file jenlib/measurement/AdaptiveSampling.h
+//! @brief Measurement interval that follows the dynamics of the signal.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_MEASUREMENT_ADAPTIVESAMPLING_H_
+#define INCLUDE_JENLIB_MEASUREMENT_ADAPTIVESAMPLING_H_
+
+#include <cstdint>
+#include "jenlib/ble/Messages.h"
+
+namespace jenlib::measurement {
+
+//! @brief Adaptive sampling bounds and sensitivity.
+struct AdaptiveSamplingConfig {
+    std::uint32_t min_interval_ms{1000};           //!< Shortest interval (broker-configured).
+    std::uint32_t max_interval_ms{60000};          //!< Longest interval (broker-configured).
+    std::uint16_t temperature_step_centi{10};      //!< Temperature change per interval worth resolving.
+    std::uint16_t humidity_step_bp{50};            //!< Humidity change per interval worth resolving.
+};
+
+//! @brief Chooses the next measurement interval from the readings so far.
+//! @details
+//! Each reading is compared with the previous one and the change is scaled
+//! by the step sizes into an activity figure, where 1.0 means one step per
+//! interval. The sampler then:
+//! - shortens the interval in proportion when activity exceeds 1.0, so the
+//!   next interval is expected to see about one step;
+//! - halves it when the running variance of the activity is high, since an
+//!   erratic signal cannot be predicted from one quiet interval;
+//! - doubles it when activity is below 0.5 and the variance is low, so a
+//!   steady signal backs off exponentially up to max_interval_ms.
+//!
+//! Steps usually match the send-on-delta deadbands, so the interval tracks
+//! how often a reading would be worth sending. Arithmetic is integer-only.
+//!
+//! @par Usage Example:
+//! @code
+//! jenlib::measurement::AdaptiveSampler sampler({1000, 60000, 10, 50});
+//! auto timer = jenlib::time::schedule_repeating_timer(sampler.interval_ms(), on_sample);
+//!
+//! void on_sample() {
+//!     const auto reading = take_reading();
+//!     const std::uint32_t before = sampler.interval_ms();
+//!     if (sampler.update(reading) != before) {
+//!         jenlib::time::Time::reschedule_callback(timer, sampler.interval_ms());
+//!     }
+//! }
+//! @endcode
+class AdaptiveSampler {
+ public:
+    //! @brief Constructor; starts at the shortest interval.
+    explicit AdaptiveSampler(const AdaptiveSamplingConfig& config = AdaptiveSamplingConfig{}) noexcept;
+
+    //! @brief Replace the configuration, clamping the current interval to the new bounds.
+    void configure(const AdaptiveSamplingConfig& config) noexcept;
+
+    //! @brief Replace only the bounds, e.g. from a broker SamplingConfigMsg.
+    //! @return false (and no change) if min is zero or greater than max.
+    bool set_bounds(std::uint32_t min_interval_ms, std::uint32_t max_interval_ms) noexcept;
+
+    //! @brief Current configuration.
+    const AdaptiveSamplingConfig& config() const noexcept { return config_; }
+
+    //! @brief Forget the signal history and return to the shortest interval.
+    void reset() noexcept;
+
+    //! @brief Forget the signal history but carry on from @p interval_ms, clamped to the bounds.
+    //! @details For a session restored after a reboot, which should not fall back to the shortest interval.
+    void resume(std::uint32_t interval_ms) noexcept;
+
+    //! @brief Feed a reading and compute the interval until the next one.
+    //! @param reading The reading just taken.
+    //! @return The new measurement interval in milliseconds.
+    std::uint32_t update(const jenlib::ble::ReadingMsg& reading) noexcept;
+
+    //! @brief Current measurement interval in milliseconds.
+    std::uint32_t interval_ms() const noexcept { return interval_ms_; }
+
+    //! @brief Activity of the last reading in Q8 (256 = one step per interval).
+    std::uint32_t activity_q8() const noexcept { return activity_q8_; }
+
+ private:
+    void clamp_interval() noexcept;
+
+    AdaptiveSamplingConfig config_;
+    std::uint32_t interval_ms_{0};
+    bool has_previous_{false};
+    std::int16_t previous_temperature_centi_{0};
+    std::uint16_t previous_humidity_bp_{0};
+    std::uint32_t activity_q8_{0};
+    std::int32_t activity_mean_q8_{0};
+    std::uint32_t activity_variance_q16_{0};
+};
+
+}  // namespace jenlib::measurement
+
+#endif  // INCLUDE_JENLIB_MEASUREMENT_ADAPTIVESAMPLING_H_
@@ -0,0 +1,196 @@
+//! @file jenlib/measurement/Aggregates.h
+//! @brief Incremental per-session and per-bucket reading statistics.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_MEASUREMENT_AGGREGATES_H_
+#define INCLUDE_JENLIB_MEASUREMENT_AGGREGATES_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "jenlib/ble/Messages.h"
+
+namespace jenlib::measurement {
+
+//! @brief Count, minimum, maximum, mean and variance of a value stream.
+//! @details
+//! Updated in O(1) per value with Welford's method, which stays accurate
+//! where the naive sum of squares cancels. Values are in wire units
+//! (centi-degrees, basis points); min and max stay integers, mean and the
+//! sum of squared deviations are single-precision floats so the update is
+//! cheap on an FPU without double support.
+class RunningStats {
+ public:
+    //! @brief Add one value.
+    void add(std::int32_t value) noexcept;
+
+    //! @brief Fold another set of statistics into this one, as if its values had been added here.
+    void merge(const RunningStats& other) noexcept;
+
+    //! @brief Forget every value.
+    void reset() noexcept { *this = RunningStats{}; }
+
+    //! @brief Values added.
+    std::uint32_t count() const noexcept { return count_; }
+
+    //! @brief Smallest value (0 when empty).
+    std::int32_t min() const noexcept { return min_; }
+
+    //! @brief Largest value (0 when empty).
+    std::int32_t max() const noexcept { return max_; }
+
+    //! @brief Arithmetic mean (0 when empty).
+    float mean() const noexcept { return mean_; }
+
+    //! @brief Population variance (0 with fewer than two values).
+    float variance() const noexcept { return count_ > 1 ? m2_ / static_cast<float>(count_) : 0.0f; }
+
+ private:
+    std::uint32_t count_{0};
+    std::int32_t min_{0};
+    std::int32_t max_{0};
+    float mean_{0.0f};
+    float m2_{0.0f};  // Sum of squared deviations from the mean
+};
+
+//! @brief Statistics of both channels over a span of readings.
+struct ReadingAggregate {
+    std::uint32_t first_offset_ms{0};
+    std::uint32_t last_offset_ms{0};
+    RunningStats temperature_c_centi;
+    RunningStats humidity_bp;
+
+    //! @brief Add one reading.
+    void add(const jenlib::ble::ReadingMsg& reading) noexcept;
+
+    //! @brief Readings added.
+    std::uint32_t count() const noexcept { return temperature_c_centi.count(); }
+};
+
+//! @brief Aggregate of the readings in one time bucket.
+struct AggregateBucket {
+    std::uint32_t start_ms{0};  //!< Session offset the bucket starts at
+    ReadingAggregate stats;
+};
+
+//! @brief Session-wide statistics plus fixed-width time buckets, ready for upload.
+//! @details
+//! Each reading updates the session aggregate and the open bucket in O(1).
+//! When a reading falls in a later bucket the open one is closed into a ring
+//! of @p Capacity completed buckets; drain() hands them over for upload. If
+//! the ring is full the oldest bucket is overwritten and counted as dropped.
+//! Readings must arrive in offset order; one for an already closed bucket is
+//! rejected.
+//! @tparam Capacity Completed buckets retained until drained.
+//!
+//! @par Usage Example:
+//! @code
+//! jenlib::measurement::BucketedAggregates<16> aggregates(60000);  // One-minute buckets
+//! aggregates.add(reading_msg);
+//! aggregates.drain(std::back_inserter(upload_batch));
+//! const float mean_c = aggregates.session().temperature_c_centi.mean() / 100.0f;
+//! @endcode
+template <std::size_t Capacity>
+class BucketedAggregates {
+    static_assert(Capacity > 0, "BucketedAggregates needs room for at least one bucket");
+
+ public:
+    //! @brief Constructor.
+    //! @param bucket_ms Bucket width (0 = a single bucket for the whole session).
+    explicit BucketedAggregates(std::uint32_t bucket_ms = 60000) noexcept : bucket_ms_(bucket_ms) {}
+
+    //! @brief Change the bucket width; drops everything held.
+    void set_bucket_ms(std::uint32_t bucket_ms) noexcept {
+        bucket_ms_ = bucket_ms;
+        clear();
+    }
+
+    //! @brief Bucket width.
+    std::uint32_t bucket_ms() const noexcept { return bucket_ms_; }
+
+    //! @brief Add a received reading.
+    //! @return false if the reading belongs to a bucket that is already closed.
+    bool add(const jenlib::ble::ReadingMsg& reading) noexcept {
+        const std::uint32_t start_ms = bucket_ms_ ? reading.offset_ms - reading.offset_ms % bucket_ms_ : 0;
+        if (has_open_ && start_ms != open_.start_ms) {
+            if (start_ms < open_.start_ms) {
+                return false;
+            }
+            flush();
+        }
+        if (!has_open_) {
+            open_ = AggregateBucket{start_ms, {}};
+            has_open_ = true;
+        }
+        open_.stats.add(reading);
+        session_.add(reading);
+        return true;
+    }
+
+    //! @brief Close the open bucket, e.g. at session end, so drain() includes it.
+    void flush() noexcept {
+        if (!has_open_) {
+            return;
+        }
+        completed_[(start_ + size_) % Capacity] = open_;
+        if (size_ < Capacity) {
+            ++size_;
+        } else {
+            start_ = (start_ + 1) % Capacity;
+            ++dropped_;
+        }
+        has_open_ = false;
+    }
+
+    //! @brief Move completed buckets, oldest first, to @p out and forget them.
+    //! @return Number of buckets written.
+    template <typename OutputIt>
+    std::size_t drain(OutputIt out) {
+        const std::size_t drained = size_;
+        for (std::size_t i = 0; i < drained; ++i) {
+            *out++ = at(i);
+        }
+        start_ = 0;
+        size_ = 0;
+        return drained;
+    }
+
+    //! @brief Statistics of every reading accepted since clear().
+    const ReadingAggregate& session() const noexcept { return session_; }
+
+    //! @brief Bucket still receiving readings, or nullptr.
+    const AggregateBucket* open_bucket() const noexcept { return has_open_ ? &open_ : nullptr; }
+
+    //! @brief Completed buckets held.
+    std::size_t size() const noexcept { return size_; }
+
+    //! @brief Completed bucket by age, 0 being the oldest held.
+    const AggregateBucket& at(std::size_t index) const noexcept { return completed_[(start_ + index) % Capacity]; }
+
+    //! @brief Completed buckets overwritten before they were drained.
+    std::uint32_t dropped() const noexcept { return dropped_; }
+
+    //! @brief Drop all statistics, e.g. at session start.
+    void clear() noexcept {
+        session_ = ReadingAggregate{};
+        has_open_ = false;
+        start_ = 0;
+        size_ = 0;
+        dropped_ = 0;
+    }
+
+ private:
+    std::uint32_t bucket_ms_;
+    ReadingAggregate session_{};
+    AggregateBucket open_{};
+    bool has_open_{false};
+    std::array<AggregateBucket, Capacity> completed_{};
+    std::size_t start_{0};
+    std::size_t size_{0};
+    std::uint32_t dropped_{0};
+};
+
+}  // namespace jenlib::measurement
+
+#endif  // INCLUDE_JENLIB_MEASUREMENT_AGGREGATES_H_
@@ -0,0 +1,134 @@
+//! @file jenlib/measurement/Downsample.h
+//! @brief Bounded-size downsampling of reading series for upload.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_MEASUREMENT_DOWNSAMPLE_H_
+#define INCLUDE_JENLIB_MEASUREMENT_DOWNSAMPLE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include "jenlib/measurement/SendOnDelta.h"
+
+namespace jenlib::measurement {
+
+//! @brief Read-only view of contiguous points, usable wherever a series is expected.
+//! @details The downsamplers take any series with size() and at(index), such
+//! as StepHoldSeries; this adapts a plain array or vector.
+struct SeriesSpan {
+    const SeriesPoint* points;
+    std::size_t count;
+
+    std::size_t size() const noexcept { return count; }
+    const SeriesPoint& at(std::size_t index) const noexcept { return points[index]; }
+};
+
+//! @brief Keep the lowest and highest temperature of each of @p buckets equal slices of a series.
+//! @details Emits at most 2 * @p buckets points, in offset order, so spikes
+//! survive however far the series is reduced. Humidity travels with the
+//! chosen points. Series no longer than 2 * @p buckets are copied whole.
+//! @return Number of points written.
+template <typename Series, typename OutputIt>
+std::size_t downsample_min_max(const Series& series, std::size_t buckets, OutputIt out) {
+    const std::size_t count = series.size();
+    if (buckets == 0) {
+        return 0;
+    }
+    if (count <= 2 * buckets) {
+        for (std::size_t i = 0; i < count; ++i) {
+            *out++ = series.at(i);
+        }
+        return count;
+    }
+    std::size_t written = 0;
+    for (std::size_t b = 0; b < buckets; ++b) {
+        const std::size_t begin = b * count / buckets;
+        const std::size_t end = (b + 1) * count / buckets;
+        std::size_t low = begin;
+        std::size_t high = begin;
+        for (std::size_t i = begin + 1; i < end; ++i) {
+            if (series.at(i).temperature_c_centi < series.at(low).temperature_c_centi) {
+                low = i;
+            } else if (series.at(i).temperature_c_centi > series.at(high).temperature_c_centi) {
+                high = i;
+            }
+        }
+        *out++ = series.at(low < high ? low : high);
+        ++written;
+        if (low != high) {
+            *out++ = series.at(low < high ? high : low);
+            ++written;
+        }
+    }
+    return written;
+}
+
+//! @brief Largest-Triangle-Three-Buckets reduction of a series to at most @p threshold points.
+//! @details Keeps the first and last point and, from each of the
+//! @p threshold - 2 slices in between, the point forming the largest triangle
+//! with the previously kept point and the average of the next slice. This
+//! preserves the visual shape of the temperature curve far better than
+//! decimation. Humidity travels with the chosen points. Series no longer
+//! than @p threshold are copied whole.
+//! @return Number of points written.
+template <typename Series, typename OutputIt>
+std::size_t downsample_lttb(const Series& series, std::size_t threshold, OutputIt out) {
+    const std::size_t count = series.size();
+    if (count <= threshold || threshold < 3) {
+        const std::size_t keep = count <= threshold ? count : threshold;
+        for (std::size_t i = 0; i < keep; ++i) {
+            *out++ = series.at(i == 1 && keep == 2 ? count - 1 : i);  // Two points: first and last
+        }
+        return keep;
+    }
+
+    // Offsets relative to the first point keep float precision over long sessions
+    const std::uint32_t origin_ms = series.at(0).offset_ms;
+    const auto x = [&series, origin_ms](std::size_t i) {
+        return static_cast<float>(series.at(i).offset_ms - origin_ms);
+    };
+    const auto y = [&series](std::size_t i) { return static_cast<float>(series.at(i).temperature_c_centi); };
+
+    const std::size_t slices = threshold - 2;
+    const std::size_t inner = count - 2;
+    const auto slice_begin = [slices, inner](std::size_t slice) { return 1 + slice * inner / slices; };
+
+    *out++ = series.at(0);
+    std::size_t kept = 0;
+    for (std::size_t slice = 0; slice < slices; ++slice) {
+        // Average of the next slice, or the last point after the final slice
+        const std::size_t next_begin = slice_begin(slice + 1);
+        const std::size_t next_end = slice + 1 < slices ? slice_begin(slice + 2) : count;
+        float avg_x = 0.0f;
+        float avg_y = 0.0f;
+        for (std::size_t i = next_begin; i < next_end; ++i) {
+            avg_x += x(i);
+            avg_y += y(i);
+        }
+        const float span = static_cast<float>(next_end - next_begin);
+        avg_x /= span;
+        avg_y /= span;
+
+        const float kept_x = x(kept);
+        const float kept_y = y(kept);
+        std::size_t best = slice_begin(slice);
+        float best_area = -1.0f;
+        for (std::size_t i = slice_begin(slice); i < next_begin; ++i) {
+            // Twice the triangle area; the factor does not change which point wins
+            float area = (kept_x - avg_x) * (y(i) - kept_y) - (kept_x - x(i)) * (avg_y - kept_y);
+            area = area < 0.0f ? -area : area;
+            if (area > best_area) {
+                best_area = area;
+                best = i;
+            }
+        }
+        *out++ = series.at(best);
+        kept = best;
+    }
+    *out++ = series.at(count - 1);
+    return threshold;
+}
+
+}  // namespace jenlib::measurement
+
+#endif  // INCLUDE_JENLIB_MEASUREMENT_DOWNSAMPLE_H_
@@ -0,0 +1,269 @@
+//! @file jenlib/measurement/Filters.h
+//! @brief Allocation-free fixed-point filters for smoothing sensor samples.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_MEASUREMENT_FILTERS_H_
+#define INCLUDE_JENLIB_MEASUREMENT_FILTERS_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include "jenlib/ble/Messages.h"
+
+//! @brief Fixed-point smoothing filters.
+//! @details
+//! The filters operate on integer samples in wire units (centi-degrees,
+//! basis points), so smoothing needs no floating point. Each filter keeps
+//! its state in fixed-size members and can be fed one sample at a time
+//! with update() or over a range with process().
+//!
+//! @par Usage Example:
+//! @code
+//! jenlib::measurement::MedianFilter<5> temperature_filter;
+//! jenlib::measurement::ExponentialMovingAverage<3> humidity_filter;
+//! jenlib::measurement::ReadingFilter smoother(temperature_filter, humidity_filter);
+//!
+//! jenlib::ble::ReadingMsg msg{id, session, offset, raw_centi, raw_bp};
+//! smoother.apply(msg);  // Replaces the raw values with filtered ones
+//! @endcode
+namespace jenlib::measurement {
+
+//! @brief Sample type shared by all filters (wire units).
+using Sample = std::int32_t;
+
+namespace detail {
+
+//! @brief Divide rounding half away from zero.
+constexpr std::int64_t div_round(std::int64_t numerator, std::int64_t denominator) {
+    return (numerator >= 0) == (denominator >= 0)
+               ? (numerator + denominator / 2) / denominator
+               : (numerator - denominator / 2) / denominator;
+}
+
+//! @brief Adds range processing to a filter with an update(Sample) method.
+template <typename Derived>
+class FilterBase {
+ public:
+    //! @brief Filter a range of samples.
+    //! @tparam InputIt Iterator over values convertible to Sample.
+    //! @tparam OutputIt Output iterator assignable from Sample.
+    //! @return Iterator past the last written output.
+    template <typename InputIt, typename OutputIt>
+    OutputIt process(InputIt first, InputIt last, OutputIt out) {
+        auto& self = static_cast<Derived&>(*this);
+        for (; first != last; ++first, ++out) {
+            *out = self.update(static_cast<Sample>(*first));
+        }
+        return out;
+    }
+};
+
+}  // namespace detail
+
+//! @brief Boxcar average of the last N samples.
+//! @details A running sum makes each update O(1). Until N samples have been
+//! seen the average is over the samples so far.
+template <std::size_t N>
+class MovingAverage : public detail::FilterBase<MovingAverage<N>> {
+    static_assert(N > 0, "MovingAverage needs a window of at least one sample");
+
+ public:
+    //! @brief Add a sample and return the rounded window average.
+    Sample update(Sample sample) {
+        if (count_ == N) {
+            sum_ -= window_[head_];
+        } else {
+            ++count_;
+        }
+        window_[head_] = sample;
+        sum_ += sample;
+        head_ = (head_ + 1) % N;
+        return static_cast<Sample>(detail::div_round(sum_, static_cast<std::int64_t>(count_)));
+    }
+
+    //! @brief Forget all samples.
+    void reset() {
+        sum_ = 0;
+        count_ = 0;
+        head_ = 0;
+    }
+
+ private:
+    std::array<Sample, N> window_{};
+    std::int64_t sum_{0};
+    std::size_t count_{0};
+    std::size_t head_{0};
+};
+
+//! @brief Exponential moving average with alpha = 1 / 2^Shift.
+//! @details The state is kept with Shift extra fraction bits so small steps
+//! are not lost to truncation. The first sample initializes the state.
+template <unsigned Shift>
+class ExponentialMovingAverage : public detail::FilterBase<ExponentialMovingAverage<Shift>> {
+    static_assert(Shift > 0 && Shift < 16, "Shift must be in 1..15");
+
+ public:
+    //! @brief Add a sample and return the rounded average.
+    Sample update(Sample sample) {
+        const std::int64_t scaled = static_cast<std::int64_t>(sample) * (std::int64_t{1} << Shift);
+        if (!primed_) {
+            state_ = scaled;
+            primed_ = true;
+        } else {
+            // state += (sample - state) * alpha, all in Q(Shift)
+            state_ += detail::div_round(scaled - state_, std::int64_t{1} << Shift);
+        }
+        return static_cast<Sample>(detail::div_round(state_, std::int64_t{1} << Shift));
+    }
+
+    //! @brief Forget the state; the next sample re-initializes it.
+    void reset() { primed_ = false; }
+
+ private:
+    std::int64_t state_{0};
+    bool primed_{false};
+};
+
+//! @brief Median of the last N samples (N odd), rejecting impulse noise.
+//! @details The window is copied and sorted with an odd-even transposition
+//! network: a fixed sequence of branch-free compare-exchanges. Until N samples
+//! have been seen the median is over the samples so far.
+template <std::size_t N>
+class MedianFilter : public detail::FilterBase<MedianFilter<N>> {
+    static_assert(N % 2 == 1, "MedianFilter needs an odd window");
+
+ public:
+    //! @brief Add a sample and return the window median.
+    Sample update(Sample sample) {
+        window_[head_] = sample;
+        head_ = (head_ + 1) % N;
+        if (count_ < N) {
+            ++count_;
+            return partial_median();
+        }
+        std::array<Sample, N> sorted = window_;
+        for (std::size_t round = 0; round < N; ++round) {
+            for (std::size_t i = round & 1u; i + 1 < N; i += 2) {
+                compare_exchange(sorted[i], sorted[i + 1]);
+            }
+        }
+        return sorted[N / 2];
+    }
+
+    //! @brief Forget all samples.
+    void reset() {
+        count_ = 0;
+        head_ = 0;
+    }
+
+ private:
+    static void compare_exchange(Sample& a, Sample& b) {
+        const Sample lo = a < b ? a : b;
+        const Sample hi = a < b ? b : a;
+        a = lo;
+        b = hi;
+    }
+
+    //! @brief Median of the first count_ samples (warm-up only).
+    Sample partial_median() const {
+        std::array<Sample, N> sorted = window_;
+        for (std::size_t i = 1; i < count_; ++i) {
+            for (std::size_t j = i; j > 0 && sorted[j - 1] > sorted[j]; --j) {
+                compare_exchange(sorted[j - 1], sorted[j]);
+            }
+        }
+        return sorted[(count_ - 1) / 2];
+    }
+
+    std::array<Sample, N> window_{};
+    std::size_t count_{0};
+    std::size_t head_{0};
+};
+
+//! @brief Scalar Kalman filter for a slowly varying value.
+//! @details Constant-value model: predict adds the process noise to the
+//! estimate variance, correct blends the sample in with gain
+//! K = P / (P + R) held in Q16. Variances are in squared sample units
+//! (e.g. centi-degrees^2). The first sample initializes the estimate.
+class Kalman1D : public detail::FilterBase<Kalman1D> {
+ public:
+    //! @brief Constructor.
+    //! @param process_variance Q: how much the true value may drift per sample.
+    //! @param measurement_variance R: sensor noise variance.
+    //! @param initial_variance P0: confidence in the first sample.
+    Kalman1D(std::int32_t process_variance, std::int32_t measurement_variance,
+             std::int32_t initial_variance = 0) noexcept
+        : q_(process_variance), r_(measurement_variance), p0_(initial_variance) {}
+
+    //! @brief Add a sample and return the rounded estimate.
+    Sample update(Sample sample) {
+        if (!primed_) {
+            estimate_q16_ = static_cast<std::int64_t>(sample) * kOne;
+            p_ = p0_ > 0 ? p0_ : r_;
+            primed_ = true;
+            return sample;
+        }
+        p_ += q_;
+        const std::int64_t denominator = p_ + static_cast<std::int64_t>(r_);
+        const std::int64_t gain_q16 = denominator > 0 ? detail::div_round(p_ * kOne, denominator) : kOne;
+        const std::int64_t innovation_q16 = static_cast<std::int64_t>(sample) * kOne - estimate_q16_;
+        estimate_q16_ += detail::div_round(innovation_q16 * gain_q16, kOne);
+        p_ = detail::div_round((kOne - gain_q16) * p_, kOne);
+        return static_cast<Sample>(detail::div_round(estimate_q16_, kOne));
+    }
+
+    //! @brief Current estimate variance P.
+    std::int64_t variance() const noexcept { return p_; }
+
+    //! @brief Forget the state; the next sample re-initializes it.
+    void reset() { primed_ = false; }
+
+ private:
+    static constexpr std::int64_t kOne = std::int64_t{1} << 16;
+
+    std::int32_t q_;
+    std::int32_t r_;
+    std::int32_t p0_;
+    std::int64_t estimate_q16_{0};
+    std::int64_t p_{0};
+    bool primed_{false};
+};
+
+//! @brief Applies one filter to temperature and another to humidity of a reading.
+//! @details Sits between sampling and serialization: fill a ReadingMsg with
+//! raw values, then apply() replaces them with filtered, range-clamped ones.
+//! @tparam TemperatureFilter Filter for temperature_c_centi.
+//! @tparam HumidityFilter Filter for humidity_bp.
+template <typename TemperatureFilter, typename HumidityFilter>
+class ReadingFilter {
+ public:
+    //! @brief Bind filters owned by the caller.
+    ReadingFilter(TemperatureFilter& temperature, HumidityFilter& humidity) noexcept
+        : temperature_(temperature), humidity_(humidity) {}
+
+    //! @brief Filter a reading in place.
+    void apply(jenlib::ble::ReadingMsg& msg) {
+        const Sample t = temperature_.update(msg.temperature_c_centi);
+        const Sample h = humidity_.update(msg.humidity_bp);
+        constexpr Sample kTempMin = std::numeric_limits<std::int16_t>::min();
+        constexpr Sample kTempMax = std::numeric_limits<std::int16_t>::max();
+        msg.temperature_c_centi = static_cast<std::int16_t>(t < kTempMin ? kTempMin : (t > kTempMax ? kTempMax : t));
+        msg.humidity_bp = static_cast<std::uint16_t>(h < 0 ? 0 : (h > 10000 ? 10000 : h));
+    }
+
+    //! @brief Reset both filters (e.g. at the start of a session).
+    void reset() {
+        temperature_.reset();
+        humidity_.reset();
+    }
+
+ private:
+    TemperatureFilter& temperature_;
+    HumidityFilter& humidity_;
+};
+
+}  // namespace jenlib::measurement
+
+#endif  // INCLUDE_JENLIB_MEASUREMENT_FILTERS_H_
@@ -0,0 +1,150 @@
+//! @file jenlib/measurement/LinkQuality.h
+//! @brief Per-session loss, reordering and jitter of a sensor's readings as seen by the broker.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_MEASUREMENT_LINKQUALITY_H_
+#define INCLUDE_JENLIB_MEASUREMENT_LINKQUALITY_H_
+
+#include <cstdint>
+#include "jenlib/ble/Messages.h"
+
+namespace jenlib::measurement {
+
+//! @brief Link-quality counters for one sensor session, updated in O(1) per reading.
+//! @details
+//! A sensor sampling every interval_ms stamps its readings with offsets on
+//! that grid, so offset / interval numbers the reading slots. The slots from
+//! the first reading to the newest one are expected; the ones received are
+//! tracked in a 64-slot bitmap behind the newest slot. That separates late
+//! arrivals (which fill a hole) from duplicates such as retransmissions.
+//! Readings older than the bitmap cannot be classified and are rejected.
+//!
+//! A jump of more than one slot is a streak of missing readings. Streaks are
+//! recorded when they open and are not shortened if late readings fill them.
+//! Jitter is the RFC 3550 interarrival estimate: a 1/16-gain running mean of
+//! how much each reading's arrival spacing differs from its offset spacing.
+//! Arrival times come from the broker's millisecond clock.
+//!
+//! Sensors that skip unchanged readings (send-on-delta) or adapt their
+//! interval do not send on a fixed grid. Track them with Cadence::kAtMost and
+//! the longest spacing they guarantee (the heartbeat, or the longest adaptive
+//! interval): a slot then counts as received once any reading lands in it,
+//! and only slots with no reading count as lost.
+//!
+//! @par Usage Example:
+//! @code
+//! jenlib::measurement::LinkQuality link(1000);
+//! link.add(reading_msg, jenlib::time::Time::now());
+//! if (link.loss_ratio() > 0.2f || link.longest_gap() > 10) {
+//!     request_retransmission(sensor_id);
+//! }
+//! @endcode
+class LinkQuality {
+ public:
+    //! @brief Slots behind the newest one in which late and duplicate readings are told apart.
+    static constexpr std::uint32_t kWindowSlots = 64;
+
+    //! @brief How a sensor's readings relate to the interval.
+    enum class Cadence : std::uint8_t {
+        kFixed,   //!< One reading per interval; each missing one is lost.
+        kAtMost,  //!< At least one reading per interval, possibly more; only empty slots are lost.
+    };
+
+    //! @brief Track a sensor sampling at the sensor default of 1000 ms.
+    LinkQuality() noexcept = default;
+
+    //! @param interval_ms Sensor sampling interval (0 disables tracking).
+    //! @param cadence Whether readings follow the interval exactly or only bound its spacing.
+    explicit LinkQuality(std::uint32_t interval_ms, Cadence cadence = Cadence::kFixed) noexcept
+        : interval_ms_(interval_ms), cadence_(cadence) {}
+
+    //! @brief Forget every reading, keeping the interval and cadence; e.g. at session start.
+    void reset() noexcept { *this = LinkQuality(interval_ms_, cadence_); }
+
+    //! @brief Switch to a new sampling interval from the newest reading on.
+    //! @details Counts so far are kept; slots restart at the newest reading.
+    void set_interval_ms(std::uint32_t interval_ms, Cadence cadence = Cadence::kFixed) noexcept;
+
+    //! @brief Sampling interval the slots are based on.
+    std::uint32_t interval_ms() const noexcept { return interval_ms_; }
+
+    //! @brief How readings relate to interval_ms().
+    Cadence cadence() const noexcept { return cadence_; }
+
+    //! @brief Account for one received reading.
+    //! @param offset_ms Session offset the sensor stamped on the reading.
+    //! @param arrival_ms Broker clock when the reading arrived.
+    //! @return false for duplicates, readings older than the window and when the interval is 0.
+    bool add(std::uint32_t offset_ms, std::uint32_t arrival_ms) noexcept;
+
+    //! @brief Account for one received reading.
+    bool add(const jenlib::ble::ReadingMsg& reading, std::uint32_t arrival_ms) noexcept {
+        return add(reading.offset_ms, arrival_ms);
+    }
+
+    //! @brief Readings the sensor should have sent, from the first one received to the newest.
+    std::uint32_t expected() const noexcept { return started_ ? carried_expected_ + newest_slot_ + 1 : 0; }
+
+    //! @brief Distinct readings received.
+    //! @details Under Cadence::kAtMost this can exceed expected(), since several readings may share a slot.
+    std::uint32_t received() const noexcept { return received_; }
+
+    //! @brief Expected slots that no reading (yet) landed in.
+    std::uint32_t lost() const noexcept { return expected() > filled_ ? expected() - filled_ : 0; }
+
+    //! @brief Fraction of expected readings not received.
+    float loss_ratio() const noexcept {
+        return expected() ? static_cast<float>(lost()) / static_cast<float>(expected()) : 0.0f;
+    }
+
+    //! @brief Readings received again after their slot was already filled.
+    //! @details Under Cadence::kAtMost only a repeat of the newest reading is recognisably a duplicate.
+    std::uint32_t duplicates() const noexcept { return duplicates_; }
+
+    //! @brief Readings that arrived after a newer one and filled a hole.
+    std::uint32_t late() const noexcept { return late_; }
+
+    //! @brief Streaks of one or more missing readings.
+    std::uint32_t gaps() const noexcept { return gaps_; }
+
+    //! @brief Longest streak of missing readings.
+    std::uint32_t longest_gap() const noexcept { return longest_gap_; }
+
+    //! @brief Slots that have passed without a reading since the newest one arrived.
+    //! @param now_ms Broker clock, on the same base as the arrival times.
+    std::uint32_t missing_since_newest(std::uint32_t now_ms) const noexcept {
+        return started_ && interval_ms_ ? (now_ms - newest_arrival_ms_) / interval_ms_ : 0;
+    }
+
+    //! @brief Interarrival jitter in milliseconds.
+    float jitter_ms() const noexcept { return static_cast<float>(jitter_16_) / 16.0f; }
+
+ private:
+    std::uint32_t slot_of(std::uint32_t offset_ms) const noexcept {
+        return (offset_ms - base_offset_ms_ + interval_ms_ / 2) / interval_ms_;
+    }
+
+    std::uint32_t interval_ms_{1000};
+    std::uint32_t base_offset_ms_{0};    // Offset of slot 0
+    std::uint32_t carried_expected_{0};  // Expected readings before the last interval change
+    std::uint32_t newest_slot_{0};
+    std::uint32_t newest_offset_ms_{0};
+    std::uint32_t newest_arrival_ms_{0};
+    std::uint64_t window_{0};  // Bit i set: slot newest_slot_ - i received
+    std::uint32_t received_{0};
+    std::uint32_t filled_{0};  // Expected slots with at least one reading
+    std::uint32_t duplicates_{0};
+    std::uint32_t late_{0};
+    std::uint32_t gaps_{0};
+    std::uint32_t longest_gap_{0};
+    std::uint32_t previous_offset_ms_{0};
+    std::uint32_t previous_arrival_ms_{0};
+    std::uint32_t jitter_16_{0};  // Jitter in 1/16 ms
+    Cadence cadence_{Cadence::kFixed};
+    bool started_{false};
+};
+
+}  // namespace jenlib::measurement
+
+#endif  // INCLUDE_JENLIB_MEASUREMENT_LINKQUALITY_H_
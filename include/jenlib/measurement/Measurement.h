@@ -54,8 +54,8 @@
 //! - Humidity: Percentage to basis points (multiply by 100)
 //! - Time: Platform-specific to milliseconds
 //!
-//! @note Sensor-specific reading code (like TMP36 conversion) should
-//! be implemented in your application, not in this library.
+//! @note For a TMP36 on an ADC pin, jenlib::sensors::Tmp36 produces
+//! centi-degrees directly without going through float.
 //!
 //! @see jenlib::ble::Messages for BLE message formats
 //! @see @ref measurement_example "Measurement Example" for sensor integration
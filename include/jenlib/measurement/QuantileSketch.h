@@ -0,0 +1,356 @@
+//! @file jenlib/measurement/QuantileSketch.h
+//! @brief Fixed-memory, mergeable KLL quantile sketch for reading values.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_MEASUREMENT_QUANTILESKETCH_H_
+#define INCLUDE_JENLIB_MEASUREMENT_QUANTILESKETCH_H_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "jenlib/ble/Messages.h"
+#include "jenlib/storage/ByteOrder.h"
+
+namespace jenlib::measurement {
+
+//! @brief KLL sketch answering approximate quantiles of a stream of wire-unit values.
+//! @details
+//! Items live in levels; an item at level h stands for 2^h values. When the
+//! fixed buffer fills, the lowest level at its capacity is sorted and every
+//! other item, starting at a random parity, moves up a level. Capacities
+//! shrink by 2/3 per level below the top, so the buffer never grows beyond
+//! kCapacity items whatever the stream length. The rank error is about
+//! 1.7 / K of the count with high probability; min and max are exact.
+//!
+//! Values are int16 wire units: centi-degrees, or basis points of humidity,
+//! which fit since they never exceed 10000. Sketches with the same K merge
+//! into one that summarises both streams, so per-shard or per-broker sketches
+//! can be combined upstream. serialize() writes a little-endian image for
+//! the uplink batch.
+//! @tparam K Accuracy parameter: capacity of the top level.
+//!
+//! @par Usage Example:
+//! @code
+//! jenlib::measurement::QuantileSketch<> sketch;
+//! sketch.add(reading_msg.temperature_c_centi);
+//! const std::int16_t p99 = sketch.quantile(0.99f);
+//! std::uint8_t image[jenlib::measurement::QuantileSketch<>::kMaxSerializedSize];
+//! const std::size_t bytes = sketch.serialize(image, sizeof(image));
+//! @endcode
+template <std::size_t K = 128>
+class QuantileSketch {
+    static_assert(K >= 8 && K <= 4096, "QuantileSketch K must be between 8 and 4096");
+
+ public:
+    //! @brief Levels available; enough for 2^32 values.
+    static constexpr std::size_t kMaxLevels = 32;
+
+    //! @brief Items retained at most: the level capacities plus two per level of slack.
+    static constexpr std::size_t kCapacity = 3 * K + 2 * kMaxLevels;
+
+    //! @brief Serialized header: version, levels, K, count, min, max.
+    static constexpr std::size_t kHeaderSize = 12;
+
+    //! @brief Largest serialize() output.
+    static constexpr std::size_t kMaxSerializedSize = kHeaderSize + 2 * kMaxLevels + 2 * kCapacity;
+
+    //! @brief Constructor.
+    //! @param seed Seed for the compaction coin; sketches merged together may share it.
+    explicit QuantileSketch(std::uint32_t seed = 0x9E3779B9u) noexcept : rng_(seed ? seed : 1) {}
+
+    //! @brief Add one value.
+    void add(std::int16_t value) noexcept {
+        if (count_ == 0 || value < min_) {
+            min_ = value;
+        }
+        if (count_ == 0 || value > max_) {
+            max_ = value;
+        }
+        ++count_;
+        make_room();
+        items_[total_++] = value;  // Level 0 is the tail of the buffer
+        ++sizes_[0];
+    }
+
+    //! @brief Fold @p other into this sketch, as if its values had been added here.
+    void merge(const QuantileSketch& other) noexcept {
+        if (other.count_ == 0) {
+            return;
+        }
+        if (&other == this) {
+            const QuantileSketch copy = *this;
+            merge(copy);
+            return;
+        }
+        if (count_ == 0 || other.min_ < min_) {
+            min_ = other.min_;
+        }
+        if (count_ == 0 || other.max_ > max_) {
+            max_ = other.max_;
+        }
+        count_ += other.count_;
+        levels_ = std::max(levels_, other.levels_);
+        for (std::size_t level = other.levels_; level-- > 0;) {
+            const std::size_t start = other.level_start(level);
+            for (std::size_t i = 0; i < other.sizes_[level]; ++i) {
+                insert(level, other.items_[start + i]);
+            }
+        }
+    }
+
+    //! @brief Value at normalised rank @p q (0 = min, 1 = max); 0 when empty.
+    std::int16_t quantile(float q) const noexcept {
+        if (count_ == 0) {
+            return 0;
+        }
+        if (q <= 0.0f) {
+            return min_;
+        }
+        if (q >= 1.0f) {
+            return max_;
+        }
+        // Smallest value whose weighted rank reaches q; bisect the value range rather than sort a copy
+        const double wanted = static_cast<double>(q) * static_cast<double>(count_);
+        const std::uint64_t target = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(wanted + 0.999999));
+        std::int32_t low = min_;
+        std::int32_t high = max_;
+        while (low < high) {
+            const std::int32_t mid = low + (high - low) / 2;
+            if (rank(static_cast<std::int16_t>(mid)) >= target) {
+                high = mid;
+            } else {
+                low = mid + 1;
+            }
+        }
+        return static_cast<std::int16_t>(low);
+    }
+
+    //! @brief Estimated number of values at or below @p value.
+    std::uint64_t rank(std::int16_t value) const noexcept {
+        std::uint64_t weight = 0;
+        std::size_t index = 0;
+        for (std::size_t level = levels_; level-- > 0;) {
+            std::uint64_t below = 0;
+            for (const std::size_t end = index + sizes_[level]; index < end; ++index) {
+                below += items_[index] <= value;
+            }
+            weight += below << level;
+        }
+        return weight;
+    }
+
+    //! @brief Values added, including through merges.
+    std::uint32_t count() const noexcept { return count_; }
+
+    //! @brief Smallest value seen (0 when empty).
+    std::int16_t min() const noexcept { return min_; }
+
+    //! @brief Largest value seen (0 when empty).
+    std::int16_t max() const noexcept { return max_; }
+
+    //! @brief Items currently retained.
+    std::size_t retained() const noexcept { return total_; }
+
+    //! @brief Forget every value; the coin keeps its state.
+    void reset() noexcept {
+        sizes_.fill(0);
+        levels_ = 1;
+        total_ = 0;
+        count_ = 0;
+        min_ = 0;
+        max_ = 0;
+    }
+
+    //! @brief Write the sketch to @p out.
+    //! @return Bytes written, or 0 if @p capacity is too small.
+    std::size_t serialize(std::uint8_t* out, std::size_t capacity) const noexcept {
+        const std::size_t size = kHeaderSize + 2 * levels_ + 2 * total_;
+        if (capacity < size) {
+            return 0;
+        }
+        out[0] = kVersion;
+        out[1] = static_cast<std::uint8_t>(levels_);
+        jenlib::storage::store_u16le(out + 2, static_cast<std::uint16_t>(K));
+        jenlib::storage::store_u32le(out + 4, count_);
+        jenlib::storage::store_u16le(out + 8, static_cast<std::uint16_t>(min_));
+        jenlib::storage::store_u16le(out + 10, static_cast<std::uint16_t>(max_));
+        std::uint8_t* cursor = out + kHeaderSize;
+        for (std::size_t level = 0; level < levels_; ++level, cursor += 2) {
+            jenlib::storage::store_u16le(cursor, sizes_[level]);
+        }
+        for (std::size_t i = 0; i < total_; ++i, cursor += 2) {
+            jenlib::storage::store_u16le(cursor, static_cast<std::uint16_t>(items_[i]));
+        }
+        return size;
+    }
+
+    //! @brief Replace this sketch with one written by serialize().
+    //! @return Bytes consumed, or 0 if the image is malformed or was built with another K.
+    std::size_t deserialize(const std::uint8_t* in, std::size_t size) noexcept {
+        if (size < kHeaderSize || in[0] != kVersion || in[1] == 0 || in[1] > kMaxLevels ||
+            jenlib::storage::load_u16le(in + 2) != K) {
+            return 0;
+        }
+        const std::size_t levels = in[1];
+        if (size < kHeaderSize + 2 * levels) {
+            return 0;
+        }
+        std::array<std::uint16_t, kMaxLevels> sizes{};
+        std::size_t total = 0;
+        std::uint64_t weight = 0;
+        for (std::size_t level = 0; level < levels; ++level) {
+            sizes[level] = jenlib::storage::load_u16le(in + kHeaderSize + 2 * level);
+            total += sizes[level];
+            weight += static_cast<std::uint64_t>(sizes[level]) << level;
+        }
+        const std::uint32_t count = jenlib::storage::load_u32le(in + 4);
+        const std::size_t image_size = kHeaderSize + 2 * levels + 2 * total;
+        if (total > kCapacity || size < image_size || weight != count) {
+            return 0;  // Weights must add up to the count, which catches most corruption
+        }
+        sizes_ = sizes;
+        levels_ = levels;
+        total_ = total;
+        count_ = count;
+        min_ = static_cast<std::int16_t>(jenlib::storage::load_u16le(in + 8));
+        max_ = static_cast<std::int16_t>(jenlib::storage::load_u16le(in + 10));
+        const std::uint8_t* cursor = in + kHeaderSize + 2 * levels;
+        for (std::size_t i = 0; i < total; ++i, cursor += 2) {
+            items_[i] = static_cast<std::int16_t>(jenlib::storage::load_u16le(cursor));
+        }
+        return image_size;
+    }
+
+ private:
+    static constexpr std::uint8_t kVersion = 1;
+
+    //! @brief Buffer index where @p level begins; higher levels come first.
+    std::size_t level_start(std::size_t level) const noexcept {
+        std::size_t start = 0;
+        for (std::size_t above = level + 1; above < levels_; ++above) {
+            start += sizes_[above];
+        }
+        return start;
+    }
+
+    //! @brief Items @p level may hold before it is compacted.
+    std::size_t level_capacity(std::size_t level) const noexcept {
+        std::size_t capacity = K;
+        for (std::size_t depth = levels_ - 1 - level; depth > 0 && capacity > 2; --depth) {
+            capacity = capacity * 2 / 3;
+        }
+        return std::max<std::size_t>(capacity, 2);
+    }
+
+    //! @brief Compact until one item fits.
+    void make_room() noexcept {
+        while (total_ >= kCapacity) {
+            std::size_t level = 0;
+            while (level + 1 < levels_ && sizes_[level] < level_capacity(level)) {
+                ++level;
+            }
+            compact(level);
+        }
+    }
+
+    //! @brief Add an item of weight 2^@p level at the end of its level.
+    void insert(std::size_t level, std::int16_t value) noexcept {
+        make_room();
+        const std::size_t position = level_start(level) + sizes_[level];
+        std::memmove(&items_[position + 1], &items_[position], (total_ - position) * sizeof(std::int16_t));
+        items_[position] = value;
+        ++sizes_[level];
+        ++total_;
+    }
+
+    //! @brief Move half of @p level, every other item after sorting, up one level.
+    void compact(std::size_t level) noexcept {
+        if (level + 1 == levels_) {
+            ++levels_;  // New empty top level, just before the old one in the buffer
+        }
+        const std::size_t start = level_start(level);
+        const std::size_t size = sizes_[level];
+        const bool odd = size & 1;
+        const std::int16_t leftover = items_[start + size - 1];  // Stays behind when the level is odd
+        const std::size_t paired = size - odd;
+        std::sort(&items_[start], &items_[start] + paired);
+
+        // Survivors end up right after the next level's items, so they join it without moving it
+        rng_ ^= rng_ << 13;
+        rng_ ^= rng_ >> 17;
+        rng_ ^= rng_ << 5;
+        const std::size_t offset = rng_ & 1;
+        const std::size_t half = paired / 2;
+        for (std::size_t i = 0; i < half; ++i) {
+            items_[start + i] = items_[start + 2 * i + offset];
+        }
+        if (odd) {
+            items_[start + half] = leftover;
+        }
+        const std::size_t end = start + size;
+        std::memmove(&items_[start + half + odd], &items_[end], (total_ - end) * sizeof(std::int16_t));
+        total_ -= half;
+        sizes_[level + 1] = static_cast<std::uint16_t>(sizes_[level + 1] + half);
+        sizes_[level] = odd;
+    }
+
+    std::array<std::int16_t, kCapacity> items_{};
+    std::array<std::uint16_t, kMaxLevels> sizes_{};
+    std::size_t levels_{1};
+    std::size_t total_{0};
+    std::uint32_t count_{0};
+    std::int16_t min_{0};
+    std::int16_t max_{0};
+    std::uint32_t rng_;
+};
+
+//! @brief Temperature and humidity sketches of one sensor, e.g. for one hour.
+template <std::size_t K = 128>
+struct ReadingQuantiles {
+    QuantileSketch<K> temperature_c_centi;
+    QuantileSketch<K> humidity_bp;
+
+    //! @brief Largest serialize() output.
+    static constexpr std::size_t kMaxSerializedSize = 2 * QuantileSketch<K>::kMaxSerializedSize;
+
+    //! @brief Add both values of a reading.
+    void add(const jenlib::ble::ReadingMsg& reading) noexcept {
+        temperature_c_centi.add(reading.temperature_c_centi);
+        humidity_bp.add(static_cast<std::int16_t>(reading.humidity_bp));
+    }
+
+    //! @brief Fold another sensor, shard or broker's sketches into these.
+    void merge(const ReadingQuantiles& other) noexcept {
+        temperature_c_centi.merge(other.temperature_c_centi);
+        humidity_bp.merge(other.humidity_bp);
+    }
+
+    //! @brief Forget every reading.
+    void reset() noexcept {
+        temperature_c_centi.reset();
+        humidity_bp.reset();
+    }
+
+    //! @brief Write temperature then humidity sketch to @p out.
+    //! @return Bytes written, or 0 if @p capacity is too small.
+    std::size_t serialize(std::uint8_t* out, std::size_t capacity) const noexcept {
+        const std::size_t first = temperature_c_centi.serialize(out, capacity);
+        const std::size_t second = first ? humidity_bp.serialize(out + first, capacity - first) : 0;
+        return second ? first + second : 0;
+    }
+
+    //! @brief Read sketches written by serialize().
+    //! @return Bytes consumed, or 0 if either image is malformed.
+    std::size_t deserialize(const std::uint8_t* in, std::size_t size) noexcept {
+        const std::size_t first = temperature_c_centi.deserialize(in, size);
+        const std::size_t second = first ? humidity_bp.deserialize(in + first, size - first) : 0;
+        return second ? first + second : 0;
+    }
+};
+
+}  // namespace jenlib::measurement
+
+#endif  // INCLUDE_JENLIB_MEASUREMENT_QUANTILESKETCH_H_
@@ -0,0 +1,171 @@
+//! @file jenlib/measurement/SendOnDelta.h
+//! @brief Send-on-delta reporting and broker-side step-hold reconstruction.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_MEASUREMENT_SENDONDELTA_H_
+#define INCLUDE_JENLIB_MEASUREMENT_SENDONDELTA_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "jenlib/ble/Messages.h"
+
+namespace jenlib::measurement {
+
+//! @brief Send-on-delta thresholds.
+struct SendOnDeltaConfig {
+    std::uint16_t temperature_deadband_centi{10};  //!< Send when temperature moves more than this.
+    std::uint16_t humidity_deadband_bp{50};        //!< Send when humidity moves more than this.
+    std::uint32_t max_silence_ms{60000};           //!< Heartbeat: send at least this often (0 = never).
+};
+
+//! @brief Decides which readings a sensor needs to broadcast.
+//! @details
+//! A reading is sent when either value has moved beyond its deadband since
+//! the last sent reading, or when max_silence_ms has passed without sending.
+//! The broker holds the last value between readings, so its reconstruction
+//! is never further than the deadband from what the sensor measured.
+//!
+//! @par Usage Example:
+//! @code
+//! jenlib::measurement::SendOnDeltaFilter filter({10, 50, 60000});
+//! if (filter.should_send(reading_msg)) {
+//!     sensor.broadcast_reading(reading_msg);
+//! }
+//! @endcode
+class SendOnDeltaFilter {
+ public:
+    //! @brief Constructor.
+    explicit SendOnDeltaFilter(const SendOnDeltaConfig& config = SendOnDeltaConfig{}) noexcept
+        : config_(config) {}
+
+    //! @brief Replace the thresholds; the last sent reading is kept.
+    void configure(const SendOnDeltaConfig& config) noexcept { config_ = config; }
+
+    //! @brief Current thresholds.
+    const SendOnDeltaConfig& config() const noexcept { return config_; }
+
+    //! @brief Forget the last sent reading (e.g. at session start); the next reading is sent.
+    void reset() noexcept {
+        has_sent_ = false;
+        sent_count_ = 0;
+        suppressed_count_ = 0;
+    }
+
+    //! @brief Decide whether to send a reading, recording it as sent if so.
+    //! @param reading The freshly sampled reading.
+    //! @return true if the reading should be broadcast.
+    bool should_send(const jenlib::ble::ReadingMsg& reading) noexcept;
+
+    //! @brief Readings that passed the filter since reset().
+    std::uint32_t sent_count() const noexcept { return sent_count_; }
+
+    //! @brief Readings held back since reset().
+    std::uint32_t suppressed_count() const noexcept { return suppressed_count_; }
+
+ private:
+    SendOnDeltaConfig config_;
+    bool has_sent_{false};
+    std::int16_t last_temperature_centi_{0};
+    std::uint16_t last_humidity_bp_{0};
+    std::uint32_t last_offset_ms_{0};
+    std::uint32_t sent_count_{0};
+    std::uint32_t suppressed_count_{0};
+};
+
+//! @brief One point of a reconstructed series, in wire units.
+struct SeriesPoint {
+    std::uint32_t offset_ms;
+    std::int16_t temperature_c_centi;
+    std::uint16_t humidity_bp;
+};
+
+//! @brief Broker-side series that holds each reading until the next one.
+//! @details Keeps the most recent @p Capacity readings in a ring; older ones
+//! are overwritten. Readings must arrive in offset order; late ones are
+//! rejected so the series stays sorted for lookups.
+//! @tparam Capacity Number of readings retained.
+template <std::size_t Capacity>
+class StepHoldSeries {
+    static_assert(Capacity > 0, "StepHoldSeries needs room for at least one reading");
+
+ public:
+    //! @brief Add a received reading.
+    //! @return false if the reading is older than the newest one held.
+    bool append(const jenlib::ble::ReadingMsg& reading) noexcept {
+        if (size_ > 0 && reading.offset_ms < at(size_ - 1).offset_ms) {
+            return false;
+        }
+        points_[(start_ + size_) % Capacity] =
+            SeriesPoint{reading.offset_ms, reading.temperature_c_centi, reading.humidity_bp};
+        if (size_ < Capacity) {
+            ++size_;
+        } else {
+            start_ = (start_ + 1) % Capacity;
+        }
+        return true;
+    }
+
+    //! @brief Value in effect at @p offset_ms: the last reading at or before it.
+    //! @return false if @p offset_ms precedes the oldest reading held.
+    bool value_at(std::uint32_t offset_ms, SeriesPoint& out) const noexcept {
+        if (size_ == 0 || offset_ms < at(0).offset_ms) {
+            return false;
+        }
+        // Binary search for the last point with offset <= offset_ms
+        std::size_t lo = 0;
+        std::size_t hi = size_;
+        while (hi - lo > 1) {
+            const std::size_t mid = lo + (hi - lo) / 2;
+            if (at(mid).offset_ms <= offset_ms) {
+                lo = mid;
+            } else {
+                hi = mid;
+            }
+        }
+        out = at(lo);
+        out.offset_ms = offset_ms;
+        return true;
+    }
+
+    //! @brief Resample onto a regular grid, e.g. for plotting or export.
+    //! @param start_ms First grid offset.
+    //! @param period_ms Grid spacing.
+    //! @param count Number of grid points.
+    //! @param out Output iterator receiving SeriesPoint values.
+    //! @return Number of points written (grid points before the first reading are skipped).
+    template <typename OutputIt>
+    std::size_t resample(std::uint32_t start_ms, std::uint32_t period_ms, std::size_t count, OutputIt out) const {
+        std::size_t written = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            SeriesPoint point{};
+            if (value_at(start_ms + static_cast<std::uint32_t>(i) * period_ms, point)) {
+                *out++ = point;
+                ++written;
+            }
+        }
+        return written;
+    }
+
+    //! @brief Readings held.
+    std::size_t size() const noexcept { return size_; }
+
+    //! @brief Reading by age, 0 being the oldest held.
+    const SeriesPoint& at(std::size_t index) const noexcept { return points_[(start_ + index) % Capacity]; }
+
+    //! @brief Drop all readings.
+    void clear() noexcept {
+        start_ = 0;
+        size_ = 0;
+    }
+
+ private:
+    std::array<SeriesPoint, Capacity> points_{};
+    std::size_t start_{0};
+    std::size_t size_{0};
+};
+
+}  // namespace jenlib::measurement
+
+#endif  // INCLUDE_JENLIB_MEASUREMENT_SENDONDELTA_H_
@@ -0,0 +1,64 @@
+//! @file include/jenlib/onewire/OneWireBackend.h
+//! @brief Bit-level transfer interface used by OneWireBus.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_ONEWIRE_ONEWIREBACKEND_H_
+#define INCLUDE_JENLIB_ONEWIRE_ONEWIREBACKEND_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace jenlib::onewire {
+
+//! @brief Physical layer for a 1-Wire bus.
+//! @details
+//! A backend only knows how to issue reset pulses and run time slots.
+//! Everything above that (ROM commands, byte framing, CRC) lives in
+//! @ref OneWireBus, so a backend can move whole bytes per hardware
+//! operation (UART, RMT) instead of one GPIO call per edge.
+//!
+//! Every time slot both writes and samples the line: a read slot is a
+//! write-1 slot where the device may hold the line low. Bits are packed
+//! LSB first, matching the order on the wire.
+class OneWireBackend {
+ public:
+    virtual ~OneWireBackend() = default;
+
+    //! @brief Prepare the hardware for bus transactions.
+    //! @return true if the backend is ready.
+    virtual bool begin() = 0;
+
+    //! @brief Release any hardware owned by the backend.
+    virtual void end() = 0;
+
+    //! @brief Issue a reset pulse and sample the presence pulse.
+    //! @return true if at least one device answered with presence.
+    virtual bool reset() = 0;
+
+    //! @brief Run @p nbits time slots.
+    //! @param tx Bits to drive, LSB first. Must hold at least (nbits + 7) / 8 bytes.
+    //! @param rx Optional destination for sampled bits, LSB first; nullptr for write-only.
+    //! @param nbits Number of time slots to run.
+    //! @return true if all slots completed, false otherwise.
+    virtual bool transfer_bits(const std::uint8_t* tx, std::uint8_t* rx, std::size_t nbits) = 0;
+};
+
+//! @brief Read bit @p index from an LSB-first packed bit buffer.
+inline bool get_packed_bit(const std::uint8_t* bits, std::size_t index) {
+    return (bits[index / 8u] >> (index % 8u)) & 0x01u;
+}
+
+//! @brief Write bit @p index into an LSB-first packed bit buffer.
+inline void set_packed_bit(std::uint8_t* bits, std::size_t index, bool value) {
+    const auto mask = static_cast<std::uint8_t>(1u << (index % 8u));
+    if (value) {
+        bits[index / 8u] = static_cast<std::uint8_t>(bits[index / 8u] | mask);
+    } else {
+        bits[index / 8u] = static_cast<std::uint8_t>(bits[index / 8u] & ~mask);
+    }
+}
+
+}  // namespace jenlib::onewire
+
+#endif  // INCLUDE_JENLIB_ONEWIRE_ONEWIREBACKEND_H_
@@ -8,9 +8,12 @@
 #include <cstdint>
 #include <array>
 #include <iterator>
+#include <optional>
 #include <type_traits>
 #include "../gpio/GPIO.h"
 #include "../gpio/PinTypes.h"
+#include "OneWireBackend.h"
+#include "drivers/GpioOneWireBackend.h"
 
 //! @namespace jenlib::onewire
 //! @brief Public wrapper API for OneWire bus operations.
@@ -21,9 +24,16 @@ namespace jenlib::onewire {
 //! This is a concrete class that can be easily understood by students.
 //! All multi-byte data uses little-endian byte order as sent on the wire (LSB first)
 //! consistent with 1-Wire protocol.
+//!
+//! The physical layer is a @ref OneWireBackend. Pin constructors use the
+//! portable @ref GpioOneWireBackend, timed with platform_delay_us(); pass a
+//! backend explicitly to run whole bytes per hardware operation (UART, RMT)
+//! or to use the native loopback.
 class OneWireBus {
  public:
         using byte = std::uint8_t;
+        //! Bytes handed to the backend per transfer in write_bytes/read_bytes.
+        static constexpr std::size_t kTransferChunkBytes = 8;
         //! 64-bit ROM code, LSB first as transmitted on the wire.
         using rom_code_t = std::array<byte, 8>;
 
@@ -45,9 +55,16 @@ class OneWireBus {
         //! @brief Construct from a raw platform pin number.
         //! @param raw_pin The raw pin number (for backward compatibility).
         explicit OneWireBus(std::uint8_t raw_pin);
+        //! @brief Construct on top of an explicit backend.
+        //! @param backend The physical layer; must outlive the bus.
+        explicit OneWireBus(OneWireBackend& backend);
         //! @brief Destructor.
         ~OneWireBus() = default;
 
+        //! The bus may point at its own GPIO backend, so it is not copyable.
+        OneWireBus(const OneWireBus&) = delete;
+        OneWireBus& operator=(const OneWireBus&) = delete;
+
         //! @brief Initialize the bus and configure the GPIO.
         void begin();
         //! @brief Release any resources associated with the bus.
@@ -61,32 +78,70 @@ class OneWireBus {
         void write_byte(byte data);
 
         //! @brief Write a range of bytes using iterators (no raw arrays required).
+        //! @details Bytes are staged in chunks of @ref kTransferChunkBytes so the
+        //! backend sees one transfer per chunk instead of one per byte.
         //! @tparam InputIt An input iterator whose value_type is byte-compatible.
         //! @param first Iterator to the first byte to write.
         //! @param last Iterator past the last byte to write.
+        //! @return Number of bytes written.
         template <typename InputIt>
         std::size_t write_bytes(InputIt first, InputIt last) {
-            // Accept input iterators; write element-wise to avoid contiguity assumptions.
+            if (!initialized_) {
+                return 0;
+            }
+            std::array<byte, kTransferChunkBytes> chunk{};
+            std::size_t written = 0;
+            std::size_t staged = 0;
+            // Accept input iterators; stage element-wise to avoid contiguity assumptions.
             for (auto it = first; it != last; ++it) {
-                write_byte(static_cast<byte>(*it));
+                chunk[staged++] = static_cast<byte>(*it);
+                if (staged == chunk.size()) {
+                    if (!backend_->transfer_bits(chunk.data(), nullptr, staged * 8u)) {
+                        return written;
+                    }
+                    written += staged;
+                    staged = 0;
+                }
+            }
+            if (staged > 0 && backend_->transfer_bits(chunk.data(), nullptr, staged * 8u)) {
+                written += staged;
             }
-            return static_cast<std::size_t>(std::distance(first, last));
+            return written;
         }
 
         //! @brief Read a single byte (LSB first on the wire).
         byte read_byte();
 
         //! @brief Read into a range using iterators (no raw arrays required).
+        //! @details Read slots are issued in chunks of @ref kTransferChunkBytes.
         //! @tparam OutputIt An output iterator assignable from byte.
         //! @param first Iterator to the first destination element to write.
         //! @param last Iterator past the last destination element to write.
         //! @return Number of bytes read.
         template <typename OutputIt>
         std::size_t read_bytes(OutputIt first, OutputIt last) {
-            for (auto it = first; it != last; ++it) {
-                *it = read_byte();
+            if (!initialized_) {
+                return 0;
+            }
+            std::array<byte, kTransferChunkBytes> ones{};
+            ones.fill(0xFF);
+            std::array<byte, kTransferChunkBytes> chunk{};
+            std::size_t read = 0;
+            auto it = first;
+            while (it != last) {
+                std::size_t wanted = 0;
+                for (auto probe = it; probe != last && wanted < chunk.size(); ++probe) {
+                    ++wanted;
+                }
+                if (!backend_->transfer_bits(ones.data(), chunk.data(), wanted * 8u)) {
+                    return read;
+                }
+                for (std::size_t i = 0; i < wanted; ++i, ++it) {
+                    *it = chunk[i];
+                }
+                read += wanted;
             }
-            return static_cast<std::size_t>(std::distance(first, last));
+            return read;
         }
 
         //! @brief Send SKIP ROM (address all devices).
@@ -109,27 +164,18 @@ class OneWireBus {
         template <typename InputIt>
         static std::uint8_t crc8(InputIt first, InputIt last);
 
+        //! @brief Get the backend driving this bus.
+        OneWireBackend& backend() noexcept { return *backend_; }
+
  private:
-        //! @brief The pin used for this OneWire bus.
-        std::uint8_t pin_;
+        //! @brief Bit-banged backend owned by the pin constructors; empty when a backend is passed in.
+        std::optional<GpioOneWireBackend> gpio_backend_;
+
+        //! @brief Backend performing the time slots.
+        OneWireBackend* backend_;
 
         //! @brief Whether the bus has been initialized.
         bool initialized_;
-
-        //! @brief Internal method to configure the pin for OneWire use.
-        void configure_pin();
-
-        //! @brief Internal method to perform a reset pulse.
-        //! @return true if a device is present, false otherwise.
-        bool perform_reset();
-
-        //! @brief Internal method to write a single bit.
-        //! @param bit The bit to write (0 or 1).
-        void write_bit(bool bit);
-
-        //! @brief Internal method to read a single bit.
-        //! @return The bit read from the bus.
-        bool read_bit();
 };
 
 // Inline CRC-8 (Dallas/Maxim, poly 0x31 reflected => 0x8C, init 0x00)
@@ -0,0 +1,39 @@
+//! @file include/jenlib/onewire/drivers/ArduinoOneWireBackend.h
+//! @brief OneWire backend wrapping the Arduino OneWire library.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_ONEWIRE_DRIVERS_ARDUINOONEWIREBACKEND_H_
+#define INCLUDE_JENLIB_ONEWIRE_DRIVERS_ARDUINOONEWIREBACKEND_H_
+
+#include <jenlib/onewire/OneWireBackend.h>
+
+// Only use for Arduino when you need to use the OneWire library
+#ifdef JENLIB_ENABLE_ARDUINO_ONEWIRE
+#include <OneWire.h>
+
+namespace jenlib::onewire {
+
+//! @brief OneWire backend delegating slot timing to the Arduino OneWire library.
+//! @details Whole write-only bytes go through OneWire::write(); anything else
+//! falls back to the library's bit primitives.
+class ArduinoOneWireBackend : public OneWireBackend {
+ public:
+    //! @brief Constructor.
+    //! @param pin The raw pin number wired to the bus.
+    explicit ArduinoOneWireBackend(std::uint8_t pin) : ow_(pin) {}
+
+    bool begin() override { return true; }
+    void end() override {}
+    bool reset() override { return ow_.reset() == 1; }
+    bool transfer_bits(const std::uint8_t* tx, std::uint8_t* rx, std::size_t nbits) override;
+
+ private:
+    ::OneWire ow_;  //!< Library instance bound to the bus pin.
+};
+
+}  // namespace jenlib::onewire
+
+#endif  // JENLIB_ENABLE_ARDUINO_ONEWIRE
+
+#endif  // INCLUDE_JENLIB_ONEWIRE_DRIVERS_ARDUINOONEWIREBACKEND_H_
@@ -0,0 +1,70 @@
+//! @file include/jenlib/onewire/drivers/EspIdfUartOneWireBackend.h
+//! @brief ESP-IDF OneWire backend that times slots with a UART.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_ONEWIRE_DRIVERS_ESPIDFUARTONEWIREBACKEND_H_
+#define INCLUDE_JENLIB_ONEWIRE_DRIVERS_ESPIDFUARTONEWIREBACKEND_H_
+
+#include <jenlib/onewire/OneWireBackend.h>
+
+#ifdef ESP_PLATFORM
+#include <driver/gpio.h>
+#include <driver/uart.h>
+
+namespace jenlib::onewire {
+
+//! @brief OneWire backend using a UART as the slot generator (Maxim AN214).
+//! @details
+//! TX and RX share the bus (open-drain TX, or TX through a diode). A reset is
+//! one 0xF0 frame at 9600 baud; each time slot is one frame at 115200 baud,
+//! 0xFF for a 1/read slot and 0x00 for a 0 slot. The echoed frame is the
+//! sampled level. Up to @ref kMaxSlotsPerBurst slots go out in one
+//! uart_write_bytes call, so the CPU only touches the bus once per burst.
+class EspIdfUartOneWireBackend : public OneWireBackend {
+ public:
+    //! @brief Maximum number of slots sent per UART burst.
+    static constexpr std::size_t kMaxSlotsPerBurst = 64;
+
+    //! @brief Constructor.
+    //! @param uart The UART peripheral to use.
+    //! @param tx_pin TX pin wired to the bus.
+    //! @param rx_pin RX pin wired to the bus.
+    EspIdfUartOneWireBackend(uart_port_t uart, gpio_num_t tx_pin, gpio_num_t rx_pin);
+
+    //! @brief Destructor.
+    ~EspIdfUartOneWireBackend() override;
+
+    bool begin() override;
+    void end() override;
+    bool reset() override;
+    bool transfer_bits(const std::uint8_t* tx, std::uint8_t* rx, std::size_t nbits) override;
+
+ private:
+    //! @brief Switch baud rate if it differs from the current one.
+    bool set_baud(std::uint32_t baud);
+
+    uart_port_t uart_;                    //!< UART peripheral
+    gpio_num_t tx_pin_;                   //!< TX pin
+    gpio_num_t rx_pin_;                   //!< RX pin
+    std::uint32_t baud_;                  //!< Current baud rate
+    bool initialized_;                    //!< Initialization state
+};
+
+}  // namespace jenlib::onewire
+
+#else
+// Fallback implementation for non-ESP platforms
+namespace jenlib::onewire {
+
+//! @brief Empty stub implementation for non-ESP platforms.
+class EspIdfUartOneWireBackend {
+ public:
+    EspIdfUartOneWireBackend() = delete;
+};
+
+}  // namespace jenlib::onewire
+
+#endif  // ESP_PLATFORM
+
+#endif  // INCLUDE_JENLIB_ONEWIRE_DRIVERS_ESPIDFUARTONEWIREBACKEND_H_
@@ -0,0 +1,62 @@
+//! @file include/jenlib/onewire/drivers/GpioOneWireBackend.h
+//! @brief Portable bit-banged OneWire backend on top of the GPIO wrapper.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_ONEWIRE_DRIVERS_GPIOONEWIREBACKEND_H_
+#define INCLUDE_JENLIB_ONEWIRE_DRIVERS_GPIOONEWIREBACKEND_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <jenlib/gpio/GPIO.h>
+#include <jenlib/onewire/OneWireBackend.h>
+
+namespace jenlib::onewire {
+
+//! @brief Busy-wait from the platform (ets_delay_us, delayMicroseconds or steady_clock).
+void platform_delay_us(std::uint32_t microseconds);
+
+//! @brief Fallback backend that drives the bus through the active GPIO driver.
+//! @details
+//! Works on any platform with a GPIO driver, at the cost of several driver
+//! calls per time slot. Slot timing needs a microsecond delay; the pin
+//! constructors of OneWireBus pass platform_delay_us(). Without one the
+//! slots run back-to-back, which is what the native tests and benchmarks
+//! want; reset() still reports only what the line shows, so an idle bus
+//! reads as empty.
+class GpioOneWireBackend : public OneWireBackend {
+ public:
+    //! @brief Microsecond busy-wait used to shape the time slots.
+    using DelayUsFn = void (*)(std::uint32_t microseconds);
+
+    //! @brief Constructor.
+    //! @param pin The pin index wired to the bus.
+    //! @param delay_us Optional microsecond delay; nullptr skips slot timing.
+    explicit GpioOneWireBackend(GPIO::PinIndex pin, DelayUsFn delay_us = nullptr) noexcept
+        : pin_(pin), delay_us_(delay_us) {}
+
+    bool begin() override;
+    void end() override;
+    bool reset() override;
+    bool transfer_bits(const std::uint8_t* tx, std::uint8_t* rx, std::size_t nbits) override;
+
+    //! @brief Get the pin index used for the bus.
+    GPIO::PinIndex pin() const noexcept { return pin_; }
+
+    //! @brief Slot timing hook; nullptr if the slots are untimed.
+    DelayUsFn delay_us() const noexcept { return delay_us_; }
+
+ private:
+    //! @brief Run a single time slot and return the sampled level.
+    bool slot(bool bit);
+
+    //! @brief Wait for @p microseconds if a delay function is configured.
+    void wait_us(std::uint32_t microseconds) const;
+
+    GPIO::PinIndex pin_;  //!< Bus pin.
+    DelayUsFn delay_us_;  //!< Slot timing hook (may be nullptr).
+};
+
+}  // namespace jenlib::onewire
+
+#endif  // INCLUDE_JENLIB_ONEWIRE_DRIVERS_GPIOONEWIREBACKEND_H_
@@ -0,0 +1,75 @@
+//! @file include/jenlib/onewire/drivers/NativeOneWireBackend.h
+//! @brief Native loopback OneWire backend for tests and benchmarks.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_ONEWIRE_DRIVERS_NATIVEONEWIREBACKEND_H_
+#define INCLUDE_JENLIB_ONEWIRE_DRIVERS_NATIVEONEWIREBACKEND_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>    // OK for desktop; NativeOneWireBackend doesn't run on Arduino
+#include <vector>
+#include <jenlib/onewire/OneWireBackend.h>
+
+namespace jenlib::onewire {
+
+//! @brief In-memory bus that loops transmitted bits back to the caller.
+//! @details
+//! Every slot the host drives is recorded, and the sampled level is the
+//! wired-AND of the host bit and the next scripted device bit (a device
+//! can only pull the line low). With nothing scripted the bus floats high,
+//! so the host reads back exactly what it wrote.
+class NativeOneWireBackend : public OneWireBackend {
+ public:
+    bool begin() override {
+        initialized_ = true;
+        return true;
+    }
+
+    void end() override { initialized_ = false; }
+
+    bool reset() override {
+        ++reset_count_;
+        return initialized_ && device_present_;
+    }
+
+    bool transfer_bits(const std::uint8_t* tx, std::uint8_t* rx, std::size_t nbits) override;
+
+    //! @brief Control whether reset() reports a presence pulse.
+    void set_device_present(bool present) noexcept { device_present_ = present; }
+
+    //! @brief Queue bytes the simulated device will answer with, LSB first.
+    void queue_device_bytes(const std::uint8_t* data, std::size_t len);
+
+    //! @brief Bits the host drove onto the bus, one entry per slot.
+    const std::vector<bool>& written_bits() const noexcept { return written_bits_; }
+
+    //! @brief Reassemble the written bit stream into bytes (LSB first).
+    std::vector<std::uint8_t> written_bytes() const;
+
+    //! @brief Number of transfer_bits() calls (hardware operations).
+    std::size_t transfer_count() const noexcept { return transfer_count_; }
+
+    //! @brief Number of reset pulses issued.
+    std::size_t reset_count() const noexcept { return reset_count_; }
+
+    //! @brief Forget recorded traffic and scripted responses.
+    void clear();
+
+    //! @brief Stop recording written bits (keeps benchmarks allocation-free).
+    void set_recording(bool enabled) noexcept { recording_ = enabled; }
+
+ private:
+    bool initialized_{false};
+    bool device_present_{true};
+    bool recording_{true};
+    std::size_t transfer_count_{0};
+    std::size_t reset_count_{0};
+    std::vector<bool> written_bits_{};
+    std::deque<bool> device_bits_{};
+};
+
+}  // namespace jenlib::onewire
+
+#endif  // INCLUDE_JENLIB_ONEWIRE_DRIVERS_NATIVEONEWIREBACKEND_H_
@@ -0,0 +1,136 @@
+//! @file jenlib/sensors/Tmp36.h
+//! @brief Integer-only TMP36 analog temperature sensor driver.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_SENSORS_TMP36_H_
+#define INCLUDE_JENLIB_SENSORS_TMP36_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include "jenlib/gpio/GPIO.h"
+
+//! @namespace jenlib::sensors
+//! @brief Drivers for the sensors used by the reference hardware.
+namespace jenlib::sensors {
+
+namespace detail {
+
+//! @brief TMP36 centi-degrees for one ADC code, rounded to nearest.
+constexpr std::int16_t tmp36_centi(std::uint32_t code, std::uint32_t max_code, std::uint32_t ref_millivolts) {
+    const std::int64_t divisor = max_code;
+    const std::int64_t numerator = static_cast<std::int64_t>(code) * ref_millivolts * 10 - 5000 * divisor;
+    const std::int64_t centi = numerator >= 0 ? (numerator + divisor / 2) / divisor
+                                              : (numerator - divisor / 2) / divisor;
+    constexpr std::int64_t kMax = std::numeric_limits<std::int16_t>::max();
+    return static_cast<std::int16_t>(centi > kMax ? kMax : centi);
+}
+
+//! @brief Code -> centi-degrees table for a given ADC resolution and reference.
+template <std::uint8_t Bits, std::uint32_t RefMillivolts>
+constexpr std::array<std::int16_t, (std::size_t{1} << Bits)> make_tmp36_table() {
+    std::array<std::int16_t, (std::size_t{1} << Bits)> table{};
+    for (std::size_t code = 0; code < table.size(); ++code) {
+        table[code] = tmp36_centi(static_cast<std::uint32_t>(code), (1u << Bits) - 1u, RefMillivolts);
+    }
+    return table;
+}
+
+//! @brief One table per configuration, shared by all instances.
+template <std::uint8_t Bits, std::uint32_t RefMillivolts>
+inline constexpr auto kTmp36Table = make_tmp36_table<Bits, RefMillivolts>();
+
+}  // namespace detail
+
+//! @brief TMP36 driver mapping ADC codes straight to centi-degrees.
+//! @details
+//! The TMP36 outputs 500 mV at 0 C and 10 mV/C, so the temperature in
+//! centi-degrees is (mV - 500) * 10. The table holds that value, rounded,
+//! for every code of a @p Bits ADC referenced to @p RefMillivolts; it is
+//! built at compile time and lives in read-only memory.
+//!
+//! With @p OversampleLog2 = k each read sums 2^k conversions and the
+//! fractional part of the average interpolates between neighbouring table
+//! entries, so oversampling still adds resolution. The whole path from ADC
+//! code to ReadingMsg::temperature_c_centi is integer arithmetic.
+//!
+//! @par Usage Example:
+//! @code
+//! #include <jenlib/sensors/Tmp36.h>
+//!
+//! jenlib::sensors::Tmp36<12, 3300, 4> tmp36(GPIO::Pin(A0));  // 16x oversampling
+//! tmp36.begin();
+//! reading_msg.temperature_c_centi = tmp36.read_centi();
+//! @endcode
+//!
+//! @tparam Bits ADC resolution the table is built for (1..12).
+//! @tparam RefMillivolts ADC full-scale reference voltage in millivolts.
+//! @tparam OversampleLog2 log2 of the conversions summed per read (0..8).
+template <std::uint8_t Bits, std::uint32_t RefMillivolts, std::uint8_t OversampleLog2 = 0>
+class Tmp36 {
+    static_assert(Bits >= 1 && Bits <= 12, "Tmp36 table supports 1 to 12 bit ADCs");
+    static_assert(RefMillivolts > 0, "Reference voltage must be positive");
+    static_assert(OversampleLog2 <= 8, "At most 256 conversions per read");
+
+ public:
+    //! Number of ADC codes (and table entries).
+    static constexpr std::size_t kCodes = std::size_t{1} << Bits;
+    //! Conversions summed per read.
+    static constexpr std::uint32_t kSamplesPerRead = std::uint32_t{1} << OversampleLog2;
+
+    //! @brief Construct on an ADC-capable pin.
+    explicit Tmp36(GPIO::Pin pin) noexcept : pin_(pin.getIndex()) {}
+
+    //! @brief The compile-time code table.
+    static constexpr const std::array<std::int16_t, kCodes>& table() noexcept { return kTable; }
+
+    //! @brief Configure the pin and the ADC resolution the table was built for.
+    //! @return false if the GPIO driver cannot run at @p Bits resolution.
+    bool begin() noexcept {
+        GPIO::Pin(pin_).pinMode(GPIO::PinMode::INPUT);
+        GPIO::setAnalogReadResolution(Bits);
+        return GPIO::getAnalogReadResolution() == Bits;
+    }
+
+    //! @brief Sample the sensor.
+    //! @return Temperature in centi-degrees Celsius.
+    std::int16_t read_centi() const noexcept {
+        const GPIO::Pin pin(pin_);
+        std::uint32_t sum = 0;
+        for (std::uint32_t i = 0; i < kSamplesPerRead; ++i) {
+            sum += pin.analogRead();
+        }
+        return centi_from_sum(sum);
+    }
+
+    //! @brief Look up one ADC code.
+    static constexpr std::int16_t centi_from_code(std::uint16_t code) noexcept {
+        return kTable[code < kCodes ? code : kCodes - 1];
+    }
+
+    //! @brief Convert a sum of kSamplesPerRead codes, interpolating the fraction.
+    static constexpr std::int16_t centi_from_sum(std::uint32_t sum) noexcept {
+        const std::uint32_t index = sum >> OversampleLog2;
+        if (index >= kCodes - 1) {
+            return kTable[kCodes - 1];
+        }
+        const std::int32_t fraction = static_cast<std::int32_t>(sum & (kSamplesPerRead - 1u));
+        const std::int32_t low = kTable[index];
+        const std::int32_t step = kTable[index + 1] - low;
+        // Round half up; OversampleLog2 = 0 leaves fraction at 0
+        const std::int32_t half = static_cast<std::int32_t>(kSamplesPerRead / 2);
+        const std::int32_t delta = (step * fraction + half) >> OversampleLog2;
+        return static_cast<std::int16_t>(low + delta);
+    }
+
+ private:
+    static constexpr const auto& kTable = detail::kTmp36Table<Bits, RefMillivolts>;
+
+    GPIO::PinIndex pin_;
+};
+
+}  // namespace jenlib::sensors
+
+#endif  // INCLUDE_JENLIB_SENSORS_TMP36_H_
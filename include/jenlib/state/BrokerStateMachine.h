@@ -10,6 +10,10 @@
 #include <jenlib/ble/Ids.h>
 #include <jenlib/ble/Messages.h>
 #include <jenlib/events/EventTypes.h>
+#include <jenlib/measurement/Aggregates.h>
+#include <jenlib/measurement/LinkQuality.h>
+#include <jenlib/measurement/QuantileSketch.h>
+#include <jenlib/measurement/SendOnDelta.h>
 
 namespace jenlib::state {
 
@@ -73,6 +77,44 @@ class BrokerStateMachine : public StateMachine<BrokerState> {
     //! @brief Get session start time
     std::uint32_t get_session_start_time_ms() const { return session_start_time_ms_; }
 
+    //! @brief Readings retained for step-hold reconstruction
+    static constexpr std::size_t kSeriesCapacity = 128;
+
+    //! @brief Step-hold series of this session's readings
+    //! @details Sensors in send-on-delta mode skip unchanged readings; the
+    //! series holds each value until the next one so it can be resampled.
+    const jenlib::measurement::StepHoldSeries<kSeriesCapacity>& get_series() const { return series_; }
+
+    //! @brief Completed aggregate buckets retained until drained
+    static constexpr std::size_t kAggregateBuckets = 16;
+
+    //! @brief Session and per-bucket statistics of this session's readings
+    //! @details Updated in O(1) per reading; drain the buckets for upload
+    //! instead of shipping every sample.
+    jenlib::measurement::BucketedAggregates<kAggregateBuckets>& get_aggregates() { return aggregates_; }
+    const jenlib::measurement::BucketedAggregates<kAggregateBuckets>& get_aggregates() const { return aggregates_; }
+
+    //! @brief Quantile sketches of this session's readings
+    //! @details Serialize and reset them once per upload period (e.g. hourly)
+    //! to report p50/p95/p99 without keeping every reading.
+    jenlib::measurement::ReadingQuantiles<>& get_quantiles() { return quantiles_; }
+    const jenlib::measurement::ReadingQuantiles<>& get_quantiles() const { return quantiles_; }
+
+    //! @brief Loss, reordering and jitter of this session's readings
+    //! @details Expected readings are derived from offset_ms and the sensor's
+    //! interval; see set_expected_interval_ms.
+    const jenlib::measurement::LinkQuality& get_link_quality() const { return link_quality_; }
+
+    //! @brief Sampling interval the target sensor uses (default 1000 ms, the sensor default)
+    //! @details Call again whenever the sensor's interval changes mid-session. For a
+    //! sensor on adaptive sampling or send-on-delta, pass the longest spacing it
+    //! guarantees (max interval or heartbeat) with Cadence::kAtMost.
+    void set_expected_interval_ms(std::uint32_t interval_ms,
+                                  jenlib::measurement::LinkQuality::Cadence cadence =
+                                      jenlib::measurement::LinkQuality::Cadence::kFixed) {
+        link_quality_.set_interval_ms(interval_ms, cadence);
+    }
+
  protected:
     //! @brief Check if transition is valid
     bool is_valid_transition(BrokerState from_state, BrokerState to_state) const override;
@@ -109,6 +151,10 @@ class BrokerStateMachine : public StateMachine<BrokerState> {
     std::uint32_t reading_count_;
     std::uint32_t last_receipt_offset_ms_;
     bool session_active_;
+    jenlib::measurement::StepHoldSeries<kSeriesCapacity> series_;
+    jenlib::measurement::BucketedAggregates<kAggregateBuckets> aggregates_;
+    jenlib::measurement::ReadingQuantiles<> quantiles_;
+    jenlib::measurement::LinkQuality link_quality_;
 };
 
 }  // namespace jenlib::state
@@ -0,0 +1,47 @@
+//! @file include/jenlib/state/SensorHealth.h
+//! @brief Sample a sensor's health counters from the library's own bookkeeping.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_STATE_SENSORHEALTH_H_
+#define INCLUDE_JENLIB_STATE_SENSORHEALTH_H_
+
+#include <cstdint>
+#include <jenlib/ble/BleDriver.h>
+#include <jenlib/ble/Messages.h>
+#include <jenlib/events/EventContext.h>
+#include <jenlib/storage/ReadingJournal.h>
+#include <jenlib/time/TimerContext.h>
+
+namespace jenlib::state {
+
+//! @brief Where sample_health() reads each counter; a null source reports 0.
+//! @details Most firmware passes EventDispatcher::default_context() and
+//! Time::default_context(). Battery comes from the application, which knows
+//! how its ADC is wired.
+struct HealthSources {
+    const jenlib::events::EventContext* events{nullptr};     //!< Queue evictions
+    const jenlib::time::TimerContext* timers{nullptr};       //!< Missed timer periods
+    const jenlib::ble::BleDriver* radio{nullptr};            //!< Inbox drops
+    const jenlib::storage::ReadingJournal* journal{nullptr};  //!< Retention fill
+    std::uint16_t battery_mv{0};                             //!< Latest battery reading
+};
+
+//! @brief Read the current health counters.
+//! @param now_ms Milliseconds since boot, reported as whole seconds of uptime.
+//!
+//! @par Usage Example:
+//! @code
+//! jenlib::state::HealthSources sources;
+//! sources.events = &jenlib::events::EventDispatcher::default_context();
+//! sources.timers = &jenlib::time::Time::default_context();
+//! sources.radio = &ble_driver;
+//! sources.journal = &journal;
+//! sources.battery_mv = read_battery_mv();
+//! sensor.broadcast_health(encoder.next(sensor_id, jenlib::state::sample_health(sources, Time::now())));
+//! @endcode
+jenlib::ble::HealthCounters sample_health(const HealthSources& sources, std::uint32_t now_ms);
+
+}  // namespace jenlib::state
+
+#endif  // INCLUDE_JENLIB_STATE_SENSORHEALTH_H_
@@ -10,6 +10,10 @@
 #include <jenlib/ble/Ids.h>
 #include <jenlib/ble/Messages.h>
 #include <jenlib/events/EventTypes.h>
+#include <jenlib/measurement/AdaptiveSampling.h>
+#include <jenlib/measurement/SendOnDelta.h>
+#include <jenlib/state/SessionSnapshot.h>
+#include <jenlib/time/TimeTypes.h>
 
 //! @namespace jenlib::state
 //! @brief State machine implementations for sensor and broker roles.
@@ -22,6 +26,7 @@
 //! @dot
 //! digraph sensor_states {
 //!     Disconnected -> Waiting [label="BLE Connected"];
+//!     Waiting -> Running [label="Restored Session"];
 //!     Waiting -> Running [label="StartBroadcast"];
 //!     Running -> Waiting [label="Session End"];
 //!     Waiting -> Disconnected [label="BLE Disconnected"];
@@ -55,7 +60,25 @@
 //! // Check if session is active before taking readings
 //! void take_reading() {
 //!     if (sensor_state_machine.is_session_active()) {
-//!         // Take and broadcast reading
+//!         // Take reading; broadcast unless send-on-delta holds it back
+//!         if (sensor_state_machine.should_broadcast(reading_msg)) {
+//!             broadcast(reading_msg);
+//!         }
+//!         // With adaptive sampling, follow the new interval without losing phase
+//!         if (sensor_state_machine.update_measurement_interval(reading_msg)) {
+//!             jenlib::time::Time::reschedule_callback(
+//!                 measurement_timer, sensor_state_machine.get_measurement_interval_ms());
+//!         }
+//!     }
+//! }
+//!
+//! // Apply sampling bounds sent with Broker::send_sampling_config
+//! void callback_sampling_config(jenlib::ble::DeviceId sender_id,
+//!                               const jenlib::ble::SamplingConfigMsg &msg) {
+//!     bool interval_changed = false;
+//!     if (sensor_state_machine.handle_sampling_config(sender_id, msg, &interval_changed) && interval_changed) {
+//!         jenlib::time::Time::reschedule_callback(
+//!             measurement_timer, sensor_state_machine.get_measurement_interval_ms());
 //!     }
 //! }
 //! @endcode
@@ -77,6 +100,12 @@ enum class SensorState : std::uint8_t {
     kError = 0x04          //!< Error state
 };
 
+//! @brief How a running sensor decides which readings to broadcast
+enum class ReportingMode : std::uint8_t {
+    kPeriodic = 0x01,     //!< Broadcast every reading
+    kSendOnDelta = 0x02,  //!< Broadcast only readings that moved beyond the deadbands
+};
+
 //! @brief Sensor state machine
 //! @details
 //! Manages the lifecycle of a BLE sensor from connection through measurement broadcasting.
@@ -107,6 +136,16 @@ class SensorStateMachine : public StateMachine<SensorState> {
     //! @return true if message was processed, false otherwise
     bool handle_receipt(jenlib::ble::DeviceId sender_id, const jenlib::ble::ReceiptMsg& msg);
 
+    //! @brief Handle adaptive sampling bounds from the broker
+    //! @param sender_id ID of the sender (broker)
+    //! @param msg Sampling configuration message
+    //! @param[out] interval_changed Optional; set to true if the measurement interval moved into the new
+    //!             bounds and the measurement timer should be rescheduled
+    //! @return true if the bounds were applied, false otherwise
+    //! @note Accepted while waiting, or while running the session the message names
+    bool handle_sampling_config(jenlib::ble::DeviceId sender_id, const jenlib::ble::SamplingConfigMsg& msg,
+                                bool* interval_changed = nullptr);
+
     //! @brief Handle session end
     //! @return true if session was ended, false otherwise
     bool handle_session_end();
@@ -133,6 +172,67 @@ class SensorStateMachine : public StateMachine<SensorState> {
     //! @brief Set measurement interval
     void set_measurement_interval_ms(std::uint32_t interval_ms) { measurement_interval_ms_ = interval_ms; }
 
+    //! @brief Adapt the measurement interval to the signal within the configured bounds
+    //! @param config Bounds and step sizes; the interval starts at the minimum
+    void set_adaptive_sampling(const jenlib::measurement::AdaptiveSamplingConfig& config);
+
+    //! @brief Return to the fixed measurement interval set by set_measurement_interval_ms
+    void set_fixed_sampling();
+
+    //! @brief Check if the measurement interval adapts to the signal
+    bool is_adaptive_sampling() const { return adaptive_sampling_; }
+
+    //! @brief Feed a reading to the adaptive sampler
+    //! @param reading The reading just taken
+    //! @return true if the measurement interval changed and the timer should be rescheduled
+    bool update_measurement_interval(const jenlib::ble::ReadingMsg& reading);
+
+    //! @brief Get reporting mode
+    ReportingMode get_reporting_mode() const { return reporting_mode_; }
+
+    //! @brief Broadcast every reading (the default)
+    void set_periodic_reporting() { reporting_mode_ = ReportingMode::kPeriodic; }
+
+    //! @brief Broadcast only readings beyond the deadbands, plus a heartbeat
+    //! @param config Deadbands and maximum silence interval
+    void set_send_on_delta_reporting(const jenlib::measurement::SendOnDeltaConfig& config);
+
+    //! @brief Decide whether a freshly sampled reading should be broadcast
+    //! @param reading The reading built on a measurement timer tick
+    //! @return true if the application should broadcast it
+    bool should_broadcast(const jenlib::ble::ReadingMsg& reading);
+
+    //! @brief Readings held back by send-on-delta in the current session
+    std::uint32_t get_suppressed_reading_count() const { return send_on_delta_.suppressed_count(); }
+
+    //! @brief Capture the running session for restore() after a reboot
+    //! @param[out] out Snapshot to fill
+    //! @param measurement_timer Timer driving measurements, to record its phase; without it the
+    //!        next measurement is assumed one interval from now
+    //! @return true if a session is running, false otherwise
+    bool snapshot(SessionSnapshot& out, jenlib::time::TimerId measurement_timer = jenlib::time::kInvalidTimerId) const;
+
+    //! @brief Resume a session captured by snapshot()
+    //! @param snapshot Session to resume
+    //! @param downtime_ms Time between the snapshot and now that the local clock did not see
+    //! @return true if the session is pending, false if not disconnected or the snapshot has no session
+    //! @details The next connection goes straight to running without waiting for a StartBroadcast,
+    //! and readings continue on the same session timeline. An adaptive session keeps adapting from
+    //! the saved interval within the bounds configured with set_adaptive_sampling().
+    bool restore(const SessionSnapshot& snapshot, std::uint32_t downtime_ms = 0);
+
+    //! @brief Check if a restored session will resume on the next connection
+    bool is_resume_pending() const { return resume_pending_; }
+
+    //! @brief Milliseconds from now until the restored schedule's next measurement, 0 if overdue
+    std::uint32_t get_resume_delay_ms() const;
+
+    //! @brief Offset of the last reading should_broadcast() let through
+    std::uint32_t get_last_sent_offset_ms() const { return last_sent_offset_ms_; }
+
+    //! @brief Highest offset acknowledged by a receipt in the current session
+    std::uint32_t get_acked_offset_ms() const { return acked_offset_ms_; }
+
  protected:
     //! @brief Check if transition is valid
     bool is_valid_transition(SensorState from_state, SensorState to_state) const override;
@@ -165,6 +265,16 @@ class SensorStateMachine : public StateMachine<SensorState> {
     std::uint32_t measurement_interval_ms_;
     std::uint32_t session_start_time_ms_;
     bool session_active_;
+    ReportingMode reporting_mode_;
+    jenlib::measurement::SendOnDeltaFilter send_on_delta_;
+    bool adaptive_sampling_;
+    std::uint32_t fixed_interval_ms_;
+    jenlib::measurement::AdaptiveSampler sampler_;
+    std::uint32_t last_sent_offset_ms_;
+    std::uint32_t acked_offset_ms_;
+    std::uint8_t cursor_flags_;
+    bool resume_pending_;
+    std::uint32_t resume_offset_ms_;
 };
 
 }  // namespace jenlib::state
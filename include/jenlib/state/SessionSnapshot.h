@@ -0,0 +1,75 @@
+//! @file include/jenlib/state/SessionSnapshot.h
+//! @brief Compact, CRC-protected record of a sensor's running session.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_STATE_SESSIONSNAPSHOT_H_
+#define INCLUDE_JENLIB_STATE_SESSIONSNAPSHOT_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <jenlib/ble/Ids.h>
+#include <jenlib/storage/SnapshotStore.h>
+
+namespace jenlib::state {
+
+//! @brief Session state a sensor needs to carry on after a reboot without a new StartBroadcast.
+//! @details
+//! Offsets are milliseconds on the session timeline (the @c offset_ms of
+//! ReadingMsg), so they stay meaningful across a reset that restarts the
+//! local clock. The encoding is fixed little-endian with a magic, a version
+//! and a trailing CRC-32; anything that fails those checks is rejected
+//! rather than resumed.
+//!
+//! @par Usage Example:
+//! @code
+//! // After each broadcast or receipt
+//! jenlib::state::SessionSnapshot snapshot;
+//! if (sensor_state_machine.snapshot(snapshot, measurement_timer)) {
+//!     jenlib::state::SessionSnapshot::save(rtc_store, snapshot);
+//! }
+//!
+//! // At boot
+//! if (jenlib::state::SessionSnapshot::load(rtc_store, snapshot)) {
+//!     sensor_state_machine.restore(snapshot, estimated_downtime_ms);
+//! }
+//! @endcode
+struct SessionSnapshot {
+    //! @brief Flag bits
+    static constexpr std::uint8_t kFlagAdaptiveSampling = 0x01;  //!< Interval was adapting
+    static constexpr std::uint8_t kFlagHasSent = 0x02;           //!< last_sent_offset_ms is valid
+    static constexpr std::uint8_t kFlagHasAck = 0x04;            //!< acked_offset_ms is valid
+
+    static constexpr std::uint16_t kMagic = 0x534A;  //!< "JS" little-endian
+    static constexpr std::uint8_t kVersion = 1;
+    static constexpr std::size_t kEncodedSize = 36;
+
+    using Buffer = std::array<std::uint8_t, kEncodedSize>;
+
+    jenlib::ble::SessionId session_id;               //!< Session being run
+    jenlib::ble::DeviceId broker_id;                 //!< Broker that started it
+    std::uint32_t measurement_interval_ms{0};        //!< Interval in use
+    std::uint32_t session_offset_ms{0};              //!< Session time when the snapshot was taken
+    std::uint32_t next_measurement_offset_ms{0};     //!< Session time the next measurement was due
+    std::uint32_t last_sent_offset_ms{0};            //!< Offset of the last broadcast reading
+    std::uint32_t acked_offset_ms{0};                //!< Highest offset the broker acknowledged
+    std::uint8_t flags{0};
+
+    static bool serialize(const SessionSnapshot& snapshot, Buffer& out);
+    static bool deserialize(const std::uint8_t* data, std::size_t size, SessionSnapshot& out);
+
+    //! @brief Encode and write to @p store.
+    static bool save(jenlib::storage::SnapshotStore& store, const SessionSnapshot& snapshot);
+
+    //! @brief Read from @p store and decode.
+    //! @return false if nothing is stored or the record is corrupt or from another version.
+    static bool load(jenlib::storage::SnapshotStore& store, SessionSnapshot& out);
+};
+
+static_assert(SessionSnapshot::kEncodedSize <= jenlib::storage::SnapshotStore::kMaxSnapshotSize,
+              "Session snapshot must fit every snapshot store");
+
+}  // namespace jenlib::state
+
+#endif  // INCLUDE_JENLIB_STATE_SESSIONSNAPSHOT_H_
@@ -0,0 +1,36 @@
+//! @file include/jenlib/storage/ByteOrder.h
+//! @brief Little-endian field access for persisted records.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_STORAGE_BYTEORDER_H_
+#define INCLUDE_JENLIB_STORAGE_BYTEORDER_H_
+
+#include <cstdint>
+
+namespace jenlib::storage {
+
+inline void store_u16le(std::uint8_t* out, std::uint16_t value) {
+    out[0] = static_cast<std::uint8_t>(value);
+    out[1] = static_cast<std::uint8_t>(value >> 8);
+}
+
+inline void store_u32le(std::uint8_t* out, std::uint32_t value) {
+    out[0] = static_cast<std::uint8_t>(value);
+    out[1] = static_cast<std::uint8_t>(value >> 8);
+    out[2] = static_cast<std::uint8_t>(value >> 16);
+    out[3] = static_cast<std::uint8_t>(value >> 24);
+}
+
+inline std::uint16_t load_u16le(const std::uint8_t* in) {
+    return static_cast<std::uint16_t>(in[0] | (in[1] << 8));
+}
+
+inline std::uint32_t load_u32le(const std::uint8_t* in) {
+    return static_cast<std::uint32_t>(in[0]) | (static_cast<std::uint32_t>(in[1]) << 8) |
+           (static_cast<std::uint32_t>(in[2]) << 16) | (static_cast<std::uint32_t>(in[3]) << 24);
+}
+
+}  // namespace jenlib::storage
+
+#endif  // INCLUDE_JENLIB_STORAGE_BYTEORDER_H_
@@ -0,0 +1,23 @@
+//! @file include/jenlib/storage/Crc32.h
+//! @brief CRC-32 for records kept in RAM, flash and files.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_STORAGE_CRC32_H_
+#define INCLUDE_JENLIB_STORAGE_CRC32_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace jenlib::storage {
+
+//! @brief CRC-32 (IEEE 802.3, reflected poly 0xEDB88320), as used by zlib.
+//! @param data Bytes to check.
+//! @param len Number of bytes.
+//! @param crc Result of a previous call, to continue over split buffers; 0 to start.
+//! @return CRC of all bytes so far.
+std::uint32_t crc32(const std::uint8_t* data, std::size_t len, std::uint32_t crc = 0) noexcept;
+
+}  // namespace jenlib::storage
+
+#endif  // INCLUDE_JENLIB_STORAGE_CRC32_H_
@@ -0,0 +1,170 @@
+//! @file include/jenlib/storage/IngestWal.h
+//! @brief Group-commit write-ahead log of readings received by a native broker.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_STORAGE_INGESTWAL_H_
+#define INCLUDE_JENLIB_STORAGE_INGESTWAL_H_
+
+#if defined(__linux__) && !defined(ARDUINO) && !defined(ESP_PLATFORM)
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include "jenlib/ble/Ids.h"
+#include "jenlib/ble/Messages.h"
+
+namespace jenlib::storage {
+
+//! @brief When buffered records are written and fsynced.
+//! @details A commit happens when @c max_records are buffered or the oldest
+//! buffered record is @c max_delay_ms old, whichever comes first. {1, 0}
+//! syncs every record.
+struct WalCommitPolicy {
+    std::uint32_t max_records{64};   //!< Records per commit, at most IngestWal::kMaxBatchRecords
+    std::uint32_t max_delay_ms{10};  //!< Longest a record waits for its commit
+};
+
+//! @brief Append-only file of readings, made durable in batches.
+//! @details
+//! append() encodes a reading into an in-memory batch. commit() writes the
+//! batch with one write() and one fdatasync(), so the sync cost is shared
+//! by every record in the batch. Each record carries a CRC-32; open()
+//! replays the file, cuts off a torn tail and rebuilds the durable offsets.
+//!
+//! The log tracks, per sensor and session, the highest offset appended
+//! and the highest offset made durable. After each commit the durable
+//! callback receives a ReceiptMsg for every stream that advanced, so
+//! receipts are only sent for readings that would survive a broker crash.
+//! Readings of a stream are expected in offset order, as sensors send them.
+//!
+//! A failed write is rolled back and can be retried. If it cannot be rolled
+//! back, or fdatasync() fails, the log refuses further writes and sends no
+//! more receipts until it is reopened: after a failed sync the kernel may
+//! have dropped the batch, so a later sync that succeeds proves nothing.
+//! Recovery then cuts any partial batch.
+//!
+//! Commits run on the calling thread. Call poll() from the run loop, or
+//! from a repeating timer, so max_delay_ms holds when readings stop; the
+//! delay is measured with jenlib::time::Time, which needs a driver.
+//!
+//! @par Usage Example:
+//! @code
+//! jenlib::storage::IngestWal wal({64, 10});
+//! wal.open("/var/lib/broker/ingest.wal");
+//! wal.set_durable_callback([&broker](jenlib::ble::DeviceId sensor, const jenlib::ble::ReceiptMsg& receipt) {
+//!     broker.send_receipt(sensor, receipt);
+//! });
+//! jenlib::ble::BleCallbacks callbacks;
+//! callbacks.on_reading = [&wal](jenlib::ble::DeviceId, const jenlib::ble::ReadingMsg& msg) { wal.append(msg); };
+//! broker.configure_callbacks(callbacks);
+//! while (running) {
+//!     broker.process_events();
+//!     wal.poll();
+//! }
+//! @endcode
+class IngestWal {
+ public:
+    //! @brief Bytes per record.
+    static constexpr std::size_t kRecordSize = 20;
+
+    //! @brief Largest batch a policy may ask for.
+    static constexpr std::size_t kMaxBatchRecords = 1024;
+
+    //! @brief Sensor sessions whose offsets are tracked at once.
+    static constexpr std::size_t kMaxStreams = 64;
+
+    //! @brief Called after a commit for each stream whose durable offset advanced.
+    using DurableCallback = std::function<void(jenlib::ble::DeviceId sensor, const jenlib::ble::ReceiptMsg& receipt)>;
+
+    explicit IngestWal(WalCommitPolicy policy = {});
+    ~IngestWal() { close(); }
+    IngestWal(const IngestWal&) = delete;
+    IngestWal& operator=(const IngestWal&) = delete;
+
+    //! @brief Open or create @p path, recovering the records already in it.
+    bool open(const char* path);
+
+    //! @brief Commit what is buffered and close the file.
+    void close();
+
+    //! @brief Change the commit policy; max_records is clamped to kMaxBatchRecords.
+    void set_policy(WalCommitPolicy policy);
+
+    //! @brief Receive a receipt for each stream a commit made durable.
+    void set_durable_callback(DurableCallback callback) { durable_callback_ = std::move(callback); }
+
+    //! @brief Buffer one reading, committing if the batch is full.
+    //! @return false if the log is not open or the commit failed.
+    bool append(const jenlib::ble::ReadingMsg& reading);
+
+    //! @brief Commit if the oldest buffered record has waited max_delay_ms.
+    //! @return false if a commit was due and failed.
+    bool poll();
+
+    //! @brief Write and fdatasync the buffered records now.
+    //! @return false if the log is not open or has failed, or the write or sync failed.
+    bool commit();
+
+    //! @brief Empty the log once its readings are stored elsewhere; durable offsets are kept.
+    bool clear();
+
+    //! @brief Highest durable offset of a sensor's session.
+    //! @return false if nothing of that session is durable.
+    bool durable_offset(jenlib::ble::DeviceId sensor, jenlib::ble::SessionId session, std::uint32_t& offset_ms) const;
+
+    //! @brief Records buffered and not yet durable.
+    std::size_t pending_records() const { return batch_records_; }
+
+    //! @brief Records in the file, including those recovered by open().
+    std::uint64_t durable_records() const { return durable_records_; }
+
+    //! @brief Commits (fdatasync calls) since open().
+    std::uint64_t commit_count() const { return commit_count_; }
+
+    //! @brief Bytes of torn tail cut off by open().
+    std::uint64_t truncated_bytes() const { return truncated_bytes_; }
+
+    //! @brief A sync failed, or a failed write could not be rolled back; writes are refused until open().
+    bool failed() const { return failed_; }
+
+ private:
+    //! @brief Offsets of one sensor session.
+    struct Stream {
+        jenlib::ble::DeviceId sensor;
+        jenlib::ble::SessionId session;
+        std::uint32_t appended_offset_ms{0};
+        std::uint32_t durable_offset_ms{0};
+        std::uint64_t last_used{0};
+        bool active{false};
+        bool has_durable{false};
+        bool pending{false};  //!< Appended records wait for a commit
+    };
+
+    //! @brief Find or claim the stream of a sensor session, evicting the least recently used.
+    //! @return nullptr if the victim had pending records and the commit that would acknowledge them failed.
+    Stream* stream_for(jenlib::ble::DeviceId sensor, jenlib::ble::SessionId session);
+
+    //! @brief Read the file, stop at the first invalid record and cut the file there.
+    bool recover();
+
+    WalCommitPolicy policy_;
+    int fd_{-1};
+    std::array<std::uint8_t, kMaxBatchRecords * kRecordSize> batch_{};
+    std::size_t batch_records_{0};
+    std::uint32_t batch_started_ms_{0};
+    std::array<Stream, kMaxStreams> streams_{};
+    std::uint64_t use_counter_{0};
+    std::uint64_t durable_records_{0};
+    std::uint64_t commit_count_{0};
+    std::uint64_t truncated_bytes_{0};
+    bool failed_{false};
+    DurableCallback durable_callback_;
+};
+
+}  // namespace jenlib::storage
+
+#endif  // __linux__ && !ARDUINO && !ESP_PLATFORM
+
+#endif  // INCLUDE_JENLIB_STORAGE_INGESTWAL_H_
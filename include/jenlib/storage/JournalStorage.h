@@ -0,0 +1,48 @@
+//! @file include/jenlib/storage/JournalStorage.h
+//! @brief Sector-erasable storage that a log-structured journal is written to.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_STORAGE_JOURNALSTORAGE_H_
+#define INCLUDE_JENLIB_STORAGE_JOURNALSTORAGE_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace jenlib::storage {
+
+//! @brief Byte-addressable region divided into equal sectors with NOR flash rules.
+//! @details
+//! An erased sector reads as 0xFF. A write may only go to bytes that are
+//! erased, and is not guaranteed to be durable until sync() returns.
+//! Addresses are 64-bit so a native backend can span several gigabytes.
+//!
+//! Platform backends:
+//! - EspIdfPartitionJournalStorage: a data partition in SPI flash.
+//! - MmapJournalStorage: a memory-mapped file on Linux.
+class JournalStorage {
+ public:
+    virtual ~JournalStorage() = default;
+
+    //! @brief Erase unit in bytes.
+    virtual std::size_t sector_size() const = 0;
+
+    //! @brief Number of sectors.
+    virtual std::size_t sector_count() const = 0;
+
+    //! @brief Copy @p size bytes at @p address into @p out.
+    virtual bool read(std::uint64_t address, std::uint8_t* out, std::size_t size) = 0;
+
+    //! @brief Program @p size bytes at @p address; the bytes must be erased.
+    virtual bool write(std::uint64_t address, const std::uint8_t* data, std::size_t size) = 0;
+
+    //! @brief Set every byte of one sector to 0xFF.
+    virtual bool erase_sector(std::size_t sector) = 0;
+
+    //! @brief Make all completed writes and erases durable.
+    virtual bool sync() = 0;
+};
+
+}  // namespace jenlib::storage
+
+#endif  // INCLUDE_JENLIB_STORAGE_JOURNALSTORAGE_H_
@@ -0,0 +1,171 @@
+//! @file include/jenlib/storage/ReadingJournal.h
+//! @brief Append-only, flash-friendly journal of readings awaiting a receipt.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_STORAGE_READINGJOURNAL_H_
+#define INCLUDE_JENLIB_STORAGE_READINGJOURNAL_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include "jenlib/ble/Ids.h"
+#include "jenlib/ble/Messages.h"
+#include "jenlib/storage/JournalStorage.h"
+
+namespace jenlib::storage {
+
+//! @brief Log-structured ring of readings over sector-erasable storage.
+//! @details
+//! Every sector is a page: a CRC-protected header followed by fixed-size
+//! records, each with its own CRC. Pages are filled in ring order and a
+//! sector is erased only just before it is reused, so every sector is
+//! erased once per lap and no byte is programmed twice between erases.
+//!
+//! Receipts truncate the journal: truncate() records the acknowledged
+//! offset and releases pages at the head whose readings are all
+//! acknowledged or belong to an older session. The acknowledged position is
+//! logged as a record and copied into every new page header, so it survives
+//! a reset. Released pages keep their headers until reused, so receipt
+//! records and page headers also carry the sequence of the head page.
+//!
+//! open() recovers by reading only the page headers to find the tail page,
+//! then scanning the tail page for the write position and the latest head
+//! sequence; pages older than that head stay released. A torn record fails
+//! its CRC and is skipped. Recovery cost is one header per sector plus one
+//! page, not a replay of the records.
+//!
+//! Readings are delivered at least once: a reset between a receipt and its
+//! log record replays readings the broker already has.
+//!
+//! @par Usage Example:
+//! @code
+//! jenlib::storage::ReadingJournal journal(storage);
+//! journal.open();
+//!
+//! // Keep every reading until the broker acknowledges it
+//! journal.append(reading_msg);
+//!
+//! // On a receipt
+//! journal.truncate(receipt_msg);
+//!
+//! // After reconnecting, resend what was not acknowledged
+//! journal.replay(session_id, [](const jenlib::ble::ReadingMsg& reading) {
+//!     jenlib::ble::BLE::broadcast_reading(reading);
+//!     return true;
+//! });
+//! @endcode
+class ReadingJournal {
+ public:
+    //! @brief Bytes at the start of every page.
+    static constexpr std::size_t kPageHeaderSize = 28;
+
+    //! @brief Bytes per record.
+    static constexpr std::size_t kRecordSize = 24;
+
+    //! @brief Called for each replayed reading; return false to stop.
+    using ReplayCallback = std::function<bool(const jenlib::ble::ReadingMsg&)>;
+
+    explicit ReadingJournal(JournalStorage& storage) : storage_(storage) {}
+
+    //! @brief Recover the journal, or format it if it holds no valid page.
+    //! @return false if the storage is too small or cannot be read.
+    bool open();
+
+    //! @brief Erase every live page and start empty.
+    bool format();
+
+    //! @brief Append one reading.
+    //! @return false if the journal is full of unacknowledged readings or the write failed.
+    bool append(const jenlib::ble::ReadingMsg& reading);
+
+    //! @brief Acknowledge readings of @p receipt's session up to its offset and reclaim pages.
+    //! @return false if the acknowledgement could not be logged; it still applies until a reset.
+    bool truncate(const jenlib::ble::ReceiptMsg& receipt);
+
+    //! @brief Deliver unacknowledged readings of @p session, oldest first.
+    //! @return Number of readings delivered.
+    std::size_t replay(jenlib::ble::SessionId session, const ReplayCallback& callback);
+
+    //! @brief Make appended records durable.
+    bool sync() { return storage_.sync(); }
+
+    //! @brief Session whose readings are acknowledged up to acked_offset_ms(); 0 if none.
+    jenlib::ble::SessionId acked_session() const { return acked_session_; }
+
+    //! @brief Highest acknowledged offset in acked_session().
+    std::uint32_t acked_offset_ms() const { return acked_offset_ms_; }
+
+    //! @brief Pages holding records, including the one being filled.
+    std::size_t live_pages() const { return live_pages_; }
+
+    //! @brief Share of sectors holding live pages, in permille (0 before open()).
+    std::uint16_t fill_permille() const {
+        return sector_count_ == 0 ? 0 : static_cast<std::uint16_t>(live_pages_ * 1000u / sector_count_);
+    }
+
+    //! @brief Records that fit in one page.
+    std::size_t records_per_page() const { return records_per_page_; }
+
+    //! @brief Torn or corrupt records found in the tail page by open().
+    std::uint32_t corrupt_records() const { return corrupt_records_; }
+
+ private:
+    enum class RecordKind : std::uint8_t {
+        kReading = 0x01,
+        kReceipt = 0x02,
+    };
+
+    //! @brief Decoded record.
+    struct Record {
+        RecordKind kind{RecordKind::kReading};
+        jenlib::ble::ReadingMsg reading{};
+    };
+
+    enum class SlotState : std::uint8_t { kEmpty, kValid, kCorrupt };
+
+    //! @brief Read and decode one record slot.
+    SlotState read_slot(std::size_t sector, std::size_t slot, Record& out);
+
+    //! @brief Write a record at the tail, opening a new page if needed.
+    bool write_record(const Record& record);
+
+    //! @brief Erase the next sector and write its header.
+    bool open_page();
+
+    //! @brief Release up to @p max_pages head pages that hold nothing left to send; they are erased on reuse.
+    void reclaim(std::size_t max_pages);
+
+    //! @brief Check whether every reading in a page is acknowledged or stale.
+    bool is_reclaimable(std::size_t sector);
+
+    bool is_acked(const jenlib::ble::ReadingMsg& reading) const {
+        return reading.session_id == acked_session_ && reading.offset_ms <= acked_offset_ms_;
+    }
+
+    std::uint64_t slot_address(std::size_t sector, std::size_t slot) const {
+        return static_cast<std::uint64_t>(sector) * storage_.sector_size() + kPageHeaderSize + slot * kRecordSize;
+    }
+
+    std::size_t next_sector(std::size_t sector) const { return sector + 1 == sector_count_ ? 0 : sector + 1; }
+
+    //! @brief Sequence of the head page; that of the next page opened when none is live.
+    std::uint32_t head_sequence() const { return tail_sequence_ + 1 - static_cast<std::uint32_t>(live_pages_); }
+
+    JournalStorage& storage_;
+    std::size_t sector_count_{0};
+    std::size_t records_per_page_{0};
+    std::size_t head_{0};
+    std::size_t tail_{0};
+    std::size_t live_pages_{0};
+    std::size_t write_slot_{0};
+    std::uint32_t tail_sequence_{0};
+    jenlib::ble::SessionId last_session_{0};
+    jenlib::ble::SessionId acked_session_{0};
+    std::uint32_t acked_offset_ms_{0};
+    std::uint32_t corrupt_records_{0};
+};
+
+}  // namespace jenlib::storage
+
+#endif  // INCLUDE_JENLIB_STORAGE_READINGJOURNAL_H_
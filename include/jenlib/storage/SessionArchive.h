@@ -0,0 +1,236 @@
+//! @file include/jenlib/storage/SessionArchive.h
+//! @brief Segmented, column-compressed archive of readings read through mmap (Linux).
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_STORAGE_SESSIONARCHIVE_H_
+#define INCLUDE_JENLIB_STORAGE_SESSIONARCHIVE_H_
+
+#if defined(__linux__) && !defined(ARDUINO) && !defined(ESP_PLATFORM)
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+#include "jenlib/ble/Ids.h"
+#include "jenlib/ble/Messages.h"
+
+namespace jenlib::storage {
+
+//! @brief On-disk layout of the archive.
+//! @details
+//! An archive is a directory of segment files named segment-NNNNNNNN.jsa.
+//! A segment is a header, a run of immutable blocks and, once sealed, a
+//! footer listing every block. Each block holds up to kBlockRows readings of
+//! one (DeviceId, SessionId) in offset order:
+//! - a block header with the stream, the session's wall-clock base and the
+//!   offset range, covered with the rest of the block by a CRC-32;
+//! - a sparse index, one entry every kIndexStride rows, holding that row's
+//!   values and where the next row starts in each column;
+//! - three columns (offset, temperature, humidity), each the zigzag varint
+//!   deltas from the previous row.
+//!
+//! A query finds blocks through the footers and enters a block through its
+//! index, so it reads only the footer, index and column pages it needs.
+//! A segment without a footer (the writer stopped before sealing it) is
+//! recovered by walking its block headers.
+namespace archive {
+constexpr std::uint32_t kSegmentMagic = 0x5352414Au;  //!< "JARS"
+constexpr std::uint32_t kBlockMagic = 0x4252414Au;    //!< "JARB"
+constexpr std::uint32_t kFooterMagic = 0x4652414Au;   //!< "JARF"
+constexpr std::uint16_t kVersion = 1;
+constexpr std::size_t kSegmentHeaderSize = 16;
+constexpr std::size_t kBlockHeaderSize = 56;
+constexpr std::size_t kIndexEntrySize = 24;
+constexpr std::size_t kDirectoryEntrySize = 40;
+constexpr std::size_t kTrailerSize = 24;
+constexpr std::size_t kBlockRows = 4096;
+constexpr std::size_t kIndexStride = 128;
+}  // namespace archive
+
+//! @brief One archived reading.
+struct ArchiveRow {
+    jenlib::ble::DeviceId sensor;
+    jenlib::ble::SessionId session;
+    std::uint64_t time_ms{0};   //!< Wall-clock time: session base plus offset
+    std::uint32_t offset_ms{0};
+    std::int16_t temperature_c_centi{0};
+    std::uint16_t humidity_bp{0};
+};
+
+//! @brief Builds blocks per stream and writes them into rolling segments.
+//! @details Rows of a stream must arrive in offset order. A block is written
+//! when a stream has kBlockRows rows or on flush(); a segment is sealed when
+//! it passes the size limit or on close().
+//!
+//! @par Usage Example:
+//! @code
+//! jenlib::storage::ArchiveWriter writer;
+//! writer.open("/var/lib/broker/archive");
+//! writer.add(session_start_ms, reading_msg);  // From the upload path
+//! writer.close();
+//! @endcode
+class ArchiveWriter {
+ public:
+    ArchiveWriter() = default;
+    ~ArchiveWriter() { close(); }
+    ArchiveWriter(const ArchiveWriter&) = delete;
+    ArchiveWriter& operator=(const ArchiveWriter&) = delete;
+
+    //! @brief Start writing segments into @p directory after any already there.
+    //! @param max_segment_bytes Size after which a segment is sealed and a new one begun.
+    bool open(const std::string& directory, std::uint64_t max_segment_bytes = 64ull << 20);
+
+    //! @brief Buffer one reading of a session whose offset 0 was @p session_start_ms wall-clock time.
+    bool add(std::uint64_t session_start_ms, const jenlib::ble::ReadingMsg& reading);
+
+    //! @brief Write every partial block.
+    bool flush();
+
+    //! @brief Flush, seal the open segment and stop.
+    bool close();
+
+    //! @brief Mark the segments written as replacing every segment up to @p segment; used by compaction.
+    void set_replaces_through(std::uint32_t segment) { replaces_through_ = segment; }
+
+    //! @brief Blocks written since open().
+    std::size_t blocks_written() const { return blocks_written_; }
+
+ private:
+    struct Stream {
+        jenlib::ble::DeviceId sensor;
+        jenlib::ble::SessionId session;
+        std::uint64_t base_time_ms{0};
+        std::vector<jenlib::ble::ReadingMsg> rows;
+    };
+    struct DirectoryEntry {
+        jenlib::ble::DeviceId sensor;
+        jenlib::ble::SessionId session;
+        std::uint64_t base_time_ms{0};
+        std::uint32_t first_offset_ms{0};
+        std::uint32_t last_offset_ms{0};
+        std::uint64_t position{0};
+        std::uint32_t count{0};
+    };
+
+    bool write_block(Stream& stream);
+    bool begin_segment();
+    bool seal(bool final_segment);
+    bool write_all(const std::uint8_t* data, std::size_t size);
+
+    std::string directory_;
+    std::uint64_t max_segment_bytes_{0};
+    std::uint32_t next_segment_{1};
+    std::uint32_t replaces_through_{0};
+    int fd_{-1};
+    std::uint64_t position_{0};
+    std::vector<Stream> streams_;
+    std::vector<DirectoryEntry> directory_entries_;
+    std::vector<std::uint8_t> buffer_;
+    std::size_t blocks_written_{0};
+    bool open_{false};
+};
+
+//! @brief Maps every segment of an archive and answers range queries.
+//! @details Blocks are indexed in memory by sensor and start time; block
+//! contents are only touched when a query needs them. The first read of a
+//! block bounds its sizes and checks its CRC; a block that fails is skipped.
+//! That check is cached in the reader, so one reader must not be queried from
+//! several threads at once. Segments replaced by a finished compaction are
+//! skipped, as is the output of an unfinished one.
+//!
+//! @par Usage Example:
+//! @code
+//! jenlib::storage::ArchiveReader reader;
+//! reader.open("/var/lib/broker/archive");
+//! const std::uint64_t now_ms = wall_clock_ms();
+//! reader.query(sensor_id, now_ms - 24 * 3600 * 1000, now_ms, [](const jenlib::storage::ArchiveRow& row) {
+//!     plot(row.time_ms, row.temperature_c_centi);
+//!     return true;
+//! });
+//! @endcode
+class ArchiveReader {
+ public:
+    //! @brief Called per row; return false to stop.
+    using RowCallback = std::function<bool(const ArchiveRow&)>;
+
+    ArchiveReader() = default;
+    ~ArchiveReader() { close(); }
+    ArchiveReader(const ArchiveReader&) = delete;
+    ArchiveReader& operator=(const ArchiveReader&) = delete;
+
+    //! @brief Map the segments of @p directory and load their block directories.
+    bool open(const std::string& directory);
+
+    //! @brief Unmap everything.
+    void close();
+
+    //! @brief Rows of @p sensor with from_ms <= time_ms <= to_ms, in time order per session.
+    //! @return Number of rows delivered.
+    std::size_t query(jenlib::ble::DeviceId sensor, std::uint64_t from_ms, std::uint64_t to_ms,
+                      const RowCallback& callback) const;
+
+    //! @brief Every row in the archive, block by block.
+    std::size_t scan(const RowCallback& callback) const;
+
+    //! @brief Recompute every block's CRC.
+    //! @return Number of blocks that failed.
+    std::size_t verify() const;
+
+    //! @brief Visible segments.
+    std::size_t segment_count() const { return segments_.size(); }
+
+    //! @brief Visible blocks.
+    std::size_t block_count() const { return blocks_.size(); }
+
+    //! @brief Highest segment number seen, visible or not.
+    std::uint32_t last_segment() const { return last_segment_; }
+
+    //! @brief Segment numbers made redundant by a finished compaction.
+    const std::vector<std::uint32_t>& replaced_segments() const { return replaced_; }
+
+    //! @brief Segment numbers that are visible.
+    std::vector<std::uint32_t> segment_numbers() const;
+
+ private:
+    struct Segment {
+        std::uint32_t number{0};
+        const std::uint8_t* base{nullptr};
+        std::size_t size{0};
+    };
+    enum class BlockCheck : std::uint8_t { kUnchecked, kGood, kCorrupt };
+    struct BlockRef {
+        const std::uint8_t* block{nullptr};
+        jenlib::ble::DeviceId sensor;
+        jenlib::ble::SessionId session;
+        std::uint64_t first_time_ms{0};
+        std::uint64_t last_time_ms{0};
+        std::uint64_t reach_ms{0};  // Latest last_time_ms of this and earlier blocks of the sensor
+        std::uint64_t limit{0};     // Mapped bytes from block to the end of the segment's block area
+        mutable BlockCheck check{BlockCheck::kUnchecked};  // Set by the first read of the block
+    };
+
+    //! @brief Decode rows of one block with time in [from_ms, to_ms].
+    std::size_t read_block(const BlockRef& ref, std::uint64_t from_ms, std::uint64_t to_ms,
+                           const RowCallback& callback, bool& stop) const;
+
+    std::vector<Segment> mapped_;    // Every mapping, including hidden segments
+    std::vector<Segment> segments_;  // Visible segments
+    std::vector<BlockRef> blocks_;
+    std::vector<std::uint32_t> replaced_;
+    std::uint32_t last_segment_{0};
+};
+
+//! @brief Rewrite an archive so each stream is stored in full blocks, then delete the old segments.
+//! @details New segments are written and synced before old ones are removed,
+//! and readers ignore the new segments until the last one is sealed, so a
+//! crash at any point leaves each reading visible exactly once.
+//! @return false if the archive could not be read or rewritten.
+bool compact_archive(const std::string& directory);
+
+}  // namespace jenlib::storage
+
+#endif  // __linux__ && !ARDUINO && !ESP_PLATFORM
+
+#endif  // INCLUDE_JENLIB_STORAGE_SESSIONARCHIVE_H_
@@ -0,0 +1,50 @@
+//! @file include/jenlib/storage/SnapshotStore.h
+//! @brief Storage backend for a small blob that must survive a reset.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_STORAGE_SNAPSHOTSTORE_H_
+#define INCLUDE_JENLIB_STORAGE_SNAPSHOTSTORE_H_
+
+#include <cstddef>
+#include <cstdint>
+
+//! @namespace jenlib::storage
+//! @brief Persistence backends for sensor and broker state.
+//! @details
+//! Backends only move bytes. The records they hold carry their own CRC, so
+//! a torn write or stale memory shows up as a failed decode, not as wrong
+//! state.
+namespace jenlib::storage {
+
+//! @brief Holds one blob of up to kMaxSnapshotSize bytes; each save replaces the last.
+//! @details
+//! Platform backends:
+//! - EspIdfRtcSnapshotStore: RTC memory, survives watchdog and software
+//!   resets and deep sleep, costs no flash wear; lost on power loss.
+//! - EspIdfNvsSnapshotStore: NVS flash, survives power loss.
+//! - FileSnapshotStore: a file on native builds, replaced atomically.
+class SnapshotStore {
+ public:
+    //! @brief Largest blob a backend must accept.
+    static constexpr std::size_t kMaxSnapshotSize = 64;
+
+    virtual ~SnapshotStore() = default;
+
+    //! @brief Replace the stored blob.
+    //! @return false if @p size exceeds kMaxSnapshotSize or the write failed.
+    virtual bool save(const std::uint8_t* data, std::size_t size) = 0;
+
+    //! @brief Read the stored blob.
+    //! @param out Buffer of at least kMaxSnapshotSize bytes.
+    //! @param[out] size Bytes read.
+    //! @return false if nothing is stored or the read failed.
+    virtual bool load(std::uint8_t* out, std::size_t& size) = 0;
+
+    //! @brief Remove the stored blob so the next load() fails.
+    virtual bool clear() = 0;
+};
+
+}  // namespace jenlib::storage
+
+#endif  // INCLUDE_JENLIB_STORAGE_SNAPSHOTSTORE_H_
@@ -0,0 +1,62 @@
+//! @file include/jenlib/storage/Varint.h
+//! @brief Zigzag and LEB128 varint coding shared by packets, messages and archives.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_STORAGE_VARINT_H_
+#define INCLUDE_JENLIB_STORAGE_VARINT_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace jenlib::storage {
+
+constexpr std::size_t kMaxVarintSize = 5;  //!< Bytes needed for any 32-bit value.
+
+//! @brief Map signed to unsigned so small magnitudes stay small.
+constexpr std::uint32_t zigzag(std::int32_t value) {
+    return (static_cast<std::uint32_t>(value) << 1) ^ static_cast<std::uint32_t>(value >> 31);
+}
+
+//! @brief Inverse of zigzag().
+constexpr std::int32_t unzigzag(std::uint32_t value) {
+    return static_cast<std::int32_t>(value >> 1) ^ -static_cast<std::int32_t>(value & 1u);
+}
+
+//! @brief Write an LEB128 varint; @p out must hold kMaxVarintSize bytes.
+//! @return Bytes written (1-5).
+inline std::size_t put_varint(std::uint32_t value, std::uint8_t* out) {
+    std::size_t n = 0;
+    while (value >= 0x80u) {
+        out[n++] = static_cast<std::uint8_t>(value | 0x80u);
+        value >>= 7;
+    }
+    out[n++] = static_cast<std::uint8_t>(value);
+    return n;
+}
+
+//! @brief Read an LEB128 varint from [it, end), advancing @p it.
+//! @return false if the input ends first or the value does not fit 32 bits.
+template <typename InputIt>
+bool get_varint(InputIt& it, InputIt end, std::uint32_t& out) {
+    std::uint32_t value = 0;
+    for (unsigned shift = 0; shift < 32; shift += 7) {
+        if (it == end) {
+            return false;
+        }
+        const std::uint8_t byte = *it++;
+        if (shift == 28 && byte > 0x0Fu) {
+            return false;
+        }
+        value |= static_cast<std::uint32_t>(byte & 0x7Fu) << shift;
+        if ((byte & 0x80u) == 0) {
+            out = value;
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace jenlib::storage
+
+#endif  // INCLUDE_JENLIB_STORAGE_VARINT_H_
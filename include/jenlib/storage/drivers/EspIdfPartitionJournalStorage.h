@@ -0,0 +1,51 @@
+//! @file include/jenlib/storage/drivers/EspIdfPartitionJournalStorage.h
+//! @brief Journal storage on an SPI flash data partition (ESP-IDF).
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_STORAGE_DRIVERS_ESPIDFPARTITIONJOURNALSTORAGE_H_
+#define INCLUDE_JENLIB_STORAGE_DRIVERS_ESPIDFPARTITIONJOURNALSTORAGE_H_
+
+#include <jenlib/storage/JournalStorage.h>
+
+#ifdef ESP_PLATFORM
+#include <esp_partition.h>
+
+namespace jenlib::storage {
+
+//! @brief Journal storage on a data partition found by label.
+//! @details Sectors are the 4 KiB flash erase unit. Flash writes are durable
+//! when esp_partition_write returns, so sync() has nothing to do. Add the
+//! partition to partitions.csv, e.g. @c journal,data,0x40,,512K
+class EspIdfPartitionJournalStorage : public JournalStorage {
+ public:
+    //! @param label Partition label.
+    //! @param subtype Data partition subtype.
+    explicit EspIdfPartitionJournalStorage(const char* label = "journal",
+                                           esp_partition_subtype_t subtype = static_cast<esp_partition_subtype_t>(0x40))
+        : label_(label), subtype_(subtype) {}
+
+    //! @brief Look up the partition.
+    //! @return false if no data partition has the label.
+    bool begin();
+
+    std::size_t sector_size() const override { return kSectorSize; }
+    std::size_t sector_count() const override { return partition_ ? partition_->size / kSectorSize : 0; }
+    bool read(std::uint64_t address, std::uint8_t* out, std::size_t size) override;
+    bool write(std::uint64_t address, const std::uint8_t* data, std::size_t size) override;
+    bool erase_sector(std::size_t sector) override;
+    bool sync() override { return partition_ != nullptr; }
+
+ private:
+    static constexpr std::size_t kSectorSize = 4096;
+
+    const char* label_;
+    esp_partition_subtype_t subtype_;
+    const esp_partition_t* partition_{nullptr};
+};
+
+}  // namespace jenlib::storage
+
+#endif  // ESP_PLATFORM
+
+#endif  // INCLUDE_JENLIB_STORAGE_DRIVERS_ESPIDFPARTITIONJOURNALSTORAGE_H_
@@ -0,0 +1,51 @@
+//! @file include/jenlib/storage/drivers/EspIdfSnapshotStores.h
+//! @brief Snapshot stores in RTC memory and NVS flash (ESP-IDF).
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_STORAGE_DRIVERS_ESPIDFSNAPSHOTSTORES_H_
+#define INCLUDE_JENLIB_STORAGE_DRIVERS_ESPIDFSNAPSHOTSTORES_H_
+
+#include <jenlib/storage/SnapshotStore.h>
+
+#ifdef ESP_PLATFORM
+
+namespace jenlib::storage {
+
+//! @brief Keeps the snapshot in RTC slow memory that the bootloader does not clear.
+//! @details A save costs a memcpy and no flash wear, so it can run on every
+//! reading. The contents survive watchdog, panic and software resets and deep
+//! sleep, but not a power loss. There is one buffer per firmware image, so all
+//! instances share it.
+class EspIdfRtcSnapshotStore : public SnapshotStore {
+ public:
+    bool save(const std::uint8_t* data, std::size_t size) override;
+    bool load(std::uint8_t* out, std::size_t& size) override;
+    bool clear() override;
+};
+
+//! @brief Keeps the snapshot as an NVS blob.
+//! @details Survives power loss. Each save is a flash write, so save on session
+//! changes and receipts rather than on every reading. nvs_flash_init() must
+//! have run.
+class EspIdfNvsSnapshotStore : public SnapshotStore {
+ public:
+    //! @param nvs_namespace NVS namespace, at most 15 characters.
+    //! @param key Blob key, at most 15 characters.
+    explicit EspIdfNvsSnapshotStore(const char* nvs_namespace = "jenlib", const char* key = "session")
+        : namespace_(nvs_namespace), key_(key) {}
+
+    bool save(const std::uint8_t* data, std::size_t size) override;
+    bool load(std::uint8_t* out, std::size_t& size) override;
+    bool clear() override;
+
+ private:
+    const char* namespace_;
+    const char* key_;
+};
+
+}  // namespace jenlib::storage
+
+#endif  // ESP_PLATFORM
+
+#endif  // INCLUDE_JENLIB_STORAGE_DRIVERS_ESPIDFSNAPSHOTSTORES_H_
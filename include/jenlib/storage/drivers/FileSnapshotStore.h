@@ -0,0 +1,38 @@
+//! @file include/jenlib/storage/drivers/FileSnapshotStore.h
+//! @brief Snapshot store backed by a file (native builds).
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_STORAGE_DRIVERS_FILESNAPSHOTSTORE_H_
+#define INCLUDE_JENLIB_STORAGE_DRIVERS_FILESNAPSHOTSTORE_H_
+
+#if !defined(ARDUINO) && !defined(ESP_PLATFORM)
+
+#include <string>
+#include "jenlib/storage/SnapshotStore.h"
+
+namespace jenlib::storage {
+
+//! @brief Keeps the snapshot in one file.
+//! @details save() writes a sibling temporary file, syncs it and renames it
+//! over the target, so a crash leaves either the old or the new snapshot.
+class FileSnapshotStore : public SnapshotStore {
+ public:
+    //! @param path File to hold the snapshot; its directory must exist.
+    //! @param sync Whether save() calls fsync; off trades durability for speed in simulations.
+    explicit FileSnapshotStore(std::string path, bool sync = true) : path_(std::move(path)), sync_(sync) {}
+
+    bool save(const std::uint8_t* data, std::size_t size) override;
+    bool load(std::uint8_t* out, std::size_t& size) override;
+    bool clear() override;
+
+ private:
+    std::string path_;
+    bool sync_;
+};
+
+}  // namespace jenlib::storage
+
+#endif  // !ARDUINO && !ESP_PLATFORM
+
+#endif  // INCLUDE_JENLIB_STORAGE_DRIVERS_FILESNAPSHOTSTORE_H_
@@ -0,0 +1,84 @@
+//! @file include/jenlib/storage/drivers/MmapJournalStorage.h
+//! @brief Journal storage backed by a memory-mapped file (Linux).
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_STORAGE_DRIVERS_MMAPJOURNALSTORAGE_H_
+#define INCLUDE_JENLIB_STORAGE_DRIVERS_MMAPJOURNALSTORAGE_H_
+
+#if defined(__linux__) && !defined(ARDUINO) && !defined(ESP_PLATFORM)
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "jenlib/storage/JournalStorage.h"
+
+namespace jenlib::storage {
+
+//! @brief Maps a file of sector_size * sector_count bytes and treats it as flash.
+//! @details
+//! Reads and writes are memcpy into the shared mapping; sync() msyncs only
+//! the ranges dirtied since the last sync (a few are tracked separately so a
+//! journal wrapping from the end of the file to the start does not flush
+//! everything in between), so its cost follows what was written rather than
+//! the file size. A new file is created sparse and reads
+//! as zeros, which the journal treats as unformatted, so creating a
+//! multi-gigabyte journal does not write it out.
+//!
+//! @par Usage Example:
+//! @code
+//! jenlib::storage::MmapJournalStorage storage(4096, 262144);  // 1 GiB
+//! storage.open("/var/lib/sensor/journal.bin");
+//! jenlib::storage::ReadingJournal journal(storage);
+//! journal.open();
+//! @endcode
+class MmapJournalStorage : public JournalStorage {
+ public:
+    MmapJournalStorage(std::size_t sector_size, std::size_t sector_count)
+        : sector_size_(sector_size), sector_count_(sector_count) {}
+    ~MmapJournalStorage() override { close(); }
+    MmapJournalStorage(const MmapJournalStorage&) = delete;
+    MmapJournalStorage& operator=(const MmapJournalStorage&) = delete;
+
+    //! @brief Open or create @p path and map it, growing the file to the configured size.
+    bool open(const char* path);
+
+    //! @brief Unmap and close; pending writes are left to the kernel.
+    void close();
+
+    //! @brief Check whether a file is mapped.
+    bool is_open() const { return base_ != nullptr; }
+
+    std::size_t sector_size() const override { return sector_size_; }
+    std::size_t sector_count() const override { return sector_count_; }
+    bool read(std::uint64_t address, std::uint8_t* out, std::size_t size) override;
+    bool write(std::uint64_t address, const std::uint8_t* data, std::size_t size) override;
+    bool erase_sector(std::size_t sector) override;
+    bool sync() override;
+
+ private:
+    bool in_range(std::uint64_t address, std::size_t size) const {
+        return base_ && address <= size_bytes() && size <= size_bytes() - address;
+    }
+    std::uint64_t size_bytes() const { return static_cast<std::uint64_t>(sector_size_) * sector_count_; }
+    void mark_dirty(std::uint64_t address, std::size_t size);
+
+    //! @brief Byte range written since the last sync; empty when begin == end.
+    struct DirtyRange {
+        std::uint64_t begin{0};
+        std::uint64_t end{0};
+    };
+    static constexpr std::size_t kMaxDirtyRanges = 4;
+
+    std::size_t sector_size_;
+    std::size_t sector_count_;
+    int fd_{-1};
+    std::uint8_t* base_{nullptr};
+    std::array<DirtyRange, kMaxDirtyRanges> dirty_{};
+};
+
+}  // namespace jenlib::storage
+
+#endif  // __linux__ && !ARDUINO && !ESP_PLATFORM
+
+#endif  // INCLUDE_JENLIB_STORAGE_DRIVERS_MMAPJOURNALSTORAGE_H_
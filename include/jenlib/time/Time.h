@@ -9,6 +9,7 @@
 #include <utility>
 #include "jenlib/time/TimeDriver.h"
 #include "jenlib/time/TimeTypes.h"
+#include "jenlib/time/TimerContext.h"
 
 //! @namespace jenlib::time
 //! @brief Time service for platform-abstracted timing operations.
@@ -66,7 +67,9 @@ namespace jenlib::time {
 //! @details
 //! Provides a platform-abstracted time service for the jenlib library.
 //! Supports timer scheduling, cancellation, and processing across different
-//! platforms (Arduino, ESP-IDF, native).
+//! platforms (Arduino, ESP-IDF, native). Every call forwards to a
+//! process-wide default TimerContext; code that needs more than one timer
+//! table, e.g. one per worker thread, uses TimerContext instances directly.
 class Time {
  public:
     //! @brief Schedule a timer callback
@@ -81,10 +84,32 @@ class Time {
     //! @return true if successfully canceled, false if not found
     static bool cancel_callback(TimerId timer_id);
 
+    //! @brief Change the interval of a scheduled timer without losing its phase
+    //! @param timer_id The timer ID returned from schedule_callback
+    //! @param interval_ms New interval in milliseconds
+    //! @return true if the timer was found, false otherwise
+    //! @details The next fire time is measured from the timer's last scheduled
+    //! fire time, not from now, so repeated reschedules do not accumulate drift.
+    //! May be called from the timer's own callback.
+    static bool reschedule_callback(TimerId timer_id, std::uint32_t interval_ms);
+
     //! @brief Process all active timers
     //! @return Number of timers that fired
     static std::size_t process_timers();
 
+    //! @brief Get the earliest fire time among active timers
+    //! @param[out] fire_time_ms Fire time on the now() clock
+    //! @return true if any timer is active, false otherwise
+    //! @details Lets a run loop sleep until the next deadline instead of polling.
+    static bool get_next_fire_time(std::uint32_t& fire_time_ms);
+
+    //! @brief Get the next fire time of one timer
+    //! @param timer_id ID of an active timer
+    //! @param[out] fire_time_ms Fire time on the now() clock
+    //! @return true if the timer is active, false otherwise
+    //! @details Lets a session snapshot record where the measurement schedule stands.
+    static bool get_fire_time(TimerId timer_id, std::uint32_t& fire_time_ms);
+
     //! @brief Get current time in milliseconds (platform-specific)
     //! @return Current time in milliseconds
     static std::uint32_t now();
@@ -119,27 +144,12 @@ class Time {
     //! @return Pointer to the current time driver, or nullptr if none set
     static TimeDriver* getDriver() noexcept;
 
- private:
-    //! @brief Get the next available timer ID
-    static TimerId get_next_timer_id();
+    //! @brief The context behind the static API
+    static TimerContext& default_context();
 
+ private:
     //! @brief Internal initialization flag
     static bool initialized_;
-
-    //! @brief Next available timer ID
-    static TimerId next_timer_id_;
-
-    //! @brief Maximum number of timers
-    static constexpr std::size_t kMaxTimers = 16;
-
-    //! @brief Timer storage (static allocation)
-    static std::array<TimerEntry, kMaxTimers> timers_;
-
-    //! @brief Current number of active timers
-    static std::size_t timer_count_;
-
-    //! @brief Current time driver (dependency injection)
-    static TimeDriver* driver_;
 };
 
 //! @brief Convenience function to schedule a repeating timer
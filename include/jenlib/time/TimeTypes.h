@@ -6,8 +6,10 @@
 #ifndef INCLUDE_JENLIB_TIME_TIMETYPES_H_
 #define INCLUDE_JENLIB_TIME_TIMETYPES_H_
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <limits>
 #include <utility>
 
 namespace jenlib::time {
@@ -28,6 +30,49 @@ enum class TimerState : std::uint8_t {
     kExpired = 2    //!< Timer has expired and needs processing
 };
 
+//! @brief Item limit meaning "no limit" for process_events() and process_timers()
+constexpr std::size_t kNoPassLimit = std::numeric_limits<std::size_t>::max();
+
+//! @brief Execution time of one registered event or timer callback
+//! @details Durations come from the owning context's TimeDriver, so they have
+//! its resolution (milliseconds); a callback shorter than a tick reads 0.
+struct CallbackStats {
+    std::uint32_t id{0};          //!<  EventId or TimerId of the registration
+    std::uint32_t budget_ms{0};   //!<  Allowed run time per call; 0 for none
+    std::uint32_t calls{0};       //!<  Calls since registration or the last stats reset
+    std::uint32_t overruns{0};    //!<  Calls that took longer than budget_ms
+    std::uint32_t worst_ms{0};    //!<  Longest call
+    std::uint32_t total_ms{0};    //!<  Sum of all calls (wraps)
+
+    //! @brief Account for one call that ran for @p elapsed_ms
+    //! @return true if the call overran its budget
+    bool record(std::uint32_t elapsed_ms) {
+        ++calls;
+        total_ms += elapsed_ms;
+        if (elapsed_ms > worst_ms) {
+            worst_ms = elapsed_ms;
+        }
+        if (budget_ms != 0 && elapsed_ms > budget_ms) {
+            ++overruns;
+            return true;
+        }
+        return false;
+    }
+
+    //! @brief Zero the counters, keeping the id and budget
+    void clear_counts() {
+        calls = 0;
+        overruns = 0;
+        worst_ms = 0;
+        total_ms = 0;
+    }
+
+    //! @brief Whether this registration is a worse offender than @p other: more overruns, then a longer worst call
+    bool worse_than(const CallbackStats& other) const {
+        return overruns != other.overruns ? overruns > other.overruns : worst_ms > other.worst_ms;
+    }
+};
+
 //! @brief Timer entry structure for internal timer management
 struct TimerEntry {
     TimerId id;                   //!<  Unique timer identifier
@@ -36,6 +81,7 @@ struct TimerEntry {
     TimerCallback callback;       //!<  Callback function to invoke
     bool repeat;                  //!<  Whether timer repeats
     TimerState state;             //!<  Current timer state
+    CallbackStats stats;          //!<  Execution time of the callback
 
     //! @brief Default constructor
     TimerEntry()
@@ -53,7 +99,9 @@ struct TimerEntry {
         , next_fire_time(fire_time)
         , callback(std::move(cb))
         , repeat(should_repeat)
-        , state(TimerState::kActive) {}
+        , state(TimerState::kActive) {
+        stats.id = timer_id;
+    }
 };
 
 }  //  namespace jenlib::time
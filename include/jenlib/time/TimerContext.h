@@ -0,0 +1,173 @@
+//! @file include/jenlib/time/TimerContext.h
+//! @brief Instantiable timer table
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef INCLUDE_JENLIB_TIME_TIMERCONTEXT_H_
+#define INCLUDE_JENLIB_TIME_TIMERCONTEXT_H_
+
+#include <array>
+#include <cstddef>
+#include "jenlib/time/TimeDriver.h"
+#include "jenlib/time/TimeTypes.h"
+
+namespace jenlib::time {
+
+//! @brief Timer table owned by one run loop
+//! @details
+//! Holds everything Time used to keep in static members. Contexts share no
+//! state, so a native broker can run one per core, each processed by its own
+//! thread, without locking; several contexts may read the same driver. A
+//! single context is not thread-safe. Time forwards to a process-wide
+//! default context.
+//!
+//! @par Usage Example:
+//! @code
+//! jenlib::time::NativeTimeDriver clock;
+//!
+//! void worker() {
+//!     jenlib::time::TimerContext timers(&clock);
+//!     timers.schedule_callback(1000, report_shard_status, true);
+//!     while (running) {
+//!         timers.process_timers();
+//!     }
+//! }
+//! @endcode
+class TimerContext {
+ public:
+    //! @brief Maximum number of timers
+    static constexpr std::size_t kMaxTimers = 16;
+
+    //! @brief Constructor
+    //! @param driver Clock for this context; may be set later with set_driver()
+    explicit TimerContext(TimeDriver* driver = nullptr) noexcept : driver_(driver) {}
+    TimerContext(const TimerContext&) = delete;
+    TimerContext& operator=(const TimerContext&) = delete;
+
+    //! @brief Schedule a timer callback
+    //! @param interval_ms Timer interval in milliseconds
+    //! @param callback Function to call when timer expires
+    //! @param repeat Whether the timer should repeat
+    //! @return TimerId for canceling the timer, or kInvalidTimerId on failure
+    TimerId schedule_callback(std::uint32_t interval_ms, TimerCallback callback, bool repeat = false);
+
+    //! @brief Cancel a scheduled timer
+    //! @return true if successfully canceled, false if not found
+    bool cancel_callback(TimerId timer_id);
+
+    //! @brief Change the interval of a scheduled timer without losing its phase
+    //! @return true if the timer was found, false otherwise
+    //! @see Time::reschedule_callback
+    bool reschedule_callback(TimerId timer_id, std::uint32_t interval_ms);
+
+    //! @brief Process all active timers
+    //! @param max_timers Most timers to fire in this call; other due timers wait for the next
+    //! @return Number of timers that fired
+    //! @details With a pass budget set, stops once the budget is spent and leaves other due timers for the next call.
+    std::size_t process_timers(std::size_t max_timers = kNoPassLimit);
+
+    //! @brief Set how long one call of a timer's callback may run before it counts as an overrun
+    //! @param budget_ms Allowed run time in driver milliseconds; 0 removes the budget
+    //! @return true if the timer is scheduled
+    bool set_callback_budget(TimerId timer_id, std::uint32_t budget_ms);
+
+    //! @brief Get execution statistics of a scheduled timer
+    //! @return true if the timer is scheduled
+    bool get_callback_stats(TimerId timer_id, CallbackStats& stats) const;
+
+    //! @brief Get the scheduled timer with the most overruns, then the longest call; id 0 if none has fired
+    CallbackStats get_worst_offender() const;
+
+    //! @brief Get the number of budget overruns across all timers since reset (wraps)
+    std::uint32_t get_overrun_count() const { return overrun_count_; }
+
+    //! @brief Zero every timer's statistics and the overrun and deferral counts, keeping budgets
+    void reset_callback_stats();
+
+    //! @brief Bound the time one process_timers() call spends firing timers
+    //! @param budget_ms Pass budget in driver milliseconds; 0 (the default) fires every due timer
+    //! @details At least one timer fires per pass. The next pass starts at the first
+    //!          timer left waiting, so one slow timer cannot starve those after it.
+    void set_pass_budget_ms(std::uint32_t budget_ms) { pass_budget_ms_ = budget_ms; }
+
+    //! @brief Get the number of process_timers() calls cut short by the pass budget or timer limit (wraps)
+    std::uint32_t get_deferred_passes() const { return deferred_passes_; }
+
+    //! @brief Get the earliest fire time among active timers
+    //! @param[out] fire_time_ms Fire time on the now() clock
+    //! @return true if any timer is active, false otherwise
+    bool get_next_fire_time(std::uint32_t& fire_time_ms) const;
+
+    //! @brief Get the next fire time of one timer
+    //! @see Time::get_fire_time
+    bool get_fire_time(TimerId timer_id, std::uint32_t& fire_time_ms) const;
+
+    //! @brief Current time from this context's driver, or 0 without one
+    std::uint32_t now() const;
+
+    //! @brief Delay through this context's driver; no-op without one
+    void delay(std::uint32_t delay_ms) const;
+
+    //! @brief Get the number of active timers
+    std::size_t get_active_timer_count() const;
+
+    //! @brief Get the number of scheduled timers, including one currently firing
+    std::size_t get_total_timer_count() const { return timer_count_; }
+
+    //! @brief Get the number of repeating-timer periods skipped because processing ran late (wraps)
+    std::uint32_t get_missed_periods() const { return missed_periods_; }
+
+    //! @brief Clear all timers
+    void clear_all_timers();
+
+    //! @brief Clear all timers and restart timer ID numbering
+    void reset();
+
+    //! @brief Set the clock for this context
+    void set_driver(TimeDriver* driver) noexcept { driver_ = driver; }
+
+    //! @brief Get the clock for this context, or nullptr if none set
+    TimeDriver* driver() const noexcept { return driver_; }
+
+ private:
+    //! @brief Get the next available timer ID
+    TimerId get_next_timer_id();
+
+    //! @brief Find a scheduled (active or firing) timer by ID
+    TimerEntry* find_timer(TimerId timer_id);
+    const TimerEntry* find_timer(TimerId timer_id) const;
+
+    //! @brief Driver milliseconds from @p from to @p to, or 0 without a driver
+    std::uint32_t elapsed(std::uint32_t from, std::uint32_t to) const;
+
+    //! @brief Next available timer ID
+    TimerId next_timer_id_{1};
+
+    //! @brief Timer storage (static allocation)
+    std::array<TimerEntry, kMaxTimers> timers_{};
+
+    //! @brief Current number of active timers
+    std::size_t timer_count_{0};
+
+    //! @brief Repeating-timer periods skipped since reset
+    std::uint32_t missed_periods_{0};
+
+    //! @brief Callback budget overruns since reset
+    std::uint32_t overrun_count_{0};
+
+    //! @brief Time limit for one process_timers() call; 0 for none
+    std::uint32_t pass_budget_ms_{0};
+
+    //! @brief Passes cut short by pass_budget_ms_ or the timer limit
+    std::uint32_t deferred_passes_{0};
+
+    //! @brief Slot the next process_timers() call examines first
+    std::size_t next_slot_{0};
+
+    //! @brief Current time driver (dependency injection)
+    TimeDriver* driver_;
+};
+
+}  // namespace jenlib::time
+
+#endif  // INCLUDE_JENLIB_TIME_TIMERCONTEXT_H_
@@ -26,6 +26,14 @@ class NativeTimeDriver : public TimeDriver {
     //! @param delay_ms Delay duration in milliseconds
     void delay(std::uint32_t delay_ms) override;
 
+    //! @brief Check whether the millisecond counter wrapped since @p time_value was read
+    //! @param time_value A value previously returned by now()
+    //! @return true if the current time is behind @p time_value
+    bool has_overflowed(std::uint32_t time_value) noexcept override;
+
+    //! @brief Milliseconds from @p previous_time to @p current_time, across a wrap if needed
+    std::uint32_t time_difference(std::uint32_t current_time, std::uint32_t previous_time) noexcept override;
+
     //! @brief Static versions for backward compatibility
     static std::uint32_t now_static();
     static void delay_static(std::uint32_t delay_ms);
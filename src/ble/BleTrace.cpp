@@ -0,0 +1,124 @@
+//! @file src/ble/BleTrace.cpp
+//! @brief Capture file reading and writing.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#if !defined(ARDUINO) && !defined(ESP_PLATFORM)
+
+#include "jenlib/ble/BleTrace.h"
+#include <algorithm>
+#include <chrono>
+#include <utility>
+#include "jenlib/storage/ByteOrder.h"
+
+namespace jenlib::ble {
+
+namespace {
+constexpr std::uint32_t kTraceMagic = 0x5254424Au;  // "JBTR"
+constexpr std::uint16_t kTraceVersion = 1;
+constexpr std::size_t kFileHeaderSize = 8;
+constexpr std::size_t kRecordHeaderSize = 14;
+}  // namespace
+
+std::uint64_t steady_clock_us() {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                          std::chrono::steady_clock::now().time_since_epoch())
+                                          .count());
+}
+
+bool BleTraceWriter::open(const char* path) {
+    close();
+    file_ = std::fopen(path, "wb");
+    if (!file_) {
+        return false;
+    }
+    std::uint8_t header[kFileHeaderSize] = {};
+    jenlib::storage::store_u32le(header, kTraceMagic);
+    jenlib::storage::store_u16le(header + 4, kTraceVersion);
+    records_ = 0;
+    return std::fwrite(header, 1, sizeof(header), file_) == sizeof(header);
+}
+
+bool BleTraceWriter::write(std::uint64_t time_us, BleTraceDirection direction, DeviceId device,
+                           const BlePayload& payload) {
+    if (!file_) {
+        return false;
+    }
+    std::uint8_t record[kRecordHeaderSize + kMaxPayload];
+    jenlib::storage::store_u32le(record, static_cast<std::uint32_t>(time_us));
+    jenlib::storage::store_u32le(record + 4, static_cast<std::uint32_t>(time_us >> 32));
+    record[8] = static_cast<std::uint8_t>(direction);
+    jenlib::storage::store_u32le(record + 9, device.value());
+    record[13] = static_cast<std::uint8_t>(payload.size);
+    std::copy(payload.bytes.begin(), payload.bytes.begin() + payload.size, record + kRecordHeaderSize);
+    const std::size_t size = kRecordHeaderSize + payload.size;
+    if (std::fwrite(record, 1, size, file_) != size) {
+        return false;
+    }
+    ++records_;
+    return true;
+}
+
+bool BleTraceWriter::flush() {
+    return file_ && std::fflush(file_) == 0;
+}
+
+void BleTraceWriter::close() {
+    if (file_) {
+        std::fclose(file_);
+        file_ = nullptr;
+    }
+}
+
+bool BleTraceReader::open(const char* path) {
+    close();
+    file_ = std::fopen(path, "rb");
+    if (!file_) {
+        return false;
+    }
+    std::uint8_t header[kFileHeaderSize];
+    if (std::fread(header, 1, sizeof(header), file_) != sizeof(header) ||
+        jenlib::storage::load_u32le(header) != kTraceMagic ||
+        jenlib::storage::load_u16le(header + 4) != kTraceVersion) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+bool BleTraceReader::next(BleTraceRecord& out) {
+    std::uint8_t header[kRecordHeaderSize];
+    if (!file_ || std::fread(header, 1, sizeof(header), file_) != sizeof(header) || header[13] > kMaxPayload ||
+        header[8] > static_cast<std::uint8_t>(BleTraceDirection::kSendTo)) {
+        return false;
+    }
+    out.time_us = jenlib::storage::load_u32le(header) |
+                  (static_cast<std::uint64_t>(jenlib::storage::load_u32le(header + 4)) << 32);
+    out.direction = static_cast<BleTraceDirection>(header[8]);
+    out.device = DeviceId(jenlib::storage::load_u32le(header + 9));
+    out.payload.size = header[13];
+    return std::fread(out.payload.bytes.data(), 1, out.payload.size, file_) == out.payload.size;
+}
+
+void BleTraceReader::close() {
+    if (file_) {
+        std::fclose(file_);
+        file_ = nullptr;
+    }
+}
+
+bool load_ble_trace(const char* path, std::vector<BleTraceRecord>& out) {
+    BleTraceReader reader;
+    if (!reader.open(path)) {
+        return false;
+    }
+    BleTraceRecord record;
+    while (reader.next(record)) {
+        out.push_back(std::move(record));
+    }
+    return true;
+}
+
+}  // namespace jenlib::ble
+
+#endif  // !ARDUINO && !ESP_PLATFORM
@@ -0,0 +1,199 @@
+//! @file src/ble/Health.cpp
+//! @brief Health heartbeat delta coding and fleet aggregation.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include "jenlib/ble/Health.h"
+
+namespace jenlib::ble {
+
+namespace {
+
+//! @brief Per-field difference @p to - @p from, modulo each field's width.
+HealthCounters difference(const HealthCounters& from, const HealthCounters& to) {
+    HealthCounters d;
+    d.uptime_s = to.uptime_s - from.uptime_s;
+    d.event_evictions = to.event_evictions - from.event_evictions;
+    d.inbox_drops = to.inbox_drops - from.inbox_drops;
+    d.loop_overruns = to.loop_overruns - from.loop_overruns;
+    d.retention_permille = static_cast<std::uint16_t>(to.retention_permille - from.retention_permille);
+    d.battery_mv = static_cast<std::uint16_t>(to.battery_mv - from.battery_mv);
+    return d;
+}
+
+//! @brief Inverse of difference(): add @p d to @p base in place.
+void accumulate(HealthCounters& base, const HealthCounters& d) {
+    base.uptime_s += d.uptime_s;
+    base.event_evictions += d.event_evictions;
+    base.inbox_drops += d.inbox_drops;
+    base.loop_overruns += d.loop_overruns;
+    base.retention_permille = static_cast<std::uint16_t>(base.retention_permille + d.retention_permille);
+    base.battery_mv = static_cast<std::uint16_t>(base.battery_mv + d.battery_mv);
+}
+
+}  // namespace
+
+HealthMsg HealthEncoder::next(DeviceId sender_id, const HealthCounters& sample) {
+    HealthMsg msg;
+    msg.sender_id = sender_id;
+    msg.sequence = sequence_++;
+    msg.keyframe = since_keyframe_ == 0;
+    msg.values = msg.keyframe ? sample : difference(previous_, sample);
+    previous_ = sample;
+    ++since_keyframe_;
+    if (since_keyframe_ >= keyframe_interval_) {
+        since_keyframe_ = 0;
+    }
+    return msg;
+}
+
+bool HealthDecoder::apply(const HealthMsg& msg) {
+    // A rebooted sensor restarts its sequence with a keyframe; its uptime gives it away
+    if (msg.keyframe && heartbeats_ > 0 && msg.values.uptime_s < values_.uptime_s) {
+        ++restarts_;
+        last_sequence_ = msg.sequence;
+        values_ = msg.values;
+        synced_ = true;
+        ++heartbeats_;
+        return true;
+    }
+    if (seen_) {
+        const auto step = static_cast<std::uint8_t>(msg.sequence - last_sequence_);
+        if (step == 0) {
+            return false;  // Repeated heartbeat
+        }
+        if (step > 1) {
+            lost_ += step - 1u;
+            if (synced_ && !msg.keyframe) {
+                ++resyncs_;
+            }
+            synced_ = false;
+        }
+    }
+    seen_ = true;
+    last_sequence_ = msg.sequence;
+    if (msg.keyframe) {
+        values_ = msg.values;
+        synced_ = true;
+    } else if (synced_) {
+        accumulate(values_, msg.values);
+    } else {
+        return false;  // Nothing to add the delta to until the next keyframe
+    }
+    ++heartbeats_;
+    return true;
+}
+
+bool FleetHealth::add(const HealthMsg& msg, std::uint32_t now_ms) {
+    Entry* entry = find(msg.sender_id);
+    if (!entry) {
+        for (auto& candidate : entries_) {
+            if (!candidate.active) {
+                entry = &candidate;
+                break;
+            }
+        }
+        if (!entry) {
+            return false;  // Sensor table full
+        }
+        *entry = Entry{};
+        entry->id = msg.sender_id;
+        entry->active = true;
+    }
+    entry->last_seen_ms = now_ms;
+    return entry->decoder.apply(msg);
+}
+
+bool FleetHealth::add(const BlePayload& payload, std::uint32_t now_ms) {
+    const std::size_t offset = message_offset(payload);
+    if (payload.size <= offset || payload.bytes[offset] != static_cast<std::uint8_t>(MessageType::Health)) {
+        return false;
+    }
+    HealthMsg msg;
+    if (!HealthMsg::deserialize(payload.cbegin() + static_cast<std::ptrdiff_t>(offset), payload.cend(), msg)) {
+        return false;
+    }
+    return add(msg, now_ms);
+}
+
+const HealthDecoder* FleetHealth::sensor(DeviceId id) const {
+    const Entry* entry = find(id);
+    return entry ? &entry->decoder : nullptr;
+}
+
+std::uint32_t FleetHealth::last_seen_ms(DeviceId id) const {
+    const Entry* entry = find(id);
+    return entry ? entry->last_seen_ms : 0;
+}
+
+bool FleetHealth::forget(DeviceId id) {
+    Entry* entry = find(id);
+    if (!entry) {
+        return false;
+    }
+    entry->active = false;
+    return true;
+}
+
+std::size_t FleetHealth::size() const {
+    std::size_t count = 0;
+    for (const auto& entry : entries_) {
+        if (entry.active) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+FleetHealthSummary FleetHealth::summary(std::uint32_t now_ms, std::uint32_t stale_after_ms) const {
+    FleetHealthSummary s;
+    for (const auto& entry : entries_) {
+        if (!entry.active) {
+            continue;
+        }
+        ++s.sensors;
+        s.heartbeats_lost += entry.decoder.lost();
+        s.restarts += entry.decoder.restarts();
+        if (now_ms - entry.last_seen_ms > stale_after_ms) {
+            ++s.stale;
+            continue;
+        }
+        if (!entry.decoder.synced()) {
+            ++s.unsynced;
+            continue;
+        }
+        const HealthCounters& v = entry.decoder.values();
+        s.event_evictions += v.event_evictions;
+        s.inbox_drops += v.inbox_drops;
+        s.loop_overruns += v.loop_overruns;
+        if (v.retention_permille > s.max_retention_permille) {
+            s.max_retention_permille = v.retention_permille;
+            s.fullest_sensor = entry.id;
+        }
+        if (v.battery_mv != 0 && (s.min_battery_mv == 0 || v.battery_mv < s.min_battery_mv)) {
+            s.min_battery_mv = v.battery_mv;
+            s.weakest_sensor = entry.id;
+        }
+    }
+    return s;
+}
+
+FleetHealth::Entry* FleetHealth::find(DeviceId id) {
+    for (auto& entry : entries_) {
+        if (entry.active && entry.id == id) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+const FleetHealth::Entry* FleetHealth::find(DeviceId id) const {
+    for (const auto& entry : entries_) {
+        if (entry.active && entry.id == id) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+}  // namespace jenlib::ble
@@ -4,10 +4,50 @@
 //! @author Jennifer Gott (jennifer.gott@chasacademy.se)
 
 #include <jenlib/ble/Messages.h>
-
+#include <jenlib/storage/Varint.h>
+#include <array>
 
 namespace jenlib::ble {
 
+namespace {
+
+constexpr std::uint8_t kHealthKeyframeFlag = 0x80;
+constexpr std::uint8_t kHealthFieldMask = (1u << HealthCounters::kFieldCount) - 1u;
+constexpr std::size_t kFirstGaugeField = 4;  // Fields from here on are 16-bit gauges
+
+using HealthFields = std::array<std::uint32_t, HealthCounters::kFieldCount>;
+
+HealthFields fields_of(const HealthCounters &c) {
+    return {c.uptime_s, c.event_evictions, c.inbox_drops, c.loop_overruns, c.retention_permille, c.battery_mv};
+}
+
+void store_fields(const HealthFields &f, HealthCounters &c) {
+    c.uptime_s = f[0];
+    c.event_evictions = f[1];
+    c.inbox_drops = f[2];
+    c.loop_overruns = f[3];
+    c.retention_permille = static_cast<std::uint16_t>(f[4]);
+    c.battery_mv = static_cast<std::uint16_t>(f[5]);
+}
+
+bool append_varint(BlePayload &out, std::uint32_t value) {
+    std::uint8_t bytes[storage::kMaxVarintSize];
+    return out.append_raw(bytes, storage::put_varint(value, bytes));
+}
+
+//! @brief Zigzag a 16-bit difference so small steps either way stay one byte.
+std::uint32_t zigzag16(std::uint16_t diff) {
+    return storage::zigzag(static_cast<std::int16_t>(diff));
+}
+
+bool unzigzag16(std::uint32_t z, std::uint16_t &diff) {
+    if (z > 0xFFFFu) return false;
+    diff = static_cast<std::uint16_t>(storage::unzigzag(z));
+    return true;
+}
+
+}  // namespace
+
 bool StartBroadcastMsg::serialize(const StartBroadcastMsg &msg, BlePayload &out) {
     out.clear();
     if (!out.append_u8(static_cast<std::uint8_t>(MessageType::StartBroadcast))) return false;
@@ -16,8 +56,11 @@ bool StartBroadcastMsg::serialize(const StartBroadcastMsg &msg, BlePayload &out)
 }
 
 bool StartBroadcastMsg::deserialize(const BlePayload &buf, StartBroadcastMsg &out) {
-    auto it = buf.cbegin();
-    const auto end = buf.cend();
+    return deserialize(buf.cbegin(), buf.cend(), out);
+}
+
+bool StartBroadcastMsg::deserialize(BlePayload::const_iterator it, const BlePayload::const_iterator end,
+                                    StartBroadcastMsg &out) {
     std::uint8_t type = 0;
     if (!read_u8(it, end, type)) return false;
     if (type != static_cast<std::uint8_t>(MessageType::StartBroadcast)) return false;
@@ -39,8 +82,11 @@ bool ReadingMsg::serialize(const ReadingMsg &msg, BlePayload &out) {
 }
 
 bool ReadingMsg::deserialize(const BlePayload &buf, ReadingMsg &out) {
-    auto it = buf.cbegin();
-    const auto end = buf.cend();
+    return deserialize(buf.cbegin(), buf.cend(), out);
+}
+
+bool ReadingMsg::deserialize(BlePayload::const_iterator it, const BlePayload::const_iterator end,
+                             ReadingMsg &out) {
     std::uint8_t type = 0;
     if (!read_u8(it, end, type)) return false;
     if (type != static_cast<std::uint8_t>(MessageType::Reading)) return false;
@@ -62,8 +108,11 @@ bool ReceiptMsg::serialize(const ReceiptMsg &msg, BlePayload &out) {
 }
 
 bool ReceiptMsg::deserialize(const BlePayload &buf, ReceiptMsg &out) {
-    auto it = buf.cbegin();
-    const auto end = buf.cend();
+    return deserialize(buf.cbegin(), buf.cend(), out);
+}
+
+bool ReceiptMsg::deserialize(BlePayload::const_iterator it, const BlePayload::const_iterator end,
+                             ReceiptMsg &out) {
     std::uint8_t type = 0;
     if (!read_u8(it, end, type)) return false;
     if (type != static_cast<std::uint8_t>(MessageType::Receipt)) return false;
@@ -74,4 +123,84 @@ bool ReceiptMsg::deserialize(const BlePayload &buf, ReceiptMsg &out) {
     return it == end;
 }
 
+bool SamplingConfigMsg::serialize(const SamplingConfigMsg &msg, BlePayload &out) {
+    out.clear();
+    if (!out.append_u8(static_cast<std::uint8_t>(MessageType::SamplingConfig))) return false;
+    if (!out.append_u32le(msg.session_id.value())) return false;
+    if (!out.append_u32le(msg.min_interval_ms)) return false;
+    return out.append_u32le(msg.max_interval_ms);
+}
+
+bool SamplingConfigMsg::deserialize(const BlePayload &buf, SamplingConfigMsg &out) {
+    return deserialize(buf.cbegin(), buf.cend(), out);
+}
+
+bool SamplingConfigMsg::deserialize(BlePayload::const_iterator it, const BlePayload::const_iterator end,
+                                    SamplingConfigMsg &out) {
+    std::uint8_t type = 0;
+    if (!read_u8(it, end, type)) return false;
+    if (type != static_cast<std::uint8_t>(MessageType::SamplingConfig)) return false;
+    std::uint32_t sess = 0;
+    if (!read_u32le(it, end, sess)) return false;
+    out.session_id = SessionId(sess);
+    if (!read_u32le(it, end, out.min_interval_ms)) return false;
+    if (!read_u32le(it, end, out.max_interval_ms)) return false;
+    return it == end;
+}
+
+bool HealthMsg::serialize(const HealthMsg &msg, BlePayload &out) {
+    out.clear();
+    if (!out.append_u8(static_cast<std::uint8_t>(MessageType::Health))) return false;
+    if (!DeviceId::serialize(msg.sender_id, out)) return false;
+    if (!out.append_u8(msg.sequence)) return false;
+    const HealthFields fields = fields_of(msg.values);
+    std::uint8_t flags = msg.keyframe ? kHealthKeyframeFlag : 0u;
+    for (std::size_t i = 0; i < fields.size(); ++i) {
+        if (fields[i] != 0) flags |= static_cast<std::uint8_t>(1u << i);
+    }
+    if (!out.append_u8(flags)) return false;
+    for (std::size_t i = 0; i < fields.size(); ++i) {
+        if (fields[i] == 0) continue;
+        const bool gauge_delta = !msg.keyframe && i >= kFirstGaugeField;
+        const std::uint32_t value = gauge_delta ? zigzag16(static_cast<std::uint16_t>(fields[i])) : fields[i];
+        if (!append_varint(out, value)) return false;
+    }
+    return true;
+}
+
+bool HealthMsg::deserialize(const BlePayload &buf, HealthMsg &out) {
+    return deserialize(buf.cbegin(), buf.cend(), out);
+}
+
+bool HealthMsg::deserialize(BlePayload::const_iterator it, const BlePayload::const_iterator end, HealthMsg &out) {
+    std::uint8_t type = 0;
+    if (!read_u8(it, end, type)) return false;
+    if (type != static_cast<std::uint8_t>(MessageType::Health)) return false;
+    if (!DeviceId::deserialize(it, end, out.sender_id)) return false;
+    if (!read_u8(it, end, out.sequence)) return false;
+    std::uint8_t flags = 0;
+    if (!read_u8(it, end, flags)) return false;
+    if ((flags & ~(kHealthKeyframeFlag | kHealthFieldMask)) != 0) return false;
+    out.keyframe = (flags & kHealthKeyframeFlag) != 0;
+    HealthFields fields{};
+    for (std::size_t i = 0; i < fields.size(); ++i) {
+        if ((flags & (1u << i)) == 0) continue;
+        std::uint32_t value = 0;
+        if (!storage::get_varint(it, end, value)) return false;
+        if (i >= kFirstGaugeField) {
+            std::uint16_t gauge = 0;
+            if (out.keyframe) {
+                if (value > 0xFFFFu) return false;
+                gauge = static_cast<std::uint16_t>(value);
+            } else if (!unzigzag16(value, gauge)) {
+                return false;
+            }
+            value = gauge;
+        }
+        fields[i] = value;
+    }
+    store_fields(fields, out.values);
+    return it == end;
+}
+
 }  // namespace jenlib::ble
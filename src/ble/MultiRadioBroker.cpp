@@ -0,0 +1,238 @@
+//! @file src/ble/MultiRadioBroker.cpp
+//! @brief Sensor-to-radio balancing and inbound stream merging.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include "jenlib/ble/MultiRadioBroker.h"
+#include <algorithm>
+#include "jenlib/ble/Ble.h"
+#include "jenlib/time/Time.h"
+
+namespace jenlib::ble {
+
+bool MultiRadioBroker::add_radio(BleDriver& radio) {
+    if (radio_count_ >= kMaxRadios) {
+        return false;
+    }
+    radios_[radio_count_] = &radio;
+    readings_[radio_count_] = 0;
+    install_callbacks(radio_count_);
+    ++radio_count_;
+    return true;
+}
+
+bool MultiRadioBroker::begin() {
+    bool all_started = radio_count_ > 0;
+    for (std::size_t i = 0; i < radio_count_; ++i) {
+        all_started = radios_[i]->begin() && all_started;
+    }
+    return all_started;
+}
+
+void MultiRadioBroker::end() {
+    for (std::size_t i = 0; i < radio_count_; ++i) {
+        radios_[i]->end();
+    }
+}
+
+void MultiRadioBroker::configure_callbacks(const BleCallbacks& cbs) {
+    callbacks_ = cbs;
+    for (std::size_t i = 0; i < radio_count_; ++i) {
+        install_callbacks(i);
+    }
+}
+
+bool MultiRadioBroker::send_start(DeviceId sensor, const StartBroadcastMsg& msg) {
+    std::size_t radio = radio_for(sensor);
+    if (radio == kNoRadio) {
+        if (radio_count_ == 0) {
+            return false;
+        }
+        radio = least_loaded_radio();
+        if (!assign(sensor, radio)) {
+            return false;
+        }
+    }
+    BLE::send_start(radios_[radio], sensor, msg);
+    return true;
+}
+
+bool MultiRadioBroker::send_receipt(DeviceId sensor, const ReceiptMsg& msg) {
+    const std::size_t radio = radio_for(sensor);
+    if (radio == kNoRadio) {
+        return false;
+    }
+    BLE::send_receipt(radios_[radio], sensor, msg);
+    return true;
+}
+
+bool MultiRadioBroker::send_sampling_config(DeviceId sensor, const SamplingConfigMsg& msg) {
+    const std::size_t radio = radio_for(sensor);
+    if (radio == kNoRadio) {
+        return false;
+    }
+    BLE::send_sampling_config(radios_[radio], sensor, msg);
+    Assignment* entry = find(sensor);
+    entry->sampling_max_ms = msg.max_interval_ms;
+    update_link_cadence(*entry);
+    return true;
+}
+
+bool MultiRadioBroker::release(DeviceId sensor) {
+    Assignment* entry = find(sensor);
+    if (!entry) {
+        return false;
+    }
+    entry->active = false;
+    return true;
+}
+
+std::size_t MultiRadioBroker::radio_for(DeviceId sensor) const {
+    const Assignment* entry = find(sensor);
+    return entry ? entry->radio : kNoRadio;
+}
+
+std::size_t MultiRadioBroker::sensor_count(std::size_t radio) const {
+    std::size_t count = 0;
+    for (const auto& entry : assignments_) {
+        if (entry.active && entry.radio == radio) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+const jenlib::measurement::LinkQuality* MultiRadioBroker::link_quality(DeviceId sensor) const {
+    const Assignment* entry = find(sensor);
+    return entry ? &entry->link : nullptr;
+}
+
+void MultiRadioBroker::set_expected_interval_ms(std::uint32_t interval_ms) {
+    expected_interval_ms_ = interval_ms;
+    for (auto& entry : assignments_) {
+        if (entry.active) {
+            update_link_cadence(entry);
+        }
+    }
+}
+
+bool MultiRadioBroker::set_send_on_delta(DeviceId sensor, bool enabled, std::uint32_t max_silence_ms) {
+    Assignment* entry = find(sensor);
+    if (!entry) {
+        return false;
+    }
+    entry->send_on_delta = enabled;
+    entry->heartbeat_ms = max_silence_ms;
+    update_link_cadence(*entry);
+    return true;
+}
+
+void MultiRadioBroker::update_link_cadence(Assignment& entry) {
+    using Cadence = jenlib::measurement::LinkQuality::Cadence;
+    std::uint32_t interval_ms = expected_interval_ms_;
+    Cadence cadence = Cadence::kFixed;
+    if (entry.send_on_delta) {
+        // The heartbeat is checked at sample times, so an adaptive sensor may stretch it to its longest interval
+        interval_ms = entry.heartbeat_ms == 0 ? 0 : std::max(entry.heartbeat_ms, entry.sampling_max_ms);
+        cadence = Cadence::kAtMost;
+    } else if (entry.sampling_max_ms != 0) {
+        interval_ms = entry.sampling_max_ms;
+        cadence = Cadence::kAtMost;
+    }
+    if (interval_ms != entry.link.interval_ms() || cadence != entry.link.cadence()) {
+        entry.link.set_interval_ms(interval_ms, cadence);
+    }
+}
+
+void MultiRadioBroker::process_events() {
+    for (std::size_t i = 0; i < radio_count_; ++i) {
+        radios_[i]->poll();
+    }
+}
+
+void MultiRadioBroker::install_callbacks(std::size_t radio) {
+    BleDriver* driver = radios_[radio];
+    // Readings are always wrapped, even without a user callback, so load is counted and sensors are learned
+    driver->set_reading_callback([this, radio](DeviceId sender_id, const ReadingMsg& msg) {
+        ++readings_[radio];
+        if (Assignment* entry = assign(sender_id, radio)) {
+            if (entry->session != msg.session_id) {
+                entry->session = msg.session_id;
+                entry->link.reset();
+            }
+            entry->link.add(msg, jenlib::time::Time::now());
+        }
+        if (callbacks_.on_reading) {
+            callbacks_.on_reading(sender_id, msg);
+        }
+    });
+    if (callbacks_.on_connection) {
+        driver->set_connection_callback(callbacks_.on_connection);
+    }
+    if (callbacks_.on_generic) {
+        driver->set_message_callback([this](DeviceId sender_id, const BlePayload& payload) {
+            record_health(payload);
+            callbacks_.on_generic(sender_id, payload);
+        });
+    }
+}
+
+MultiRadioBroker::Assignment* MultiRadioBroker::assign(DeviceId sensor, std::size_t radio) {
+    Assignment* entry = find(sensor);
+    if (!entry) {
+        for (auto& candidate : assignments_) {
+            if (!candidate.active) {
+                entry = &candidate;
+                break;
+            }
+        }
+        if (!entry) {
+            return nullptr;  // Sensor table full
+        }
+        entry->sensor = sensor;
+        entry->active = true;
+        entry->session = SessionId(0);
+        entry->sampling_max_ms = 0;
+        entry->heartbeat_ms = 0;
+        entry->send_on_delta = false;
+        entry->link = jenlib::measurement::LinkQuality(expected_interval_ms_);
+    }
+    entry->radio = static_cast<std::uint8_t>(radio);
+    return entry;
+}
+
+std::size_t MultiRadioBroker::least_loaded_radio() const {
+    std::array<std::size_t, kMaxRadios> load{};
+    for (const auto& entry : assignments_) {
+        if (entry.active) {
+            ++load[entry.radio];
+        }
+    }
+    std::size_t best = 0;
+    for (std::size_t i = 1; i < radio_count_; ++i) {
+        if (load[i] < load[best]) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+MultiRadioBroker::Assignment* MultiRadioBroker::find(DeviceId sensor) {
+    for (auto& entry : assignments_) {
+        if (entry.active && entry.sensor == sensor) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+const MultiRadioBroker::Assignment* MultiRadioBroker::find(DeviceId sensor) const {
+    for (const auto& entry : assignments_) {
+        if (entry.active && entry.sensor == sensor) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+}  // namespace jenlib::ble
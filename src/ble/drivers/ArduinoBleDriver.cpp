@@ -91,6 +91,7 @@ ArduinoBleDriver::ArduinoBleDriver(std::string_view device_name, DeviceId local_
     start_broadcast_callback_ = nullptr;
     reading_callback_ = nullptr;
     receipt_callback_ = nullptr;
+    sampling_config_callback_ = nullptr;
     connection_callback_ = nullptr;
     initialized_ = false;
 }
@@ -101,6 +102,7 @@ ArduinoBleDriver::ArduinoBleDriver(std::string_view device_name, DeviceId local_
     if (cb.on_start) set_start_broadcast_callback(cb.on_start);
     if (cb.on_reading) set_reading_callback(cb.on_reading);
     if (cb.on_receipt) set_receipt_callback(cb.on_receipt);
+    if (cb.on_sampling_config) set_sampling_config_callback(cb.on_sampling_config);
     if (cb.on_generic) set_message_callback(cb.on_generic);
 }
 
@@ -197,10 +199,15 @@ void ArduinoBleDriver::set_receipt_callback(ReceiptCallback callback) {
     receipt_callback_ = std::move(callback);
 }
 
+void ArduinoBleDriver::set_sampling_config_callback(SamplingConfigCallback callback) {
+    sampling_config_callback_ = std::move(callback);
+}
+
 void ArduinoBleDriver::clear_type_specific_callbacks() {
     start_broadcast_callback_ = nullptr;
     reading_callback_ = nullptr;
     receipt_callback_ = nullptr;
+    sampling_config_callback_ = nullptr;
 }
 
 void ArduinoBleDriver::set_connection_callback(ConnectionCallback callback) {
@@ -317,6 +324,15 @@ bool ArduinoBleDriver::try_type_specific_callbacks(DeviceId sender_id, const Ble
         }
     }
 
+    // Try SamplingConfigMsg
+    if (sampling_config_callback_) {
+        SamplingConfigMsg sampling_config;
+        if (SamplingConfigMsg::deserialize(payload, sampling_config)) {
+            sampling_config_callback_(sender_id, sampling_config);
+            return true;
+        }
+    }
+
     return false;  //  No type-specific callback handled this message
 }
 
@@ -30,6 +30,7 @@ EspIdfBleDriver::EspIdfBleDriver(const std::string& device_name, DeviceId local_
     start_broadcast_callback_ = nullptr;
     reading_callback_ = nullptr;
     receipt_callback_ = nullptr;
+    sampling_config_callback_ = nullptr;
     connection_callback_ = nullptr;
     initialized_ = false;
     last_connected_state_ = false;
@@ -48,6 +49,7 @@ EspIdfBleDriver::EspIdfBleDriver(const std::string& device_name, DeviceId local_
     if (callbacks.on_start) set_start_broadcast_callback(callbacks.on_start);
     if (callbacks.on_reading) set_reading_callback(callbacks.on_reading);
     if (callbacks.on_receipt) set_receipt_callback(callbacks.on_receipt);
+    if (callbacks.on_sampling_config) set_sampling_config_callback(callbacks.on_sampling_config);
     if (callbacks.on_generic) set_message_callback(callbacks.on_generic);
 }
 
@@ -198,10 +200,15 @@ void EspIdfBleDriver::set_receipt_callback(ReceiptCallback callback) {
     receipt_callback_ = std::move(callback);
 }
 
+void EspIdfBleDriver::set_sampling_config_callback(SamplingConfigCallback callback) {
+    sampling_config_callback_ = std::move(callback);
+}
+
 void EspIdfBleDriver::clear_type_specific_callbacks() {
     start_broadcast_callback_ = nullptr;
     reading_callback_ = nullptr;
     receipt_callback_ = nullptr;
+    sampling_config_callback_ = nullptr;
 }
 
 void EspIdfBleDriver::set_connection_callback(ConnectionCallback callback) {
@@ -435,6 +442,15 @@ bool EspIdfBleDriver::try_type_specific_callbacks(DeviceId sender_id, const BleP
         }
     }
 
+    // Try SamplingConfigMsg
+    if (sampling_config_callback_) {
+        SamplingConfigMsg sampling_config;
+        if (SamplingConfigMsg::deserialize(payload, sampling_config)) {
+            sampling_config_callback_(sender_id, sampling_config);
+            return true;
+        }
+    }
+
     return false;
 }
 
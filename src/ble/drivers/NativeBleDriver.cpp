@@ -1,4 +1,3 @@
-
 //! @file src/ble/drivers/NativeBleDriver.cpp
 //! @brief Native (container-friendly) BLE driver using in-memory queues (UDP-like).
 //! @copyright 2025 Jennifer Gott, released under the MIT License.
@@ -6,253 +5,236 @@
 
 #if !defined(ARDUINO) && !defined(ESP_PLATFORM)
 
-#include <jenlib/ble/BleDriver.h>
+#include <jenlib/ble/drivers/NativeBleDriver.h>
+#include <jenlib/ble/drivers/ShmBleTransport.h>
 #include <jenlib/ble/Messages.h>
-#include <deque>
-#include <unordered_map>
-#include <mutex>
 #include <utility>
 
 namespace jenlib::ble {
 
 // Native driver constants
-constexpr std::uint8_t kSenderIdMarker = 0xFF;
 constexpr std::size_t kMaxQueueSize = 100u;  // Maximum messages per device inbox
 
-
-//! @class NativeBleDriver
-//! @brief Native BLE driver implementation.
-//! @details Uses in-memory queues for broadcast and point-to-point messaging.
-//! Queues are bounded to prevent memory exhaustion in resource-constrained environments.
-//! When queues are full, oldest messages are dropped to maintain system stability.
-class NativeBleDriver : public BleDriver {
- public:
-    //! @brief Constructor.
-    //! @param local_device_id Local device identifier for this instance.
-    explicit NativeBleDriver(DeviceId local_device_id) : local_device_id_(local_device_id), initialized_(false) {}
-
-    //! @brief Initialize the BLE driver and establish connections (Arduino-friendly).
-    //! @return true if initialization succeeded, false otherwise.
-    bool begin() override {
-        initialized_ = true;
-        if (connection_callback_) {
-            connection_callback_(true);
-        }
-        return true;
+bool NativeBleDriver::begin() {
+    initialized_ = true;
+    if (connection_callback_) {
+        connection_callback_(true);
     }
+    return true;
+}
 
-    //! @brief Cleanup BLE driver resources and close connections (Arduino-friendly).
-    void end() override {
+void NativeBleDriver::end() {
+    {
         std::lock_guard<std::mutex> lock(mutex_);
         inbox_.clear();
-        initialized_ = false;
-        if (connection_callback_) {
-            connection_callback_(false);
-        }
     }
-
-    // initialize/cleanup removed in favor of begin/end
-
-    //! @brief Check if the driver is connected and ready for communication.
-    //! @return true if connected and ready, false otherwise.
-    bool is_connected() const override {
-        return initialized_;
+    initialized_ = false;
+    if (connection_callback_) {
+        connection_callback_(false);
     }
+}
 
-    //! @brief Get the local device identifier for this driver instance.
-    //! @return The device ID that identifies this driver instance.
-    DeviceId get_local_device_id() const override {
-        return local_device_id_;
+void NativeBleDriver::advertise(DeviceId device_id, BlePayload payload) {
+    if (!initialized_) {
+        return;
     }
-
-    void advertise(DeviceId device_id, BlePayload payload) override {
-        if (!initialized_) {
-            return;
+    // Broadcast goes to broker inbox (device_id 0 reserved for broker)
+#if defined(__linux__)
+    if (transport_) {
+        // Write the shim header and the message straight into the ring slot
+        if (!transport_->send_in_place(DeviceId(0u), [device_id, &payload](BlePayload& slot) {
+                return append_with_sender(slot, device_id, payload);
+            })) {
+            inbox_drops_.fetch_add(1, std::memory_order_relaxed);
         }
-        // Broadcast goes to broker inbox (device_id 0 reserved for broker)
-        enqueue(DeviceId(0u), payload_with_sender(device_id, std::move(payload)));
+        return;
     }
+#endif
+    BlePayload framed;
+    append_with_sender(framed, device_id, payload);
+    deliver(DeviceId(0u), framed);
+}
 
-    void send_to(DeviceId device_id, BlePayload payload) override {
-        if (!initialized_) {
-            return;
-        }
-        enqueue(device_id, std::move(payload));
+void NativeBleDriver::send_to(DeviceId device_id, BlePayload payload) {
+    if (!initialized_) {
+        return;
     }
+    enqueue(device_id, std::move(payload));
+}
 
-    bool receive(DeviceId self_id, BlePayload &out_payload) override {
-        if (!initialized_) {
-            return false;
-        }
+bool NativeBleDriver::receive(DeviceId self_id, BlePayload &out_payload) {
+    if (!initialized_) {
+        return false;
+    }
+    {
         std::lock_guard<std::mutex> lock(mutex_);
         auto &q = inbox_[self_id.value()];
-        if (q.empty()) {
-            return false;
+        if (!q.empty()) {
+            out_payload = std::move(q.front());
+            q.pop_front();
+            return true;
         }
-        out_payload = std::move(q.front());
-        q.pop_front();
-        return true;
     }
-
-    void poll() override {
-        // Native driver doesn't need event processing - messages are queued directly
-        // This method is provided for Arduino compatibility
-    }
-
-    void set_message_callback(BleMessageCallback callback) override {
-        message_callback_ = std::move(callback);
-    }
-
-    void clear_message_callback() override {
-        message_callback_ = nullptr;
-    }
-
-    void set_start_broadcast_callback(StartBroadcastCallback callback) override {
-        start_broadcast_callback_ = std::move(callback);
+#if defined(__linux__)
+    if (transport_) {
+        return transport_->receive(self_id, out_payload);
+    }
+#endif
+    return false;
+}
+
+void NativeBleDriver::poll() {
+    // Without a transport, messages are queued directly as they are sent
+#if defined(__linux__)
+    if (initialized_ && transport_) {
+        transport_->consume(local_device_id_, [this](const BlePayload& payload) {
+            deliver(local_device_id_, payload);
+        });
+    }
+#endif
+}
+
+std::size_t NativeBleDriver::poll_limited(std::size_t max_messages) {
+#if defined(__linux__)
+    if (initialized_ && transport_) {
+        return transport_->consume(local_device_id_, [this](const BlePayload& payload) {
+            deliver(local_device_id_, payload);
+        }, max_messages);
+    }
+#endif
+    (void)max_messages;
+    return 0;
+}
+
+std::size_t NativeBleDriver::inbox_depth(DeviceId self_id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto it = inbox_.find(self_id.value());
+    std::size_t depth = it == inbox_.end() ? 0 : it->second.size();
+#if defined(__linux__)
+    if (transport_) {
+        depth += transport_->pending(self_id);
+    }
+#endif
+    return depth;
+}
+
+void NativeBleDriver::clear_type_specific_callbacks() {
+    start_broadcast_callback_ = nullptr;
+    reading_callback_ = nullptr;
+    receipt_callback_ = nullptr;
+    sampling_config_callback_ = nullptr;
+}
+
+bool NativeBleDriver::append_with_sender(BlePayload& out, DeviceId sender_id, const BlePayload& payload) {
+    // Marker, then the raw 4-byte LE sender id (no checksum) for shim routing only
+    return out.append_u8(kSenderIdMarker) && out.append_u32le(sender_id.value()) &&
+           out.append_raw(payload.bytes.data(), payload.size);
+}
+
+void NativeBleDriver::enqueue(DeviceId dest, BlePayload payload) {
+#if defined(__linux__)
+    if (transport_) {
+        // Best effort like the in-process queues: a full ring drops the message
+        if (!transport_->send(dest, payload)) {
+            inbox_drops_.fetch_add(1, std::memory_order_relaxed);
+        }
+        return;
     }
+#endif
+    deliver(dest, payload);
+}
 
-    void set_reading_callback(ReadingCallback callback) override {
-        reading_callback_ = std::move(callback);
-    }
+void NativeBleDriver::deliver(DeviceId dest, const BlePayload& payload) {
+    // Extract sender ID from payload if it has the sender marker
+    DeviceId sender_id = extract_sender_id(payload);
 
-    void set_receipt_callback(ReceiptCallback callback) override {
-        receipt_callback_ = std::move(callback);
+    // Try type-specific callbacks first, parsing the message in place past the shim header
+    const bool has_shim = payload.size >= kSenderHeaderSize && payload.bytes[0] == kSenderIdMarker;
+    const auto body = payload.cbegin() + static_cast<std::ptrdiff_t>(has_shim ? kSenderHeaderSize : 0u);
+    if (try_type_specific_callbacks(sender_id, body, payload.cend())) {
+        return;  // Handled by type-specific callback
     }
 
-    void clear_type_specific_callbacks() override {
-        start_broadcast_callback_ = nullptr;
-        reading_callback_ = nullptr;
-        receipt_callback_ = nullptr;
+    // Fallback to generic callback
+    if (message_callback_) {
+        message_callback_(sender_id, payload);
+        return;
     }
 
-    void set_connection_callback(ConnectionCallback callback) override {
-        connection_callback_ = std::move(callback);
-    }
+    // Fallback to queuing for polling-based access
+    std::lock_guard<std::mutex> lock(mutex_);
 
-    void clear_connection_callback() override {
-        connection_callback_ = nullptr;
-    }
+    try {
+        auto &queue = inbox_[dest.value()];
 
- private:
-    //! @brief Create a payload with a sender ID.
-    //! @param sender_id Sender identity.
-    //! @param payload Serialized message bytes (moved).
-    //! @return Payload with sender ID.
-    static BlePayload payload_with_sender(DeviceId sender_id, BlePayload payload) {
-        BlePayload buf;
-        // Prefix marker to indicate presence of sender id in shim header
-        buf.append_u8(kSenderIdMarker);
-        // Embed raw 4-byte LE device id (no checksum) for shim routing only
-        const std::uint32_t v = sender_id.value();
-        buf.append_u8(static_cast<std::uint8_t>(v & 0xFF));
-        buf.append_u8(static_cast<std::uint8_t>((v >> 8) & 0xFF));
-        buf.append_u8(static_cast<std::uint8_t>((v >> 16) & 0xFF));
-        buf.append_u8(static_cast<std::uint8_t>((v >> 24) & 0xFF));
-        buf.append_raw(payload.bytes.data(), payload.size);
-        return buf;
-    }
-
-    //! @brief Enqueue a payload for a destination device.
-    //! @param dest Destination identity.
-    //! @param payload Serialized message bytes (moved into queue).
-    //! @post Inbox is updated with the payload. If inbox is full, oldest payload is dropped.
-    //! @note Swallows exceptions on the queue operations.
-    //!       I am willing to accept this as a failure mode for BLE which is
-    //!       inherently unreliable.
-    void enqueue(DeviceId dest, BlePayload payload) {
-        // Extract sender ID from payload if it has the sender marker
-        DeviceId sender_id = extract_sender_id(payload);
-
-        // Try type-specific callbacks first
-        if (try_type_specific_callbacks(sender_id, payload)) {
-            return;  // Handled by type-specific callback
+        //! Drop oldest messages if queue is at capacity
+        while (queue.size() >= kMaxQueueSize) {
+            queue.pop_front();
+            inbox_drops_.fetch_add(1, std::memory_order_relaxed);
         }
 
-        // Fallback to generic callback
-        if (message_callback_) {
-            message_callback_(sender_id, payload);
-            return;
-        }
-
-        // Fallback to queuing for polling-based access
-        std::lock_guard<std::mutex> lock(mutex_);
-
-        try {
-            auto &queue = inbox_[dest.value()];
-
-            //! Drop oldest messages if queue is at capacity
-            while (queue.size() >= kMaxQueueSize) {
-                queue.pop_front();
-            }
-
-            queue.push_back(std::move(payload));
-        } catch (const std::bad_alloc&) {
-            //! Memory allocation failed - swallow and move on
-        } catch (...) {
-            //! Swallow any other unexpected exceptions
+        BlePayload copy;
+        copy.append_raw(payload.bytes.data(), payload.size);
+        queue.push_back(std::move(copy));
+    } catch (const std::bad_alloc&) {
+        //! Memory allocation failed - swallow and move on
+    } catch (...) {
+        //! Swallow any other unexpected exceptions
+    }
+}
+
+DeviceId NativeBleDriver::extract_sender_id(const BlePayload& payload) {
+    if (payload.size >= kSenderHeaderSize && payload.bytes[0] == kSenderIdMarker) {
+        // Extract 4-byte LE device ID from payload
+        std::uint32_t sender_value = static_cast<std::uint32_t>(payload.bytes[1]) |
+                                   (static_cast<std::uint32_t>(payload.bytes[2]) << 8) |
+                                   (static_cast<std::uint32_t>(payload.bytes[3]) << 16) |
+                                   (static_cast<std::uint32_t>(payload.bytes[4]) << 24);
+        return DeviceId(sender_value);
+    }
+    return DeviceId(0);  // Unknown sender
+}
+
+bool NativeBleDriver::try_type_specific_callbacks(DeviceId sender_id, BlePayload::const_iterator first,
+                                                  BlePayload::const_iterator last) {
+    // Try StartBroadcastMsg
+    if (start_broadcast_callback_) {
+        StartBroadcastMsg start_msg;
+        if (StartBroadcastMsg::deserialize(first, last, start_msg)) {
+            start_broadcast_callback_(sender_id, start_msg);
+            return true;
         }
     }
 
-    //! @brief Extract sender ID from payload if it contains the sender marker.
-    //! @param payload The payload to extract sender ID from.
-    //! @return The sender ID, or DeviceId(0) if not found.
-    DeviceId extract_sender_id(const BlePayload& payload) {
-        if (payload.size >= 5 && payload.bytes[0] == kSenderIdMarker) {
-            // Extract 4-byte LE device ID from payload
-            std::uint32_t sender_value = static_cast<std::uint32_t>(payload.bytes[1]) |
-                                       (static_cast<std::uint32_t>(payload.bytes[2]) << 8) |
-                                       (static_cast<std::uint32_t>(payload.bytes[3]) << 16) |
-                                       (static_cast<std::uint32_t>(payload.bytes[4]) << 24);
-            return DeviceId(sender_value);
+    // Try ReadingMsg
+    if (reading_callback_) {
+        ReadingMsg reading;
+        if (ReadingMsg::deserialize(first, last, reading)) {
+            reading_callback_(sender_id, reading);
+            return true;
         }
-        return DeviceId(0);  // Unknown sender
     }
 
-    //! @brief Try to handle payload with type-specific callbacks.
-    //! @param sender_id The sender device ID.
-    //! @param payload The received payload.
-    //! @return true if handled by type-specific callback, false otherwise.
-    bool try_type_specific_callbacks(DeviceId sender_id, const BlePayload& payload) {
-        // Try StartBroadcastMsg
-        if (start_broadcast_callback_) {
-            StartBroadcastMsg start_msg;
-            if (StartBroadcastMsg::deserialize(payload, start_msg)) {
-                start_broadcast_callback_(sender_id, start_msg);
-                return true;
-            }
-        }
-
-        // Try ReadingMsg
-        if (reading_callback_) {
-            ReadingMsg reading;
-            if (ReadingMsg::deserialize(payload, reading)) {
-                reading_callback_(sender_id, reading);
-                return true;
-            }
+    // Try ReceiptMsg
+    if (receipt_callback_) {
+        ReceiptMsg receipt;
+        if (ReceiptMsg::deserialize(first, last, receipt)) {
+            receipt_callback_(sender_id, receipt);
+            return true;
         }
+    }
 
-        // Try ReceiptMsg
-        if (receipt_callback_) {
-            ReceiptMsg receipt;
-            if (ReceiptMsg::deserialize(payload, receipt)) {
-                receipt_callback_(sender_id, receipt);
-                return true;
-            }
+    // Try SamplingConfigMsg
+    if (sampling_config_callback_) {
+        SamplingConfigMsg sampling_config;
+        if (SamplingConfigMsg::deserialize(first, last, sampling_config)) {
+            sampling_config_callback_(sender_id, sampling_config);
+            return true;
         }
-
-        return false;  // No type-specific callback handled this message
     }
 
-    DeviceId local_device_id_;  //!< Local device identifier.
-    bool initialized_;  //!< Initialization state.
-    BleMessageCallback message_callback_;  //!< Callback for received messages.
-    StartBroadcastCallback start_broadcast_callback_;  //!< Callback for StartBroadcast messages.
-    ReadingCallback reading_callback_;  //!< Callback for Reading messages.
-    ReceiptCallback receipt_callback_;  //!< Callback for Receipt messages.
-    ConnectionCallback connection_callback_;  //!< Callback for connection state changes.
-    std::unordered_map<std::uint32_t, std::deque<BlePayload>> inbox_;  //!< Inbox for received payloads.
-    std::mutex mutex_;  //!< Mutex for inbox.
-};
+    return false;  // No type-specific callback handled this message
+}
 
 }  // namespace jenlib::ble
 
@@ -0,0 +1,208 @@
+//! @file src/ble/drivers/ProfilingBleDriver.cpp
+//! @brief Decorator that counts the traffic of another BLE driver and times its callbacks.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include "jenlib/ble/drivers/ProfilingBleDriver.h"
+#include <utility>
+
+#if defined(ESP_PLATFORM)
+#include <esp_timer.h>
+#elif defined(ARDUINO)
+#include <Arduino.h>
+#else
+#include <chrono>
+#endif
+
+namespace jenlib::ble {
+
+namespace {
+//! @brief Serialized size of a message type; every message has a fixed length.
+template <typename Msg>
+std::size_t wire_size() {
+    static const std::size_t size = [] {
+        BlePayload payload;
+        Msg::serialize(Msg{}, payload);
+        return payload.size;
+    }();
+    return size;
+}
+
+//! @brief Run @p callback and add its duration to @p timing.
+template <typename Fn, typename... Args>
+void timed(ProfilingClock clock, BleCallbackTiming& timing, const Fn& callback, Args&&... args) {
+    const std::uint32_t start = clock();
+    callback(std::forward<Args>(args)...);
+    timing.add(clock() - start);
+}
+}  // namespace
+
+std::uint32_t platform_clock_us() {
+#if defined(ESP_PLATFORM)
+    return static_cast<std::uint32_t>(esp_timer_get_time());
+#elif defined(ARDUINO)
+    return micros();
+#else
+    return static_cast<std::uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                          std::chrono::steady_clock::now().time_since_epoch())
+                                          .count());
+#endif
+}
+
+void BleCallbackTiming::add(std::uint32_t elapsed_us) {
+    std::size_t bucket = 0;
+    for (std::uint32_t rest = elapsed_us; rest != 0 && bucket < kBuckets - 1; rest >>= 1) {
+        ++bucket;
+    }
+    ++histogram[bucket];
+    ++calls;
+    total_us += elapsed_us;
+    if (elapsed_us > max_us) {
+        max_us = elapsed_us;
+    }
+}
+
+std::uint32_t BleCallbackTiming::quantile_upper_us(float fraction) const {
+    if (calls == 0) {
+        return 0;
+    }
+    const auto target = static_cast<std::uint64_t>(fraction * static_cast<float>(calls) + 0.999999f);
+    std::uint64_t seen = 0;
+    for (std::size_t bucket = 0; bucket < kBuckets - 1; ++bucket) {
+        seen += histogram[bucket];
+        if (seen >= target) {
+            const std::uint32_t upper = 1u << bucket;
+            return upper < max_us ? upper : max_us;
+        }
+    }
+    return max_us;
+}
+
+void ProfilingBleDriver::advertise(DeviceId device_id, BlePayload payload) {
+    count(stats_.outbound, payload);
+    inner_.advertise(device_id, std::move(payload));
+}
+
+void ProfilingBleDriver::send_to(DeviceId device_id, BlePayload payload) {
+    count(stats_.outbound, payload);
+    inner_.send_to(device_id, std::move(payload));
+}
+
+bool ProfilingBleDriver::receive(DeviceId self_id, BlePayload &out_payload) {
+    sample_inbox(self_id);
+    if (!inner_.receive(self_id, out_payload)) {
+        return false;
+    }
+    count(stats_.inbound, out_payload);
+    return true;
+}
+
+void ProfilingBleDriver::poll() {
+    const std::uint32_t start = clock_();
+    inner_.poll();
+    stats_.poll.add(clock_() - start);
+    sample_inbox(inner_.get_local_device_id());
+}
+
+std::size_t ProfilingBleDriver::poll_limited(std::size_t max_messages) {
+    const std::uint32_t start = clock_();
+    const std::size_t handled = inner_.poll_limited(max_messages);
+    stats_.poll.add(clock_() - start);
+    sample_inbox(inner_.get_local_device_id());
+    return handled;
+}
+
+void ProfilingBleDriver::set_message_callback(BleMessageCallback callback) {
+    if (!callback) {
+        inner_.set_message_callback(nullptr);  // Keep unhandled messages flowing to the inbox
+        return;
+    }
+    inner_.set_message_callback([this, callback = std::move(callback)](DeviceId sender, const BlePayload& payload) {
+        count(stats_.inbound, payload);
+        timed(clock_, stats_.callbacks[static_cast<std::size_t>(BleCallbackKind::Generic)], callback, sender,
+              payload);
+    });
+}
+
+void ProfilingBleDriver::set_start_broadcast_callback(StartBroadcastCallback callback) {
+    if (!callback) {
+        inner_.set_start_broadcast_callback(nullptr);
+        return;
+    }
+    inner_.set_start_broadcast_callback(
+        [this, callback = std::move(callback)](DeviceId sender, const StartBroadcastMsg& msg) {
+            count(stats_.inbound, MessageType::StartBroadcast, wire_size<StartBroadcastMsg>());
+            timed(clock_, stats_.callbacks[static_cast<std::size_t>(BleCallbackKind::StartBroadcast)], callback,
+                  sender, msg);
+        });
+}
+
+void ProfilingBleDriver::set_reading_callback(ReadingCallback callback) {
+    if (!callback) {
+        inner_.set_reading_callback(nullptr);
+        return;
+    }
+    inner_.set_reading_callback([this, callback = std::move(callback)](DeviceId sender, const ReadingMsg& msg) {
+        count(stats_.inbound, MessageType::Reading, wire_size<ReadingMsg>());
+        timed(clock_, stats_.callbacks[static_cast<std::size_t>(BleCallbackKind::Reading)], callback, sender, msg);
+    });
+}
+
+void ProfilingBleDriver::set_receipt_callback(ReceiptCallback callback) {
+    if (!callback) {
+        inner_.set_receipt_callback(nullptr);
+        return;
+    }
+    inner_.set_receipt_callback([this, callback = std::move(callback)](DeviceId sender, const ReceiptMsg& msg) {
+        count(stats_.inbound, MessageType::Receipt, wire_size<ReceiptMsg>());
+        timed(clock_, stats_.callbacks[static_cast<std::size_t>(BleCallbackKind::Receipt)], callback, sender, msg);
+    });
+}
+
+void ProfilingBleDriver::set_sampling_config_callback(SamplingConfigCallback callback) {
+    if (!callback) {
+        inner_.set_sampling_config_callback(nullptr);
+        return;
+    }
+    inner_.set_sampling_config_callback(
+        [this, callback = std::move(callback)](DeviceId sender, const SamplingConfigMsg& msg) {
+            count(stats_.inbound, MessageType::SamplingConfig, wire_size<SamplingConfigMsg>());
+            timed(clock_, stats_.callbacks[static_cast<std::size_t>(BleCallbackKind::SamplingConfig)], callback,
+                  sender, msg);
+        });
+}
+
+void ProfilingBleDriver::set_connection_callback(ConnectionCallback callback) {
+    if (!callback) {
+        inner_.set_connection_callback(nullptr);
+        return;
+    }
+    inner_.set_connection_callback([this, callback = std::move(callback)](bool connected) {
+        timed(clock_, stats_.callbacks[static_cast<std::size_t>(BleCallbackKind::Connection)], callback, connected);
+    });
+}
+
+void ProfilingBleDriver::count(BleTrafficCounters& counters, const BlePayload& payload) {
+    const std::size_t type_at = message_offset(payload);
+    const std::uint8_t type = payload.size > type_at ? payload.bytes[type_at] : 0;
+    const std::size_t slot = type < BleTrafficCounters::kTypeSlots ? type : 0;
+    ++counters.messages;
+    counters.bytes += payload.size;
+    ++counters.by_type[slot];
+}
+
+void ProfilingBleDriver::count(BleTrafficCounters& counters, MessageType type, std::size_t bytes) {
+    ++counters.messages;
+    counters.bytes += bytes;
+    ++counters.by_type[static_cast<std::size_t>(type)];
+}
+
+void ProfilingBleDriver::sample_inbox(DeviceId device) {
+    const auto depth = static_cast<std::uint32_t>(inner_.inbox_depth(device));
+    stats_.inbox_depth = depth;
+    if (depth > stats_.inbox_high_water) {
+        stats_.inbox_high_water = depth;
+    }
+}
+
+}  // namespace jenlib::ble
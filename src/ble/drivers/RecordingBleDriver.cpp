@@ -0,0 +1,116 @@
+//! @file src/ble/drivers/RecordingBleDriver.cpp
+//! @brief Decorator that captures the traffic of another BLE driver.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#if !defined(ARDUINO) && !defined(ESP_PLATFORM)
+
+#include "jenlib/ble/drivers/RecordingBleDriver.h"
+#include <utility>
+#include "jenlib/ble/Messages.h"
+
+namespace jenlib::ble {
+
+bool RecordingBleDriver::begin() {
+    start_us_ = clock_();
+    return inner_.begin();
+}
+
+void RecordingBleDriver::advertise(DeviceId device_id, BlePayload payload) {
+    record(BleTraceDirection::kAdvertise, device_id, payload);
+    inner_.advertise(device_id, std::move(payload));
+}
+
+void RecordingBleDriver::send_to(DeviceId device_id, BlePayload payload) {
+    record(BleTraceDirection::kSendTo, device_id, payload);
+    inner_.send_to(device_id, std::move(payload));
+}
+
+bool RecordingBleDriver::receive(DeviceId self_id, BlePayload &out_payload) {
+    if (!inner_.receive(self_id, out_payload)) {
+        return false;
+    }
+    record(BleTraceDirection::kReceived, self_id, out_payload);
+    return true;
+}
+
+void RecordingBleDriver::set_message_callback(BleMessageCallback callback) {
+    if (!callback) {
+        inner_.set_message_callback(nullptr);  // Keep unhandled messages flowing to the fallbacks
+        return;
+    }
+    inner_.set_message_callback([this, callback = std::move(callback)](DeviceId sender, const BlePayload& payload) {
+        record(BleTraceDirection::kInbound, sender, payload);
+        callback(sender, payload);
+    });
+}
+
+void RecordingBleDriver::set_start_broadcast_callback(StartBroadcastCallback callback) {
+    if (!callback) {
+        inner_.set_start_broadcast_callback(nullptr);
+        return;
+    }
+    inner_.set_start_broadcast_callback(
+        [this, callback = std::move(callback)](DeviceId sender, const StartBroadcastMsg& msg) {
+            BlePayload payload;
+            if (StartBroadcastMsg::serialize(msg, payload)) {
+                record(BleTraceDirection::kInbound, sender, payload);
+            }
+            callback(sender, msg);
+        });
+}
+
+void RecordingBleDriver::set_reading_callback(ReadingCallback callback) {
+    if (!callback) {
+        inner_.set_reading_callback(nullptr);
+        return;
+    }
+    inner_.set_reading_callback([this, callback = std::move(callback)](DeviceId sender, const ReadingMsg& msg) {
+        BlePayload payload;
+        if (ReadingMsg::serialize(msg, payload)) {
+            record(BleTraceDirection::kInbound, sender, payload);
+        }
+        callback(sender, msg);
+    });
+}
+
+void RecordingBleDriver::set_receipt_callback(ReceiptCallback callback) {
+    if (!callback) {
+        inner_.set_receipt_callback(nullptr);
+        return;
+    }
+    inner_.set_receipt_callback([this, callback = std::move(callback)](DeviceId sender, const ReceiptMsg& msg) {
+        BlePayload payload;
+        if (ReceiptMsg::serialize(msg, payload)) {
+            record(BleTraceDirection::kInbound, sender, payload);
+        }
+        callback(sender, msg);
+    });
+}
+
+void RecordingBleDriver::set_sampling_config_callback(SamplingConfigCallback callback) {
+    if (!callback) {
+        inner_.set_sampling_config_callback(nullptr);
+        return;
+    }
+    inner_.set_sampling_config_callback(
+        [this, callback = std::move(callback)](DeviceId sender, const SamplingConfigMsg& msg) {
+            BlePayload payload;
+            if (SamplingConfigMsg::serialize(msg, payload)) {
+                record(BleTraceDirection::kInbound, sender, payload);
+            }
+            callback(sender, msg);
+        });
+}
+
+void RecordingBleDriver::record(BleTraceDirection direction, DeviceId device, const BlePayload& payload) {
+    const std::uint64_t now_us = clock_();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!trace_.write(now_us - start_us_, direction, device, payload)) {
+        ++write_errors_;
+    }
+}
+
+}  // namespace jenlib::ble
+
+#endif  // !ARDUINO && !ESP_PLATFORM
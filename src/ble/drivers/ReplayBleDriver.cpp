@@ -0,0 +1,171 @@
+//! @file src/ble/drivers/ReplayBleDriver.cpp
+//! @brief Driver that feeds a captured trace back into a broker.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#if !defined(ARDUINO) && !defined(ESP_PLATFORM)
+
+#include <algorithm>
+#include <limits>
+#include "jenlib/ble/drivers/ReplayBleDriver.h"
+#include "jenlib/ble/Messages.h"
+
+namespace jenlib::ble {
+
+namespace {
+constexpr std::size_t kMaxInboxSize = 100u;  // Same bound as NativeBleDriver
+}  // namespace
+
+bool ReplayBleDriver::begin() {
+    start_us_ = clock_();
+    initialized_ = true;
+    if (connection_callback_) {
+        connection_callback_(true);
+    }
+    return true;
+}
+
+void ReplayBleDriver::end() {
+    inbox_.clear();
+    initialized_ = false;
+    if (connection_callback_) {
+        connection_callback_(false);
+    }
+}
+
+void ReplayBleDriver::advertise(DeviceId, BlePayload) {
+    ++sent_;
+}
+
+void ReplayBleDriver::send_to(DeviceId, BlePayload) {
+    ++sent_;
+}
+
+bool ReplayBleDriver::receive(DeviceId self_id, BlePayload &out_payload) {
+    auto it = inbox_.find(self_id.value());
+    if (!initialized_ || it == inbox_.end() || it->second.empty()) {
+        return false;
+    }
+    out_payload = std::move(it->second.front());
+    it->second.pop_front();
+    return true;
+}
+
+std::size_t ReplayBleDriver::inbox_depth(DeviceId self_id) {
+    const auto it = inbox_.find(self_id.value());
+    return it == inbox_.end() ? 0 : it->second.size();
+}
+
+void ReplayBleDriver::poll() {
+    poll_limited(std::numeric_limits<std::size_t>::max());
+}
+
+std::size_t ReplayBleDriver::poll_limited(std::size_t max_messages) {
+    std::size_t delivered = 0;
+    if (!initialized_ || finished()) {
+        return delivered;
+    }
+    const std::uint64_t base_us = records_.front().time_us;
+    if (speed_ <= 0.0) {
+        const std::size_t limit = std::min(batch_, max_messages);
+        for (; delivered < limit && !finished(); ++next_) {
+            const BleTraceRecord& record = records_[next_];
+            if (record.direction == BleTraceDirection::kInbound || record.direction == BleTraceDirection::kReceived) {
+                deliver(record);
+                ++delivered;
+            }
+        }
+        return delivered;
+    }
+    // Trace time that has elapsed on the scaled clock
+    const std::uint64_t elapsed_us = clock_() - start_us_;
+    const std::uint64_t trace_now_us = base_us + static_cast<std::uint64_t>(static_cast<double>(elapsed_us) * speed_);
+    while (delivered < max_messages && !finished() && records_[next_].time_us <= trace_now_us) {
+        const BleTraceRecord& record = records_[next_++];
+        if (record.direction == BleTraceDirection::kInbound || record.direction == BleTraceDirection::kReceived) {
+            last_lateness_us_ =
+                static_cast<std::uint64_t>(static_cast<double>(trace_now_us - record.time_us) / speed_);
+            deliver(record);
+            ++delivered;
+        }
+    }
+    return delivered;
+}
+
+void ReplayBleDriver::clear_type_specific_callbacks() {
+    start_broadcast_callback_ = nullptr;
+    reading_callback_ = nullptr;
+    receipt_callback_ = nullptr;
+    sampling_config_callback_ = nullptr;
+}
+
+void ReplayBleDriver::rewind() {
+    next_ = 0;
+    replayed_ = 0;
+    last_lateness_us_ = 0;
+    inbox_.clear();
+    inbox_drops_ = 0;
+}
+
+void ReplayBleDriver::deliver(const BleTraceRecord& record) {
+    ++replayed_;
+    if (record.direction == BleTraceDirection::kReceived) {
+        push_inbox(record.device, record.payload);
+        return;
+    }
+    if (try_type_specific_callbacks(record.device, record.payload)) {
+        return;
+    }
+    if (message_callback_) {
+        message_callback_(record.device, record.payload);
+        return;
+    }
+    push_inbox(local_device_id_, record.payload);
+}
+
+bool ReplayBleDriver::try_type_specific_callbacks(DeviceId sender_id, const BlePayload& payload) {
+    if (start_broadcast_callback_) {
+        StartBroadcastMsg start_msg;
+        if (StartBroadcastMsg::deserialize(payload, start_msg)) {
+            start_broadcast_callback_(sender_id, start_msg);
+            return true;
+        }
+    }
+    if (reading_callback_) {
+        ReadingMsg reading;
+        if (ReadingMsg::deserialize(payload, reading)) {
+            reading_callback_(sender_id, reading);
+            return true;
+        }
+    }
+    if (receipt_callback_) {
+        ReceiptMsg receipt;
+        if (ReceiptMsg::deserialize(payload, receipt)) {
+            receipt_callback_(sender_id, receipt);
+            return true;
+        }
+    }
+    if (sampling_config_callback_) {
+        SamplingConfigMsg sampling_config;
+        if (SamplingConfigMsg::deserialize(payload, sampling_config)) {
+            sampling_config_callback_(sender_id, sampling_config);
+            return true;
+        }
+    }
+    return false;
+}
+
+void ReplayBleDriver::push_inbox(DeviceId device, const BlePayload& payload) {
+    auto& queue = inbox_[device.value()];
+    while (queue.size() >= kMaxInboxSize) {
+        queue.pop_front();
+        ++inbox_drops_;
+    }
+    BlePayload copy;
+    copy.append_raw(payload.bytes.data(), payload.size);
+    queue.push_back(std::move(copy));
+}
+
+}  // namespace jenlib::ble
+
+#endif  // !ARDUINO && !ESP_PLATFORM
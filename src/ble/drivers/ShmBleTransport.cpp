@@ -0,0 +1,216 @@
+//! @file src/ble/drivers/ShmBleTransport.cpp
+//! @brief Shared-memory segment management and futex wake-ups for ShmBleTransport.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include "jenlib/ble/drivers/ShmBleTransport.h"
+
+#if defined(__linux__) && !defined(ARDUINO) && !defined(ESP_PLATFORM)
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <climits>
+#include <ctime>
+#include <chrono>
+#include <new>
+#include <thread>
+
+namespace jenlib::ble {
+
+namespace {
+constexpr int kOpenAttempts = 1000;  // x 1 ms while another process initialises the segment
+
+// Shared (not FUTEX_PRIVATE) operations, since waiter and waker are different processes
+long futex_wait(std::atomic<std::uint32_t>& word, std::uint32_t expected, std::uint32_t timeout_ms) {
+    timespec timeout{static_cast<time_t>(timeout_ms / 1000), static_cast<long>(timeout_ms % 1000) * 1000000L};
+    return syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), FUTEX_WAIT, expected, &timeout, nullptr, 0);
+}
+
+void futex_wake_all(std::atomic<std::uint32_t>& word) {
+    syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+}
+
+std::size_t home_ring(std::uint32_t device_id) {
+    return (device_id * 2654435761u) % shm::kMaxDevices;
+}
+}  // namespace
+
+ShmBleTransport::~ShmBleTransport() {
+    close();
+}
+
+bool ShmBleTransport::open(const char* name, bool create) {
+    close();
+
+    bool creator = false;
+    int fd = -1;
+    if (create) {
+        fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600);
+        creator = fd >= 0;
+    }
+    if (fd < 0) {
+        fd = shm_open(name, O_RDWR, 0600);
+    }
+    if (fd < 0) {
+        return false;
+    }
+
+    constexpr auto kSize = static_cast<off_t>(sizeof(shm::Segment));
+    if (creator) {
+        if (ftruncate(fd, kSize) != 0) {
+            ::close(fd);
+            shm_unlink(name);
+            return false;
+        }
+    } else {
+        // The creator may not have sized the segment yet
+        struct stat info {};
+        for (int attempt = 0; fstat(fd, &info) == 0 && info.st_size < kSize && attempt < kOpenAttempts; ++attempt) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        if (info.st_size != kSize) {
+            ::close(fd);
+            return false;
+        }
+    }
+
+    void* address = mmap(nullptr, sizeof(shm::Segment), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);  // The mapping keeps the segment alive
+    if (address == MAP_FAILED) {
+        return false;
+    }
+    auto* segment = static_cast<shm::Segment*>(address);
+
+    if (creator) {
+        new (segment) shm::Segment();
+        segment->version = shm::kVersion;
+        for (auto& ring : segment->rings) {
+            for (std::size_t i = 0; i < kRingSlots; ++i) {
+                ring.slots[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+        segment->magic.store(shm::kMagic, std::memory_order_release);
+    } else {
+        int attempt = 0;
+        while (segment->magic.load(std::memory_order_acquire) != shm::kMagic && attempt++ < kOpenAttempts) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        if (segment->magic.load(std::memory_order_acquire) != shm::kMagic || segment->version != shm::kVersion) {
+            munmap(segment, sizeof(shm::Segment));
+            return false;
+        }
+    }
+
+    segment_ = segment;
+    return true;
+}
+
+void ShmBleTransport::close() {
+    if (segment_) {
+        munmap(segment_, sizeof(shm::Segment));
+        segment_ = nullptr;
+    }
+}
+
+bool ShmBleTransport::unlink(const char* name) {
+    return shm_unlink(name) == 0;
+}
+
+bool ShmBleTransport::send(DeviceId dest, const BlePayload& payload) {
+    return send_in_place(dest, [&payload](BlePayload& slot) {
+        return slot.append_raw(payload.bytes.data(), payload.size);
+    });
+}
+
+bool ShmBleTransport::receive(DeviceId self, BlePayload& out) {
+    return consume(self, [&out](const BlePayload& payload) {
+        out.clear();
+        out.append_raw(payload.bytes.data(), payload.size);
+    }, 1) == 1;
+}
+
+bool ShmBleTransport::wait(DeviceId self, std::uint32_t timeout_ms) {
+    shm::Ring* ring = ring_for(self, true);
+    if (!ring) {
+        return false;
+    }
+    const std::uint32_t seen = ring->wake_seq.load(std::memory_order_seq_cst);
+    if (!empty(*ring)) {
+        return true;
+    }
+    // Announce the sleep before the final check so a publish in between either
+    // sees the waiter or changes wake_seq, which makes the futex return at once
+    ring->waiters.fetch_add(1, std::memory_order_seq_cst);
+    if (empty(*ring)) {
+        futex_wait(ring->wake_seq, seen, timeout_ms);
+    }
+    ring->waiters.fetch_sub(1, std::memory_order_seq_cst);
+    return !empty(*ring);
+}
+
+std::uint64_t ShmBleTransport::dropped(DeviceId dest) const {
+    const shm::Ring* ring = ring_for(dest, false);
+    return ring ? ring->dropped.load(std::memory_order_relaxed) : 0;
+}
+
+std::size_t ShmBleTransport::pending(DeviceId dest) const {
+    const shm::Ring* ring = ring_for(dest, false);
+    if (!ring) {
+        return 0;
+    }
+    const std::uint64_t dequeued = ring->dequeue_pos.load(std::memory_order_relaxed);
+    return static_cast<std::size_t>(ring->enqueue_pos.load(std::memory_order_relaxed) - dequeued);
+}
+
+shm::Ring* ShmBleTransport::ring_for(DeviceId device, bool create) const {
+    if (!segment_) {
+        return nullptr;
+    }
+    // Every process probes in the same order and waits on rings being claimed,
+    // so two processes racing to register one device end up on the same ring
+    const std::uint32_t id = device.value();
+    const std::size_t home = home_ring(id);
+    for (std::size_t probe = 0; probe < shm::kMaxDevices; ++probe) {
+        shm::Ring& ring = segment_->rings[(home + probe) % shm::kMaxDevices];
+        std::uint32_t state = ring.state.load(std::memory_order_acquire);
+        if (state == shm::Ring::kFree) {
+            if (!create) {
+                return nullptr;
+            }
+            if (ring.state.compare_exchange_strong(state, shm::Ring::kClaiming, std::memory_order_acq_rel)) {
+                ring.device_id = id;
+                ring.state.store(shm::Ring::kReady, std::memory_order_release);
+                return &ring;
+            }
+        }
+        while (state == shm::Ring::kClaiming) {
+            std::this_thread::yield();
+            state = ring.state.load(std::memory_order_acquire);
+        }
+        if (ring.device_id == id) {
+            return &ring;
+        }
+    }
+    return nullptr;
+}
+
+void ShmBleTransport::publish(shm::Ring& ring, shm::Slot& slot, std::uint64_t pos) noexcept {
+    slot.sequence.store(pos + 1, std::memory_order_release);
+    ring.wake_seq.fetch_add(1, std::memory_order_seq_cst);
+    if (ring.waiters.load(std::memory_order_seq_cst) > 0) {
+        futex_wake_all(ring.wake_seq);
+    }
+}
+
+bool ShmBleTransport::empty(const shm::Ring& ring) noexcept {
+    const std::uint64_t pos = ring.dequeue_pos.load(std::memory_order_relaxed);
+    return ring.slots[pos & (kRingSlots - 1)].sequence.load(std::memory_order_acquire) != pos + 1;
+}
+
+}  // namespace jenlib::ble
+
+#endif  // __linux__ && !ARDUINO && !ESP_PLATFORM
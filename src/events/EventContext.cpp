@@ -0,0 +1,259 @@
+//! @file src/events/EventContext.cpp
+//! @brief Event context implementation
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include "jenlib/events/EventContext.h"
+#include <utility>
+
+namespace jenlib::events {
+
+EventId EventContext::register_callback(EventType event_type, EventCallback callback) {
+    if (!callback) {
+        return kInvalidEventId;
+    }
+
+    EventId event_id = get_next_event_id();
+    if (event_id == kInvalidEventId) {
+        return kInvalidEventId;
+    }
+
+    // Find available slot
+    CallbackEntry* entry = find_available_slot();
+    if (!entry) {
+        return kInvalidEventId;  // No available slots
+    }
+
+    // Store callback in available slot
+    *entry = CallbackEntry(event_id, event_type, std::move(callback));
+
+    return event_id;
+}
+
+bool EventContext::unregister_callback(EventId event_id) {
+    if (event_id == kInvalidEventId) {
+        return false;
+    }
+
+    CallbackEntry* entry = find_callback_entry(event_id);
+    if (!entry || !entry->active) {
+        return false;
+    }
+
+    // Clear the callback entry
+    entry->clear();
+
+    return true;
+}
+
+std::size_t EventContext::unregister_callbacks(EventType event_type) {
+    std::size_t count = 0;
+
+    // Find and remove all callbacks for this event type
+    for (auto& entry : callbacks_) {
+        if (entry.active && entry.type == event_type) {
+            entry.clear();
+            ++count;
+        }
+    }
+
+    return count;
+}
+
+EventEnqueueResult EventContext::dispatch_event(const Event& event, Event* evicted_event) {
+    auto result = EventEnqueueResult::Enqueued;
+
+    // If full, evict the oldest by advancing head and decreasing size
+    if (queue_size_ >= kMaxEventQueueSize) {
+        if (evicted_event) {
+            *evicted_event = event_queue_[queue_head_];
+        }
+        queue_head_ = (queue_head_ + 1) % kMaxEventQueueSize;
+        --queue_size_;
+        ++evicted_count_;
+        result = EventEnqueueResult::EnqueuedWithEviction;
+    }
+
+    // Compute tail position relative to head and size, with wrap-around
+    const std::size_t tail = (queue_head_ + queue_size_) % kMaxEventQueueSize;
+    event_queue_[tail] = event;
+    ++queue_size_;
+
+    if (dispatch_hook_) {
+        dispatch_hook_(dispatch_hook_context_);
+    }
+
+    return result;
+}
+
+void EventContext::set_dispatch_hook(DispatchHook hook, void* context) {
+    dispatch_hook_context_ = context;
+    dispatch_hook_ = hook;
+}
+
+std::size_t EventContext::process_events(std::size_t max_callbacks) {
+    if (queue_size_ == 0 || max_callbacks == 0) {
+        return 0;
+    }
+
+    // Each callback is timed from the end of the previous one, so the clock is read once per call
+    const std::uint32_t pass_start = clock_now();
+    std::uint32_t last_tick = pass_start;
+    std::size_t processed_count = 0;
+    std::size_t handled = 0;
+
+    // Only the events queued on entry; anything a callback dispatches waits for the next pass
+    for (std::size_t pending = queue_size_; pending > 0 && queue_size_ > 0; --pending) {
+        // An event runs all of its callbacks or waits whole, so the limit is checked against all of them
+        const bool over_limit = handled > 0 && max_callbacks != jenlib::time::kNoPassLimit &&
+                                (processed_count >= max_callbacks ||
+                                 get_callback_count(event_queue_[queue_head_].type) > max_callbacks - processed_count);
+        if (over_limit ||
+            (handled > 0 && pass_budget_ms_ != 0 && elapsed(pass_start, last_tick) >= pass_budget_ms_)) {
+            ++deferred_passes_;
+            break;
+        }
+
+        const Event event = event_queue_[queue_head_];
+        queue_head_ = (queue_head_ + 1) % kMaxEventQueueSize;
+        --queue_size_;
+        ++handled;
+
+        // Find all callbacks for this event type
+        for (auto& entry : callbacks_) {
+            if (entry.active && entry.type == event.type && entry.callback) {
+                run_callback(entry, event, last_tick);
+                ++processed_count;
+            }
+        }
+    }
+
+    return processed_count;
+}
+
+bool EventContext::set_callback_budget(EventId event_id, std::uint32_t budget_ms) {
+    CallbackEntry* entry = find_callback_entry(event_id);
+    if (!entry) {
+        return false;
+    }
+    entry->stats.budget_ms = budget_ms;
+    return true;
+}
+
+bool EventContext::get_callback_stats(EventId event_id, jenlib::time::CallbackStats& stats) const {
+    const CallbackEntry* entry = find_callback_entry(event_id);
+    if (!entry) {
+        return false;
+    }
+    stats = entry->stats;
+    return true;
+}
+
+jenlib::time::CallbackStats EventContext::get_worst_offender() const {
+    jenlib::time::CallbackStats worst;
+    for (const auto& entry : callbacks_) {
+        if (entry.active && entry.stats.calls > 0 && entry.stats.worse_than(worst)) {
+            worst = entry.stats;
+        }
+    }
+    return worst;
+}
+
+void EventContext::reset_callback_stats() {
+    for (auto& entry : callbacks_) {
+        entry.stats.clear_counts();
+    }
+    overrun_count_ = 0;
+    deferred_passes_ = 0;
+}
+
+std::size_t EventContext::get_callback_count(EventType event_type) const {
+    std::size_t count = 0;
+    for (const auto& entry : callbacks_) {
+        if (entry.active && entry.type == event_type) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+std::size_t EventContext::get_total_callback_count() const {
+    std::size_t count = 0;
+    for (const auto& entry : callbacks_) {
+        if (entry.active) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+void EventContext::clear_all_callbacks() {
+    for (auto& entry : callbacks_) {
+        entry.clear();
+    }
+    queue_size_ = 0;
+    queue_head_ = 0;
+}
+
+void EventContext::reset() {
+    clear_all_callbacks();
+    next_event_id_ = 1;
+    evicted_count_ = 0;
+    overrun_count_ = 0;
+    deferred_passes_ = 0;
+}
+
+EventId EventContext::get_next_event_id() {
+    if (next_event_id_ == kInvalidEventId) {
+        // Handle ID overflow - in practice, this is unlikely to happen
+        // For embedded systems, we might want to implement ID recycling
+        return kInvalidEventId;
+    }
+
+    return next_event_id_++;
+}
+
+EventContext::CallbackEntry* EventContext::find_available_slot() {
+    for (auto& entry : callbacks_) {
+        if (!entry.active) {
+            return &entry;
+        }
+    }
+    return nullptr;  // No available slots
+}
+
+EventContext::CallbackEntry* EventContext::find_callback_entry(EventId event_id) {
+    for (auto& entry : callbacks_) {
+        if (entry.active && entry.id == event_id) {
+            return &entry;
+        }
+    }
+    return nullptr;  // Not found
+}
+
+const EventContext::CallbackEntry* EventContext::find_callback_entry(EventId event_id) const {
+    for (const auto& entry : callbacks_) {
+        if (entry.active && entry.id == event_id) {
+            return &entry;
+        }
+    }
+    return nullptr;  // Not found
+}
+
+void EventContext::run_callback(CallbackEntry& entry, const Event& event, std::uint32_t& last_tick) {
+    const EventId id = entry.id;
+    entry.callback(event);
+    const std::uint32_t finished = clock_now();
+    const std::uint32_t duration = elapsed(last_tick, finished);
+    last_tick = finished;
+    // The callback may have unregistered itself, freeing the slot for another registration
+    if (entry.active && entry.id == id && entry.stats.record(duration)) {
+        ++overrun_count_;
+    }
+}
+
+std::uint32_t EventContext::elapsed(std::uint32_t from, std::uint32_t to) const {
+    return driver_ ? driver_->time_difference(to, from) : 0;
+}
+
+}  // namespace jenlib::events
@@ -0,0 +1,292 @@
+//! @file src/events/NativeReactor.cpp
+//! @brief epoll/timerfd/eventfd run loop for native Linux builds.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include "jenlib/events/NativeReactor.h"
+
+#if defined(__linux__) && !defined(ARDUINO) && !defined(ESP_PLATFORM)
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include "jenlib/ble/BleDriver.h"
+#include "jenlib/ble/drivers/ShmBleTransport.h"
+#include "jenlib/events/EventDispatcher.h"
+#include "jenlib/time/Time.h"
+
+namespace jenlib::events {
+
+namespace {
+constexpr std::uint64_t kTimerTag = ~0ull;
+constexpr std::uint64_t kWakeTag = ~1ull;
+constexpr int kMaxReadyPerWait = 16;
+constexpr std::uint32_t kBridgeWaitMs = 50;  // Bridge re-checks for shutdown this often
+
+void drain(int fd) {
+    std::uint64_t count = 0;
+    (void)::read(fd, &count, sizeof(count));
+}
+}  // namespace
+
+//! @brief Helper thread turning a futex-based ring wake-up into an eventfd the reactor can epoll.
+struct NativeReactor::TransportBridge {
+    jenlib::ble::ShmBleTransport* transport{nullptr};
+    jenlib::ble::DeviceId self;
+    int event_fd{-1};
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable rearmed_cv;
+    bool rearmed{true};
+    std::atomic<bool> running{true};
+
+    void loop() {
+        while (running.load(std::memory_order_acquire)) {
+            if (!transport->wait(self, kBridgeWaitMs)) {
+                continue;
+            }
+            // Hold off until the reactor has drained the ring, or wait() would return at once.
+            // Clear the flag before signalling so a fast rearm() cannot be overwritten
+            std::unique_lock<std::mutex> lock(mutex);
+            rearmed = false;
+            const std::uint64_t one = 1;
+            (void)::write(event_fd, &one, sizeof(one));
+            rearmed_cv.wait(lock, [this] { return rearmed || !running.load(std::memory_order_acquire); });
+        }
+    }
+
+    void rearm() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            rearmed = true;
+        }
+        rearmed_cv.notify_one();
+    }
+
+    void shutdown() {
+        running.store(false, std::memory_order_release);
+        rearm();
+        if (thread.joinable()) {
+            thread.join();
+        }
+        if (event_fd >= 0) {
+            ::close(event_fd);
+            event_fd = -1;
+        }
+    }
+};
+
+NativeReactor::NativeReactor()
+    : NativeReactor(EventDispatcher::default_context(), jenlib::time::Time::default_context()) {}
+
+NativeReactor::NativeReactor(EventContext& events, jenlib::time::TimerContext& timers)
+    : events_(events), timers_(timers) {}
+
+NativeReactor::~NativeReactor() {
+    close();
+}
+
+bool NativeReactor::open() {
+    close();
+    epoll_fd_ = epoll_create1(EPOLL_CLOEXEC);
+    timer_fd_ = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    wake_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (epoll_fd_ < 0 || timer_fd_ < 0 || wake_fd_ < 0) {
+        close();
+        return false;
+    }
+
+    epoll_event timer_event{};
+    timer_event.events = EPOLLIN;
+    timer_event.data.u64 = kTimerTag;
+    epoll_event wake_event{};
+    wake_event.events = EPOLLIN;
+    wake_event.data.u64 = kWakeTag;
+    if (epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, timer_fd_, &timer_event) != 0 ||
+        epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, wake_fd_, &wake_event) != 0) {
+        close();
+        return false;
+    }
+
+    events_.set_dispatch_hook(&NativeReactor::on_dispatch, this);
+    return true;
+}
+
+void NativeReactor::close() {
+    if (bridge_) {
+        bridge_->shutdown();
+        bridge_.reset();
+    }
+    if (epoll_fd_ >= 0) {
+        events_.set_dispatch_hook(nullptr, nullptr);
+    }
+    for (int* fd : {&epoll_fd_, &timer_fd_, &wake_fd_}) {
+        if (*fd >= 0) {
+            ::close(*fd);
+            *fd = -1;
+        }
+    }
+    for (auto& source : sources_) {
+        source = Source{};
+    }
+    timer_armed_ = false;
+}
+
+bool NativeReactor::add_fd(int fd, std::uint32_t events, FdCallback callback) {
+    if (!is_open() || fd < 0 || !callback) {
+        return false;
+    }
+    for (std::size_t i = 0; i < kMaxSources; ++i) {
+        Source& source = sources_[i];
+        if (source.fd >= 0) {
+            continue;
+        }
+        epoll_event event{};
+        event.events = events;
+        event.data.u64 = i;
+        if (epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &event) != 0) {
+            return false;
+        }
+        source.fd = fd;
+        source.callback = std::move(callback);
+        return true;
+    }
+    return false;
+}
+
+bool NativeReactor::remove_fd(int fd) {
+    for (auto& source : sources_) {
+        if (source.fd == fd && fd >= 0) {
+            epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, fd, nullptr);
+            source = Source{};
+            return true;
+        }
+    }
+    return false;
+}
+
+bool NativeReactor::watch_transport(jenlib::ble::ShmBleTransport& transport, jenlib::ble::BleDriver& driver) {
+    if (!is_open() || bridge_ || !transport.is_open()) {
+        return false;
+    }
+    auto bridge = std::make_unique<TransportBridge>();
+    bridge->transport = &transport;
+    bridge->self = driver.get_local_device_id();
+    bridge->event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (bridge->event_fd < 0) {
+        return false;
+    }
+    TransportBridge* raw = bridge.get();
+    if (!add_fd(raw->event_fd, EPOLLIN, [raw, &driver](std::uint32_t) {
+            drain(raw->event_fd);
+            driver.poll();
+            raw->rearm();
+        })) {
+        ::close(raw->event_fd);
+        return false;
+    }
+    raw->thread = std::thread([raw] { raw->loop(); });
+    bridge_ = std::move(bridge);
+    return true;
+}
+
+void NativeReactor::wake() noexcept {
+    if (wake_fd_ >= 0) {
+        const std::uint64_t one = 1;
+        (void)::write(wake_fd_, &one, sizeof(one));
+    }
+}
+
+std::size_t NativeReactor::run_once(int timeout_ms) {
+    if (!is_open()) {
+        return 0;
+    }
+    std::size_t work = process_services();
+
+    // Announce the sleep before the last look at the queue, so a dispatch from
+    // another thread either sees sleeping_ and writes the eventfd, or is seen here
+    sleeping_.store(true, std::memory_order_seq_cst);
+    const bool must_not_block = arm_timer() || events_.get_pending_event_count() > 0;
+    epoll_event ready[kMaxReadyPerWait];
+    const int count = epoll_wait(epoll_fd_, ready, kMaxReadyPerWait, must_not_block ? 0 : timeout_ms);
+    sleeping_.store(false, std::memory_order_seq_cst);
+    ++wakeups_;
+
+    for (int i = 0; i < count; ++i) {
+        const std::uint64_t tag = ready[i].data.u64;
+        if (tag == kTimerTag) {
+            drain(timer_fd_);
+            timer_armed_ = false;
+        } else if (tag == kWakeTag) {
+            drain(wake_fd_);
+        } else if (tag < kMaxSources && sources_[tag].callback) {
+            sources_[tag].callback(ready[i].events);
+            ++work;
+        }
+    }
+
+    return work + process_services();
+}
+
+void NativeReactor::run() {
+    running_.store(true, std::memory_order_release);
+    while (running_.load(std::memory_order_acquire)) {
+        run_once(-1);
+    }
+}
+
+void NativeReactor::stop() noexcept {
+    running_.store(false, std::memory_order_release);
+    wake();
+}
+
+void NativeReactor::on_dispatch(void* context) {
+    auto* reactor = static_cast<NativeReactor*>(context);
+    if (reactor->sleeping_.load(std::memory_order_seq_cst)) {
+        reactor->wake();
+    }
+}
+
+std::size_t NativeReactor::process_services() {
+    return timers_.process_timers() + events_.process_events();
+}
+
+bool NativeReactor::arm_timer() {
+    std::uint32_t deadline_ms = 0;
+    if (!timers_.get_next_fire_time(deadline_ms)) {
+        if (timer_armed_) {
+            const itimerspec disarm{};
+            timerfd_settime(timer_fd_, 0, &disarm, nullptr);
+            timer_armed_ = false;
+        }
+        return false;
+    }
+
+    // Signed difference, so a due deadline still reads as due across the 49.7-day wrap
+    const std::int32_t remaining_ms = static_cast<std::int32_t>(deadline_ms - timers_.now());
+    if (remaining_ms <= 0) {
+        return true;
+    }
+    if (timer_armed_ && deadline_ms == armed_deadline_ms_) {
+        return false;  // Already armed for this deadline
+    }
+    // now() truncates to whole milliseconds, so a relative wait of the full
+    // difference never fires before now() reaches the deadline
+    const std::uint32_t delay_ms = static_cast<std::uint32_t>(remaining_ms);
+    itimerspec spec{};
+    spec.it_value.tv_sec = static_cast<time_t>(delay_ms / 1000);
+    spec.it_value.tv_nsec = static_cast<long>(delay_ms % 1000) * 1000000L;
+    timerfd_settime(timer_fd_, 0, &spec, nullptr);
+    timer_armed_ = true;
+    armed_deadline_ms_ = deadline_ms;
+    return false;
+}
+
+}  // namespace jenlib::events
+
+#endif  // __linux__ && !ARDUINO && !ESP_PLATFORM
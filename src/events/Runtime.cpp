@@ -0,0 +1,139 @@
+//! @file src/events/Runtime.cpp
+//! @brief Cooperative main loop implementation.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include "jenlib/events/Runtime.h"
+#include <algorithm>
+#include <utility>
+
+namespace jenlib::events {
+
+Runtime::Runtime(jenlib::time::TimeDriver* clock) : clock_(clock) {}
+
+PhaseId Runtime::add_phase(const char* name, PhaseStep step, const PhaseConfig& config) {
+    if (phase_count_ >= kMaxPhases || !step) {
+        return kInvalidPhaseId;
+    }
+    const auto id = static_cast<PhaseId>(phase_count_);
+    Phase& phase = phases_[id];
+    phase.name = name;
+    phase.step = std::move(step);
+    phase.config = config;
+    phase.stats = PhaseStats{};
+    phase.stats.timing.id = id;
+    phase.stats.timing.budget_ms = config.budget_ms;
+    ++phase_count_;
+    sort_phases();
+    return id;
+}
+
+PhaseId Runtime::add_events(EventContext& events, const PhaseConfig& config) {
+    if (!events.time_driver()) {
+        events.set_time_driver(clock_);
+    }
+    return add_phase("events", [&events](const PhaseConfig& c) {
+        events.set_pass_budget_ms(c.budget_ms);
+        return events.process_events(c.max_items);
+    }, config);
+}
+
+PhaseId Runtime::add_timers(jenlib::time::TimerContext& timers, const PhaseConfig& config) {
+    return add_phase("timers", [&timers](const PhaseConfig& c) {
+        timers.set_pass_budget_ms(c.budget_ms);
+        return timers.process_timers(c.max_items);
+    }, config);
+}
+
+PhaseId Runtime::add_ble_intake(jenlib::ble::BleDriver& radio, const PhaseConfig& config) {
+    return add_phase("ble", [&radio](const PhaseConfig& c) { return radio.poll_limited(c.max_items); }, config);
+}
+
+bool Runtime::set_phase_config(PhaseId id, const PhaseConfig& config) {
+    if (id >= phase_count_) {
+        return false;
+    }
+    phases_[id].config = config;
+    phases_[id].stats.timing.budget_ms = config.budget_ms;
+    sort_phases();
+    return true;
+}
+
+std::size_t Runtime::run_once() {
+    const std::uint32_t loop_start = clock_now();
+    std::uint32_t last_tick = loop_start;
+    std::size_t handled = 0;
+
+    // Walk groups of equal priority; within a group the starting phase rotates every iteration
+    for (std::size_t group = 0; group < phase_count_;) {
+        const std::uint8_t priority = phases_[order_[group]].config.priority;
+        std::size_t size = 1;
+        while (group + size < phase_count_ && phases_[order_[group + size]].config.priority == priority) {
+            ++size;
+        }
+        const std::size_t first = loop_stats_.calls % size;
+        for (std::size_t i = 0; i < size; ++i) {
+            handled += run_phase(order_[group + (first + i) % size], last_tick);
+        }
+        group += size;
+    }
+
+    loop_stats_.record(elapsed(loop_start, last_tick));
+    return handled;
+}
+
+bool Runtime::get_phase_stats(PhaseId id, PhaseStats& out) const {
+    if (id >= phase_count_) {
+        return false;
+    }
+    out = phases_[id].stats;
+    return true;
+}
+
+void Runtime::reset_stats() {
+    loop_stats_.clear_counts();
+    for (std::size_t i = 0; i < phase_count_; ++i) {
+        PhaseStats& stats = phases_[i].stats;
+        stats.timing.clear_counts();
+        stats.items = 0;
+        stats.idle_passes = 0;
+    }
+}
+
+void Runtime::sort_phases() {
+    for (std::size_t i = 0; i < phase_count_; ++i) {
+        order_[i] = static_cast<PhaseId>(i);
+    }
+    std::stable_sort(order_.begin(), order_.begin() + static_cast<std::ptrdiff_t>(phase_count_),
+                     [this](PhaseId a, PhaseId b) { return phases_[a].config.priority < phases_[b].config.priority; });
+}
+
+std::size_t Runtime::run_phase(PhaseId id, std::uint32_t& last_tick) {
+    Phase& phase = phases_[id];
+    const std::uint32_t started = last_tick;
+    const std::size_t items = phase.step(phase.config);
+    const std::uint32_t finished = clock_now();
+    const std::uint32_t duration = elapsed(started, finished);
+    last_tick = finished;
+
+    phase.stats.timing.record(duration);
+    phase.stats.items += items;
+    if (items == 0) {
+        ++phase.stats.idle_passes;
+    }
+    if (profile_hook_) {
+        profile_hook_(PhaseSample{id, phase.name, items, started, duration});
+        last_tick = clock_now();  // Keep the hook's own time out of the next phase
+    }
+    return items;
+}
+
+std::uint32_t Runtime::clock_now() const {
+    return clock_ ? clock_->now() : 0;
+}
+
+std::uint32_t Runtime::elapsed(std::uint32_t from, std::uint32_t to) const {
+    return clock_ ? clock_->time_difference(to, from) : 0;
+}
+
+}  // namespace jenlib::events
@@ -0,0 +1,124 @@
+//! @file src/gpio/GpioEdgeMonitor.cpp
+//! @brief Debounced GPIO edge monitor implementation.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include <jenlib/gpio/GpioEdgeMonitor.h>
+#include <jenlib/events/EventDispatcher.h>
+#include <jenlib/time/Time.h>
+
+namespace jenlib::gpio {
+
+namespace {
+// Edges copied out of the ring per drain pass; keeps the stack small.
+constexpr std::size_t kDrainBatch = 16;
+}  // namespace
+
+GpioEdgeMonitor::GpioEdgeMonitor(GpioDriver* driver) noexcept : driver_(driver) {
+    if (driver_) {
+        driver_->set_edge_ring(&ring_);
+    }
+}
+
+GpioEdgeMonitor::~GpioEdgeMonitor() {
+    if (!driver_) {
+        return;
+    }
+    for (auto& sub : subscriptions_) {
+        if (sub.active) {
+            driver_->detach_interrupt(sub.pin);
+            sub.active = false;
+        }
+    }
+    if (driver_->edge_ring() == &ring_) {
+        driver_->set_edge_ring(nullptr);
+    }
+}
+
+bool GpioEdgeMonitor::subscribe(PinIndex pin, InterruptEdge edge, std::uint32_t debounce_ms) {
+    if (!driver_) {
+        return false;
+    }
+
+    Subscription* slot = find(pin);
+    if (!slot) {
+        for (auto& sub : subscriptions_) {
+            if (!sub.active) {
+                slot = &sub;
+                break;
+            }
+        }
+    }
+    if (!slot || !driver_->attach_interrupt(pin, edge)) {
+        return false;
+    }
+
+    const DigitalValue level = driver_->digital_read(pin);
+    *slot = Subscription{pin, debounce_ms, 0, level, level, 0, edge, true};
+    return true;
+}
+
+bool GpioEdgeMonitor::unsubscribe(PinIndex pin) {
+    Subscription* sub = find(pin);
+    if (!sub) {
+        return false;
+    }
+    driver_->detach_interrupt(pin);
+    sub->active = false;
+    return true;
+}
+
+std::size_t GpioEdgeMonitor::process() {
+    return process(jenlib::time::Time::now());
+}
+
+std::size_t GpioEdgeMonitor::process(std::uint32_t now_ms) {
+    // Fold every queued edge into the per-pin state in one pass
+    std::array<EdgeRecord, kDrainBatch> batch{};
+    std::size_t drained = 0;
+    while ((drained = ring_.drain(batch.data(), batch.size())) > 0) {
+        consumed_edges_ += static_cast<std::uint32_t>(drained);
+        for (std::size_t i = 0; i < drained; ++i) {
+            Subscription* sub = find(batch[i].pin);
+            if (!sub) {
+                continue;  // Edge raced an unsubscribe
+            }
+            sub->pending_level = batch[i].level;
+            sub->last_edge_ms = batch[i].timestamp_ms;
+            if (sub->pending_edges < 0xFFFFu) {
+                ++sub->pending_edges;
+            }
+        }
+    }
+
+    std::size_t posted = 0;
+    for (auto& sub : subscriptions_) {
+        if (!sub.active || sub.pending_edges == 0) {
+            continue;
+        }
+        if (now_ms - sub.last_edge_ms < sub.debounce_ms) {
+            continue;  // Still bouncing
+        }
+        // Single-edge subscriptions record only one level, so the settled level cannot tell bursts apart
+        if (sub.edge != InterruptEdge::CHANGE || sub.pending_level != sub.stable_level) {
+            sub.stable_level = sub.pending_level;
+            const GpioChange change{sub.pin, sub.stable_level, sub.pending_edges};
+            jenlib::events::EventDispatcher::dispatch_event(jenlib::events::Event(
+                jenlib::events::EventType::kGpioChange, sub.last_edge_ms, GpioChange::encode(change)));
+            ++posted;
+        }
+        sub.pending_edges = 0;
+    }
+    return posted;
+}
+
+GpioEdgeMonitor::Subscription* GpioEdgeMonitor::find(PinIndex pin) {
+    for (auto& sub : subscriptions_) {
+        if (sub.active && sub.pin == pin) {
+            return &sub;
+        }
+    }
+    return nullptr;
+}
+
+}  // namespace jenlib::gpio
@@ -88,6 +88,72 @@ std::uint8_t ArduinoGpioDriver::get_analog_write_resolution() const noexcept {
     return analog_write_bits_;
 }
 
+ArduinoGpioDriver* ArduinoGpioDriver::isr_owner_ = nullptr;
+
+template <std::size_t Slot>
+void ArduinoGpioDriver::isr_trampoline() {
+    if (isr_owner_) {
+        isr_owner_->on_interrupt(Slot);
+    }
+}
+
+//! @brief Attach an edge interrupt. Uses Arduino API.
+bool ArduinoGpioDriver::attach_interrupt(PinIndex pin, InterruptEdge edge) noexcept {
+    static constexpr std::array<void (*)(), kMaxInterruptPins> kIsrTable = {
+        &isr_trampoline<0>, &isr_trampoline<1>, &isr_trampoline<2>, &isr_trampoline<3>,
+        &isr_trampoline<4>, &isr_trampoline<5>, &isr_trampoline<6>, &isr_trampoline<7>,
+    };
+
+    const int irq = digitalPinToInterrupt(pin);
+    if (irq < 0) {
+        return false;
+    }
+
+    std::size_t slot = kMaxInterruptPins;
+    for (std::size_t i = 0; i < kMaxInterruptPins; ++i) {
+        if (interrupt_used_[i] && interrupt_pins_[i] == pin) {
+            slot = i;
+            break;
+        }
+        if (!interrupt_used_[i] && slot == kMaxInterruptPins) {
+            slot = i;
+        }
+    }
+    if (slot == kMaxInterruptPins) {
+        return false;
+    }
+
+    auto mode = CHANGE;  // int on some cores, PinStatus on ArduinoCore-API
+    switch (edge) {
+        case InterruptEdge::RISING: mode = RISING; break;
+        case InterruptEdge::FALLING: mode = FALLING; break;
+        case InterruptEdge::CHANGE: mode = CHANGE; break;
+    }
+
+    isr_owner_ = this;
+    interrupt_pins_[slot] = pin;
+    interrupt_used_[slot] = true;
+    attachInterrupt(irq, kIsrTable[slot], mode);
+    return true;
+}
+
+//! @brief Detach an edge interrupt. Uses Arduino API.
+void ArduinoGpioDriver::detach_interrupt(PinIndex pin) noexcept {
+    for (std::size_t i = 0; i < kMaxInterruptPins; ++i) {
+        if (interrupt_used_[i] && interrupt_pins_[i] == pin) {
+            detachInterrupt(digitalPinToInterrupt(pin));
+            interrupt_used_[i] = false;
+        }
+    }
+}
+
+//! @brief Sample the pin and record the edge (ISR context).
+void ArduinoGpioDriver::on_interrupt(std::size_t slot) noexcept {
+    const PinIndex pin = interrupt_pins_[slot];
+    record_edge(pin, digitalRead(pin) == HIGH ? DigitalValue::HIGH : DigitalValue::LOW,
+                static_cast<std::uint32_t>(millis()));
+}
+
 }  // namespace jenlib::gpio
 
 #else
@@ -10,6 +10,8 @@
 #include <driver/adc.h>
 #include <driver/ledc.h>
 #include <esp_adc_cal.h>
+#include <esp_attr.h>
+#include <esp_timer.h>
 
 namespace jenlib::gpio {
 
@@ -99,6 +101,54 @@ std::uint8_t EspIdfGpioDriver::get_analog_write_resolution() const noexcept {
     return analog_write_bits_;
 }
 
+bool EspIdfGpioDriver::attach_interrupt(PinIndex pin, InterruptEdge edge) noexcept {
+    if (pin >= GPIO_NUM_MAX) {
+        return false;
+    }
+    if (!isr_service_installed_) {
+        const esp_err_t err = gpio_install_isr_service(0);
+        // Another component may already own the service; that is fine
+        if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) {
+            return false;
+        }
+        isr_service_installed_ = true;
+    }
+
+    gpio_int_type_t type = GPIO_INTR_ANYEDGE;
+    switch (edge) {
+        case InterruptEdge::RISING: type = GPIO_INTR_POSEDGE; break;
+        case InterruptEdge::FALLING: type = GPIO_INTR_NEGEDGE; break;
+        case InterruptEdge::CHANGE: type = GPIO_INTR_ANYEDGE; break;
+    }
+
+    const auto gpio = static_cast<gpio_num_t>(pin);
+    interrupt_contexts_[pin] = InterruptContext{this, pin};
+    if (gpio_set_intr_type(gpio, type) != ESP_OK) {
+        return false;
+    }
+    gpio_isr_handler_remove(gpio);
+    if (gpio_isr_handler_add(gpio, &EspIdfGpioDriver::isr_handler, &interrupt_contexts_[pin]) != ESP_OK) {
+        return false;
+    }
+    return gpio_intr_enable(gpio) == ESP_OK;
+}
+
+void EspIdfGpioDriver::detach_interrupt(PinIndex pin) noexcept {
+    if (pin >= GPIO_NUM_MAX) {
+        return;
+    }
+    const auto gpio = static_cast<gpio_num_t>(pin);
+    gpio_intr_disable(gpio);
+    gpio_isr_handler_remove(gpio);
+}
+
+void IRAM_ATTR EspIdfGpioDriver::isr_handler(void* arg) {
+    auto* ctx = static_cast<InterruptContext*>(arg);
+    const int level = gpio_get_level(static_cast<gpio_num_t>(ctx->pin));
+    ctx->driver->record_edge(ctx->pin, level ? DigitalValue::HIGH : DigitalValue::LOW,
+                             static_cast<std::uint32_t>(esp_timer_get_time() / 1000));
+}
+
 ledc_channel_t EspIdfGpioDriver::get_or_allocate_channel_for_pin(int gpio_pin) noexcept {
     auto it = pin_to_channel_.find(gpio_pin);
     if (it != pin_to_channel_.end()) {
@@ -0,0 +1,141 @@
+//! @file src/gpio/drivers/NativeAnalogSources.cpp
+//! @brief Scripted analog waveform implementations.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#if !defined(ARDUINO) && !defined(ESP_PLATFORM)
+
+#include <jenlib/gpio/drivers/NativeAnalogSources.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+
+//! @namespace jenlib::gpio
+//! @brief GPIO namespace.
+namespace jenlib::gpio {
+
+namespace {
+
+constexpr double kTwoPi = 6.283185307179586;
+
+// SplitMix64 finalizer: cheap, stateless and well mixed.
+std::uint64_t mix64(std::uint64_t x) {
+    x += 0x9E3779B97F4A7C15ull;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+}
+
+bool parse_row(const std::string& line, std::uint64_t& time_ns, float& volts) {
+    const char* begin = line.c_str();
+    char* end = nullptr;
+    const double time_ms = std::strtod(begin, &end);
+    if (end == begin || time_ms < 0.0) {
+        return false;
+    }
+    while (*end == ' ' || *end == '\t') {
+        ++end;
+    }
+    if (*end != ',') {
+        return false;
+    }
+    const char* value = end + 1;
+    const double v = std::strtod(value, &end);
+    if (end == value) {
+        return false;
+    }
+    time_ns = static_cast<std::uint64_t>(time_ms * 1e6 + 0.5);
+    volts = static_cast<float>(v);
+    return true;
+}
+
+}  // namespace
+
+float SineSource::voltage_at(std::uint64_t time_ns) const {
+    // Reduce the phase in double so long runs keep their precision
+    const double cycles = static_cast<double>(frequency_hz_) * static_cast<double>(time_ns) * 1e-9;
+    const double fraction = cycles - std::floor(cycles);
+    return offset_volts_ + amplitude_volts_ * static_cast<float>(std::sin(kTwoPi * fraction + phase_rad_));
+}
+
+float RampSource::voltage_at(std::uint64_t time_ns) const {
+    if (duration_ns_ == 0) {
+        return end_volts_;
+    }
+    if (repeat_) {
+        time_ns %= duration_ns_;
+    } else if (time_ns >= duration_ns_) {
+        return end_volts_;
+    }
+    const float t = static_cast<float>(static_cast<double>(time_ns) / static_cast<double>(duration_ns_));
+    return start_volts_ + (end_volts_ - start_volts_) * t;
+}
+
+float NoiseSource::voltage_at(std::uint64_t time_ns) const {
+    // Top 24 bits -> [0, 1), then to [-1, 1)
+    const std::uint64_t bits = mix64(seed_ ^ mix64(time_ns)) >> 40;
+    const float unit = static_cast<float>(bits) / 16777216.0f;
+    return mean_volts_ + amplitude_volts_ * (2.0f * unit - 1.0f);
+}
+
+bool CsvSource::load(std::istream& in) {
+    samples_.clear();
+    std::string line;
+    bool first_row = true;
+    while (std::getline(in, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        Sample sample{};
+        if (!parse_row(line, sample.time_ns, sample.volts)) {
+            if (first_row) {
+                first_row = false;
+                continue;  // Column header
+            }
+            samples_.clear();
+            return false;
+        }
+        first_row = false;
+        if (!samples_.empty() && sample.time_ns < samples_.back().time_ns) {
+            samples_.clear();
+            return false;
+        }
+        samples_.push_back(sample);
+    }
+    return !samples_.empty();
+}
+
+bool CsvSource::load_file(const std::string& path) {
+    std::ifstream in(path);
+    if (!in) {
+        samples_.clear();
+        return false;
+    }
+    return load(in);
+}
+
+float CsvSource::voltage_at(std::uint64_t time_ns) const {
+    if (samples_.empty()) {
+        return 0.0f;
+    }
+    const std::uint64_t span = samples_.back().time_ns;
+    if (loop_ && span > 0 && time_ns > span) {
+        time_ns %= span;
+    }
+    // Last sample at or before time_ns
+    auto it = std::upper_bound(samples_.begin(), samples_.end(), time_ns,
+                               [](std::uint64_t t, const Sample& s) { return t < s.time_ns; });
+    if (it == samples_.begin()) {
+        return samples_.front().volts;
+    }
+    return std::prev(it)->volts;
+}
+
+}  // namespace jenlib::gpio
+
+#endif  // !ARDUINO && !ESP_PLATFORM
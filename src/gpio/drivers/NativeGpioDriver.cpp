@@ -6,12 +6,114 @@
 #if !defined(ARDUINO) && !defined(ESP_PLATFORM)
 
 #include <jenlib/gpio/drivers/NativeGpioDriver.h>
+#include <map>
+#include <string>
 
 //! @namespace jenlib::gpio
 //! @brief GPIO namespace.
 namespace jenlib::gpio {
 
-// All methods are inline in the header; no additional implementation needed.
+namespace {
+
+//! @brief Line state of a traced pin while replaying the trace.
+struct VcdPinState {
+    std::string id;
+    bool has_mode{false};
+    PinMode mode{PinMode::INPUT};
+    DigitalValue driven{DigitalValue::LOW};
+    char shown{'x'};
+};
+
+// VCD identifiers are short strings of printable ASCII ('!'..'~').
+std::string vcd_identifier(std::size_t index) {
+    std::string id;
+    do {
+        id.push_back(static_cast<char>('!' + index % 94));
+        index /= 94;
+    } while (index > 0);
+    return id;
+}
+
+char vcd_level(const VcdPinState& state) {
+    const char driven = state.driven == DigitalValue::HIGH ? '1' : '0';
+    if (!state.has_mode) {
+        return driven;
+    }
+    switch (state.mode) {
+        case PinMode::OUTPUT: return driven;
+        case PinMode::INPUT_PULLUP: return '1';
+        case PinMode::INPUT_PULLDOWN: return '0';
+        case PinMode::INPUT: return 'z';
+    }
+    return 'x';
+}
+
+}  // namespace
+
+double NativeGpioDriver::toggles_per_second(PinIndex pin) const {
+    if (virtual_time_ns_ == 0) {
+        return 0.0;
+    }
+    return static_cast<double>(pin_stats(pin).toggles) * 1e9 / static_cast<double>(virtual_time_ns_);
+}
+
+void NativeGpioDriver::export_vcd(std::ostream& out) const {
+    // Ordered so the header lists pins ascending
+    std::map<PinIndex, VcdPinState> pins;
+    for (const auto& record : trace_) {
+        if (record.op == GpioTraceOp::kSetMode || record.op == GpioTraceOp::kDigitalWrite) {
+            pins[record.pin];
+        }
+    }
+    std::size_t index = 0;
+    for (auto& entry : pins) {
+        entry.second.id = vcd_identifier(index++);
+    }
+
+    out << "$timescale 1ns $end\n";
+    out << "$scope module gpio $end\n";
+    for (const auto& entry : pins) {
+        out << "$var wire 1 " << entry.second.id << " pin" << static_cast<unsigned>(entry.first) << " $end\n";
+    }
+    out << "$upscope $end\n";
+    out << "$enddefinitions $end\n";
+    out << "#0\n$dumpvars\n";
+    for (const auto& entry : pins) {
+        out << 'x' << entry.second.id << '\n';
+    }
+    out << "$end\n";
+
+    std::uint64_t current_ns = 0;
+    for (const auto& record : trace_) {
+        auto it = pins.find(record.pin);
+        if (it == pins.end()) {
+            continue;
+        }
+        VcdPinState& state = it->second;
+        if (record.op == GpioTraceOp::kSetMode) {
+            state.has_mode = true;
+            state.mode = static_cast<PinMode>(record.value);
+        } else if (record.op == GpioTraceOp::kDigitalWrite) {
+            state.driven = static_cast<DigitalValue>(record.value);
+        } else {
+            continue;
+        }
+        const char level = vcd_level(state);
+        if (level == state.shown) {
+            continue;
+        }
+        if (record.timestamp_ns != current_ns) {
+            current_ns = record.timestamp_ns;
+            out << '#' << current_ns << '\n';
+        }
+        out << level << state.id << '\n';
+        state.shown = level;
+    }
+    // Close the dump at the end of virtual time so the last level has a width
+    if (virtual_time_ns_ > current_ns) {
+        out << '#' << virtual_time_ns_ << '\n';
+    }
+}
 
 }  // namespace jenlib::gpio
 
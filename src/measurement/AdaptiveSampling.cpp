@@ -0,0 +1,102 @@
+//! @file src/measurement/AdaptiveSampling.cpp
+//! @brief Adaptive measurement interval selection.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include "jenlib/measurement/AdaptiveSampling.h"
+#include <algorithm>
+
+namespace jenlib::measurement {
+
+namespace {
+constexpr std::uint32_t kOneStepQ8 = 256;
+constexpr std::uint32_t kMaxActivityQ8 = 64 * kOneStepQ8;  // Keeps the variance in 32 bits
+constexpr std::uint32_t kErraticVarianceQ16 = kOneStepQ8 * kOneStepQ8 / 4;  // Standard deviation of half a step
+constexpr unsigned kAverageShift = 2;  // Running statistics weight the newest reading by 1/4
+
+std::uint32_t scaled_change(std::int32_t change, std::uint16_t step) {
+    const auto magnitude = static_cast<std::uint32_t>(change < 0 ? -change : change);
+    return magnitude * kOneStepQ8 / std::max<std::uint32_t>(step, 1);
+}
+}  // namespace
+
+AdaptiveSampler::AdaptiveSampler(const AdaptiveSamplingConfig& config) noexcept : config_(config) {
+    reset();
+}
+
+void AdaptiveSampler::configure(const AdaptiveSamplingConfig& config) noexcept {
+    config_ = config;
+    clamp_interval();
+}
+
+bool AdaptiveSampler::set_bounds(std::uint32_t min_interval_ms, std::uint32_t max_interval_ms) noexcept {
+    if (min_interval_ms == 0 || min_interval_ms > max_interval_ms) {
+        return false;
+    }
+    config_.min_interval_ms = min_interval_ms;
+    config_.max_interval_ms = max_interval_ms;
+    clamp_interval();
+    return true;
+}
+
+void AdaptiveSampler::reset() noexcept {
+    interval_ms_ = config_.min_interval_ms;
+    has_previous_ = false;
+    activity_q8_ = 0;
+    activity_mean_q8_ = 0;
+    activity_variance_q16_ = 0;
+    clamp_interval();
+}
+
+void AdaptiveSampler::resume(std::uint32_t interval_ms) noexcept {
+    reset();
+    interval_ms_ = interval_ms;
+    clamp_interval();
+}
+
+std::uint32_t AdaptiveSampler::update(const jenlib::ble::ReadingMsg& reading) noexcept {
+    if (!has_previous_) {
+        has_previous_ = true;
+        previous_temperature_centi_ = reading.temperature_c_centi;
+        previous_humidity_bp_ = reading.humidity_bp;
+        return interval_ms_;
+    }
+
+    const std::uint32_t temperature_activity = scaled_change(
+        static_cast<std::int32_t>(reading.temperature_c_centi) - previous_temperature_centi_,
+        config_.temperature_step_centi);
+    const std::uint32_t humidity_activity = scaled_change(
+        static_cast<std::int32_t>(reading.humidity_bp) - previous_humidity_bp_, config_.humidity_step_bp);
+    previous_temperature_centi_ = reading.temperature_c_centi;
+    previous_humidity_bp_ = reading.humidity_bp;
+    activity_q8_ = std::min(std::max(temperature_activity, humidity_activity), kMaxActivityQ8);
+
+    // Exponentially weighted mean and variance of the activity
+    const std::int32_t deviation = static_cast<std::int32_t>(activity_q8_) - activity_mean_q8_;
+    activity_mean_q8_ += deviation / (1 << kAverageShift);
+    const auto squared = static_cast<std::uint32_t>(deviation * deviation);
+    activity_variance_q16_ = activity_variance_q16_ - (activity_variance_q16_ >> kAverageShift) +
+                             (squared >> kAverageShift);
+
+    if (activity_q8_ > kOneStepQ8) {
+        // Aim for about one step over the next interval
+        interval_ms_ = static_cast<std::uint32_t>(static_cast<std::uint64_t>(interval_ms_) * kOneStepQ8 /
+                                                  activity_q8_);
+    } else if (activity_variance_q16_ > kErraticVarianceQ16) {
+        interval_ms_ /= 2;
+    } else if (activity_q8_ <= kOneStepQ8 / 2) {
+        // Steady: back off exponentially
+        interval_ms_ = interval_ms_ > config_.max_interval_ms / 2 ? config_.max_interval_ms : interval_ms_ * 2;
+    }
+    clamp_interval();
+    return interval_ms_;
+}
+
+void AdaptiveSampler::clamp_interval() noexcept {
+    interval_ms_ = std::max(config_.min_interval_ms, std::min(interval_ms_, config_.max_interval_ms));
+    if (interval_ms_ == 0) {
+        interval_ms_ = 1;
+    }
+}
+
+}  // namespace jenlib::measurement
@@ -0,0 +1,54 @@
+//! @file src/measurement/Aggregates.cpp
+//! @brief Welford updates for running reading statistics.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include "jenlib/measurement/Aggregates.h"
+
+namespace jenlib::measurement {
+
+void RunningStats::add(std::int32_t value) noexcept {
+    if (count_ == 0) {
+        min_ = value;
+        max_ = value;
+    } else if (value < min_) {
+        min_ = value;
+    } else if (value > max_) {
+        max_ = value;
+    }
+    ++count_;
+    const float delta = static_cast<float>(value) - mean_;
+    mean_ += delta / static_cast<float>(count_);
+    m2_ += delta * (static_cast<float>(value) - mean_);
+}
+
+void RunningStats::merge(const RunningStats& other) noexcept {
+    if (other.count_ == 0) {
+        return;
+    }
+    if (count_ == 0) {
+        *this = other;
+        return;
+    }
+    // Chan et al.: combine means and squared deviations without revisiting values
+    const float n_a = static_cast<float>(count_);
+    const float n_b = static_cast<float>(other.count_);
+    const float n = n_a + n_b;
+    const float delta = other.mean_ - mean_;
+    mean_ += delta * n_b / n;
+    m2_ += other.m2_ + delta * delta * n_a * n_b / n;
+    count_ += other.count_;
+    min_ = other.min_ < min_ ? other.min_ : min_;
+    max_ = other.max_ > max_ ? other.max_ : max_;
+}
+
+void ReadingAggregate::add(const jenlib::ble::ReadingMsg& reading) noexcept {
+    if (count() == 0) {
+        first_offset_ms = reading.offset_ms;
+    }
+    last_offset_ms = reading.offset_ms;
+    temperature_c_centi.add(reading.temperature_c_centi);
+    humidity_bp.add(reading.humidity_bp);
+}
+
+}  // namespace jenlib::measurement
@@ -0,0 +1,95 @@
+//! @file src/measurement/LinkQuality.cpp
+//! @brief Per-session loss, reordering and jitter of a sensor's readings as seen by the broker.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include "jenlib/measurement/LinkQuality.h"
+
+namespace jenlib::measurement {
+
+namespace {
+constexpr std::uint32_t kMaxJitterSampleMs = 1u << 20;  // Keeps the 1/16 ms estimate far from overflow
+}  // namespace
+
+void LinkQuality::set_interval_ms(std::uint32_t interval_ms, Cadence cadence) noexcept {
+    if (started_) {
+        // The newest reading becomes slot 0 of the new grid and is counted there
+        carried_expected_ = expected() - 1;
+        base_offset_ms_ = newest_offset_ms_;
+        newest_slot_ = 0;
+        window_ = 1;
+    }
+    interval_ms_ = interval_ms;
+    cadence_ = cadence;
+}
+
+bool LinkQuality::add(std::uint32_t offset_ms, std::uint32_t arrival_ms) noexcept {
+    if (interval_ms_ == 0) {
+        return false;
+    }
+    if (!started_) {
+        started_ = true;
+        base_offset_ms_ = offset_ms;
+        newest_slot_ = 0;
+        newest_offset_ms_ = offset_ms;
+        newest_arrival_ms_ = arrival_ms;
+        window_ = 1;
+        received_ = 1;
+        filled_ = 1;
+        previous_offset_ms_ = offset_ms;
+        previous_arrival_ms_ = arrival_ms;
+        return true;
+    }
+    if (offset_ms < base_offset_ms_) {
+        return false;  // Before the first reading tracked
+    }
+
+    const std::uint32_t slot = slot_of(offset_ms);
+    if (slot > newest_slot_) {
+        const std::uint32_t advance = slot - newest_slot_;
+        if (advance > 1) {
+            ++gaps_;
+            if (advance - 1 > longest_gap_) {
+                longest_gap_ = advance - 1;
+            }
+        }
+        window_ = advance < kWindowSlots ? (window_ << advance) | 1u : 1u;
+        newest_slot_ = slot;
+        newest_offset_ms_ = offset_ms;
+        newest_arrival_ms_ = arrival_ms;
+        ++filled_;
+    } else {
+        const std::uint32_t behind = newest_slot_ - slot;
+        if (behind >= kWindowSlots) {
+            return false;  // Too old to tell a late reading from a duplicate
+        }
+        const std::uint64_t bit = std::uint64_t{1} << behind;
+        if (!(window_ & bit)) {
+            window_ |= bit;
+            ++late_;
+            ++filled_;
+        } else if (cadence_ == Cadence::kFixed || offset_ms == newest_offset_ms_) {
+            ++duplicates_;
+            return false;
+        } else if (behind == 0 && offset_ms > newest_offset_ms_) {
+            // Another reading in the newest slot; the slot is already counted
+            newest_offset_ms_ = offset_ms;
+            newest_arrival_ms_ = arrival_ms;
+        }
+    }
+    ++received_;
+
+    // RFC 3550: D = arrival spacing - send spacing; J += (|D| - J) / 16, kept in 1/16 ms
+    const std::int64_t spacing_difference = (static_cast<std::int64_t>(arrival_ms) - previous_arrival_ms_) -
+                                            (static_cast<std::int64_t>(offset_ms) - previous_offset_ms_);
+    std::uint64_t magnitude = spacing_difference < 0 ? -spacing_difference : spacing_difference;
+    if (magnitude > kMaxJitterSampleMs) {
+        magnitude = kMaxJitterSampleMs;
+    }
+    jitter_16_ = jitter_16_ - jitter_16_ / 16 + static_cast<std::uint32_t>(magnitude);
+    previous_offset_ms_ = offset_ms;
+    previous_arrival_ms_ = arrival_ms;
+    return true;
+}
+
+}  // namespace jenlib::measurement
@@ -0,0 +1,74 @@
+//! @file src/measurement/MeasurementPacketiser.cpp
+//! @brief Delta packet encoding and lazy decoding for Measurement runs.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include "jenlib/measurement/MeasurementPacketiser.h"
+
+namespace jenlib::measurement {
+
+using jenlib::storage::get_varint;
+using jenlib::storage::put_varint;
+using jenlib::storage::unzigzag;
+using jenlib::storage::zigzag;
+
+std::size_t MeasurementPacketiser::encode_delta(const WireSample& previous, const WireSample& current,
+                                                std::uint8_t* out) {
+    // Timestamps are usually ascending, but zigzag keeps a reordered sample legal
+    const auto dt = static_cast<std::int32_t>(current.timestamp_ms - previous.timestamp_ms);
+    const std::int32_t dtemp = static_cast<std::int32_t>(current.temperature_centi) - previous.temperature_centi;
+    const std::int32_t dhum = static_cast<std::int32_t>(current.humidity_bp) - previous.humidity_bp;
+
+    std::size_t len = put_varint(zigzag(dt), out);
+    len += put_varint(zigzag(dtemp), out + len);
+    len += put_varint(zigzag(dhum), out + len);
+    return len;
+}
+
+MeasurementPacketReader::MeasurementPacketReader(const jenlib::ble::BlePayload& payload) noexcept
+    : payload_(payload) {
+    std::uint8_t format = 0;
+    std::uint8_t count = 0;
+    std::uint32_t timestamp_ms = 0;
+    std::int16_t temperature_centi = 0;
+    std::uint16_t humidity_bp = 0;
+    ok_ = jenlib::ble::read_u8(payload_, index_, format) && format == packet::kPacketFormat &&
+          jenlib::ble::read_u8(payload_, index_, count) && count > 0 &&
+          jenlib::ble::read_u32le(payload_, index_, timestamp_ms) &&
+          jenlib::ble::read_i16le(payload_, index_, temperature_centi) &&
+          jenlib::ble::read_u16le(payload_, index_, humidity_bp);
+    if (ok_) {
+        count_ = count;
+        timestamp_ms_ = timestamp_ms;
+        temperature_centi_ = temperature_centi;
+        humidity_bp_ = humidity_bp;
+    }
+}
+
+bool MeasurementPacketReader::next(Measurement& out) {
+    if (!ok_ || decoded_ >= count_) {
+        return false;
+    }
+    if (decoded_ > 0) {
+        std::uint32_t dt = 0;
+        std::uint32_t dtemp = 0;
+        std::uint32_t dhum = 0;
+        auto it = payload_.cbegin() + static_cast<std::ptrdiff_t>(index_);
+        const auto end = payload_.cend();
+        if (!get_varint(it, end, dt) || !get_varint(it, end, dtemp) || !get_varint(it, end, dhum)) {
+            ok_ = false;
+            return false;
+        }
+        index_ = static_cast<std::size_t>(it - payload_.cbegin());
+        timestamp_ms_ += static_cast<std::uint32_t>(unzigzag(dt));
+        temperature_centi_ += unzigzag(dtemp);
+        humidity_bp_ += unzigzag(dhum);
+    }
+    ++decoded_;
+    out.timestamp_ms = timestamp_ms_;
+    out.temperature_c = temperature_from_centi(static_cast<std::int16_t>(temperature_centi_));
+    out.humidity_bp = humidity_from_basis_points(static_cast<std::uint16_t>(humidity_bp_));
+    return true;
+}
+
+}  // namespace jenlib::measurement
@@ -0,0 +1,38 @@
+//! @file src/measurement/SendOnDelta.cpp
+//! @brief Send-on-delta reporting decision.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include "jenlib/measurement/SendOnDelta.h"
+
+namespace jenlib::measurement {
+
+namespace {
+std::uint32_t magnitude(std::int32_t value) {
+    return static_cast<std::uint32_t>(value < 0 ? -value : value);
+}
+}  // namespace
+
+bool SendOnDeltaFilter::should_send(const jenlib::ble::ReadingMsg& reading) noexcept {
+    bool send = !has_sent_;
+    if (!send) {
+        const std::int32_t dtemp = static_cast<std::int32_t>(reading.temperature_c_centi) - last_temperature_centi_;
+        const std::int32_t dhum = static_cast<std::int32_t>(reading.humidity_bp) - last_humidity_bp_;
+        send = magnitude(dtemp) > config_.temperature_deadband_centi ||
+               magnitude(dhum) > config_.humidity_deadband_bp ||
+               (config_.max_silence_ms > 0 && reading.offset_ms - last_offset_ms_ >= config_.max_silence_ms);
+    }
+
+    if (!send) {
+        ++suppressed_count_;
+        return false;
+    }
+    has_sent_ = true;
+    last_temperature_centi_ = reading.temperature_c_centi;
+    last_humidity_bp_ = reading.humidity_bp;
+    last_offset_ms_ = reading.offset_ms;
+    ++sent_count_;
+    return true;
+}
+
+}  // namespace jenlib::measurement
@@ -0,0 +1,90 @@
+//! @file src/onewire/OneWireBus.cpp
+//! @brief OneWire bus command layer on top of a OneWireBackend.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include <jenlib/onewire/OneWireBus.h>
+
+namespace jenlib::onewire {
+
+OneWireBus::OneWireBus(gpio::OneWirePin pin) : OneWireBus(static_cast<std::uint8_t>(pin.getIndex())) {}
+
+OneWireBus::OneWireBus(GPIO::Pin pin) : OneWireBus(static_cast<std::uint8_t>(pin.getIndex())) {}
+
+// Every pin constructor lands here, so each gets slot timing on hardware
+OneWireBus::OneWireBus(std::uint8_t raw_pin)
+    : gpio_backend_(std::in_place, raw_pin, &platform_delay_us), backend_(&*gpio_backend_), initialized_(false) {}
+
+OneWireBus::OneWireBus(OneWireBackend& backend)
+    : backend_(&backend), initialized_(false) {}
+
+void OneWireBus::begin() {
+    initialized_ = backend_->begin();
+}
+
+void OneWireBus::end() {
+    if (initialized_) {
+        backend_->end();
+    }
+    initialized_ = false;
+}
+
+bool OneWireBus::reset() {
+    if (!initialized_) {
+        return false;
+    }
+    return backend_->reset();
+}
+
+void OneWireBus::write_byte(byte data) {
+    if (!initialized_) {
+        return;
+    }
+    backend_->transfer_bits(&data, nullptr, 8u);
+}
+
+OneWireBus::byte OneWireBus::read_byte() {
+    if (!initialized_) {
+        return 0;
+    }
+    const byte ones = 0xFF;
+    byte data = 0;
+    backend_->transfer_bits(&ones, &data, 8u);
+    return data;
+}
+
+void OneWireBus::skip_rom() {
+    if (!initialized_) {
+        return;
+    }
+    write_byte(static_cast<byte>(Command::SkipRom));
+}
+
+void OneWireBus::match_rom(const rom_code_t& rom) {
+    if (!initialized_) {
+        return;
+    }
+
+    // Command and address go out as one 9-byte transfer
+    std::array<byte, 1 + std::tuple_size<rom_code_t>::value> frame{};
+    frame[0] = static_cast<byte>(Command::MatchRom);
+    for (std::size_t i = 0; i < rom.size(); ++i) {
+        frame[i + 1] = rom[i];
+    }
+    backend_->transfer_bits(frame.data(), nullptr, frame.size() * 8u);
+}
+
+bool OneWireBus::read_rom(rom_code_t& out_rom) {
+    if (!initialized_) {
+        return false;
+    }
+
+    if (!backend_->reset()) {
+        return false;
+    }
+
+    write_byte(static_cast<byte>(Command::ReadRom));
+    return read_bytes(out_rom.begin(), out_rom.end()) == out_rom.size();
+}
+
+}  // namespace jenlib::onewire
@@ -0,0 +1,40 @@
+//! @file src/onewire/drivers/ArduinoOneWireBackend.cpp
+//! @brief Arduino OneWire library backend implementation.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifdef JENLIB_ENABLE_ARDUINO_ONEWIRE
+
+#include <jenlib/onewire/drivers/ArduinoOneWireBackend.h>
+
+namespace jenlib::onewire {
+
+bool ArduinoOneWireBackend::transfer_bits(const std::uint8_t* tx, std::uint8_t* rx, std::size_t nbits) {
+    if (!tx) {
+        return false;
+    }
+
+    std::size_t i = 0;
+    if (!rx) {
+        // Write-only: let the library push whole bytes
+        for (; i + 8u <= nbits; i += 8u) {
+            ow_.write(tx[i / 8u]);
+        }
+    }
+    for (; i < nbits; ++i) {
+        const bool bit = get_packed_bit(tx, i);
+        if (bit && rx) {
+            set_packed_bit(rx, i, ow_.read_bit() == 1);
+        } else {
+            ow_.write_bit(bit ? 1 : 0);
+            if (rx) {
+                set_packed_bit(rx, i, bit);
+            }
+        }
+    }
+    return true;
+}
+
+}  // namespace jenlib::onewire
+
+#endif  // JENLIB_ENABLE_ARDUINO_ONEWIRE
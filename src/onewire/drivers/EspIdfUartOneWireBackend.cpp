@@ -0,0 +1,135 @@
+//! @file src/onewire/drivers/EspIdfUartOneWireBackend.cpp
+//! @brief ESP-IDF UART OneWire backend implementation.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include <jenlib/onewire/drivers/EspIdfUartOneWireBackend.h>
+
+#ifdef ESP_PLATFORM
+#include <array>
+#include <freertos/FreeRTOS.h>
+
+namespace jenlib::onewire {
+
+namespace {
+constexpr std::uint32_t kResetBaud = 9600;
+constexpr std::uint32_t kSlotBaud = 115200;
+constexpr std::uint8_t kResetFrame = 0xF0;
+constexpr std::uint8_t kSlotOne = 0xFF;
+constexpr std::uint8_t kSlotZero = 0x00;
+constexpr int kUartBufferSize = 256;
+constexpr TickType_t kReadTimeout = pdMS_TO_TICKS(20);
+}  // namespace
+
+EspIdfUartOneWireBackend::EspIdfUartOneWireBackend(uart_port_t uart, gpio_num_t tx_pin, gpio_num_t rx_pin)
+    : uart_(uart), tx_pin_(tx_pin), rx_pin_(rx_pin), baud_(0), initialized_(false) {
+}
+
+EspIdfUartOneWireBackend::~EspIdfUartOneWireBackend() {
+    end();
+}
+
+bool EspIdfUartOneWireBackend::begin() {
+    if (initialized_) {
+        return true;
+    }
+
+    uart_config_t config = {};
+    config.baud_rate = static_cast<int>(kSlotBaud);
+    config.data_bits = UART_DATA_8_BITS;
+    config.parity = UART_PARITY_DISABLE;
+    config.stop_bits = UART_STOP_BITS_1;
+    config.flow_ctrl = UART_HW_FLOWCTRL_DISABLE;
+    config.source_clk = UART_SCLK_DEFAULT;
+
+    if (uart_driver_install(uart_, kUartBufferSize, kUartBufferSize, 0, nullptr, 0) != ESP_OK) {
+        return false;
+    }
+    if (uart_param_config(uart_, &config) != ESP_OK ||
+        uart_set_pin(uart_, tx_pin_, rx_pin_, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE) != ESP_OK) {
+        uart_driver_delete(uart_);
+        return false;
+    }
+    // The bus idles high; let TX float so devices can pull it low
+    gpio_set_pull_mode(tx_pin_, GPIO_PULLUP_ONLY);
+
+    baud_ = kSlotBaud;
+    initialized_ = true;
+    return true;
+}
+
+void EspIdfUartOneWireBackend::end() {
+    if (!initialized_) {
+        return;
+    }
+    uart_driver_delete(uart_);
+    initialized_ = false;
+}
+
+bool EspIdfUartOneWireBackend::reset() {
+    if (!initialized_ || !set_baud(kResetBaud)) {
+        return false;
+    }
+
+    uart_flush_input(uart_);
+    uart_write_bytes(uart_, &kResetFrame, 1);
+
+    std::uint8_t echo = kResetFrame;
+    const int got = uart_read_bytes(uart_, &echo, 1, kReadTimeout);
+    set_baud(kSlotBaud);
+
+    // A presence pulse stretches the low part of the frame
+    return got == 1 && echo != kResetFrame;
+}
+
+bool EspIdfUartOneWireBackend::transfer_bits(const std::uint8_t* tx, std::uint8_t* rx, std::size_t nbits) {
+    if (!initialized_ || !tx) {
+        return false;
+    }
+
+    std::array<std::uint8_t, kMaxSlotsPerBurst> frames{};
+    std::size_t done = 0;
+    while (done < nbits) {
+        const std::size_t burst = (nbits - done) < kMaxSlotsPerBurst ? (nbits - done) : kMaxSlotsPerBurst;
+        for (std::size_t i = 0; i < burst; ++i) {
+            frames[i] = get_packed_bit(tx, done + i) ? kSlotOne : kSlotZero;
+        }
+
+        uart_flush_input(uart_);
+        uart_write_bytes(uart_, frames.data(), burst);
+        const int got = uart_read_bytes(uart_, frames.data(), burst, kReadTimeout);
+        if (got != static_cast<int>(burst)) {
+            return false;
+        }
+
+        if (rx) {
+            for (std::size_t i = 0; i < burst; ++i) {
+                set_packed_bit(rx, done + i, frames[i] == kSlotOne);
+            }
+        }
+        done += burst;
+    }
+    return true;
+}
+
+bool EspIdfUartOneWireBackend::set_baud(std::uint32_t baud) {
+    if (baud_ == baud) {
+        return true;
+    }
+    uart_wait_tx_done(uart_, kReadTimeout);
+    if (uart_set_baudrate(uart_, baud) != ESP_OK) {
+        return false;
+    }
+    baud_ = baud;
+    return true;
+}
+
+}  // namespace jenlib::onewire
+
+#else
+// Empty implementation for non-ESP platforms
+namespace jenlib::onewire {
+    // No implementation needed - constructors are deleted in header
+}
+
+#endif  // ESP_PLATFORM
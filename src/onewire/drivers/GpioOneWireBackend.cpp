@@ -0,0 +1,116 @@
+//! @file src/onewire/drivers/GpioOneWireBackend.cpp
+//! @brief Bit-banged OneWire backend implementation.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include <jenlib/onewire/drivers/GpioOneWireBackend.h>
+
+#if defined(ESP_PLATFORM)
+#include <rom/ets_sys.h>
+#elif defined(ARDUINO)
+#include <Arduino.h>
+#else
+#include <chrono>
+#endif
+
+namespace jenlib::onewire {
+
+namespace {
+// Standard-speed slot timings in microseconds (Maxim AN126).
+constexpr std::uint32_t kResetLowUs = 480;
+constexpr std::uint32_t kPresenceSampleUs = 70;
+constexpr std::uint32_t kResetRecoveryUs = 410;
+constexpr std::uint32_t kWriteOneLowUs = 6;
+constexpr std::uint32_t kWriteZeroLowUs = 60;
+constexpr std::uint32_t kWriteZeroRecoveryUs = 10;
+constexpr std::uint32_t kReadSampleUs = 9;
+constexpr std::uint32_t kReadRecoveryUs = 55;
+}  // namespace
+
+void platform_delay_us(std::uint32_t microseconds) {
+#if defined(ESP_PLATFORM)
+    ets_delay_us(microseconds);
+#elif defined(ARDUINO)
+    delayMicroseconds(microseconds);
+#else
+    // Spin rather than sleep; a sleep overshoots a 6 us slot by far
+    const auto end = std::chrono::steady_clock::now() + std::chrono::microseconds(microseconds);
+    while (std::chrono::steady_clock::now() < end) {
+    }
+#endif
+}
+
+bool GpioOneWireBackend::begin() {
+    GPIO::Pin gpio_pin(pin_);
+    gpio_pin.pinMode(GPIO::PinMode::OUTPUT);
+    gpio_pin.digitalWrite(GPIO::DigitalValue::HIGH);
+    return true;
+}
+
+void GpioOneWireBackend::end() {
+    GPIO::Pin(pin_).pinMode(GPIO::PinMode::INPUT_PULLUP);
+}
+
+bool GpioOneWireBackend::reset() {
+    GPIO::Pin gpio_pin(pin_);
+
+    gpio_pin.digitalWrite(GPIO::DigitalValue::LOW);
+    wait_us(kResetLowUs);
+
+    // Release the line and sample the presence pulse
+    gpio_pin.pinMode(GPIO::PinMode::INPUT_PULLUP);
+    wait_us(kPresenceSampleUs);
+    const bool presence = gpio_pin.digitalRead() == GPIO::DigitalValue::LOW;
+    wait_us(kResetRecoveryUs);
+
+    gpio_pin.pinMode(GPIO::PinMode::OUTPUT);
+    gpio_pin.digitalWrite(GPIO::DigitalValue::HIGH);
+
+    return presence;
+}
+
+bool GpioOneWireBackend::transfer_bits(const std::uint8_t* tx, std::uint8_t* rx, std::size_t nbits) {
+    if (!tx) {
+        return false;
+    }
+    for (std::size_t i = 0; i < nbits; ++i) {
+        const bool bit = get_packed_bit(tx, i);
+        const bool sampled = slot(bit);
+        if (rx) {
+            set_packed_bit(rx, i, sampled);
+        }
+    }
+    return true;
+}
+
+bool GpioOneWireBackend::slot(bool bit) {
+    GPIO::Pin gpio_pin(pin_);
+
+    if (!bit) {
+        // Write 0: hold low for the whole slot
+        gpio_pin.digitalWrite(GPIO::DigitalValue::LOW);
+        wait_us(kWriteZeroLowUs);
+        gpio_pin.digitalWrite(GPIO::DigitalValue::HIGH);
+        wait_us(kWriteZeroRecoveryUs);
+        return false;
+    }
+
+    // Write 1 / read: short low pulse, release, then sample
+    gpio_pin.digitalWrite(GPIO::DigitalValue::LOW);
+    wait_us(kWriteOneLowUs);
+    gpio_pin.pinMode(GPIO::PinMode::INPUT_PULLUP);
+    wait_us(kReadSampleUs);
+    const bool sampled = gpio_pin.digitalRead() == GPIO::DigitalValue::HIGH;
+    wait_us(kReadRecoveryUs);
+    gpio_pin.pinMode(GPIO::PinMode::OUTPUT);
+    gpio_pin.digitalWrite(GPIO::DigitalValue::HIGH);
+    return sampled;
+}
+
+void GpioOneWireBackend::wait_us(std::uint32_t microseconds) const {
+    if (delay_us_ && microseconds > 0) {
+        delay_us_(microseconds);
+    }
+}
+
+}  // namespace jenlib::onewire
@@ -0,0 +1,58 @@
+//! @file src/onewire/drivers/NativeOneWireBackend.cpp
+//! @brief Native loopback OneWire backend implementation.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#if !defined(ARDUINO) && !defined(ESP_PLATFORM)
+
+#include <jenlib/onewire/drivers/NativeOneWireBackend.h>
+
+namespace jenlib::onewire {
+
+bool NativeOneWireBackend::transfer_bits(const std::uint8_t* tx, std::uint8_t* rx, std::size_t nbits) {
+    if (!initialized_ || !tx) {
+        return false;
+    }
+    ++transfer_count_;
+
+    for (std::size_t i = 0; i < nbits; ++i) {
+        const bool host_bit = get_packed_bit(tx, i);
+        bool line = host_bit;
+        if (!device_bits_.empty()) {
+            line = line && device_bits_.front();
+            device_bits_.pop_front();
+        }
+        if (recording_) {
+            written_bits_.push_back(host_bit);
+        }
+        if (rx) {
+            set_packed_bit(rx, i, line);
+        }
+    }
+    return true;
+}
+
+void NativeOneWireBackend::queue_device_bytes(const std::uint8_t* data, std::size_t len) {
+    for (std::size_t i = 0; i < len * 8u; ++i) {
+        device_bits_.push_back(get_packed_bit(data, i));
+    }
+}
+
+std::vector<std::uint8_t> NativeOneWireBackend::written_bytes() const {
+    std::vector<std::uint8_t> out((written_bits_.size() + 7u) / 8u, 0);
+    for (std::size_t i = 0; i < written_bits_.size(); ++i) {
+        set_packed_bit(out.data(), i, written_bits_[i]);
+    }
+    return out;
+}
+
+void NativeOneWireBackend::clear() {
+    transfer_count_ = 0;
+    reset_count_ = 0;
+    written_bits_.clear();
+    device_bits_.clear();
+}
+
+}  // namespace jenlib::onewire
+
+#endif  // !ARDUINO && !ESP_PLATFORM
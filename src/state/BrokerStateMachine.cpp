@@ -158,9 +158,14 @@ void BrokerStateMachine::start_session(jenlib::ble::DeviceId sensor_id, jenlib::
     reading_count_ = 0;
     last_receipt_offset_ms_ = 0;
     session_active_ = true;
+    series_.clear();
+    aggregates_.clear();
+    quantiles_.reset();
+    link_quality_.reset();
 }
 
 void BrokerStateMachine::end_session() {
+    aggregates_.flush();  // The last bucket stays drainable until the next session starts
     session_active_ = false;
     current_session_id_ = jenlib::ble::SessionId(0);
     target_sensor_id_ = jenlib::ble::DeviceId(0);
@@ -176,6 +181,10 @@ void BrokerStateMachine::send_receipt(jenlib::ble::DeviceId sensor_id, std::uint
 
 void BrokerStateMachine::process_reading(const jenlib::ble::ReadingMsg& msg) {
     reading_count_++;
+    series_.append(msg);
+    aggregates_.add(msg);
+    quantiles_.add(msg);
+    link_quality_.add(msg, jenlib::time::Time::now());
 
     // Could implement receipt sending logic here
     // For now, just track the reading
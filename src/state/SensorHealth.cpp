@@ -0,0 +1,29 @@
+//! @file src/state/SensorHealth.cpp
+//! @brief Health counter sampling.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include <jenlib/state/SensorHealth.h>
+
+namespace jenlib::state {
+
+jenlib::ble::HealthCounters sample_health(const HealthSources& sources, std::uint32_t now_ms) {
+    jenlib::ble::HealthCounters counters;
+    counters.uptime_s = now_ms / 1000u;
+    if (sources.events) {
+        counters.event_evictions = sources.events->get_evicted_count();
+    }
+    if (sources.timers) {
+        counters.loop_overruns = sources.timers->get_missed_periods();
+    }
+    if (sources.radio) {
+        counters.inbox_drops = sources.radio->inbox_drops();
+    }
+    if (sources.journal) {
+        counters.retention_permille = sources.journal->fill_permille();
+    }
+    counters.battery_mv = sources.battery_mv;
+    return counters;
+}
+
+}  // namespace jenlib::state
@@ -15,7 +15,15 @@ SensorStateMachine::SensorStateMachine()
     , broker_id_(0)
     , measurement_interval_ms_(1000)
     , session_start_time_ms_(0)
-    , session_active_(false) {
+    , session_active_(false)
+    , reporting_mode_(ReportingMode::kPeriodic)
+    , adaptive_sampling_(false)
+    , fixed_interval_ms_(1000)
+    , last_sent_offset_ms_(0)
+    , acked_offset_ms_(0)
+    , cursor_flags_(0)
+    , resume_pending_(false)
+    , resume_offset_ms_(0) {
 }
 
 bool SensorStateMachine::handle_event(const jenlib::events::Event& event) {
@@ -42,6 +50,12 @@ bool SensorStateMachine::handle_event(const jenlib::events::Event& event) {
 
 bool SensorStateMachine::handle_connection_change(bool connected) {
     if (connected && is_in_state(SensorState::kDisconnected)) {
+        if (resume_pending_) {
+            // The broker still holds the session; skip the StartBroadcast round trip
+            resume_pending_ = false;
+            session_active_ = true;
+            return transition_to(SensorState::kWaiting) && transition_to(SensorState::kRunning);
+        }
         return transition_to(SensorState::kWaiting);
     } else if (!connected && !is_in_state(SensorState::kDisconnected)) {
         return transition_to(SensorState::kDisconnected);
@@ -66,7 +80,10 @@ bool SensorStateMachine::handle_receipt(jenlib::ble::DeviceId sender_id, const j
         return false;  // Can only receive receipts when running and session matches
     }
 
-    // Process receipt - could purge buffered readings here
+    if (!(cursor_flags_ & SessionSnapshot::kFlagHasAck) || msg.up_to_offset_ms > acked_offset_ms_) {
+        acked_offset_ms_ = msg.up_to_offset_ms;
+        cursor_flags_ |= SessionSnapshot::kFlagHasAck;
+    }
     return true;
 }
 
@@ -88,6 +105,132 @@ bool SensorStateMachine::handle_measurement_timer() {
     return true;
 }
 
+bool SensorStateMachine::handle_sampling_config(
+    jenlib::ble::DeviceId sender_id,
+    const jenlib::ble::SamplingConfigMsg& msg,
+    bool* interval_changed) {
+    (void)sender_id;
+    if (interval_changed) {
+        *interval_changed = false;
+    }
+    const bool for_this_session = is_in_state(SensorState::kRunning) && msg.session_id == current_session_id_;
+    if (!is_in_state(SensorState::kWaiting) && !for_this_session) {
+        return false;
+    }
+
+    if (!sampler_.set_bounds(msg.min_interval_ms, msg.max_interval_ms)) {
+        return false;
+    }
+    if (adaptive_sampling_ && sampler_.interval_ms() != measurement_interval_ms_) {
+        measurement_interval_ms_ = sampler_.interval_ms();
+        if (interval_changed) {
+            *interval_changed = true;
+        }
+    }
+    return true;
+}
+
+void SensorStateMachine::set_adaptive_sampling(const jenlib::measurement::AdaptiveSamplingConfig& config) {
+    if (!adaptive_sampling_) {
+        fixed_interval_ms_ = measurement_interval_ms_;
+    }
+    sampler_.configure(config);
+    sampler_.reset();
+    adaptive_sampling_ = true;
+    measurement_interval_ms_ = sampler_.interval_ms();
+}
+
+void SensorStateMachine::set_fixed_sampling() {
+    if (adaptive_sampling_) {
+        adaptive_sampling_ = false;
+        measurement_interval_ms_ = fixed_interval_ms_;
+    }
+}
+
+bool SensorStateMachine::update_measurement_interval(const jenlib::ble::ReadingMsg& reading) {
+    if (!adaptive_sampling_ || !is_in_state(SensorState::kRunning) || reading.session_id != current_session_id_) {
+        return false;
+    }
+
+    const std::uint32_t previous_interval_ms = measurement_interval_ms_;
+    measurement_interval_ms_ = sampler_.update(reading);
+    return measurement_interval_ms_ != previous_interval_ms;
+}
+
+void SensorStateMachine::set_send_on_delta_reporting(const jenlib::measurement::SendOnDeltaConfig& config) {
+    send_on_delta_.configure(config);
+    reporting_mode_ = ReportingMode::kSendOnDelta;
+}
+
+bool SensorStateMachine::should_broadcast(const jenlib::ble::ReadingMsg& reading) {
+    if (!is_in_state(SensorState::kRunning) || reading.session_id != current_session_id_) {
+        return false;
+    }
+    if (reporting_mode_ == ReportingMode::kSendOnDelta && !send_on_delta_.should_send(reading)) {
+        return false;
+    }
+    last_sent_offset_ms_ = reading.offset_ms;
+    cursor_flags_ |= SessionSnapshot::kFlagHasSent;
+    return true;
+}
+
+bool SensorStateMachine::snapshot(SessionSnapshot& out, jenlib::time::TimerId measurement_timer) const {
+    if (!is_in_state(SensorState::kRunning)) {
+        return false;
+    }
+
+    const std::uint32_t session_offset_ms = jenlib::time::Time::now() - session_start_time_ms_;
+    std::uint32_t fire_time_ms = 0;
+    out.session_id = current_session_id_;
+    out.broker_id = broker_id_;
+    out.measurement_interval_ms = measurement_interval_ms_;
+    out.session_offset_ms = session_offset_ms;
+    out.next_measurement_offset_ms = jenlib::time::Time::get_fire_time(measurement_timer, fire_time_ms)
+                                         ? fire_time_ms - session_start_time_ms_
+                                         : session_offset_ms + measurement_interval_ms_;
+    out.last_sent_offset_ms = last_sent_offset_ms_;
+    out.acked_offset_ms = acked_offset_ms_;
+    out.flags = cursor_flags_ | (adaptive_sampling_ ? SessionSnapshot::kFlagAdaptiveSampling : 0);
+    return true;
+}
+
+bool SensorStateMachine::restore(const SessionSnapshot& snapshot, std::uint32_t downtime_ms) {
+    if (!is_in_state(SensorState::kDisconnected) || snapshot.session_id == jenlib::ble::SessionId(0) ||
+        snapshot.measurement_interval_ms == 0) {
+        return false;
+    }
+
+    if (snapshot.flags & SessionSnapshot::kFlagAdaptiveSampling) {
+        if (!adaptive_sampling_) {
+            fixed_interval_ms_ = measurement_interval_ms_;
+        }
+        adaptive_sampling_ = true;
+        sampler_.resume(snapshot.measurement_interval_ms);
+        measurement_interval_ms_ = sampler_.interval_ms();
+    } else {
+        adaptive_sampling_ = false;
+        measurement_interval_ms_ = snapshot.measurement_interval_ms;
+    }
+    current_session_id_ = snapshot.session_id;
+    broker_id_ = snapshot.broker_id;
+    // Rebase the session start on the local clock so offsets carry on where they stopped
+    session_start_time_ms_ = jenlib::time::Time::now() - snapshot.session_offset_ms - downtime_ms;
+    last_sent_offset_ms_ = snapshot.last_sent_offset_ms;
+    acked_offset_ms_ = snapshot.acked_offset_ms;
+    cursor_flags_ = snapshot.flags & (SessionSnapshot::kFlagHasSent | SessionSnapshot::kFlagHasAck);
+    resume_offset_ms_ = snapshot.next_measurement_offset_ms;
+    resume_pending_ = true;
+    // The filter's reference reading was lost; the first reading after resume is always sent
+    send_on_delta_.reset();
+    return true;
+}
+
+std::uint32_t SensorStateMachine::get_resume_delay_ms() const {
+    const std::uint32_t session_offset_ms = jenlib::time::Time::now() - session_start_time_ms_;
+    const auto remaining = static_cast<std::int32_t>(resume_offset_ms_ - session_offset_ms);
+    return remaining > 0 ? static_cast<std::uint32_t>(remaining) : 0;
+}
+
 void SensorStateMachine::handle_error(std::string_view error_message) {
     StateMachine<SensorState>::handle_error(error_message);
     transition_to(SensorState::kError);
@@ -177,6 +320,17 @@ void SensorStateMachine::start_measurement_session(const jenlib::ble::StartBroad
     broker_id_ = msg.device_id;
     session_start_time_ms_ = jenlib::time::Time::now();
     session_active_ = true;
+    last_sent_offset_ms_ = 0;
+    acked_offset_ms_ = 0;
+    cursor_flags_ = 0;
+    resume_pending_ = false;
+    // First reading of every session is always sent
+    send_on_delta_.reset();
+    // Every session starts sampling at full rate
+    if (adaptive_sampling_) {
+        sampler_.reset();
+        measurement_interval_ms_ = sampler_.interval_ms();
+    }
 }
 
 void SensorStateMachine::stop_measurement_session() {
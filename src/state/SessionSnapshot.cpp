@@ -0,0 +1,71 @@
+//! @file src/state/SessionSnapshot.cpp
+//! @brief Session snapshot encoding and persistence.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include <jenlib/state/SessionSnapshot.h>
+#include <jenlib/storage/ByteOrder.h>
+#include <jenlib/storage/Crc32.h>
+
+namespace jenlib::state {
+
+using jenlib::storage::load_u32le;
+using jenlib::storage::store_u32le;
+
+namespace {
+constexpr std::size_t kCrcOffset = SessionSnapshot::kEncodedSize - 4;
+}  // namespace
+
+bool SessionSnapshot::serialize(const SessionSnapshot& snapshot, Buffer& out) {
+    std::uint8_t* p = out.data();
+    p[0] = static_cast<std::uint8_t>(kMagic);
+    p[1] = static_cast<std::uint8_t>(kMagic >> 8);
+    p[2] = kVersion;
+    p[3] = snapshot.flags;
+    store_u32le(p + 4, snapshot.session_id.value());
+    store_u32le(p + 8, snapshot.broker_id.value());
+    store_u32le(p + 12, snapshot.measurement_interval_ms);
+    store_u32le(p + 16, snapshot.session_offset_ms);
+    store_u32le(p + 20, snapshot.next_measurement_offset_ms);
+    store_u32le(p + 24, snapshot.last_sent_offset_ms);
+    store_u32le(p + 28, snapshot.acked_offset_ms);
+    store_u32le(p + kCrcOffset, jenlib::storage::crc32(p, kCrcOffset));
+    return true;
+}
+
+bool SessionSnapshot::deserialize(const std::uint8_t* data, std::size_t size, SessionSnapshot& out) {
+    if (size != kEncodedSize) {
+        return false;
+    }
+    if (data[0] != static_cast<std::uint8_t>(kMagic) || data[1] != static_cast<std::uint8_t>(kMagic >> 8)) {
+        return false;
+    }
+    if (data[2] != kVersion) {
+        return false;
+    }
+    if (load_u32le(data + kCrcOffset) != jenlib::storage::crc32(data, kCrcOffset)) {
+        return false;
+    }
+    out.flags = data[3];
+    out.session_id = jenlib::ble::SessionId(load_u32le(data + 4));
+    out.broker_id = jenlib::ble::DeviceId(load_u32le(data + 8));
+    out.measurement_interval_ms = load_u32le(data + 12);
+    out.session_offset_ms = load_u32le(data + 16);
+    out.next_measurement_offset_ms = load_u32le(data + 20);
+    out.last_sent_offset_ms = load_u32le(data + 24);
+    out.acked_offset_ms = load_u32le(data + 28);
+    return true;
+}
+
+bool SessionSnapshot::save(jenlib::storage::SnapshotStore& store, const SessionSnapshot& snapshot) {
+    Buffer buffer{};
+    return serialize(snapshot, buffer) && store.save(buffer.data(), buffer.size());
+}
+
+bool SessionSnapshot::load(jenlib::storage::SnapshotStore& store, SessionSnapshot& out) {
+    std::array<std::uint8_t, jenlib::storage::SnapshotStore::kMaxSnapshotSize> buffer{};
+    std::size_t size = 0;
+    return store.load(buffer.data(), size) && deserialize(buffer.data(), size, out);
+}
+
+}  // namespace jenlib::state
@@ -0,0 +1,38 @@
+//! @file src/storage/Crc32.cpp
+//! @brief Table-driven CRC-32.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include "jenlib/storage/Crc32.h"
+#include <array>
+
+namespace jenlib::storage {
+
+namespace {
+constexpr std::uint32_t kPolynomial = 0xEDB88320u;
+
+constexpr std::array<std::uint32_t, 256> make_table() {
+    std::array<std::uint32_t, 256> table{};
+    for (std::uint32_t i = 0; i < 256; ++i) {
+        std::uint32_t c = i;
+        for (int bit = 0; bit < 8; ++bit) {
+            c = (c & 1u) ? (c >> 1) ^ kPolynomial : c >> 1;
+        }
+        table[i] = c;
+    }
+    return table;
+}
+
+// 1 KiB in flash/rodata; built at compile time
+constexpr std::array<std::uint32_t, 256> kTable = make_table();
+}  // namespace
+
+std::uint32_t crc32(const std::uint8_t* data, std::size_t len, std::uint32_t crc) noexcept {
+    crc = ~crc;
+    for (std::size_t i = 0; i < len; ++i) {
+        crc = kTable[(crc ^ data[i]) & 0xFFu] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+}  // namespace jenlib::storage
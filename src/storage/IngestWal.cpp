@@ -0,0 +1,263 @@
+//! @file src/storage/IngestWal.cpp
+//! @brief Group-commit ingest log.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#if defined(__linux__) && !defined(ARDUINO) && !defined(ESP_PLATFORM)
+
+#include "jenlib/storage/IngestWal.h"
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include "jenlib/storage/ByteOrder.h"
+#include "jenlib/storage/Crc32.h"
+#include "jenlib/time/Time.h"
+
+namespace jenlib::storage {
+
+namespace {
+constexpr std::size_t kCrcOffset = IngestWal::kRecordSize - 4;
+
+void encode(const jenlib::ble::ReadingMsg& reading, std::uint8_t* out) {
+    store_u32le(out, reading.sender_id.value());
+    store_u32le(out + 4, reading.session_id.value());
+    store_u32le(out + 8, reading.offset_ms);
+    store_u16le(out + 12, static_cast<std::uint16_t>(reading.temperature_c_centi));
+    store_u16le(out + 14, reading.humidity_bp);
+    store_u32le(out + kCrcOffset, crc32(out, kCrcOffset));
+}
+
+bool decode(const std::uint8_t* in, jenlib::ble::ReadingMsg& out) {
+    if (load_u32le(in + kCrcOffset) != crc32(in, kCrcOffset)) {
+        return false;
+    }
+    out.sender_id = jenlib::ble::DeviceId(load_u32le(in));
+    out.session_id = jenlib::ble::SessionId(load_u32le(in + 4));
+    out.offset_ms = load_u32le(in + 8);
+    out.temperature_c_centi = static_cast<std::int16_t>(load_u16le(in + 12));
+    out.humidity_bp = load_u16le(in + 14);
+    return true;
+}
+}  // namespace
+
+IngestWal::IngestWal(WalCommitPolicy policy) {
+    set_policy(policy);
+}
+
+bool IngestWal::open(const char* path) {
+    close();
+    fd_ = ::open(path, O_RDWR | O_CREAT | O_APPEND, 0644);
+    if (fd_ < 0) {
+        return false;
+    }
+    streams_.fill(Stream{});
+    batch_records_ = 0;
+    durable_records_ = 0;
+    commit_count_ = 0;
+    truncated_bytes_ = 0;
+    failed_ = false;
+    if (!recover()) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void IngestWal::close() {
+    if (fd_ < 0) {
+        return;
+    }
+    commit();
+    ::close(fd_);
+    fd_ = -1;
+}
+
+void IngestWal::set_policy(WalCommitPolicy policy) {
+    if (policy.max_records == 0 || policy.max_records > kMaxBatchRecords) {
+        policy.max_records = kMaxBatchRecords;
+    }
+    policy_ = policy;
+}
+
+bool IngestWal::append(const jenlib::ble::ReadingMsg& reading) {
+    if (fd_ < 0 || failed_) {
+        return false;
+    }
+    Stream* stream = stream_for(reading.sender_id, reading.session_id);
+    if (stream == nullptr) {
+        return false;
+    }
+    if (batch_records_ == 0) {
+        batch_started_ms_ = jenlib::time::Time::now();
+    }
+    encode(reading, batch_.data() + batch_records_ * kRecordSize);
+    ++batch_records_;
+    stream->appended_offset_ms = reading.offset_ms;
+    stream->pending = true;
+    if (batch_records_ >= policy_.max_records) {
+        return commit();
+    }
+    return true;
+}
+
+bool IngestWal::poll() {
+    if (batch_records_ == 0 || jenlib::time::Time::now() - batch_started_ms_ < policy_.max_delay_ms) {
+        return true;
+    }
+    return commit();
+}
+
+bool IngestWal::commit() {
+    if (batch_records_ == 0) {
+        return true;
+    }
+    if (fd_ < 0 || failed_) {
+        return false;
+    }
+    const std::size_t size = batch_records_ * kRecordSize;
+    std::size_t written = 0;
+    while (written < size) {
+        const ssize_t result = ::write(fd_, batch_.data() + written, size - written);
+        if (result < 0 && errno == EINTR) {
+            continue;
+        }
+        if (result <= 0) {
+            // Drop any partial batch so a retry does not misalign the records; the batch stays buffered
+            if (ftruncate(fd_, static_cast<off_t>(durable_records_ * kRecordSize)) != 0) {
+                failed_ = true;  // Appends would land after the partial batch
+            }
+            return false;
+        }
+        written += static_cast<std::size_t>(result);
+    }
+    if (fdatasync(fd_) != 0) {
+        // The kernel may have dropped the dirty pages, so a later sync that succeeds proves nothing
+        failed_ = true;
+        return false;
+    }
+    durable_records_ += batch_records_;
+    batch_records_ = 0;
+    ++commit_count_;
+
+    for (auto& stream : streams_) {
+        if (!stream.active || !stream.pending) {
+            continue;
+        }
+        stream.pending = false;
+        stream.durable_offset_ms = stream.appended_offset_ms;
+        stream.has_durable = true;
+        if (durable_callback_) {
+            durable_callback_(stream.sensor, jenlib::ble::ReceiptMsg{stream.session, stream.durable_offset_ms});
+        }
+    }
+    return true;
+}
+
+bool IngestWal::clear() {
+    if (fd_ < 0 || !commit()) {
+        return false;
+    }
+    if (ftruncate(fd_, 0) != 0) {
+        return false;
+    }
+    if (fdatasync(fd_) != 0) {
+        failed_ = true;
+        return false;
+    }
+    durable_records_ = 0;
+    return true;
+}
+
+bool IngestWal::durable_offset(jenlib::ble::DeviceId sensor, jenlib::ble::SessionId session,
+                               std::uint32_t& offset_ms) const {
+    for (const auto& stream : streams_) {
+        if (stream.active && stream.has_durable && stream.sensor == sensor && stream.session == session) {
+            offset_ms = stream.durable_offset_ms;
+            return true;
+        }
+    }
+    return false;
+}
+
+IngestWal::Stream* IngestWal::stream_for(jenlib::ble::DeviceId sensor, jenlib::ble::SessionId session) {
+    Stream* victim = &streams_[0];
+    for (auto& stream : streams_) {
+        if (stream.active && stream.sensor == sensor && stream.session == session) {
+            stream.last_used = ++use_counter_;
+            return &stream;
+        }
+        if (!stream.active) {
+            victim = victim->active ? &stream : victim;
+        } else if (victim->active && stream.last_used < victim->last_used) {
+            victim = &stream;
+        }
+    }
+    if (victim->active && victim->pending && !commit()) {
+        return nullptr;  // Its receipt must go out before the slot is reused
+    }
+    *victim = Stream{};
+    victim->sensor = sensor;
+    victim->session = session;
+    victim->active = true;
+    victim->last_used = ++use_counter_;
+    return victim;
+}
+
+bool IngestWal::recover() {
+    if (lseek(fd_, 0, SEEK_SET) < 0) {
+        return false;
+    }
+    // The batch buffer is idle during recovery; it holds a whole number of records
+    std::uint64_t valid_bytes = 0;
+    std::size_t filled = 0;
+    bool torn = false;
+    while (!torn) {
+        const ssize_t result = ::read(fd_, batch_.data() + filled, batch_.size() - filled);
+        if (result < 0) {
+            return false;
+        }
+        filled += static_cast<std::size_t>(result);
+        const std::size_t records = filled / kRecordSize;
+        for (std::size_t i = 0; i < records; ++i) {
+            jenlib::ble::ReadingMsg reading;
+            if (!decode(batch_.data() + i * kRecordSize, reading)) {
+                torn = true;
+                break;
+            }
+            // Nothing is pending during recovery, so a slot is always found
+            Stream* stream = stream_for(reading.sender_id, reading.session_id);
+            stream->appended_offset_ms = reading.offset_ms;
+            stream->durable_offset_ms = reading.offset_ms;
+            stream->has_durable = true;
+            valid_bytes += kRecordSize;
+            ++durable_records_;
+        }
+        if (result == 0 || torn) {
+            break;
+        }
+        // Keep a partial record for the next read
+        const std::size_t consumed = records * kRecordSize;
+        for (std::size_t i = consumed; i < filled; ++i) {
+            batch_[i - consumed] = batch_[i];
+        }
+        filled -= consumed;
+    }
+
+    struct stat info {};
+    if (fstat(fd_, &info) != 0) {
+        return false;
+    }
+    const auto file_size = static_cast<std::uint64_t>(info.st_size);
+    if (file_size > valid_bytes) {
+        truncated_bytes_ = file_size - valid_bytes;
+        if (ftruncate(fd_, static_cast<off_t>(valid_bytes)) != 0 || fdatasync(fd_) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace jenlib::storage
+
+#endif  // __linux__ && !ARDUINO && !ESP_PLATFORM
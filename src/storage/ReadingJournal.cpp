@@ -0,0 +1,274 @@
+//! @file src/storage/ReadingJournal.cpp
+//! @brief Log-structured reading journal.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include "jenlib/storage/ReadingJournal.h"
+#include <array>
+#include "jenlib/storage/ByteOrder.h"
+#include "jenlib/storage/Crc32.h"
+
+namespace jenlib::storage {
+
+namespace {
+constexpr std::uint32_t kPageMagic = 0x4C4E524Au;  // "JRNL"
+constexpr std::size_t kHeaderCrcOffset = ReadingJournal::kPageHeaderSize - 4;
+constexpr std::size_t kRecordCrcOffset = ReadingJournal::kRecordSize - 4;
+
+//! @brief Decoded page header.
+struct PageHeader {
+    std::uint32_t sequence{0};
+    jenlib::ble::SessionId acked_session{0};
+    std::uint32_t acked_offset_ms{0};
+    jenlib::ble::SessionId last_session{0};
+    std::uint32_t head_sequence{0};
+};
+
+using HeaderBytes = std::array<std::uint8_t, ReadingJournal::kPageHeaderSize>;
+using RecordBytes = std::array<std::uint8_t, ReadingJournal::kRecordSize>;
+
+bool read_header(JournalStorage& storage, std::size_t sector, PageHeader& out) {
+    HeaderBytes bytes;
+    const std::uint64_t address = static_cast<std::uint64_t>(sector) * storage.sector_size();
+    if (!storage.read(address, bytes.data(), bytes.size()) || load_u32le(bytes.data()) != kPageMagic ||
+        load_u32le(bytes.data() + kHeaderCrcOffset) != crc32(bytes.data(), kHeaderCrcOffset)) {
+        return false;
+    }
+    out.sequence = load_u32le(bytes.data() + 4);
+    out.acked_session = jenlib::ble::SessionId(load_u32le(bytes.data() + 8));
+    out.acked_offset_ms = load_u32le(bytes.data() + 12);
+    out.last_session = jenlib::ble::SessionId(load_u32le(bytes.data() + 16));
+    out.head_sequence = load_u32le(bytes.data() + 20);
+    return true;
+}
+}  // namespace
+
+bool ReadingJournal::open() {
+    sector_count_ = storage_.sector_count();
+    const std::size_t sector_size = storage_.sector_size();
+    if (sector_count_ < 2 || sector_size < kPageHeaderSize + kRecordSize) {
+        return false;  // Need a page to fill while another holds unacknowledged readings
+    }
+    records_per_page_ = (sector_size - kPageHeaderSize) / kRecordSize;
+    live_pages_ = 0;
+    corrupt_records_ = 0;
+
+    // Header scan: the newest sequence is the tail
+    bool found = false;
+    PageHeader tail_header;
+    for (std::size_t sector = 0; sector < sector_count_; ++sector) {
+        PageHeader header;
+        if (read_header(storage_, sector, header) && (!found || header.sequence > tail_header.sequence)) {
+            tail_ = sector;
+            tail_header = header;
+            found = true;
+        }
+    }
+    if (!found) {
+        tail_sequence_ = 0;
+        return format();
+    }
+    tail_sequence_ = tail_header.sequence;
+    acked_session_ = tail_header.acked_session;
+    acked_offset_ms_ = tail_header.acked_offset_ms;
+    last_session_ = tail_header.last_session;
+
+    // Only the tail page is scanned, for the write position and later receipts
+    std::uint32_t head_sequence = tail_header.head_sequence;
+    write_slot_ = records_per_page_;
+    for (std::size_t slot = 0; slot < records_per_page_; ++slot) {
+        Record record;
+        const SlotState state = read_slot(tail_, slot, record);
+        if (state == SlotState::kEmpty) {
+            write_slot_ = slot;
+            break;
+        }
+        if (state == SlotState::kCorrupt) {
+            ++corrupt_records_;
+        } else if (record.kind == RecordKind::kReceipt) {
+            acked_session_ = record.reading.session_id;
+            acked_offset_ms_ = record.reading.offset_ms;
+            head_sequence = record.reading.sender_id.value();
+        } else {
+            last_session_ = record.reading.session_id;
+        }
+    }
+
+    // Released pages keep their headers until reused; the head is the oldest page not yet released
+    head_ = tail_;
+    std::uint32_t oldest = tail_sequence_;
+    for (std::size_t sector = 0; sector < sector_count_; ++sector) {
+        PageHeader header;
+        if (read_header(storage_, sector, header) && header.sequence >= head_sequence && header.sequence < oldest) {
+            head_ = sector;
+            oldest = header.sequence;
+        }
+    }
+    live_pages_ = (tail_ + sector_count_ - head_) % sector_count_ + 1;
+    return true;
+}
+
+bool ReadingJournal::format() {
+    // Every valid header must go, or its sequence would outrank the new pages
+    for (std::size_t sector = 0; sector < sector_count_; ++sector) {
+        PageHeader header;
+        if (read_header(storage_, sector, header) && !storage_.erase_sector(sector)) {
+            return false;
+        }
+    }
+    live_pages_ = 0;
+    head_ = 0;
+    write_slot_ = 0;
+    last_session_ = jenlib::ble::SessionId(0);
+    acked_session_ = jenlib::ble::SessionId(0);
+    acked_offset_ms_ = 0;
+    return open_page();
+}
+
+bool ReadingJournal::append(const jenlib::ble::ReadingMsg& reading) {
+    // Set first so a new page records the new session and older sessions become reclaimable
+    last_session_ = reading.session_id;
+    return write_record(Record{RecordKind::kReading, reading});
+}
+
+bool ReadingJournal::truncate(const jenlib::ble::ReceiptMsg& receipt) {
+    if (receipt.session_id == acked_session_ && receipt.up_to_offset_ms <= acked_offset_ms_) {
+        return true;
+    }
+    acked_session_ = receipt.session_id;
+    acked_offset_ms_ = receipt.up_to_offset_ms;
+    reclaim(sector_count_);
+    return write_record(Record{RecordKind::kReceipt,
+                               jenlib::ble::ReadingMsg{jenlib::ble::DeviceId(0), receipt.session_id,
+                                                       receipt.up_to_offset_ms, 0, 0}});
+}
+
+std::size_t ReadingJournal::replay(jenlib::ble::SessionId session, const ReplayCallback& callback) {
+    std::size_t delivered = 0;
+    std::size_t sector = head_;
+    for (std::size_t page = 0; page < live_pages_; ++page, sector = next_sector(sector)) {
+        PageHeader header;
+        if (!read_header(storage_, sector, header)) {
+            continue;
+        }
+        const std::size_t slots = sector == tail_ ? write_slot_ : records_per_page_;
+        for (std::size_t slot = 0; slot < slots; ++slot) {
+            Record record;
+            const SlotState state = read_slot(sector, slot, record);
+            if (state == SlotState::kEmpty) {
+                break;
+            }
+            if (state != SlotState::kValid || record.kind != RecordKind::kReading ||
+                record.reading.session_id != session || is_acked(record.reading)) {
+                continue;
+            }
+            ++delivered;
+            if (!callback(record.reading)) {
+                return delivered;
+            }
+        }
+    }
+    return delivered;
+}
+
+ReadingJournal::SlotState ReadingJournal::read_slot(std::size_t sector, std::size_t slot, Record& out) {
+    RecordBytes bytes;
+    if (!storage_.read(slot_address(sector, slot), bytes.data(), bytes.size())) {
+        return SlotState::kCorrupt;
+    }
+    bool erased = true;
+    for (const std::uint8_t byte : bytes) {
+        erased = erased && byte == 0xFF;
+    }
+    if (erased) {
+        return SlotState::kEmpty;
+    }
+    if (load_u32le(bytes.data() + kRecordCrcOffset) != crc32(bytes.data(), kRecordCrcOffset) ||
+        (bytes[0] != static_cast<std::uint8_t>(RecordKind::kReading) &&
+         bytes[0] != static_cast<std::uint8_t>(RecordKind::kReceipt))) {
+        return SlotState::kCorrupt;
+    }
+    out.kind = static_cast<RecordKind>(bytes[0]);
+    out.reading.temperature_c_centi = static_cast<std::int16_t>(load_u16le(bytes.data() + 2));
+    out.reading.humidity_bp = load_u16le(bytes.data() + 4);
+    out.reading.sender_id = jenlib::ble::DeviceId(load_u32le(bytes.data() + 8));
+    out.reading.session_id = jenlib::ble::SessionId(load_u32le(bytes.data() + 12));
+    out.reading.offset_ms = load_u32le(bytes.data() + 16);
+    return SlotState::kValid;
+}
+
+bool ReadingJournal::write_record(const Record& record) {
+    if (live_pages_ == 0 || write_slot_ >= records_per_page_) {
+        if (!open_page()) {
+            return false;
+        }
+    }
+    RecordBytes bytes{};
+    bytes[0] = static_cast<std::uint8_t>(record.kind);
+    store_u16le(bytes.data() + 2, static_cast<std::uint16_t>(record.reading.temperature_c_centi));
+    store_u16le(bytes.data() + 4, record.reading.humidity_bp);
+    // A receipt has no sender; it records where reclaim() has moved the head instead
+    const bool receipt = record.kind == RecordKind::kReceipt;
+    store_u32le(bytes.data() + 8, receipt ? head_sequence() : record.reading.sender_id.value());
+    store_u32le(bytes.data() + 12, record.reading.session_id.value());
+    store_u32le(bytes.data() + 16, record.reading.offset_ms);
+    store_u32le(bytes.data() + kRecordCrcOffset, crc32(bytes.data(), kRecordCrcOffset));
+    if (!storage_.write(slot_address(tail_, write_slot_), bytes.data(), bytes.size())) {
+        return false;
+    }
+    ++write_slot_;
+    return true;
+}
+
+bool ReadingJournal::open_page() {
+    if (live_pages_ == sector_count_) {
+        // One page is enough; releasing a long stale run here would stall this append
+        reclaim(1);
+        if (live_pages_ == sector_count_) {
+            return false;  // Full of unacknowledged readings
+        }
+    }
+    const std::size_t sector = live_pages_ == 0 ? head_ : next_sector(tail_);
+    HeaderBytes bytes{};
+    store_u32le(bytes.data(), kPageMagic);
+    store_u32le(bytes.data() + 4, tail_sequence_ + 1);
+    store_u32le(bytes.data() + 8, acked_session_.value());
+    store_u32le(bytes.data() + 12, acked_offset_ms_);
+    store_u32le(bytes.data() + 16, last_session_.value());
+    store_u32le(bytes.data() + 20, head_sequence());
+    store_u32le(bytes.data() + kHeaderCrcOffset, crc32(bytes.data(), kHeaderCrcOffset));
+    const std::uint64_t address = static_cast<std::uint64_t>(sector) * storage_.sector_size();
+    if (!storage_.erase_sector(sector) || !storage_.write(address, bytes.data(), bytes.size())) {
+        return false;
+    }
+    if (live_pages_ == 0) {
+        head_ = sector;
+    }
+    tail_ = sector;
+    ++tail_sequence_;
+    ++live_pages_;
+    write_slot_ = 0;
+    return true;
+}
+
+void ReadingJournal::reclaim(std::size_t max_pages) {
+    // The tail page stays; it is still being filled
+    for (; max_pages > 0 && live_pages_ > 1 && is_reclaimable(head_); --max_pages) {
+        head_ = next_sector(head_);
+        --live_pages_;
+    }
+}
+
+bool ReadingJournal::is_reclaimable(std::size_t sector) {
+    // Readings are appended in offset order, so the page's last reading decides
+    for (std::size_t slot = records_per_page_; slot-- > 0;) {
+        Record record;
+        if (read_slot(sector, slot, record) != SlotState::kValid || record.kind != RecordKind::kReading) {
+            continue;
+        }
+        return record.reading.session_id != last_session_ || is_acked(record.reading);
+    }
+    return true;
+}
+
+}  // namespace jenlib::storage
@@ -0,0 +1,627 @@
+//! @file src/storage/SessionArchive.cpp
+//! @brief Session archive writer, reader and compaction.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#if defined(__linux__) && !defined(ARDUINO) && !defined(ESP_PLATFORM)
+
+#include "jenlib/storage/SessionArchive.h"
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include "jenlib/storage/ByteOrder.h"
+#include "jenlib/storage/Crc32.h"
+#include "jenlib/storage/Varint.h"
+
+namespace jenlib::storage {
+
+namespace {
+using namespace archive;  // NOLINT(build/namespaces)
+
+constexpr std::uint16_t kSegmentCompacted = 0x0001;  // Segment header flag
+constexpr std::uint32_t kTrailerFinal = 0x0001;      // Last segment of a compaction
+
+//! @brief Block header fields.
+struct BlockHeader {
+    std::uint32_t sensor{0};
+    std::uint32_t session{0};
+    std::uint32_t count{0};
+    std::uint64_t base_time_ms{0};
+    std::uint32_t first_offset_ms{0};
+    std::uint32_t last_offset_ms{0};
+    std::uint32_t index_count{0};
+    std::uint32_t column_bytes[3]{};
+};
+
+void store_u64le(std::uint8_t* out, std::uint64_t value) {
+    store_u32le(out, static_cast<std::uint32_t>(value));
+    store_u32le(out + 4, static_cast<std::uint32_t>(value >> 32));
+}
+
+std::uint64_t load_u64le(const std::uint8_t* in) {
+    return load_u32le(in) | (static_cast<std::uint64_t>(load_u32le(in + 4)) << 32);
+}
+
+void append_varint(std::vector<std::uint8_t>& out, std::uint32_t value) {
+    std::uint8_t bytes[kMaxVarintSize];
+    out.insert(out.end(), bytes, bytes + put_varint(value, bytes));
+}
+
+BlockHeader read_block_header(const std::uint8_t* block) {
+    BlockHeader header;
+    header.sensor = load_u32le(block + 4);
+    header.session = load_u32le(block + 8);
+    header.count = load_u32le(block + 12);
+    header.base_time_ms = load_u64le(block + 16);
+    header.first_offset_ms = load_u32le(block + 24);
+    header.last_offset_ms = load_u32le(block + 28);
+    header.index_count = load_u32le(block + 32);
+    header.column_bytes[0] = load_u32le(block + 36);
+    header.column_bytes[1] = load_u32le(block + 40);
+    header.column_bytes[2] = load_u32le(block + 44);
+    return header;
+}
+
+std::uint64_t block_size(const BlockHeader& header) {
+    return kBlockHeaderSize + static_cast<std::uint64_t>(header.index_count) * kIndexEntrySize +
+           header.column_bytes[0] + header.column_bytes[1] + header.column_bytes[2];
+}
+
+std::uint32_t block_crc(const std::uint8_t* block, const BlockHeader& header) {
+    const std::uint32_t crc = crc32(block, 48);
+    return crc32(block + kBlockHeaderSize, static_cast<std::size_t>(block_size(header) - kBlockHeaderSize), crc);
+}
+
+//! @brief Whether the @p limit bytes at @p block hold a well-formed block whose CRC holds.
+//! @details Bounds every size and offset a decode will follow before the CRC is computed.
+bool check_block(const std::uint8_t* block, std::uint64_t limit) {
+    if (limit < kBlockHeaderSize || load_u32le(block) != kBlockMagic) {
+        return false;
+    }
+    const BlockHeader header = read_block_header(block);
+    if (header.count == 0 || header.count > kBlockRows ||
+        header.index_count != (header.count + kIndexStride - 1) / kIndexStride || block_size(header) > limit) {
+        return false;
+    }
+    for (std::uint32_t i = 0; i < header.index_count; ++i) {
+        const std::uint8_t* e = block + kBlockHeaderSize + static_cast<std::size_t>(i) * kIndexEntrySize;
+        if (load_u32le(e) != i * kIndexStride || load_u32le(e + 12) > header.column_bytes[0] ||
+            load_u32le(e + 16) > header.column_bytes[1] || load_u32le(e + 20) > header.column_bytes[2]) {
+            return false;
+        }
+    }
+    return block_crc(block, header) == load_u32le(block + 48);
+}
+
+std::string segment_path(const std::string& directory, std::uint32_t number) {
+    char name[32];
+    std::snprintf(name, sizeof(name), "/segment-%08u.jsa", number);
+    return directory + name;
+}
+
+//! @brief Segment numbers present in @p directory, ascending.
+std::vector<std::uint32_t> list_segments(const std::string& directory) {
+    std::vector<std::uint32_t> numbers;
+    DIR* dir = opendir(directory.c_str());
+    if (!dir) {
+        return numbers;
+    }
+    while (const dirent* entry = readdir(dir)) {
+        unsigned number = 0;
+        char tail = 0;
+        if (std::sscanf(entry->d_name, "segment-%8u.js%c", &number, &tail) == 2 && tail == 'a' &&
+            std::strlen(entry->d_name) == 20) {
+            numbers.push_back(number);
+        }
+    }
+    closedir(dir);
+    std::sort(numbers.begin(), numbers.end());
+    return numbers;
+}
+
+bool sync_directory(const std::string& directory) {
+    const int fd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY);
+    if (fd < 0) {
+        return false;
+    }
+    const bool ok = fsync(fd) == 0;
+    ::close(fd);
+    return ok;
+}
+}  // namespace
+
+// ---------------------------------------------------------------------------
+// ArchiveWriter
+
+bool ArchiveWriter::open(const std::string& directory, std::uint64_t max_segment_bytes) {
+    close();
+    if (mkdir(directory.c_str(), 0755) != 0 && errno != EEXIST) {
+        return false;
+    }
+    const std::vector<std::uint32_t> existing = list_segments(directory);
+    directory_ = directory;
+    max_segment_bytes_ = max_segment_bytes;
+    next_segment_ = existing.empty() ? 1 : existing.back() + 1;
+    blocks_written_ = 0;
+    open_ = true;
+    return true;
+}
+
+bool ArchiveWriter::add(std::uint64_t session_start_ms, const jenlib::ble::ReadingMsg& reading) {
+    if (!open_) {
+        return false;
+    }
+    auto it = std::find_if(streams_.begin(), streams_.end(), [&reading](const Stream& stream) {
+        return stream.sensor == reading.sender_id && stream.session == reading.session_id;
+    });
+    if (it == streams_.end()) {
+        streams_.push_back(Stream{reading.sender_id, reading.session_id, session_start_ms, {}});
+        it = streams_.end() - 1;
+        it->rows.reserve(kBlockRows);
+    }
+    it->rows.push_back(reading);
+    return it->rows.size() < kBlockRows || write_block(*it);
+}
+
+bool ArchiveWriter::flush() {
+    bool ok = true;
+    for (auto& stream : streams_) {
+        ok = write_block(stream) && ok;
+    }
+    streams_.clear();
+    return ok;
+}
+
+bool ArchiveWriter::close() {
+    if (!open_) {
+        return true;
+    }
+    bool ok = flush();
+    if (fd_ >= 0) {
+        ok = seal(true) && ok;
+    }
+    open_ = false;
+    replaces_through_ = 0;
+    return ok;
+}
+
+bool ArchiveWriter::write_block(Stream& stream) {
+    const std::size_t count = stream.rows.size();
+    if (count == 0) {
+        return true;
+    }
+    if (fd_ < 0 && !begin_segment()) {
+        return false;
+    }
+
+    // Columns hold deltas from the previous row; index entries hold absolute values
+    std::vector<std::uint8_t> columns[3];
+    std::vector<std::uint8_t> index;
+    for (std::size_t row = 0; row < count; ++row) {
+        const jenlib::ble::ReadingMsg& reading = stream.rows[row];
+        if (row > 0) {
+            const jenlib::ble::ReadingMsg& previous = stream.rows[row - 1];
+            append_varint(columns[0], zigzag(static_cast<std::int32_t>(reading.offset_ms - previous.offset_ms)));
+            append_varint(columns[1], zigzag(reading.temperature_c_centi - previous.temperature_c_centi));
+            append_varint(columns[2], zigzag(reading.humidity_bp - previous.humidity_bp));
+        }
+        if (row % kIndexStride == 0) {
+            std::uint8_t entry[kIndexEntrySize];
+            store_u32le(entry, static_cast<std::uint32_t>(row));
+            store_u32le(entry + 4, reading.offset_ms);
+            store_u16le(entry + 8, static_cast<std::uint16_t>(reading.temperature_c_centi));
+            store_u16le(entry + 10, reading.humidity_bp);
+            store_u32le(entry + 12, static_cast<std::uint32_t>(columns[0].size()));
+            store_u32le(entry + 16, static_cast<std::uint32_t>(columns[1].size()));
+            store_u32le(entry + 20, static_cast<std::uint32_t>(columns[2].size()));
+            index.insert(index.end(), entry, entry + kIndexEntrySize);
+        }
+    }
+
+    buffer_.assign(kBlockHeaderSize, 0);
+    std::uint8_t* header = buffer_.data();
+    store_u32le(header, kBlockMagic);
+    store_u32le(header + 4, stream.sensor.value());
+    store_u32le(header + 8, stream.session.value());
+    store_u32le(header + 12, static_cast<std::uint32_t>(count));
+    store_u64le(header + 16, stream.base_time_ms);
+    store_u32le(header + 24, stream.rows.front().offset_ms);
+    store_u32le(header + 28, stream.rows.back().offset_ms);
+    store_u32le(header + 32, static_cast<std::uint32_t>(index.size() / kIndexEntrySize));
+    for (int c = 0; c < 3; ++c) {
+        store_u32le(header + 36 + 4 * c, static_cast<std::uint32_t>(columns[c].size()));
+    }
+    buffer_.insert(buffer_.end(), index.begin(), index.end());
+    for (const auto& column : columns) {
+        buffer_.insert(buffer_.end(), column.begin(), column.end());
+    }
+    store_u32le(buffer_.data() + 48, block_crc(buffer_.data(), read_block_header(buffer_.data())));
+
+    const std::uint64_t position = position_;
+    if (!write_all(buffer_.data(), buffer_.size())) {
+        return false;
+    }
+    directory_entries_.push_back(DirectoryEntry{stream.sensor, stream.session, stream.base_time_ms,
+                                                stream.rows.front().offset_ms, stream.rows.back().offset_ms,
+                                                position, static_cast<std::uint32_t>(count)});
+    stream.rows.clear();
+    ++blocks_written_;
+    return position_ < max_segment_bytes_ || seal(false);
+}
+
+bool ArchiveWriter::begin_segment() {
+    fd_ = ::open(segment_path(directory_, next_segment_).c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd_ < 0) {
+        return false;
+    }
+    ++next_segment_;
+    position_ = 0;
+    directory_entries_.clear();
+    std::uint8_t header[kSegmentHeaderSize];
+    store_u32le(header, kSegmentMagic);
+    store_u16le(header + 4, kVersion);
+    store_u16le(header + 6, replaces_through_ ? kSegmentCompacted : 0);
+    store_u32le(header + 8, next_segment_ - 1);
+    store_u32le(header + 12, replaces_through_);
+    return write_all(header, sizeof(header));
+}
+
+bool ArchiveWriter::seal(bool final_segment) {
+    if (fd_ < 0) {
+        return true;
+    }
+    const std::uint64_t directory_position = position_;
+    buffer_.assign(directory_entries_.size() * kDirectoryEntrySize + kTrailerSize, 0);
+    std::uint8_t* out = buffer_.data();
+    for (const auto& entry : directory_entries_) {
+        store_u32le(out, entry.sensor.value());
+        store_u32le(out + 4, entry.session.value());
+        store_u64le(out + 8, entry.base_time_ms);
+        store_u32le(out + 16, entry.first_offset_ms);
+        store_u32le(out + 20, entry.last_offset_ms);
+        store_u64le(out + 24, entry.position);
+        store_u32le(out + 32, entry.count);
+        out += kDirectoryEntrySize;
+    }
+    store_u64le(out, directory_position);
+    store_u32le(out + 8, static_cast<std::uint32_t>(directory_entries_.size()));
+    store_u32le(out + 12, crc32(buffer_.data(), directory_entries_.size() * kDirectoryEntrySize));
+    store_u32le(out + 16, final_segment ? kTrailerFinal : 0);
+    store_u32le(out + 20, kFooterMagic);
+    const bool ok = write_all(buffer_.data(), buffer_.size()) && fdatasync(fd_) == 0;
+    ::close(fd_);
+    fd_ = -1;
+    return ok && sync_directory(directory_);
+}
+
+bool ArchiveWriter::write_all(const std::uint8_t* data, std::size_t size) {
+    while (size > 0) {
+        const ssize_t result = ::write(fd_, data, size);
+        if (result < 0) {
+            return false;
+        }
+        data += result;
+        size -= static_cast<std::size_t>(result);
+        position_ += static_cast<std::uint64_t>(result);
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// ArchiveReader
+
+bool ArchiveReader::open(const std::string& directory) {
+    close();
+    struct Mapped {
+        Segment segment;
+        std::uint16_t flags{0};
+        std::uint32_t replaces_through{0};
+        bool final_segment{false};
+        std::vector<BlockRef> blocks;
+    };
+    std::vector<Mapped> mapped;
+    for (const std::uint32_t number : list_segments(directory)) {
+        last_segment_ = number;
+        const int fd = ::open(segment_path(directory, number).c_str(), O_RDONLY);
+        if (fd < 0) {
+            continue;
+        }
+        struct stat info {};
+        void* base = MAP_FAILED;
+        if (fstat(fd, &info) == 0 && info.st_size >= static_cast<off_t>(kSegmentHeaderSize)) {
+            base = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_SHARED, fd, 0);
+        }
+        ::close(fd);  // The mapping keeps the file alive
+        if (base == MAP_FAILED) {
+            continue;
+        }
+        // Queries jump between footers, indexes and column slices; read-around would pull in whole blocks
+        madvise(base, static_cast<std::size_t>(info.st_size), MADV_RANDOM);
+        Mapped segment;
+        segment.segment =
+            Segment{number, static_cast<const std::uint8_t*>(base), static_cast<std::size_t>(info.st_size)};
+        mapped_.push_back(segment.segment);
+        const std::uint8_t* data = segment.segment.base;
+        const std::size_t size = segment.segment.size;
+        if (load_u32le(data) != kSegmentMagic || load_u16le(data + 4) != kVersion) {
+            continue;
+        }
+        segment.flags = load_u16le(data + 6);
+        segment.replaces_through = load_u32le(data + 12);
+
+        const auto add_block = [&segment](const std::uint8_t* block, std::uint64_t limit, const BlockHeader& header,
+                                          BlockCheck check) {
+            BlockRef ref{block, jenlib::ble::DeviceId(header.sensor), jenlib::ble::SessionId(header.session),
+                         header.base_time_ms + header.first_offset_ms, header.base_time_ms + header.last_offset_ms};
+            ref.limit = limit;
+            ref.check = check;
+            segment.blocks.push_back(ref);
+        };
+
+        // Sealed: index the footer without touching block pages; each block is checked when first read
+        const std::uint8_t* trailer = data + size - kTrailerSize;
+        bool sealed = false;
+        if (size >= kSegmentHeaderSize + kTrailerSize && load_u32le(trailer + 20) == kFooterMagic) {
+            const std::uint64_t directory_position = load_u64le(trailer);
+            const std::uint32_t entries = load_u32le(trailer + 8);
+            const std::uint64_t directory_bytes = static_cast<std::uint64_t>(entries) * kDirectoryEntrySize;
+            sealed = directory_position + directory_bytes + kTrailerSize == size &&
+                     crc32(data + directory_position, directory_bytes) == load_u32le(trailer + 12);
+            for (std::uint32_t i = 0; sealed && i < entries; ++i) {
+                const std::uint8_t* entry = data + directory_position + i * kDirectoryEntrySize;
+                const std::uint64_t position = load_u64le(entry + 24);
+                if (position + kBlockHeaderSize > directory_position) {
+                    sealed = false;
+                    break;
+                }
+                BlockHeader header;
+                header.sensor = load_u32le(entry);
+                header.session = load_u32le(entry + 4);
+                header.base_time_ms = load_u64le(entry + 8);
+                header.first_offset_ms = load_u32le(entry + 16);
+                header.last_offset_ms = load_u32le(entry + 20);
+                add_block(data + position, directory_position - position, header, BlockCheck::kUnchecked);
+            }
+            segment.final_segment = sealed && (load_u32le(trailer + 16) & kTrailerFinal);
+        }
+        if (!sealed) {
+            // Unsealed: walk block headers and keep every block whose CRC holds
+            segment.blocks.clear();
+            std::uint64_t position = kSegmentHeaderSize;
+            while (position + kBlockHeaderSize <= size && load_u32le(data + position) == kBlockMagic) {
+                if (!check_block(data + position, size - position)) {
+                    break;
+                }
+                const BlockHeader header = read_block_header(data + position);
+                const std::uint64_t length = block_size(header);
+                add_block(data + position, length, header, BlockCheck::kGood);
+                position += length;
+            }
+        }
+        mapped.push_back(std::move(segment));
+    }
+
+    // A compaction counts once its last segment is sealed; it hides what it replaced
+    std::uint32_t replaced_through = 0;
+    for (const auto& segment : mapped) {
+        if ((segment.flags & kSegmentCompacted) && segment.final_segment) {
+            replaced_through = std::max(replaced_through, segment.replaces_through);
+        }
+    }
+    for (const auto& segment : mapped) {
+        const bool replaced = segment.segment.number <= replaced_through;
+        const bool unfinished = (segment.flags & kSegmentCompacted) && segment.replaces_through > replaced_through;
+        if (replaced) {
+            replaced_.push_back(segment.segment.number);
+        }
+        if (replaced || unfinished) {
+            continue;
+        }
+        segments_.push_back(segment.segment);
+        blocks_.insert(blocks_.end(), segment.blocks.begin(), segment.blocks.end());
+    }
+    std::stable_sort(blocks_.begin(), blocks_.end(), [](const BlockRef& a, const BlockRef& b) {
+        return a.sensor.value() != b.sensor.value() ? a.sensor.value() < b.sensor.value()
+                                                    : a.first_time_ms < b.first_time_ms;
+    });
+    for (std::size_t i = 0; i < blocks_.size(); ++i) {
+        const bool same_sensor = i > 0 && blocks_[i - 1].sensor == blocks_[i].sensor;
+        blocks_[i].reach_ms = same_sensor ? std::max(blocks_[i - 1].reach_ms, blocks_[i].last_time_ms)
+                                          : blocks_[i].last_time_ms;
+    }
+    return true;
+}
+
+void ArchiveReader::close() {
+    for (const auto& segment : mapped_) {
+        munmap(const_cast<std::uint8_t*>(segment.base), segment.size);
+    }
+    mapped_.clear();
+    segments_.clear();
+    blocks_.clear();
+    replaced_.clear();
+    last_segment_ = 0;
+}
+
+std::vector<std::uint32_t> ArchiveReader::segment_numbers() const {
+    std::vector<std::uint32_t> numbers;
+    for (const auto& segment : segments_) {
+        numbers.push_back(segment.number);
+    }
+    return numbers;
+}
+
+std::size_t ArchiveReader::query(jenlib::ble::DeviceId sensor, std::uint64_t from_ms, std::uint64_t to_ms,
+                                 const RowCallback& callback) const {
+    // reach_ms only grows within a sensor, so both keys bisect: skip blocks that all end before from_ms
+    const auto before = [sensor, from_ms](const BlockRef& ref) {
+        return ref.sensor.value() < sensor.value() || (ref.sensor == sensor && ref.reach_ms < from_ms);
+    };
+    auto it = std::partition_point(blocks_.begin(), blocks_.end(), before);
+    std::size_t delivered = 0;
+    bool stop = false;
+    for (; it != blocks_.end() && it->sensor == sensor && !stop; ++it) {
+        if (it->first_time_ms > to_ms) {
+            break;  // Blocks of a sensor are sorted by start time
+        }
+        if (it->last_time_ms >= from_ms) {
+            delivered += read_block(*it, from_ms, to_ms, callback, stop);
+        }
+    }
+    return delivered;
+}
+
+std::size_t ArchiveReader::scan(const RowCallback& callback) const {
+    std::size_t delivered = 0;
+    bool stop = false;
+    for (auto it = blocks_.begin(); it != blocks_.end() && !stop; ++it) {
+        delivered += read_block(*it, 0, UINT64_MAX, callback, stop);
+    }
+    return delivered;
+}
+
+std::size_t ArchiveReader::verify() const {
+    std::size_t failed = 0;
+    for (const auto& ref : blocks_) {
+        if (!check_block(ref.block, ref.limit)) {
+            ++failed;
+        }
+    }
+    return failed;
+}
+
+std::size_t ArchiveReader::read_block(const BlockRef& ref, std::uint64_t from_ms, std::uint64_t to_ms,
+                                      const RowCallback& callback, bool& stop) const {
+    if (ref.check == BlockCheck::kUnchecked) {
+        ref.check = check_block(ref.block, ref.limit) ? BlockCheck::kGood : BlockCheck::kCorrupt;
+    }
+    if (ref.check == BlockCheck::kCorrupt) {
+        return 0;
+    }
+    const BlockHeader header = read_block_header(ref.block);
+    const std::uint8_t* index = ref.block + kBlockHeaderSize;
+    const std::uint8_t* column_base[3];
+    const std::uint8_t* column_end[3];
+    column_base[0] = index + static_cast<std::size_t>(header.index_count) * kIndexEntrySize;
+    column_end[0] = column_base[0] + header.column_bytes[0];
+    column_base[1] = column_end[0];
+    column_end[1] = column_base[1] + header.column_bytes[1];
+    column_base[2] = column_end[1];
+    column_end[2] = column_base[2] + header.column_bytes[2];
+
+    // Enter at the last index entry at or before the start of the range
+    const std::uint32_t from_offset =
+        from_ms > header.base_time_ms ? static_cast<std::uint32_t>(from_ms - header.base_time_ms) : 0;
+    std::uint32_t entry = 0;
+    std::uint32_t low = 0;
+    std::uint32_t high = header.index_count;
+    while (low < high) {
+        const std::uint32_t mid = (low + high) / 2;
+        if (load_u32le(index + mid * kIndexEntrySize + 4) <= from_offset) {
+            entry = mid;
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+
+    const std::uint8_t* e = index + entry * kIndexEntrySize;
+    std::uint32_t row = load_u32le(e);
+    ArchiveRow out;
+    out.sensor = ref.sensor;
+    out.session = ref.session;
+    out.offset_ms = load_u32le(e + 4);
+    out.temperature_c_centi = static_cast<std::int16_t>(load_u16le(e + 8));
+    out.humidity_bp = load_u16le(e + 10);
+    const std::uint8_t* cursor[3] = {column_base[0] + load_u32le(e + 12), column_base[1] + load_u32le(e + 16),
+                                     column_base[2] + load_u32le(e + 20)};
+    std::size_t delivered = 0;
+    while (true) {
+        out.time_ms = header.base_time_ms + out.offset_ms;
+        if (out.time_ms > to_ms) {
+            break;
+        }
+        if (out.time_ms >= from_ms) {
+            ++delivered;
+            if (!callback(out)) {
+                stop = true;
+                break;
+            }
+        }
+        if (++row >= header.count) {
+            break;
+        }
+        std::uint32_t delta[3];
+        for (int c = 0; c < 3; ++c) {
+            if (!get_varint(cursor[c], column_end[c], delta[c])) {
+                return delivered;  // Column shorter than the row count
+            }
+        }
+        out.offset_ms += static_cast<std::uint32_t>(unzigzag(delta[0]));
+        out.temperature_c_centi = static_cast<std::int16_t>(out.temperature_c_centi + unzigzag(delta[1]));
+        out.humidity_bp = static_cast<std::uint16_t>(out.humidity_bp + unzigzag(delta[2]));
+    }
+    return delivered;
+}
+
+// ---------------------------------------------------------------------------
+// Compaction
+
+bool compact_archive(const std::string& directory) {
+    ArchiveReader reader;
+    if (!reader.open(directory)) {
+        return false;
+    }
+    const std::uint32_t replaces_through = reader.last_segment();
+    if (replaces_through == 0) {
+        return true;  // Nothing to compact
+    }
+
+    // Rows come out grouped by sensor and in time order, so one stream buffers at a time
+    ArchiveWriter writer;
+    if (!writer.open(directory)) {
+        return false;
+    }
+    writer.set_replaces_through(replaces_through);
+    bool ok = true;
+    jenlib::ble::DeviceId sensor(0);
+    jenlib::ble::SessionId session(0);
+    std::uint64_t base_time_ms = 0;
+    reader.scan([&](const ArchiveRow& row) {
+        if (row.sensor != sensor || row.session != session) {
+            ok = writer.flush() && ok;
+            sensor = row.sensor;
+            session = row.session;
+            base_time_ms = row.time_ms - row.offset_ms;
+        }
+        ok = writer.add(base_time_ms, jenlib::ble::ReadingMsg{row.sensor, row.session, row.offset_ms,
+                                                              row.temperature_c_centi, row.humidity_bp}) &&
+             ok;
+        return ok;
+    });
+    ok = writer.close() && ok;
+    if (!ok) {
+        return false;
+    }
+    if (writer.blocks_written() == 0) {
+        return true;  // No rows, so no sealed output to hide the old segments behind
+    }
+    reader.close();
+
+    for (const std::uint32_t number : list_segments(directory)) {
+        if (number <= replaces_through) {
+            unlink(segment_path(directory, number).c_str());
+        }
+    }
+    return sync_directory(directory);
+}
+
+}  // namespace jenlib::storage
+
+#endif  // __linux__ && !ARDUINO && !ESP_PLATFORM
@@ -0,0 +1,32 @@
+//! @file src/storage/drivers/EspIdfPartitionJournalStorage.cpp
+//! @brief SPI flash partition journal storage.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include <jenlib/storage/drivers/EspIdfPartitionJournalStorage.h>
+
+#ifdef ESP_PLATFORM
+
+namespace jenlib::storage {
+
+bool EspIdfPartitionJournalStorage::begin() {
+    partition_ = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, subtype_, label_);
+    return partition_ != nullptr;
+}
+
+bool EspIdfPartitionJournalStorage::read(std::uint64_t address, std::uint8_t* out, std::size_t size) {
+    return partition_ && esp_partition_read(partition_, static_cast<std::size_t>(address), out, size) == ESP_OK;
+}
+
+bool EspIdfPartitionJournalStorage::write(std::uint64_t address, const std::uint8_t* data, std::size_t size) {
+    return partition_ && esp_partition_write(partition_, static_cast<std::size_t>(address), data, size) == ESP_OK;
+}
+
+bool EspIdfPartitionJournalStorage::erase_sector(std::size_t sector) {
+    return partition_ && sector < sector_count() &&
+           esp_partition_erase_range(partition_, sector * kSectorSize, kSectorSize) == ESP_OK;
+}
+
+}  // namespace jenlib::storage
+
+#endif  // ESP_PLATFORM
@@ -0,0 +1,89 @@
+//! @file src/storage/drivers/EspIdfSnapshotStores.cpp
+//! @brief RTC-memory and NVS snapshot stores.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include <jenlib/storage/drivers/EspIdfSnapshotStores.h>
+
+#ifdef ESP_PLATFORM
+#include <esp_attr.h>
+#include <nvs.h>
+#include <cstring>
+
+namespace jenlib::storage {
+
+namespace {
+//! @brief RTC memory layout; the size doubles as a validity marker.
+struct RtcSnapshot {
+    std::uint32_t size;
+    std::uint8_t bytes[SnapshotStore::kMaxSnapshotSize];
+};
+
+// Not zeroed at boot; the snapshot's own CRC rejects garbage after power-on
+RTC_NOINIT_ATTR RtcSnapshot rtc_snapshot;
+}  // namespace
+
+bool EspIdfRtcSnapshotStore::save(const std::uint8_t* data, std::size_t size) {
+    if (size > kMaxSnapshotSize) {
+        return false;
+    }
+    std::memcpy(rtc_snapshot.bytes, data, size);
+    rtc_snapshot.size = static_cast<std::uint32_t>(size);
+    return true;
+}
+
+bool EspIdfRtcSnapshotStore::load(std::uint8_t* out, std::size_t& size) {
+    if (rtc_snapshot.size == 0 || rtc_snapshot.size > kMaxSnapshotSize) {
+        return false;
+    }
+    std::memcpy(out, rtc_snapshot.bytes, rtc_snapshot.size);
+    size = rtc_snapshot.size;
+    return true;
+}
+
+bool EspIdfRtcSnapshotStore::clear() {
+    rtc_snapshot.size = 0;
+    return true;
+}
+
+bool EspIdfNvsSnapshotStore::save(const std::uint8_t* data, std::size_t size) {
+    if (size > kMaxSnapshotSize) {
+        return false;
+    }
+    nvs_handle_t handle;
+    if (nvs_open(namespace_, NVS_READWRITE, &handle) != ESP_OK) {
+        return false;
+    }
+    const bool ok = nvs_set_blob(handle, key_, data, size) == ESP_OK && nvs_commit(handle) == ESP_OK;
+    nvs_close(handle);
+    return ok;
+}
+
+bool EspIdfNvsSnapshotStore::load(std::uint8_t* out, std::size_t& size) {
+    nvs_handle_t handle;
+    if (nvs_open(namespace_, NVS_READONLY, &handle) != ESP_OK) {
+        return false;
+    }
+    std::size_t length = kMaxSnapshotSize;
+    const bool ok = nvs_get_blob(handle, key_, out, &length) == ESP_OK;
+    nvs_close(handle);
+    if (ok) {
+        size = length;
+    }
+    return ok;
+}
+
+bool EspIdfNvsSnapshotStore::clear() {
+    nvs_handle_t handle;
+    if (nvs_open(namespace_, NVS_READWRITE, &handle) != ESP_OK) {
+        return false;
+    }
+    const esp_err_t err = nvs_erase_key(handle, key_);
+    const bool ok = (err == ESP_OK || err == ESP_ERR_NVS_NOT_FOUND) && nvs_commit(handle) == ESP_OK;
+    nvs_close(handle);
+    return ok;
+}
+
+}  // namespace jenlib::storage
+
+#endif  // ESP_PLATFORM
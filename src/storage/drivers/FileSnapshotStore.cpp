@@ -0,0 +1,64 @@
+//! @file src/storage/drivers/FileSnapshotStore.cpp
+//! @brief File-backed snapshot store.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#if !defined(ARDUINO) && !defined(ESP_PLATFORM)
+
+#include "jenlib/storage/drivers/FileSnapshotStore.h"
+#include <cstdio>
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+namespace jenlib::storage {
+
+bool FileSnapshotStore::save(const std::uint8_t* data, std::size_t size) {
+    if (size > kMaxSnapshotSize) {
+        return false;
+    }
+    const std::string temp = path_ + ".tmp";
+    std::FILE* file = std::fopen(temp.c_str(), "wb");
+    if (!file) {
+        return false;
+    }
+    bool ok = std::fwrite(data, 1, size, file) == size && std::fflush(file) == 0;
+#if defined(__unix__) || defined(__APPLE__)
+    if (ok && sync_) {
+        ok = fsync(fileno(file)) == 0;
+    }
+#endif
+    ok = std::fclose(file) == 0 && ok;
+    if (!ok) {
+        std::remove(temp.c_str());
+        return false;
+    }
+    return std::rename(temp.c_str(), path_.c_str()) == 0;
+}
+
+bool FileSnapshotStore::load(std::uint8_t* out, std::size_t& size) {
+    std::FILE* file = std::fopen(path_.c_str(), "rb");
+    if (!file) {
+        return false;
+    }
+    // Read one byte past the limit to reject an oversized file
+    std::uint8_t buffer[kMaxSnapshotSize + 1];
+    const std::size_t read = std::fread(buffer, 1, sizeof(buffer), file);
+    std::fclose(file);
+    if (read == 0 || read > kMaxSnapshotSize) {
+        return false;
+    }
+    for (std::size_t i = 0; i < read; ++i) {
+        out[i] = buffer[i];
+    }
+    size = read;
+    return true;
+}
+
+bool FileSnapshotStore::clear() {
+    return std::remove(path_.c_str()) == 0;
+}
+
+}  // namespace jenlib::storage
+
+#endif  // !ARDUINO && !ESP_PLATFORM
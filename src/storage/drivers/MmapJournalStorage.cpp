@@ -0,0 +1,128 @@
+//! @file src/storage/drivers/MmapJournalStorage.cpp
+//! @brief Memory-mapped file journal storage.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#if defined(__linux__) && !defined(ARDUINO) && !defined(ESP_PLATFORM)
+
+#include "jenlib/storage/drivers/MmapJournalStorage.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstring>
+
+namespace jenlib::storage {
+
+bool MmapJournalStorage::open(const char* path) {
+    close();
+    if (sector_size_ == 0 || sector_count_ == 0) {
+        return false;
+    }
+    fd_ = ::open(path, O_RDWR | O_CREAT, 0644);
+    if (fd_ < 0) {
+        return false;
+    }
+    struct stat info {};
+    const auto size = static_cast<off_t>(size_bytes());
+    if (fstat(fd_, &info) != 0 || (info.st_size < size && ftruncate(fd_, size) != 0)) {
+        close();
+        return false;
+    }
+    void* mapped = mmap(nullptr, size_bytes(), PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (mapped == MAP_FAILED) {
+        close();
+        return false;
+    }
+    base_ = static_cast<std::uint8_t*>(mapped);
+    dirty_.fill(DirtyRange{});
+    return true;
+}
+
+void MmapJournalStorage::close() {
+    if (base_) {
+        munmap(base_, size_bytes());
+        base_ = nullptr;
+    }
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+}
+
+bool MmapJournalStorage::read(std::uint64_t address, std::uint8_t* out, std::size_t size) {
+    if (!in_range(address, size)) {
+        return false;
+    }
+    std::memcpy(out, base_ + address, size);
+    return true;
+}
+
+bool MmapJournalStorage::write(std::uint64_t address, const std::uint8_t* data, std::size_t size) {
+    if (!in_range(address, size)) {
+        return false;
+    }
+    std::memcpy(base_ + address, data, size);
+    mark_dirty(address, size);
+    return true;
+}
+
+bool MmapJournalStorage::erase_sector(std::size_t sector) {
+    if (!base_ || sector >= sector_count_) {
+        return false;
+    }
+    const std::uint64_t address = static_cast<std::uint64_t>(sector) * sector_size_;
+    std::memset(base_ + address, 0xFF, sector_size_);
+    mark_dirty(address, sector_size_);
+    return true;
+}
+
+bool MmapJournalStorage::sync() {
+    if (!base_) {
+        return false;
+    }
+    // msync wants a page-aligned start
+    const auto page = static_cast<std::uint64_t>(sysconf(_SC_PAGESIZE));
+    for (auto& range : dirty_) {
+        if (range.begin == range.end) {
+            continue;
+        }
+        const std::uint64_t begin = range.begin / page * page;
+        if (msync(base_ + begin, range.end - begin, MS_SYNC) != 0) {
+            return false;
+        }
+        range = DirtyRange{};
+    }
+    return true;
+}
+
+void MmapJournalStorage::mark_dirty(std::uint64_t address, std::size_t size) {
+    const DirtyRange added{address, address + size};
+    DirtyRange* empty = nullptr;
+    DirtyRange* nearest = nullptr;
+    std::uint64_t nearest_gap = 0;
+    for (auto& range : dirty_) {
+        if (range.begin == range.end) {
+            empty = empty ? empty : &range;
+            continue;
+        }
+        const std::uint64_t gap = added.begin > range.end ? added.begin - range.end
+                                  : range.begin > added.end ? range.begin - added.end
+                                                            : 0;
+        if (!nearest || gap < nearest_gap) {
+            nearest = &range;
+            nearest_gap = gap;
+        }
+    }
+    // Extend a range that touches the write, else start a new one, else widen the closest
+    if (nearest && (nearest_gap <= sector_size_ || !empty)) {
+        nearest->begin = added.begin < nearest->begin ? added.begin : nearest->begin;
+        nearest->end = added.end > nearest->end ? added.end : nearest->end;
+    } else {
+        *empty = added;
+    }
+}
+
+}  // namespace jenlib::storage
+
+#endif  // __linux__ && !ARDUINO && !ESP_PLATFORM
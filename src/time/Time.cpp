@@ -4,142 +4,65 @@
 //! @author Jennifer Gott (jennifer.gott@chasacademy.se)
 
 #include "jenlib/time/Time.h"
-#include <algorithm>
-#include <cassert>
 #include <utility>
-#include "jenlib/time/drivers/NativeTimeDriver.h"
 
 namespace jenlib::time {
 
 // Static member definitions
 bool Time::initialized_ = false;
-TimerId Time::next_timer_id_ = 1;
-std::array<TimerEntry, Time::kMaxTimers> Time::timers_;
-std::size_t Time::timer_count_ = 0;
-TimeDriver* Time::driver_ = nullptr;
+
+TimerContext& Time::default_context() {
+    // Constructed on first use so other static initialisers can schedule safely
+    static TimerContext context;
+    return context;
+}
 
 TimerId Time::schedule_callback(std::uint32_t interval_ms, TimerCallback callback, bool repeat) {
     if (!callback || interval_ms == 0) {
         return kInvalidTimerId;
     }
-
     initialize();
-
-    // Check if we have space for another timer
-    if (timer_count_ >= kMaxTimers) {
-        return kInvalidTimerId;
-    }
-
-    TimerId timer_id = get_next_timer_id();
-    if (timer_id == kInvalidTimerId) {
-        return kInvalidTimerId;
-    }
-
-    std::uint32_t current_time = now();
-    std::uint32_t fire_time = current_time + interval_ms;
-
-    // Create timer entry
-    TimerEntry entry(timer_id, interval_ms, fire_time, std::move(callback), repeat);
-
-    // Find available slot and create timer entry
-    for (auto& timer : timers_) {
-        if (timer.state == TimerState::kInactive) {
-            timer = std::move(entry);
-            ++timer_count_;
-            return timer_id;
-        }
-    }
-
-    return kInvalidTimerId;  //  Should not reach here if timer_count_ < kMaxTimers
+    return default_context().schedule_callback(interval_ms, std::move(callback), repeat);
 }
 
 bool Time::cancel_callback(TimerId timer_id) {
-    if (timer_id == kInvalidTimerId) {
-        return false;
-    }
-
-    for (auto& timer : timers_) {
-        if (timer.id == timer_id && timer.state == TimerState::kActive) {
-            timer.state = TimerState::kInactive;
-            --timer_count_;
-            return true;
-        }
-    }
+    return default_context().cancel_callback(timer_id);
+}
 
-    return false;
+bool Time::reschedule_callback(TimerId timer_id, std::uint32_t interval_ms) {
+    return default_context().reschedule_callback(timer_id, interval_ms);
 }
 
 std::size_t Time::process_timers() {
-    if (timer_count_ == 0) {
-        return 0;
-    }
-
-    std::uint32_t current_time = now();
-    std::size_t fired_count = 0;
-
-    // Process all active timers
-    for (auto& timer : timers_) {
-        if (timer.state == TimerState::kActive && current_time >= timer.next_fire_time) {
-            // Timer has expired
-            timer.state = TimerState::kExpired;
-
-            // Invoke callback
-            if (timer.callback) {
-                timer.callback();
-                ++fired_count;
-            }
-
-            // Handle repeat or mark as inactive
-            if (timer.repeat) {
-                // Reschedule for next interval
-                timer.next_fire_time = current_time + timer.interval_ms;
-                timer.state = TimerState::kActive;
-            } else {
-                // One-shot timer - mark as inactive
-                timer.state = TimerState::kInactive;
-                --timer_count_;
-            }
-        }
-    }
+    return default_context().process_timers();
+}
 
-    // Note: Inactive timers remain in the array but are not processed
-    // This allows for efficient reuse of slots without expensive array operations
+bool Time::get_next_fire_time(std::uint32_t& fire_time_ms) {
+    return default_context().get_next_fire_time(fire_time_ms);
+}
 
-    return fired_count;
+bool Time::get_fire_time(TimerId timer_id, std::uint32_t& fire_time_ms) {
+    return default_context().get_fire_time(timer_id, fire_time_ms);
 }
 
 std::uint32_t Time::now() {
-    if (!driver_) {
-        // No-op when no driver is set - return 0
-        return 0;
-    }
-    return driver_->now();
+    return default_context().now();
 }
 
 void Time::delay(std::uint32_t delay_ms) {
-    if (!driver_) {
-        // No-op when no driver is set - do nothing
-        return;
-    }
-    driver_->delay(delay_ms);
+    default_context().delay(delay_ms);
 }
 
 std::size_t Time::get_active_timer_count() {
-    return std::count_if(timers_.begin(), timers_.end(),
-        [](const TimerEntry& entry) {
-            return entry.state == TimerState::kActive;
-        });
+    return default_context().get_active_timer_count();
 }
 
 std::size_t Time::get_total_timer_count() {
-    return timer_count_;
+    return default_context().get_total_timer_count();
 }
 
 void Time::clear_all_timers() {
-    for (auto& timer : timers_) {
-        timer.state = TimerState::kInactive;
-    }
-    timer_count_ = 0;
+    default_context().clear_all_timers();
 }
 
 bool Time::is_initialized() {
@@ -148,31 +71,17 @@ bool Time::is_initialized() {
 
 void Time::initialize() {
     if (!initialized_) {
-        for (auto& timer : timers_) {
-            timer.state = TimerState::kInactive;
-        }
-        timer_count_ = 0;
-        next_timer_id_ = 1;
+        default_context().reset();
         initialized_ = true;
     }
 }
 
-TimerId Time::get_next_timer_id() {
-    if (next_timer_id_ == kInvalidTimerId) {
-        // Handle ID overflow - in practice, this is unlikely to happen
-        // For embedded systems, we might want to implement ID recycling
-        return kInvalidTimerId;
-    }
-
-    return next_timer_id_++;
-}
-
 void Time::setDriver(TimeDriver* driver) noexcept {
-    driver_ = driver;
+    default_context().set_driver(driver);
 }
 
 TimeDriver* Time::getDriver() noexcept {
-    return driver_;
+    return default_context().driver();
 }
 
 }  // namespace jenlib::time
@@ -0,0 +1,288 @@
+//! @file src/time/TimerContext.cpp
+//! @brief Timer context implementation
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include "jenlib/time/TimerContext.h"
+#include <algorithm>
+#include <utility>
+
+namespace jenlib::time {
+
+TimerId TimerContext::schedule_callback(std::uint32_t interval_ms, TimerCallback callback, bool repeat) {
+    if (!callback || interval_ms == 0) {
+        return kInvalidTimerId;
+    }
+
+    // Check if we have space for another timer
+    if (timer_count_ >= kMaxTimers) {
+        return kInvalidTimerId;
+    }
+
+    TimerId timer_id = get_next_timer_id();
+    if (timer_id == kInvalidTimerId) {
+        return kInvalidTimerId;
+    }
+
+    std::uint32_t current_time = now();
+    std::uint32_t fire_time = current_time + interval_ms;
+
+    // Create timer entry
+    TimerEntry entry(timer_id, interval_ms, fire_time, std::move(callback), repeat);
+
+    // Find available slot and create timer entry
+    for (auto& timer : timers_) {
+        if (timer.state == TimerState::kInactive) {
+            timer = std::move(entry);
+            ++timer_count_;
+            return timer_id;
+        }
+    }
+
+    return kInvalidTimerId;  //  Should not reach here if timer_count_ < kMaxTimers
+}
+
+bool TimerContext::cancel_callback(TimerId timer_id) {
+    if (timer_id == kInvalidTimerId) {
+        return false;
+    }
+
+    for (auto& timer : timers_) {
+        if (timer.id == timer_id && timer.state == TimerState::kActive) {
+            timer.state = TimerState::kInactive;
+            --timer_count_;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool TimerContext::reschedule_callback(TimerId timer_id, std::uint32_t interval_ms) {
+    if (timer_id == kInvalidTimerId || interval_ms == 0) {
+        return false;
+    }
+
+    for (auto& timer : timers_) {
+        if (timer.id != timer_id) {
+            continue;
+        }
+        if (timer.state == TimerState::kActive) {
+            // Anchor on the last scheduled fire time
+            timer.next_fire_time = timer.next_fire_time - timer.interval_ms + interval_ms;
+            timer.interval_ms = interval_ms;
+            return true;
+        }
+        if (timer.state == TimerState::kExpired) {
+            // Called from the timer's own callback; process_timers applies the new interval
+            timer.interval_ms = interval_ms;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+std::size_t TimerContext::process_timers(std::size_t max_timers) {
+    if (timer_count_ == 0 || max_timers == 0) {
+        return 0;
+    }
+
+    std::uint32_t current_time = now();
+    std::uint32_t last_tick = current_time;  // Each callback is timed from the end of the previous one
+    std::size_t fired_count = 0;
+
+    // Start at the slot a cut-short pass stopped at, so every due timer gets its turn
+    for (std::size_t i = 0; i < kMaxTimers; ++i) {
+        const std::size_t slot = (next_slot_ + i) % kMaxTimers;
+        auto& timer = timers_[slot];
+        if (timer.state != TimerState::kActive || current_time < timer.next_fire_time) {
+            continue;
+        }
+
+        if (fired_count == max_timers ||
+            (fired_count > 0 && pass_budget_ms_ != 0 && elapsed(current_time, last_tick) >= pass_budget_ms_)) {
+            // Leave this and later due timers for the next pass; they are late, not lost
+            next_slot_ = slot;
+            ++deferred_passes_;
+            return fired_count;
+        }
+
+        // Timer has expired
+        timer.state = TimerState::kExpired;
+
+        // Invoke callback
+        if (timer.callback) {
+            timer.callback();
+            ++fired_count;
+            const std::uint32_t finished = now();
+            if (timer.stats.record(elapsed(last_tick, finished))) {
+                ++overrun_count_;
+            }
+            last_tick = finished;
+        }
+
+        // Handle repeat or mark as inactive
+        if (timer.repeat) {
+            // Reschedule from the scheduled fire time so late processing does not drift;
+            // periods missed entirely are skipped rather than fired in a burst
+            timer.next_fire_time += timer.interval_ms;
+            if (current_time >= timer.next_fire_time) {
+                const std::uint32_t missed = (current_time - timer.next_fire_time) / timer.interval_ms + 1;
+                timer.next_fire_time += missed * timer.interval_ms;
+                missed_periods_ += missed;
+            }
+            timer.state = TimerState::kActive;
+        } else {
+            // One-shot timer - mark as inactive
+            timer.state = TimerState::kInactive;
+            --timer_count_;
+        }
+    }
+
+    // Note: Inactive timers remain in the array but are not processed
+    // This allows for efficient reuse of slots without expensive array operations
+
+    return fired_count;
+}
+
+bool TimerContext::set_callback_budget(TimerId timer_id, std::uint32_t budget_ms) {
+    TimerEntry* timer = find_timer(timer_id);
+    if (!timer) {
+        return false;
+    }
+    timer->stats.budget_ms = budget_ms;
+    return true;
+}
+
+bool TimerContext::get_callback_stats(TimerId timer_id, CallbackStats& stats) const {
+    const TimerEntry* timer = find_timer(timer_id);
+    if (!timer) {
+        return false;
+    }
+    stats = timer->stats;
+    return true;
+}
+
+CallbackStats TimerContext::get_worst_offender() const {
+    CallbackStats worst;
+    for (const auto& timer : timers_) {
+        if (timer.state != TimerState::kInactive && timer.stats.calls > 0 && timer.stats.worse_than(worst)) {
+            worst = timer.stats;
+        }
+    }
+    return worst;
+}
+
+void TimerContext::reset_callback_stats() {
+    for (auto& timer : timers_) {
+        timer.stats.clear_counts();
+    }
+    overrun_count_ = 0;
+    deferred_passes_ = 0;
+}
+
+bool TimerContext::get_next_fire_time(std::uint32_t& fire_time_ms) const {
+    bool found = false;
+    for (const auto& timer : timers_) {
+        if (timer.state == TimerState::kActive && (!found || timer.next_fire_time < fire_time_ms)) {
+            fire_time_ms = timer.next_fire_time;
+            found = true;
+        }
+    }
+    return found;
+}
+
+bool TimerContext::get_fire_time(TimerId timer_id, std::uint32_t& fire_time_ms) const {
+    if (timer_id == kInvalidTimerId) {
+        return false;
+    }
+
+    for (const auto& timer : timers_) {
+        if (timer.id == timer_id && timer.state == TimerState::kActive) {
+            fire_time_ms = timer.next_fire_time;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+std::uint32_t TimerContext::now() const {
+    if (!driver_) {
+        // No-op when no driver is set - return 0
+        return 0;
+    }
+    return driver_->now();
+}
+
+std::uint32_t TimerContext::elapsed(std::uint32_t from, std::uint32_t to) const {
+    return driver_ ? driver_->time_difference(to, from) : 0;
+}
+
+void TimerContext::delay(std::uint32_t delay_ms) const {
+    if (!driver_) {
+        // No-op when no driver is set - do nothing
+        return;
+    }
+    driver_->delay(delay_ms);
+}
+
+std::size_t TimerContext::get_active_timer_count() const {
+    return std::count_if(timers_.begin(), timers_.end(),
+        [](const TimerEntry& entry) {
+            return entry.state == TimerState::kActive;
+        });
+}
+
+void TimerContext::clear_all_timers() {
+    for (auto& timer : timers_) {
+        timer.state = TimerState::kInactive;
+    }
+    timer_count_ = 0;
+}
+
+void TimerContext::reset() {
+    clear_all_timers();
+    next_timer_id_ = 1;
+    missed_periods_ = 0;
+    overrun_count_ = 0;
+    deferred_passes_ = 0;
+    next_slot_ = 0;
+}
+
+TimerId TimerContext::get_next_timer_id() {
+    if (next_timer_id_ == kInvalidTimerId) {
+        // Handle ID overflow - in practice, this is unlikely to happen
+        // For embedded systems, we might want to implement ID recycling
+        return kInvalidTimerId;
+    }
+
+    return next_timer_id_++;
+}
+
+TimerEntry* TimerContext::find_timer(TimerId timer_id) {
+    if (timer_id == kInvalidTimerId) {
+        return nullptr;
+    }
+    for (auto& timer : timers_) {
+        if (timer.id == timer_id && timer.state != TimerState::kInactive) {
+            return &timer;
+        }
+    }
+    return nullptr;
+}
+
+const TimerEntry* TimerContext::find_timer(TimerId timer_id) const {
+    if (timer_id == kInvalidTimerId) {
+        return nullptr;
+    }
+    for (const auto& timer : timers_) {
+        if (timer.id == timer_id && timer.state != TimerState::kInactive) {
+            return &timer;
+        }
+    }
+    return nullptr;
+}
+
+}  // namespace jenlib::time
@@ -25,6 +25,15 @@ void NativeTimeDriver::delay(std::uint32_t delay_ms) {
     delay_static(delay_ms);
 }
 
+bool NativeTimeDriver::has_overflowed(std::uint32_t time_value) noexcept {
+    return now_static() < time_value;
+}
+
+std::uint32_t NativeTimeDriver::time_difference(std::uint32_t current_time, std::uint32_t previous_time) noexcept {
+    // Unsigned subtraction is modulo 2^32, which is exactly the wrapped difference
+    return current_time - previous_time;
+}
+
 std::uint32_t NativeTimeDriver::now_static() {
     if (!initialized_) {
         initialize();
@@ -0,0 +1,179 @@
+//! @file tests/AdaptiveSamplingTests.cpp
+//! @brief Tests for adaptive sampling and drift-free timer rescheduling
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include <unity.h>
+#include <vector>
+#include <jenlib/ble/Messages.h>
+#include <jenlib/ble/Roles.h>
+#include <jenlib/ble/drivers/NativeBleDriver.h>
+#include <jenlib/measurement/AdaptiveSampling.h>
+#include <jenlib/state/SensorStateMachine.h>
+#include <jenlib/time/Time.h>
+#include "TestHelpers.h"
+
+using jenlib::test::ManualTimeDriver;
+using jenlib::test::make_reading;
+
+namespace {
+constexpr jenlib::ble::DeviceId kSensor(0x1234);
+constexpr jenlib::ble::SessionId kSession(0x5678);
+}  // namespace
+
+//! @test test_adaptive_sampler_backs_off_when_steady
+//! @brief Verifies the interval doubles on a steady signal up to the maximum
+void test_adaptive_sampler_backs_off_when_steady(void) {
+    //! @section Arrange
+    jenlib::measurement::AdaptiveSampler sampler({1000, 6000, 10, 50});
+
+    //! @section Act
+    std::vector<std::uint32_t> intervals;
+    for (int i = 0; i < 5; ++i) {
+        intervals.push_back(sampler.update(make_reading(kSensor, kSession, 0, 2000, 4000)));
+    }
+
+    //! @section Assert
+    const std::vector<std::uint32_t> expected{1000, 2000, 4000, 6000, 6000};
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(expected.data(), intervals.data(), expected.size());
+}
+
+//! @test test_adaptive_sampler_shortens_on_change
+//! @brief Verifies a fast change shortens the interval in proportion, clamped to the minimum
+void test_adaptive_sampler_shortens_on_change(void) {
+    //! @section Arrange
+    jenlib::measurement::AdaptiveSampler sampler({500, 8000, 10, 50});
+    sampler.update(make_reading(kSensor, kSession, 0, 2000, 4000));
+    for (int i = 0; i < 4; ++i) {
+        sampler.update(make_reading(kSensor, kSession, 0, 2000, 4000));
+    }
+    TEST_ASSERT_EQUAL_UINT32(8000, sampler.interval_ms());
+
+    //! @section Act / Assert
+    // Four temperature steps: a quarter; two humidity steps: a half; then clamped to the minimum
+    TEST_ASSERT_EQUAL_UINT32(2000, sampler.update(make_reading(kSensor, kSession, 0, 2040, 4000)));
+    TEST_ASSERT_EQUAL_UINT32(1000, sampler.update(make_reading(kSensor, kSession, 0, 2040, 4100)));
+    TEST_ASSERT_EQUAL_UINT32(500, sampler.update(make_reading(kSensor, kSession, 0, 2540, 4100)));
+    TEST_ASSERT_FALSE(sampler.set_bounds(2000, 1000));
+    TEST_ASSERT_TRUE(sampler.set_bounds(750, 1000));
+    TEST_ASSERT_EQUAL_UINT32(750, sampler.interval_ms());
+}
+
+//! @test test_time_reschedule_without_drift
+//! @brief Verifies repeating timers keep their phase when processed late or rescheduled
+void test_time_reschedule_without_drift(void) {
+    //! @section Arrange
+    ManualTimeDriver driver;
+    jenlib::time::Time::setDriver(&driver);
+    jenlib::time::Time::clear_all_timers();
+    std::vector<std::uint32_t> fired;
+    jenlib::time::TimerId timer = jenlib::time::kInvalidTimerId;
+    timer = jenlib::time::schedule_repeating_timer(1000, [&]() {
+        fired.push_back(driver.now_ms);
+        if (fired.size() == 2) {
+            jenlib::time::Time::reschedule_callback(timer, 500);  // From inside the callback
+        }
+    });
+
+    //! @section Act
+    for (std::uint32_t t : {1250u, 1900u, 2000u, 2499u, 2500u, 2600u, 4100u, 4500u}) {
+        driver.now_ms = t;
+        jenlib::time::Time::process_timers();
+    }
+    TEST_ASSERT_TRUE(jenlib::time::Time::reschedule_callback(timer, 2000));  // Anchored at 4500
+    driver.now_ms = 6499;
+    jenlib::time::Time::process_timers();
+    driver.now_ms = 6500;
+    jenlib::time::Time::process_timers();
+
+    //! @section Assert
+    // Late at 1250 still fires next at 2000; 3000-4000 are skipped after the stall, not burst
+    const std::vector<std::uint32_t> expected{1250, 2000, 2500, 4100, 4500, 6500};
+    TEST_ASSERT_EQUAL(expected.size(), fired.size());
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(expected.data(), fired.data(), expected.size());
+    jenlib::time::Time::clear_all_timers();
+    jenlib::time::Time::setDriver(nullptr);
+}
+
+//! @test test_sensor_applies_broker_sampling_bounds
+//! @brief Verifies the sensor applies SamplingConfig bounds and adapts its interval per session
+void test_sensor_applies_broker_sampling_bounds(void) {
+    //! @section Arrange
+    jenlib::state::SensorStateMachine sensor_sm;
+    sensor_sm.set_measurement_interval_ms(1500);
+    sensor_sm.handle_connection_change(true);
+    jenlib::ble::BlePayload payload;
+    TEST_ASSERT_TRUE(jenlib::ble::SamplingConfigMsg::serialize(
+        jenlib::ble::SamplingConfigMsg{kSession, 2000, 4000}, payload));
+    jenlib::ble::SamplingConfigMsg config_msg{jenlib::ble::SessionId(0), 0, 0};
+    TEST_ASSERT_TRUE(jenlib::ble::SamplingConfigMsg::deserialize(payload, config_msg));
+
+    //! @section Act
+    sensor_sm.set_adaptive_sampling({1000, 60000, 10, 50});
+    TEST_ASSERT_TRUE(sensor_sm.handle_sampling_config(kSensor, config_msg));
+    sensor_sm.handle_start_broadcast(kSensor,
+        jenlib::ble::StartBroadcastMsg{kSensor, kSession});
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL_UINT32(2000, sensor_sm.get_measurement_interval_ms());
+    TEST_ASSERT_FALSE(sensor_sm.update_measurement_interval(make_reading(kSensor, kSession, 0, 2000, 4000)));
+    TEST_ASSERT_TRUE(sensor_sm.update_measurement_interval(make_reading(kSensor, kSession, 0, 2000, 4000)));
+    TEST_ASSERT_EQUAL_UINT32(4000, sensor_sm.get_measurement_interval_ms());
+    config_msg.session_id = jenlib::ble::SessionId(0x9999);
+    TEST_ASSERT_FALSE(sensor_sm.handle_sampling_config(kSensor, config_msg));
+    sensor_sm.set_fixed_sampling();
+    TEST_ASSERT_EQUAL_UINT32(1500, sensor_sm.get_measurement_interval_ms());
+    TEST_ASSERT_FALSE(sensor_sm.update_measurement_interval(make_reading(kSensor, kSession, 0, 2500, 4000)));
+}
+
+//! @test test_broker_sampling_config_reschedules_sensor_timer
+//! @brief Verifies bounds sent by the broker reach the sensor over the driver and move its measurement timer
+void test_broker_sampling_config_reschedules_sensor_timer(void) {
+    //! @section Arrange
+    ManualTimeDriver driver;
+    jenlib::time::Time::setDriver(&driver);
+    jenlib::time::Time::clear_all_timers();
+    const jenlib::ble::DeviceId sensor_id(0x1234);
+    const jenlib::ble::SessionId session_id(0x5678);
+    jenlib::ble::NativeBleDriver radio(jenlib::ble::DeviceId(0));
+    jenlib::ble::Broker broker(&radio);
+    jenlib::ble::Sensor sensor(sensor_id, &radio);
+    jenlib::state::SensorStateMachine sensor_sm;
+    sensor_sm.set_adaptive_sampling({1000, 60000, 10, 50});
+    sensor_sm.handle_connection_change(true);
+    sensor_sm.handle_start_broadcast(jenlib::ble::DeviceId(0), jenlib::ble::StartBroadcastMsg{sensor_id, session_id});
+    std::vector<std::uint32_t> fired;
+    const jenlib::time::TimerId timer = jenlib::time::schedule_repeating_timer(
+        sensor_sm.get_measurement_interval_ms(), [&]() { fired.push_back(driver.now_ms); });
+    std::uint32_t reschedules = 0;
+    sensor.configure_callbacks(jenlib::ble::BleCallbacks{
+        .on_sampling_config = [&](jenlib::ble::DeviceId sender, const jenlib::ble::SamplingConfigMsg& msg) {
+            bool interval_changed = false;
+            if (sensor_sm.handle_sampling_config(sender, msg, &interval_changed) && interval_changed) {
+                jenlib::time::Time::reschedule_callback(timer, sensor_sm.get_measurement_interval_ms());
+                ++reschedules;
+            }
+        }});
+    sensor.begin();
+
+    //! @section Act
+    driver.now_ms = 1000;
+    jenlib::time::Time::process_timers();
+    driver.now_ms = 1500;
+    broker.send_sampling_config(sensor_id, jenlib::ble::SamplingConfigMsg{session_id, 3000, 8000});
+    broker.send_sampling_config(sensor_id, jenlib::ble::SamplingConfigMsg{session_id, 3000, 8000});
+    broker.send_sampling_config(sensor_id, jenlib::ble::SamplingConfigMsg{jenlib::ble::SessionId(0x9999), 500, 800});
+    for (std::uint32_t t : {2000u, 3999u, 4000u}) {
+        driver.now_ms = t;
+        jenlib::time::Time::process_timers();
+    }
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL_UINT32(3000, sensor_sm.get_measurement_interval_ms());
+    TEST_ASSERT_EQUAL_UINT32(1, reschedules);  // The repeat and the other session's bounds change nothing
+    const std::vector<std::uint32_t> expected{1000, 4000};  // Anchored at the last fire, not at receipt
+    TEST_ASSERT_EQUAL(expected.size(), fired.size());
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(expected.data(), fired.data(), expected.size());
+    jenlib::time::Time::clear_all_timers();
+    jenlib::time::Time::setDriver(nullptr);
+}
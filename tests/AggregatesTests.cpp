@@ -0,0 +1,151 @@
+//! @file tests/AggregatesTests.cpp
+//! @brief Tests for running aggregates and upload downsampling
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include <unity.h>
+#include <vector>
+#include <jenlib/measurement/Aggregates.h>
+#include <jenlib/measurement/Downsample.h>
+#include <jenlib/state/BrokerStateMachine.h>
+#include "TestHelpers.h"
+
+using jenlib::measurement::AggregateBucket;
+using jenlib::measurement::RunningStats;
+using jenlib::measurement::SeriesPoint;
+using jenlib::measurement::SeriesSpan;
+using jenlib::test::make_reading;
+
+namespace {
+constexpr jenlib::ble::DeviceId kSensor(0x1234);
+constexpr jenlib::ble::SessionId kSession(0x5678);
+}  // namespace
+
+//! @test test_running_stats_welford_and_merge
+//! @brief Verifies count, extremes, mean and variance, and that merging matches adding in one pass
+void test_running_stats_welford_and_merge(void) {
+    //! @section Arrange
+    const std::int32_t values[] = {2, 4, 4, 4, 5, 5, 7, 9};
+    RunningStats all;
+    RunningStats first_half;
+    RunningStats second_half;
+
+    //! @section Act
+    for (std::size_t i = 0; i < 8; ++i) {
+        all.add(values[i] + 10000);  // Large offset: the naive sum of squares would lose the variance
+        (i < 3 ? first_half : second_half).add(values[i] + 10000);
+    }
+    first_half.merge(second_half);
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL_UINT32(8, all.count());
+    TEST_ASSERT_EQUAL_INT32(10002, all.min());
+    TEST_ASSERT_EQUAL_INT32(10009, all.max());
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 10005.0f, all.mean());
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 4.0f, all.variance());
+    TEST_ASSERT_EQUAL_UINT32(8, first_half.count());
+    TEST_ASSERT_EQUAL_INT32(10002, first_half.min());
+    TEST_ASSERT_EQUAL_INT32(10009, first_half.max());
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, all.mean(), first_half.mean());
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, all.variance(), first_half.variance());
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, RunningStats{}.variance());
+}
+
+//! @test test_bucketed_aggregates_close_and_drain
+//! @brief Verifies readings land in time buckets, late ones are rejected and a full ring drops the oldest
+void test_bucketed_aggregates_close_and_drain(void) {
+    //! @section Arrange
+    jenlib::measurement::BucketedAggregates<2> aggregates(1000);
+
+    //! @section Act
+    TEST_ASSERT_TRUE(aggregates.add(make_reading(kSensor, kSession, 0, 2000, 4000)));
+    TEST_ASSERT_TRUE(aggregates.add(make_reading(kSensor, kSession, 500, 2100, 4100)));
+    TEST_ASSERT_TRUE(aggregates.add(make_reading(kSensor, kSession, 1200, 2200, 4200)));
+    const bool late = aggregates.add(make_reading(kSensor, kSession, 900, 1900, 3900));
+    TEST_ASSERT_TRUE(aggregates.add(make_reading(kSensor, kSession, 3100, 2300, 4300)));  // Skips an empty bucket
+    const std::size_t completed = aggregates.size();
+    std::vector<AggregateBucket> uploaded;
+    aggregates.flush();
+    const std::size_t drained = aggregates.drain(std::back_inserter(uploaded));
+
+    //! @section Assert
+    TEST_ASSERT_FALSE(late);
+    TEST_ASSERT_EQUAL(2, completed);
+    TEST_ASSERT_EQUAL(2, drained);
+    TEST_ASSERT_EQUAL_UINT32(1, aggregates.dropped());  // The first bucket was overwritten by the flush
+    TEST_ASSERT_EQUAL_UINT32(1000, uploaded[0].start_ms);
+    TEST_ASSERT_EQUAL_UINT32(1, uploaded[0].stats.count());
+    TEST_ASSERT_EQUAL_UINT32(3000, uploaded[1].start_ms);
+    TEST_ASSERT_EQUAL_INT32(2300, uploaded[1].stats.temperature_c_centi.max());
+    TEST_ASSERT_EQUAL(0, aggregates.size());
+    TEST_ASSERT_EQUAL_UINT32(4, aggregates.session().count());
+    TEST_ASSERT_EQUAL_UINT32(0, aggregates.session().first_offset_ms);
+    TEST_ASSERT_EQUAL_UINT32(3100, aggregates.session().last_offset_ms);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 4150.0f, aggregates.session().humidity_bp.mean());
+}
+
+//! @test test_downsample_bounds_and_keeps_extremes
+//! @brief Verifies both downsamplers bound their output, keep the end points and keep a spike
+void test_downsample_bounds_and_keeps_extremes(void) {
+    //! @section Arrange
+    std::vector<SeriesPoint> points;
+    for (std::uint32_t i = 0; i < 1000; ++i) {
+        const std::int16_t temp = static_cast<std::int16_t>(i == 421 ? 3000 : 2000 + (i % 10));
+        points.push_back(SeriesPoint{i * 1000, temp, 4000});
+    }
+    const SeriesSpan span{points.data(), points.size()};
+
+    //! @section Act
+    std::vector<SeriesPoint> lttb;
+    std::vector<SeriesPoint> min_max;
+    std::vector<SeriesPoint> short_copy;
+    const std::size_t lttb_count = jenlib::measurement::downsample_lttb(span, 50, std::back_inserter(lttb));
+    const std::size_t min_max_count = jenlib::measurement::downsample_min_max(span, 20, std::back_inserter(min_max));
+    jenlib::measurement::downsample_lttb(SeriesSpan{points.data(), 2}, 50, std::back_inserter(short_copy));
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL(50, lttb_count);
+    TEST_ASSERT_EQUAL(50, lttb.size());
+    TEST_ASSERT_EQUAL_UINT32(0, lttb.front().offset_ms);
+    TEST_ASSERT_EQUAL_UINT32(999000, lttb.back().offset_ms);
+    TEST_ASSERT_LESS_OR_EQUAL(40, min_max_count);
+    bool lttb_spike = false;
+    bool min_max_spike = false;
+    for (const auto& point : lttb) {
+        lttb_spike = lttb_spike || point.temperature_c_centi == 3000;
+    }
+    for (std::size_t i = 0; i < min_max.size(); ++i) {
+        min_max_spike = min_max_spike || min_max[i].temperature_c_centi == 3000;
+        TEST_ASSERT_TRUE(i == 0 || min_max[i - 1].offset_ms < min_max[i].offset_ms);
+    }
+    TEST_ASSERT_TRUE(lttb_spike);
+    TEST_ASSERT_TRUE(min_max_spike);
+    TEST_ASSERT_EQUAL(2, short_copy.size());
+}
+
+//! @test test_broker_aggregates_session_readings
+//! @brief Verifies the broker aggregates accepted readings and closes the last bucket at session end
+void test_broker_aggregates_session_readings(void) {
+    //! @section Arrange
+    jenlib::state::BrokerStateMachine broker_sm;
+    broker_sm.get_aggregates().set_bucket_ms(10000);
+    broker_sm.handle_start_command(kSensor, kSession);
+
+    //! @section Act
+    broker_sm.handle_reading(kSensor, make_reading(kSensor, kSession, 0, 2000, 4000));
+    broker_sm.handle_reading(kSensor, make_reading(kSensor, kSession, 5000, 2200, 4000));
+    broker_sm.handle_reading(kSensor, make_reading(kSensor, kSession, 12000, 2100, 4000));
+    const jenlib::ble::DeviceId stranger(0x9999);
+    broker_sm.handle_reading(stranger, make_reading(stranger, kSession, 13000, 9999, 4000));  // Wrong sensor
+    const std::size_t before_end = broker_sm.get_aggregates().size();
+    broker_sm.handle_session_end();
+
+    //! @section Assert
+    const auto& aggregates = broker_sm.get_aggregates();
+    TEST_ASSERT_EQUAL(1, before_end);
+    TEST_ASSERT_EQUAL(2, aggregates.size());
+    TEST_ASSERT_EQUAL_UINT32(3, aggregates.session().count());
+    TEST_ASSERT_EQUAL_INT32(2200, aggregates.session().temperature_c_centi.max());
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 2100.0f, aggregates.at(0).stats.temperature_c_centi.mean());
+    TEST_ASSERT_EQUAL_UINT32(10000, aggregates.at(1).start_ms);
+}
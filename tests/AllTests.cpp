@@ -21,6 +21,9 @@ extern void test_native_driver_analog(void);
 extern void test_voltage_levels_and_tmp36(void);
 extern void test_tmp36_conversion_10bit_5v(void);
 extern void test_tmp36_conversion_12bit_3v3(void);
+extern void test_tmp36_lut_matches_float_conversion(void);
+extern void test_tmp36_oversampling_interpolates(void);
+extern void test_tmp36_driver_reads_native_pin(void);
 extern void test_crc8_atm_empty_data(void);
 extern void test_crc8_atm_single_zero_byte(void);
 extern void test_crc8_atm_test_pattern_12345678(void);
@@ -123,6 +126,160 @@ extern void test_driver_no_op_behavior(void);
 extern void test_driver_switching(void);
 extern void test_driver_clear(void);
 
+// OneWire Backend Tests
+extern void test_onewire_backend_write_bytes_chunked(void);
+extern void test_onewire_backend_read_rom_from_device(void);
+extern void test_onewire_backend_match_rom_single_transfer(void);
+extern void test_onewire_backend_presence_and_lifecycle(void);
+extern void test_onewire_pin_constructors_time_slots(void);
+
+// GPIO Edge Monitor Tests
+extern void test_gpio_edge_monitor_coalesces_bounces(void);
+extern void test_gpio_edge_monitor_drops_glitch(void);
+extern void test_gpio_edge_monitor_rising_only(void);
+extern void test_gpio_edge_monitor_rising_only_repeats(void);
+extern void test_gpio_edge_monitor_counts_overflow(void);
+
+// GPIO Trace Tests
+extern void test_gpio_trace_records_calls_with_virtual_time(void);
+extern void test_gpio_trace_stats_and_overflow(void);
+extern void test_gpio_trace_exports_vcd(void);
+
+// Analog Source Tests
+extern void test_analog_source_sine_and_ramp(void);
+extern void test_analog_source_noise_is_deterministic(void);
+extern void test_analog_source_csv_replay(void);
+extern void test_analog_source_drives_native_driver(void);
+
+// Measurement Filter Tests
+extern void test_filter_moving_average_window(void);
+extern void test_filter_ema_converges(void);
+extern void test_filter_median_rejects_spikes(void);
+extern void test_filter_kalman_tracks_noisy_constant(void);
+extern void test_filter_reading_filter_applies_and_clamps(void);
+
+// Measurement Packetiser Tests
+extern void test_packetiser_roundtrip_across_packets(void);
+extern void test_packetiser_large_and_negative_deltas(void);
+extern void test_packetiser_rejects_malformed_packets(void);
+extern void test_varint_codec_bounds(void);
+
+// Send-on-Delta Tests
+extern void test_send_on_delta_deadband_and_heartbeat(void);
+extern void test_sensor_should_broadcast_by_reporting_mode(void);
+extern void test_broker_step_hold_reconstruction(void);
+extern void test_step_hold_series_ring_and_order(void);
+
+// Adaptive Sampling Tests
+extern void test_adaptive_sampler_backs_off_when_steady(void);
+extern void test_adaptive_sampler_shortens_on_change(void);
+extern void test_time_reschedule_without_drift(void);
+extern void test_sensor_applies_broker_sampling_bounds(void);
+extern void test_broker_sampling_config_reschedules_sensor_timer(void);
+
+// Shared-Memory BLE Transport Tests
+extern void test_shm_transport_round_trip_between_mappings(void);
+extern void test_shm_transport_full_ring_drops_newest(void);
+extern void test_shm_transport_across_processes(void);
+extern void test_native_driver_over_shm_transport(void);
+
+// Native Reactor Tests
+extern void test_reactor_sleeps_until_timer_deadline(void);
+extern void test_reactor_does_not_sleep_on_deadline_past_clock_wrap(void);
+extern void test_reactor_dispatches_ready_fd(void);
+extern void test_reactor_wakes_on_dispatch_and_stop(void);
+extern void test_reactor_wakes_on_shm_transport(void);
+
+// Context Tests
+extern void test_event_contexts_are_independent(void);
+extern void test_event_dispatcher_forwards_to_default_context(void);
+extern void test_timer_contexts_are_independent(void);
+extern void test_time_forwards_to_default_context(void);
+extern void test_contexts_run_on_separate_threads(void);
+
+// Multi-Radio Broker Tests
+extern void test_multi_radio_broker_balances_sensors(void);
+extern void test_multi_radio_broker_merges_readings(void);
+extern void test_roles_bound_to_driver_ignore_global_driver(void);
+extern void test_multi_radio_broker_limits(void);
+
+// Session Snapshot Tests
+extern void test_session_snapshot_round_trip(void);
+extern void test_session_snapshot_rejects_corruption(void);
+extern void test_sensor_resumes_session_without_start_broadcast(void);
+extern void test_sensor_restore_keeps_adaptive_sampling(void);
+extern void test_file_snapshot_store_save_load_clear(void);
+
+// Reading Journal Tests
+extern void test_reading_journal_recovers_after_reopen(void);
+extern void test_reading_journal_receipt_truncates_and_persists(void);
+extern void test_reading_journal_skips_torn_record(void);
+extern void test_reading_journal_full_until_acknowledged(void);
+extern void test_reading_journal_reclaim_survives_reopen(void);
+
+// Ingest WAL Tests
+extern void test_ingest_wal_commits_full_batch(void);
+extern void test_ingest_wal_commits_after_delay(void);
+extern void test_ingest_wal_recovers_and_cuts_torn_tail(void);
+extern void test_ingest_wal_clear_keeps_offsets(void);
+extern void test_ingest_wal_fails_when_rollback_fails(void);
+extern void test_ingest_wal_fails_when_sync_fails(void);
+
+// Session Archive Tests
+extern void test_session_archive_round_trip_and_range_query(void);
+extern void test_session_archive_recovers_unsealed_segment(void);
+extern void test_session_archive_compaction_merges_fragments(void);
+extern void test_session_archive_hides_unfinished_compaction(void);
+extern void test_session_archive_skips_corrupt_sealed_block(void);
+
+// Aggregates Tests
+extern void test_running_stats_welford_and_merge(void);
+extern void test_bucketed_aggregates_close_and_drain(void);
+extern void test_downsample_bounds_and_keeps_extremes(void);
+extern void test_broker_aggregates_session_readings(void);
+
+// Quantile Sketch Tests
+extern void test_quantile_sketch_exact_while_small(void);
+extern void test_quantile_sketch_bounded_memory_and_error(void);
+extern void test_quantile_sketch_merge_matches_combined_stream(void);
+extern void test_quantile_sketch_serialize_round_trip(void);
+
+// BLE Trace Tests
+extern void test_ble_trace_round_trip(void);
+extern void test_recording_driver_captures_both_directions(void);
+extern void test_replay_driver_delivers_as_fast_as_possible(void);
+extern void test_replay_driver_follows_scaled_clock(void);
+
+// Profiling BLE Driver Tests
+extern void test_profiling_driver_counts_traffic_by_direction_and_type(void);
+extern void test_profiling_driver_times_callbacks(void);
+extern void test_profiling_driver_tracks_inbox_high_water(void);
+
+// Link Quality Tests
+extern void test_link_quality_counts_loss_and_gaps(void);
+extern void test_link_quality_separates_late_and_duplicate_readings(void);
+extern void test_link_quality_jitter_and_interval_change(void);
+extern void test_brokers_track_link_quality_per_session(void);
+extern void test_broker_scores_each_sensor_on_its_own_cadence(void);
+
+// Health Tests
+extern void test_health_message_roundtrip_and_size(void);
+extern void test_health_decoder_resyncs_after_lost_delta(void);
+extern void test_health_decoder_resets_on_sensor_restart(void);
+extern void test_health_sampled_from_internal_state(void);
+extern void test_broker_aggregates_fleet_health(void);
+
+// Callback Budget Tests
+extern void test_event_budget_counts_overruns_and_worst_offender(void);
+extern void test_event_pass_budget_defers_remaining_events(void);
+extern void test_event_limit_counts_callbacks(void);
+extern void test_timer_budgets_and_fair_deferral(void);
+
+// Runtime Tests
+extern void test_runtime_orders_phases_by_priority_and_rotates_ties(void);
+extern void test_runtime_bounds_events_and_timers_per_pass(void);
+extern void test_runtime_bounds_ble_intake_and_profiles_phases(void);
+
 void setUp(void) {}
 void tearDown(void) {}
 
@@ -142,6 +299,9 @@ int main() {
     RUN_TEST(test_voltage_levels_and_tmp36);
     RUN_TEST(test_tmp36_conversion_10bit_5v);
     RUN_TEST(test_tmp36_conversion_12bit_3v3);
+    RUN_TEST(test_tmp36_lut_matches_float_conversion);
+    RUN_TEST(test_tmp36_oversampling_interpolates);
+    RUN_TEST(test_tmp36_driver_reads_native_pin);
     RUN_TEST(test_crc8_atm_empty_data);
     RUN_TEST(test_crc8_atm_single_zero_byte);
     RUN_TEST(test_crc8_atm_test_pattern_12345678);
@@ -245,5 +405,159 @@ int main() {
     RUN_TEST(test_driver_switching);
     RUN_TEST(test_driver_clear);
 
+    // OneWire Backend Tests
+    RUN_TEST(test_onewire_backend_write_bytes_chunked);
+    RUN_TEST(test_onewire_backend_read_rom_from_device);
+    RUN_TEST(test_onewire_backend_match_rom_single_transfer);
+    RUN_TEST(test_onewire_backend_presence_and_lifecycle);
+    RUN_TEST(test_onewire_pin_constructors_time_slots);
+
+    // GPIO Edge Monitor Tests
+    RUN_TEST(test_gpio_edge_monitor_coalesces_bounces);
+    RUN_TEST(test_gpio_edge_monitor_drops_glitch);
+    RUN_TEST(test_gpio_edge_monitor_rising_only);
+    RUN_TEST(test_gpio_edge_monitor_rising_only_repeats);
+    RUN_TEST(test_gpio_edge_monitor_counts_overflow);
+
+    // GPIO Trace Tests
+    RUN_TEST(test_gpio_trace_records_calls_with_virtual_time);
+    RUN_TEST(test_gpio_trace_stats_and_overflow);
+    RUN_TEST(test_gpio_trace_exports_vcd);
+
+    // Analog Source Tests
+    RUN_TEST(test_analog_source_sine_and_ramp);
+    RUN_TEST(test_analog_source_noise_is_deterministic);
+    RUN_TEST(test_analog_source_csv_replay);
+    RUN_TEST(test_analog_source_drives_native_driver);
+
+    // Measurement Filter Tests
+    RUN_TEST(test_filter_moving_average_window);
+    RUN_TEST(test_filter_ema_converges);
+    RUN_TEST(test_filter_median_rejects_spikes);
+    RUN_TEST(test_filter_kalman_tracks_noisy_constant);
+    RUN_TEST(test_filter_reading_filter_applies_and_clamps);
+
+    // Measurement Packetiser Tests
+    RUN_TEST(test_packetiser_roundtrip_across_packets);
+    RUN_TEST(test_packetiser_large_and_negative_deltas);
+    RUN_TEST(test_packetiser_rejects_malformed_packets);
+    RUN_TEST(test_varint_codec_bounds);
+
+    // Send-on-Delta Tests
+    RUN_TEST(test_send_on_delta_deadband_and_heartbeat);
+    RUN_TEST(test_sensor_should_broadcast_by_reporting_mode);
+    RUN_TEST(test_broker_step_hold_reconstruction);
+    RUN_TEST(test_step_hold_series_ring_and_order);
+
+    // Adaptive Sampling Tests
+    RUN_TEST(test_adaptive_sampler_backs_off_when_steady);
+    RUN_TEST(test_adaptive_sampler_shortens_on_change);
+    RUN_TEST(test_time_reschedule_without_drift);
+    RUN_TEST(test_sensor_applies_broker_sampling_bounds);
+    RUN_TEST(test_broker_sampling_config_reschedules_sensor_timer);
+
+    // Shared-Memory BLE Transport Tests
+    RUN_TEST(test_shm_transport_round_trip_between_mappings);
+    RUN_TEST(test_shm_transport_full_ring_drops_newest);
+    RUN_TEST(test_shm_transport_across_processes);
+    RUN_TEST(test_native_driver_over_shm_transport);
+
+    // Native Reactor Tests
+    RUN_TEST(test_reactor_sleeps_until_timer_deadline);
+    RUN_TEST(test_reactor_does_not_sleep_on_deadline_past_clock_wrap);
+    RUN_TEST(test_reactor_dispatches_ready_fd);
+    RUN_TEST(test_reactor_wakes_on_dispatch_and_stop);
+    RUN_TEST(test_reactor_wakes_on_shm_transport);
+
+    // Context Tests
+    RUN_TEST(test_event_contexts_are_independent);
+    RUN_TEST(test_event_dispatcher_forwards_to_default_context);
+    RUN_TEST(test_timer_contexts_are_independent);
+    RUN_TEST(test_time_forwards_to_default_context);
+    RUN_TEST(test_contexts_run_on_separate_threads);
+
+    // Multi-Radio Broker Tests
+    RUN_TEST(test_multi_radio_broker_balances_sensors);
+    RUN_TEST(test_multi_radio_broker_merges_readings);
+    RUN_TEST(test_roles_bound_to_driver_ignore_global_driver);
+    RUN_TEST(test_multi_radio_broker_limits);
+
+    // Session Snapshot Tests
+    RUN_TEST(test_session_snapshot_round_trip);
+    RUN_TEST(test_session_snapshot_rejects_corruption);
+    RUN_TEST(test_sensor_resumes_session_without_start_broadcast);
+    RUN_TEST(test_sensor_restore_keeps_adaptive_sampling);
+    RUN_TEST(test_file_snapshot_store_save_load_clear);
+
+    // Reading Journal Tests
+    RUN_TEST(test_reading_journal_recovers_after_reopen);
+    RUN_TEST(test_reading_journal_receipt_truncates_and_persists);
+    RUN_TEST(test_reading_journal_skips_torn_record);
+    RUN_TEST(test_reading_journal_full_until_acknowledged);
+    RUN_TEST(test_reading_journal_reclaim_survives_reopen);
+
+    // Ingest WAL Tests
+    RUN_TEST(test_ingest_wal_commits_full_batch);
+    RUN_TEST(test_ingest_wal_commits_after_delay);
+    RUN_TEST(test_ingest_wal_recovers_and_cuts_torn_tail);
+    RUN_TEST(test_ingest_wal_clear_keeps_offsets);
+    RUN_TEST(test_ingest_wal_fails_when_rollback_fails);
+    RUN_TEST(test_ingest_wal_fails_when_sync_fails);
+
+    // Session Archive Tests
+    RUN_TEST(test_session_archive_round_trip_and_range_query);
+    RUN_TEST(test_session_archive_recovers_unsealed_segment);
+    RUN_TEST(test_session_archive_compaction_merges_fragments);
+    RUN_TEST(test_session_archive_hides_unfinished_compaction);
+    RUN_TEST(test_session_archive_skips_corrupt_sealed_block);
+
+    // Aggregates Tests
+    RUN_TEST(test_running_stats_welford_and_merge);
+    RUN_TEST(test_bucketed_aggregates_close_and_drain);
+    RUN_TEST(test_downsample_bounds_and_keeps_extremes);
+    RUN_TEST(test_broker_aggregates_session_readings);
+
+    // Quantile Sketch Tests
+    RUN_TEST(test_quantile_sketch_exact_while_small);
+    RUN_TEST(test_quantile_sketch_bounded_memory_and_error);
+    RUN_TEST(test_quantile_sketch_merge_matches_combined_stream);
+    RUN_TEST(test_quantile_sketch_serialize_round_trip);
+
+    // BLE Trace Tests
+    RUN_TEST(test_ble_trace_round_trip);
+    RUN_TEST(test_recording_driver_captures_both_directions);
+    RUN_TEST(test_replay_driver_delivers_as_fast_as_possible);
+    RUN_TEST(test_replay_driver_follows_scaled_clock);
+
+    // Profiling BLE Driver Tests
+    RUN_TEST(test_profiling_driver_counts_traffic_by_direction_and_type);
+    RUN_TEST(test_profiling_driver_times_callbacks);
+    RUN_TEST(test_profiling_driver_tracks_inbox_high_water);
+
+    // Link Quality Tests
+    RUN_TEST(test_link_quality_counts_loss_and_gaps);
+    RUN_TEST(test_link_quality_separates_late_and_duplicate_readings);
+    RUN_TEST(test_link_quality_jitter_and_interval_change);
+    RUN_TEST(test_brokers_track_link_quality_per_session);
+    RUN_TEST(test_broker_scores_each_sensor_on_its_own_cadence);
+
+    // Health Tests
+    RUN_TEST(test_health_message_roundtrip_and_size);
+    RUN_TEST(test_health_decoder_resyncs_after_lost_delta);
+    RUN_TEST(test_health_decoder_resets_on_sensor_restart);
+    RUN_TEST(test_health_sampled_from_internal_state);
+    RUN_TEST(test_broker_aggregates_fleet_health);
+
+    // Callback Budget Tests
+    RUN_TEST(test_event_budget_counts_overruns_and_worst_offender);
+    RUN_TEST(test_event_pass_budget_defers_remaining_events);
+    RUN_TEST(test_event_limit_counts_callbacks);
+    RUN_TEST(test_timer_budgets_and_fair_deferral);
+
+    // Runtime Tests
+    RUN_TEST(test_runtime_orders_phases_by_priority_and_rotates_ties);
+    RUN_TEST(test_runtime_bounds_events_and_timers_per_pass);
+    RUN_TEST(test_runtime_bounds_ble_intake_and_profiles_phases);
+
     return UNITY_END();
 }
@@ -0,0 +1,87 @@
+//! @file tests/AnalogSourceTests.cpp
+//! @brief Scripted analog source tests for the native GPIO driver.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include <unity.h>
+#include <sstream>
+#include "jenlib/gpio/drivers/NativeAnalogSources.h"
+#include "jenlib/gpio/drivers/NativeGpioDriver.h"
+
+using jenlib::gpio::CsvSource;
+using jenlib::gpio::DigitalValue;
+using jenlib::gpio::NativeGpioDriver;
+using jenlib::gpio::NoiseSource;
+using jenlib::gpio::RampSource;
+using jenlib::gpio::SineSource;
+
+//! @test test_analog_source_sine_and_ramp
+//! @brief Verifies sine and ramp values at known points in virtual time.
+void test_analog_source_sine_and_ramp(void) {
+    const SineSource sine(1.0f, 0.5f, 1000.0f);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 1.0f, sine.voltage_at(0));
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 1.5f, sine.voltage_at(250000));   // Quarter period of 1 kHz
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 0.5f, sine.voltage_at(750000));
+
+    const RampSource ramp(0.0f, 2.0f, 1000000);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 1.0f, ramp.voltage_at(500000));
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 2.0f, ramp.voltage_at(5000000));
+
+    const RampSource saw(0.0f, 2.0f, 1000000, true);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 0.5f, saw.voltage_at(1250000));
+}
+
+//! @test test_analog_source_noise_is_deterministic
+//! @brief Verifies noise stays within bounds and repeats for the same time and seed.
+void test_analog_source_noise_is_deterministic(void) {
+    const NoiseSource a(0.75f, 0.01f, 42);
+    const NoiseSource b(0.75f, 0.01f, 42);
+    bool varies = false;
+    for (std::uint64_t t = 0; t < 1000; ++t) {
+        const float v = a.voltage_at(t * 1000);
+        TEST_ASSERT_FLOAT_WITHIN(0.01f, 0.75f, v);
+        TEST_ASSERT_EQUAL_FLOAT(v, b.voltage_at(t * 1000));
+        varies = varies || v != a.voltage_at(0);
+    }
+    TEST_ASSERT_TRUE(varies);
+}
+
+//! @test test_analog_source_csv_replay
+//! @brief Verifies CSV rows are held until the next timestamp and can loop.
+void test_analog_source_csv_replay(void) {
+    std::istringstream csv("time_ms,volts\n# comment\n0,0.5\n10,0.75\n20,1.0\n");
+    CsvSource source;
+    TEST_ASSERT_TRUE(source.load(csv));
+    TEST_ASSERT_EQUAL(3, source.samples().size());
+    TEST_ASSERT_EQUAL_FLOAT(0.5f, source.voltage_at(9999999));
+    TEST_ASSERT_EQUAL_FLOAT(0.75f, source.voltage_at(10000000));
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, source.voltage_at(500000000));
+
+    source.set_loop(true);
+    TEST_ASSERT_EQUAL_FLOAT(0.75f, source.voltage_at(35000000));
+
+    std::istringstream bad("0,0.5\n10\n");
+    TEST_ASSERT_FALSE(source.load(bad));
+}
+
+//! @test test_analog_source_drives_native_driver
+//! @brief Verifies analog_read and digital_read sample the source at the virtual time.
+void test_analog_source_drives_native_driver(void) {
+    NativeGpioDriver driver;
+    driver.set_reference_voltage(2.0f);
+    driver.set_analog_read_resolution(12);
+    const RampSource ramp(0.0f, 2.0f, 1000000);
+    driver.set_pin_source(1, &ramp);
+
+    TEST_ASSERT_EQUAL_UINT16(0, driver.analog_read(1));
+    TEST_ASSERT_TRUE(driver.digital_read(1) == DigitalValue::LOW);
+    driver.advance_time_us(500);
+    TEST_ASSERT_EQUAL_UINT16(2048, driver.analog_read(1));
+    driver.advance_time_us(500);
+    TEST_ASSERT_EQUAL_UINT16(4095, driver.analog_read(1));
+    TEST_ASSERT_TRUE(driver.digital_read(1) == DigitalValue::HIGH);
+
+    driver.set_pin_source(1, nullptr);
+    driver.set_pin_voltage(1, 1.0f);
+    TEST_ASSERT_EQUAL_UINT16(2048, driver.analog_read(1));
+}
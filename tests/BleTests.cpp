@@ -216,6 +216,7 @@ class TestBleDriver final : public jenlib::ble::BleDriver {
     void set_start_broadcast_callback(jenlib::ble::StartBroadcastCallback callback) override {}
     void set_reading_callback(jenlib::ble::ReadingCallback callback) override {}
     void set_receipt_callback(jenlib::ble::ReceiptCallback callback) override {}
+    void set_sampling_config_callback(jenlib::ble::SamplingConfigCallback callback) override {}
     void clear_type_specific_callbacks() override {}
     void set_connection_callback(jenlib::ble::ConnectionCallback callback) override {}
     void clear_connection_callback() override {}
@@ -0,0 +1,205 @@
+//! @file tests/BleTraceTests.cpp
+//! @brief Tests for BLE trace capture and replay
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include <unity.h>
+
+#if defined(__linux__)
+
+#include <string>
+#include <utility>
+#include <vector>
+#include "jenlib/ble/BleTrace.h"
+#include "jenlib/ble/Messages.h"
+#include "jenlib/ble/Roles.h"
+#include "jenlib/ble/drivers/NativeBleDriver.h"
+#include "jenlib/ble/drivers/RecordingBleDriver.h"
+#include "jenlib/ble/drivers/ReplayBleDriver.h"
+#include "TestHelpers.h"
+
+using jenlib::ble::BlePayload;
+using jenlib::ble::BleTraceDirection;
+using jenlib::ble::BleTraceRecord;
+using jenlib::ble::DeviceId;
+using jenlib::ble::ReadingMsg;
+using jenlib::ble::ReplayBleDriver;
+using jenlib::ble::SessionId;
+using jenlib::test::make_reading;
+using jenlib::test::remove_scratch;
+
+namespace {
+std::string trace_path() {
+    return jenlib::test::scratch_path("trace") + ".jbtr";
+}
+
+BleTraceRecord make_record(std::uint64_t time_us, BleTraceDirection direction, std::uint32_t device,
+                           std::uint32_t offset_ms) {
+    BleTraceRecord record;
+    record.time_us = time_us;
+    record.direction = direction;
+    record.device = DeviceId(device);
+    ReadingMsg::serialize(make_reading(DeviceId(device), SessionId(1), offset_ms), record.payload);
+    return record;
+}
+}  // namespace
+
+//! @test test_ble_trace_round_trip
+//! @brief Verifies records read back unchanged and a damaged header is rejected
+void test_ble_trace_round_trip(void) {
+    //! @section Arrange
+    jenlib::ble::BleTraceWriter writer;
+    TEST_ASSERT_TRUE(writer.open(trace_path().c_str()));
+    const BleTraceRecord first = make_record(5, BleTraceDirection::kInbound, 0x10, 1000);
+    const BleTraceRecord second = make_record(1ull << 40, BleTraceDirection::kSendTo, 0x20, 2000);
+
+    //! @section Act
+    TEST_ASSERT_TRUE(writer.write(first.time_us, first.direction, first.device, first.payload));
+    TEST_ASSERT_TRUE(writer.write(second.time_us, second.direction, second.device, second.payload));
+    writer.close();
+    std::vector<BleTraceRecord> records;
+    const bool loaded = jenlib::ble::load_ble_trace(trace_path().c_str(), records);
+    FILE* file = std::fopen(trace_path().c_str(), "r+b");
+    std::fputc('X', file);
+    std::fclose(file);
+    jenlib::ble::BleTraceReader damaged;
+    const bool damaged_opened = damaged.open(trace_path().c_str());
+
+    //! @section Assert
+    TEST_ASSERT_TRUE(loaded);
+    TEST_ASSERT_EQUAL(2, writer.records_written());
+    TEST_ASSERT_EQUAL(2, records.size());
+    TEST_ASSERT_EQUAL_UINT64(5, records[0].time_us);
+    TEST_ASSERT_EQUAL_UINT64(1ull << 40, records[1].time_us);
+    TEST_ASSERT_EQUAL(BleTraceDirection::kSendTo, records[1].direction);
+    TEST_ASSERT_EQUAL_UINT32(0x20, records[1].device.value());
+    TEST_ASSERT_EQUAL(second.payload.size, records[1].payload.size);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(second.payload.bytes.data(), records[1].payload.bytes.data(), second.payload.size);
+    TEST_ASSERT_FALSE(damaged_opened);
+    remove_scratch(trace_path());
+}
+
+//! @test test_recording_driver_captures_both_directions
+//! @brief Verifies the decorator records sent messages and callback deliveries while forwarding them
+void test_recording_driver_captures_both_directions(void) {
+    //! @section Arrange
+    jenlib::ble::NativeBleDriver radio(DeviceId(0));
+    jenlib::ble::BleTraceWriter writer;
+    writer.open(trace_path().c_str());
+    std::uint64_t now_us = 1000;
+    jenlib::ble::RecordingBleDriver recorder(radio, writer, [&now_us]() { return now_us; });
+    std::vector<std::uint32_t> offsets;
+    recorder.set_reading_callback([&offsets](DeviceId, const ReadingMsg& msg) { offsets.push_back(msg.offset_ms); });
+    recorder.begin();
+    jenlib::ble::Sensor sensor(DeviceId(0x10), &recorder);
+
+    //! @section Act
+    now_us = 1250;
+    sensor.broadcast_reading(make_reading(DeviceId(0x10), SessionId(1), 3000));
+    now_us = 1500;
+    jenlib::ble::Broker(&recorder).send_receipt(DeviceId(0x10), jenlib::ble::ReceiptMsg{SessionId(1), 3000});
+    BlePayload polled;
+    const bool received = recorder.receive(DeviceId(0x10), polled);
+    writer.close();
+    std::vector<BleTraceRecord> records;
+    jenlib::ble::load_ble_trace(trace_path().c_str(), records);
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL(1, offsets.size());
+    TEST_ASSERT_TRUE(received);
+    TEST_ASSERT_EQUAL(4, records.size());
+    TEST_ASSERT_EQUAL(BleTraceDirection::kAdvertise, records[0].direction);
+    TEST_ASSERT_EQUAL(BleTraceDirection::kInbound, records[1].direction);
+    TEST_ASSERT_EQUAL_UINT32(0x10, records[1].device.value());
+    TEST_ASSERT_EQUAL_UINT64(250, records[1].time_us);
+    ReadingMsg replayed;
+    TEST_ASSERT_TRUE(ReadingMsg::deserialize(records[1].payload, replayed));
+    TEST_ASSERT_EQUAL_UINT32(3000, replayed.offset_ms);
+    TEST_ASSERT_EQUAL(BleTraceDirection::kSendTo, records[2].direction);
+    TEST_ASSERT_EQUAL(BleTraceDirection::kReceived, records[3].direction);
+    TEST_ASSERT_EQUAL_UINT64(500, records[3].time_us);
+    TEST_ASSERT_EQUAL(0, recorder.write_errors());
+    remove_scratch(trace_path());
+}
+
+//! @test test_replay_driver_delivers_as_fast_as_possible
+//! @brief Verifies fast replay batches inbound records into callbacks and the inbox and skips outbound ones
+void test_replay_driver_delivers_as_fast_as_possible(void) {
+    //! @section Arrange
+    std::vector<BleTraceRecord> records;
+    for (std::uint32_t i = 0; i < 10; ++i) {
+        records.push_back(make_record(i * 1000000ull, BleTraceDirection::kInbound, 0x10 + i % 2, i * 1000));
+    }
+    records.push_back(make_record(11000000, BleTraceDirection::kSendTo, 0x10, 0));
+    records.push_back(make_record(12000000, BleTraceDirection::kReceived, 0x10, 42));
+    ReplayBleDriver replay(DeviceId(0), std::move(records));
+    replay.set_batch(4);
+    std::vector<std::uint32_t> senders;
+    replay.set_reading_callback([&senders](DeviceId sender, const ReadingMsg&) { senders.push_back(sender.value()); });
+    replay.begin();
+
+    //! @section Act
+    replay.poll();
+    const std::size_t after_first_poll = senders.size();
+    while (!replay.finished()) {
+        replay.poll();
+    }
+    replay.send_to(DeviceId(0x10), BlePayload{});
+    BlePayload polled;
+    const bool received = replay.receive(DeviceId(0x10), polled);
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL(4, after_first_poll);
+    TEST_ASSERT_EQUAL(10, senders.size());
+    TEST_ASSERT_EQUAL_UINT32(0x11, senders[1]);
+    TEST_ASSERT_EQUAL(11, replay.replayed());
+    TEST_ASSERT_EQUAL(1, replay.sent());
+    TEST_ASSERT_TRUE(received);
+    ReadingMsg reading;
+    TEST_ASSERT_TRUE(ReadingMsg::deserialize(polled, reading));
+    TEST_ASSERT_EQUAL_UINT32(42, reading.offset_ms);
+    TEST_ASSERT_EQUAL_UINT64(0, replay.last_lateness_us());
+}
+
+//! @test test_replay_driver_follows_scaled_clock
+//! @brief Verifies scaled replay delivers records only when the scaled clock reaches them
+void test_replay_driver_follows_scaled_clock(void) {
+    //! @section Arrange
+    std::vector<BleTraceRecord> records;
+    for (std::uint32_t i = 0; i < 4; ++i) {
+        records.push_back(make_record(500000 + i * 1000000ull, BleTraceDirection::kInbound, 0x10, i * 1000));
+    }
+    std::uint64_t now_us = 0;
+    ReplayBleDriver replay(DeviceId(0), std::move(records), 2.0, [&now_us]() { return now_us; });
+    std::size_t delivered = 0;
+    replay.set_reading_callback([&delivered](DeviceId, const ReadingMsg&) { ++delivered; });
+    replay.begin();
+
+    //! @section Act
+    replay.poll();
+    const std::size_t at_start = delivered;
+    now_us = 499999;  // Just short of the second record, 1 s of trace time at double speed
+    replay.poll();
+    const std::size_t before_second = delivered;
+    now_us = 1100000;
+    replay.poll();
+    const std::size_t after_late_poll = delivered;
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL(1, at_start);
+    TEST_ASSERT_EQUAL(1, before_second);
+    TEST_ASSERT_EQUAL(3, after_late_poll);
+    TEST_ASSERT_EQUAL_UINT64(100000, replay.last_lateness_us());
+    TEST_ASSERT_FALSE(replay.finished());
+    replay.rewind();
+    TEST_ASSERT_EQUAL(0, replay.replayed());
+}
+
+#else
+
+void test_ble_trace_round_trip(void) { TEST_IGNORE(); }
+void test_recording_driver_captures_both_directions(void) { TEST_IGNORE(); }
+void test_replay_driver_delivers_as_fast_as_possible(void) { TEST_IGNORE(); }
+void test_replay_driver_follows_scaled_clock(void) { TEST_IGNORE(); }
+
+#endif  // __linux__
@@ -0,0 +1,167 @@
+//! @file tests/CallbackBudgetTests.cpp
+//! @brief Tests for per-callback execution budgets and pass budgets in event and timer contexts
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include <unity.h>
+#include <vector>
+#include "jenlib/events/EventContext.h"
+#include "jenlib/time/TimeDriver.h"
+#include "jenlib/time/TimerContext.h"
+#include "TestHelpers.h"
+
+using jenlib::events::Event;
+using jenlib::events::EventContext;
+using jenlib::events::EventType;
+using jenlib::test::ManualTimeDriver;
+using jenlib::time::CallbackStats;
+
+namespace {
+Event custom_event(std::uint32_t data) {
+    return Event(EventType::kCustom, 0, data);
+}
+}  // namespace
+
+//! @test test_event_budget_counts_overruns_and_worst_offender
+//! @brief Verifies callbacks are timed with the driver and the slowest overrunning one is named
+void test_event_budget_counts_overruns_and_worst_offender(void) {
+    //! @section Arrange
+    ManualTimeDriver clock;
+    EventContext events;
+    events.set_time_driver(&clock);
+    const auto quick = events.register_callback(EventType::kCustom, [&](const Event&) { clock.delay(2); });
+    const auto slow = events.register_callback(EventType::kCustom, [&](const Event& event) {
+        clock.delay(event.data == 1 ? 25 : 8);
+    });
+    const auto unbudgeted = events.register_callback(EventType::kCustom, [&](const Event&) { clock.delay(40); });
+    events.set_callback_budget(quick, 5);
+    events.set_callback_budget(slow, 10);
+
+    //! @section Act
+    for (std::uint32_t i = 0; i < 3; ++i) {
+        events.dispatch_event(custom_event(i));
+    }
+    const std::size_t processed = events.process_events();
+    CallbackStats slow_stats;
+    const bool found = events.get_callback_stats(slow, slow_stats);
+    const CallbackStats worst = events.get_worst_offender();
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL(9, processed);
+    TEST_ASSERT_TRUE(found);
+    TEST_ASSERT_EQUAL_UINT32(3, slow_stats.calls);
+    TEST_ASSERT_EQUAL_UINT32(1, slow_stats.overruns);
+    TEST_ASSERT_EQUAL_UINT32(25, slow_stats.worst_ms);
+    TEST_ASSERT_EQUAL_UINT32(41, slow_stats.total_ms);
+    TEST_ASSERT_EQUAL_UINT32(1, events.get_overrun_count());  // No budget on the 40 ms callback
+    TEST_ASSERT_EQUAL_UINT32(slow, worst.id);
+    TEST_ASSERT_FALSE(events.set_callback_budget(unbudgeted + 100, 1));
+    events.reset_callback_stats();
+    TEST_ASSERT_TRUE(events.get_callback_stats(slow, slow_stats));
+    TEST_ASSERT_EQUAL_UINT32(0, slow_stats.calls);
+    TEST_ASSERT_EQUAL_UINT32(10, slow_stats.budget_ms);
+}
+
+//! @test test_event_pass_budget_defers_remaining_events
+//! @brief Verifies a spent pass budget leaves events queued, and events dispatched by callbacks wait a pass
+void test_event_pass_budget_defers_remaining_events(void) {
+    //! @section Arrange
+    ManualTimeDriver clock;
+    EventContext events;
+    events.set_time_driver(&clock);
+    events.set_pass_budget_ms(10);
+    std::vector<std::uint32_t> handled;
+    events.register_callback(EventType::kCustom, [&](const Event& event) {
+        handled.push_back(event.data);
+        clock.delay(6);
+        if (event.data == 0) {
+            events.dispatch_event(custom_event(99));
+        }
+    });
+    for (std::uint32_t i = 0; i < 5; ++i) {
+        events.dispatch_event(custom_event(i));
+    }
+
+    //! @section Act
+    const std::size_t first = events.process_events();
+    const std::size_t second = events.process_events();
+    const std::size_t third = events.process_events();
+    const std::size_t fourth = events.process_events();
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL(2, first);  // 6 ms, then 12 ms spent
+    TEST_ASSERT_EQUAL(2, second);
+    TEST_ASSERT_EQUAL(2, third);  // Event 4, then the one event 0 dispatched
+    TEST_ASSERT_EQUAL(0, fourth);
+    TEST_ASSERT_EQUAL(6, handled.size());
+    TEST_ASSERT_EQUAL_UINT32(99, handled.back());
+    TEST_ASSERT_EQUAL_UINT32(2, events.get_deferred_passes());
+}
+
+//! @test test_event_limit_counts_callbacks
+//! @brief Verifies the process_events limit is in callbacks, like its result, and never splits an event
+void test_event_limit_counts_callbacks(void) {
+    //! @section Arrange
+    EventContext events;
+    std::vector<std::uint32_t> handled;
+    events.register_callback(EventType::kCustom, [&](const Event& event) { handled.push_back(event.data); });
+    events.register_callback(EventType::kCustom, [&](const Event& event) { handled.push_back(event.data); });
+    for (std::uint32_t i = 0; i < 3; ++i) {
+        events.dispatch_event(custom_event(i));
+    }
+
+    //! @section Act
+    const std::size_t first = events.process_events(3);
+    const std::size_t second = events.process_events(1);
+    const std::size_t third = events.process_events(4);
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL(2, first);   // A second event would need 4 callbacks
+    TEST_ASSERT_EQUAL(2, second);  // The first event runs whole even over the limit
+    TEST_ASSERT_EQUAL(2, third);
+    TEST_ASSERT_EQUAL(6, handled.size());
+    TEST_ASSERT_EQUAL_UINT32(2, handled.back());
+    TEST_ASSERT_EQUAL(0, events.get_pending_event_count());
+    TEST_ASSERT_EQUAL_UINT32(2, events.get_deferred_passes());
+}
+
+//! @test test_timer_budgets_and_fair_deferral
+//! @brief Verifies timer overruns are attributed and a deferred timer goes first in the next pass
+void test_timer_budgets_and_fair_deferral(void) {
+    //! @section Arrange
+    ManualTimeDriver clock;
+    jenlib::time::TimerContext timers(&clock);
+    timers.set_pass_budget_ms(5);
+    std::vector<char> fired;
+    const auto hot = timers.schedule_callback(10, [&] {
+        fired.push_back('h');
+        clock.delay(8);
+    }, true);
+    const auto measure = timers.schedule_callback(10, [&] {
+        fired.push_back('m');
+        clock.delay(9);
+    }, true);
+    timers.set_callback_budget(hot, 5);
+    timers.set_callback_budget(measure, 5);
+
+    //! @section Act
+    clock.now_ms = 10;
+    const std::size_t first = timers.process_timers();
+    const std::size_t second = timers.process_timers();
+    clock.now_ms = 40;
+    const std::size_t third = timers.process_timers();
+    const CallbackStats worst = timers.get_worst_offender();
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL(1, first);
+    TEST_ASSERT_EQUAL(1, second);
+    TEST_ASSERT_EQUAL(1, third);
+    TEST_ASSERT_EQUAL(3, fired.size());
+    TEST_ASSERT_EQUAL('h', fired[0]);
+    TEST_ASSERT_EQUAL('m', fired[1]);  // Deferred, not starved
+    TEST_ASSERT_EQUAL('m', fired[2]);  // The pass starts where the last one stopped
+    TEST_ASSERT_EQUAL_UINT32(2, timers.get_deferred_passes());
+    TEST_ASSERT_EQUAL_UINT32(3, timers.get_overrun_count());
+    TEST_ASSERT_EQUAL_UINT32(measure, worst.id);
+    TEST_ASSERT_EQUAL_UINT32(2, worst.overruns);
+}
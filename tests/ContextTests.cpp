@@ -0,0 +1,155 @@
+//! @file tests/ContextTests.cpp
+//! @brief Tests for instance-based event and timer contexts
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include <unity.h>
+#include <array>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "jenlib/events/EventContext.h"
+#include "jenlib/events/EventDispatcher.h"
+#include "jenlib/time/Time.h"
+#include "jenlib/time/TimerContext.h"
+#include "TestHelpers.h"
+
+using jenlib::test::ManualTimeDriver;
+
+//! @test test_event_contexts_are_independent
+//! @brief Verifies events dispatched to one context never reach another
+void test_event_contexts_are_independent(void) {
+    //! @section Arrange
+    jenlib::events::EventContext first;
+    jenlib::events::EventContext second;
+    int first_handled = 0;
+    int second_handled = 0;
+    first.register_callback(jenlib::events::EventType::kCustom,
+                            [&first_handled](const jenlib::events::Event&) { ++first_handled; });
+    second.register_callback(jenlib::events::EventType::kCustom,
+                             [&second_handled](const jenlib::events::Event&) { ++second_handled; });
+
+    //! @section Act
+    first.dispatch_event(jenlib::events::Event(jenlib::events::EventType::kCustom, 0, 1));
+    first.dispatch_event(jenlib::events::Event(jenlib::events::EventType::kCustom, 0, 2));
+    const std::size_t second_processed = second.process_events();
+    const std::size_t first_processed = first.process_events();
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL(2, first_processed);
+    TEST_ASSERT_EQUAL(0, second_processed);
+    TEST_ASSERT_EQUAL(2, first_handled);
+    TEST_ASSERT_EQUAL(0, second_handled);
+    TEST_ASSERT_EQUAL(0, jenlib::events::EventDispatcher::get_callback_count(jenlib::events::EventType::kCustom));
+}
+
+//! @test test_event_dispatcher_forwards_to_default_context
+//! @brief Verifies the static API and the default context share one queue and registry
+void test_event_dispatcher_forwards_to_default_context(void) {
+    //! @section Arrange
+    jenlib::events::EventDispatcher::clear_all_callbacks();
+    jenlib::events::EventContext& context = jenlib::events::EventDispatcher::default_context();
+    int handled = 0;
+    const jenlib::events::EventId id = jenlib::events::EventDispatcher::register_callback(
+        jenlib::events::EventType::kTimeTick, [&handled](const jenlib::events::Event&) { ++handled; });
+
+    //! @section Act
+    jenlib::events::EventDispatcher::dispatch_event(jenlib::events::Event(jenlib::events::EventType::kTimeTick, 0));
+    const std::size_t pending = context.get_pending_event_count();
+    const std::size_t processed = context.process_events();
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL(1, pending);
+    TEST_ASSERT_EQUAL(1, processed);
+    TEST_ASSERT_EQUAL(1, handled);
+    TEST_ASSERT_EQUAL(1, context.get_callback_count(jenlib::events::EventType::kTimeTick));
+    TEST_ASSERT_TRUE(jenlib::events::EventDispatcher::unregister_callback(id));
+}
+
+//! @test test_timer_contexts_are_independent
+//! @brief Verifies each timer context keeps its own timers, IDs and clock
+void test_timer_contexts_are_independent(void) {
+    //! @section Arrange
+    ManualTimeDriver fast_clock;
+    ManualTimeDriver slow_clock;
+    jenlib::time::TimerContext fast(&fast_clock);
+    jenlib::time::TimerContext slow(&slow_clock);
+    int fast_fired = 0;
+    int slow_fired = 0;
+    const jenlib::time::TimerId fast_id = fast.schedule_callback(100, [&fast_fired]() { ++fast_fired; }, true);
+    const jenlib::time::TimerId slow_id = slow.schedule_callback(100, [&slow_fired]() { ++slow_fired; }, true);
+
+    //! @section Act
+    for (int i = 0; i < 5; ++i) {
+        fast_clock.delay(100);
+        fast.process_timers();
+        slow.process_timers();
+    }
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL(1, fast_id);
+    TEST_ASSERT_EQUAL(1, slow_id);  // IDs are per context
+    TEST_ASSERT_EQUAL(5, fast_fired);
+    TEST_ASSERT_EQUAL(0, slow_fired);
+    TEST_ASSERT_EQUAL(1, fast.get_active_timer_count());
+    TEST_ASSERT_EQUAL(0, jenlib::time::Time::get_active_timer_count());
+}
+
+//! @test test_time_forwards_to_default_context
+//! @brief Verifies the static Time API drives the default timer context
+void test_time_forwards_to_default_context(void) {
+    //! @section Arrange
+    ManualTimeDriver clock;
+    jenlib::time::Time::setDriver(&clock);
+    jenlib::time::Time::clear_all_timers();
+    int fired = 0;
+    jenlib::time::schedule_one_shot(50, [&fired]() { ++fired; });
+    jenlib::time::TimerContext& context = jenlib::time::Time::default_context();
+
+    //! @section Act
+    clock.delay(50);
+    const std::size_t processed = context.process_timers();
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL_PTR(&clock, context.driver());
+    TEST_ASSERT_EQUAL(1, processed);
+    TEST_ASSERT_EQUAL(1, fired);
+    TEST_ASSERT_EQUAL(0, jenlib::time::Time::get_total_timer_count());
+    jenlib::time::Time::setDriver(nullptr);
+}
+
+//! @test test_contexts_run_on_separate_threads
+//! @brief Verifies one context per thread needs no locking to deliver every event
+void test_contexts_run_on_separate_threads(void) {
+    //! @section Arrange
+    constexpr std::size_t kThreads = 4;
+    constexpr std::uint32_t kEventsPerThread = 20000;
+    std::array<std::uint32_t, kThreads> handled{};
+    std::vector<std::thread> workers;
+
+    //! @section Act
+    for (std::size_t t = 0; t < kThreads; ++t) {
+        workers.emplace_back([&handled, t]() {
+            jenlib::events::EventContext events;
+            std::uint32_t sum = 0;
+            events.register_callback(jenlib::events::EventType::kCustom,
+                                     [&sum](const jenlib::events::Event& event) { sum += event.data; });
+            for (std::uint32_t i = 0; i < kEventsPerThread; ++i) {
+                events.dispatch_event(jenlib::events::Event(jenlib::events::EventType::kCustom, i, 1));
+                if (events.get_pending_event_count() == jenlib::events::EventContext::kMaxEventQueueSize) {
+                    events.process_events();
+                }
+            }
+            events.process_events();
+            handled[t] = sum;
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    //! @section Assert
+    for (std::size_t t = 0; t < kThreads; ++t) {
+        TEST_ASSERT_EQUAL_UINT32(kEventsPerThread, handled[t]);
+    }
+}
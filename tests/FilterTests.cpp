@@ -0,0 +1,90 @@
+//! @file tests/FilterTests.cpp
+//! @brief Fixed-point measurement filter tests.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include <unity.h>
+#include <array>
+#include "jenlib/measurement/Filters.h"
+
+using jenlib::measurement::ExponentialMovingAverage;
+using jenlib::measurement::Kalman1D;
+using jenlib::measurement::MedianFilter;
+using jenlib::measurement::MovingAverage;
+using jenlib::measurement::ReadingFilter;
+using jenlib::measurement::Sample;
+
+//! @test test_filter_moving_average_window
+//! @brief Verifies the running sum averages the last N samples with rounding.
+void test_filter_moving_average_window(void) {
+    MovingAverage<4> filter;
+    const std::array<Sample, 6> input{10, 20, 30, 40, 50, -100};
+    std::array<Sample, 6> output{};
+    filter.process(input.begin(), input.end(), output.begin());
+
+    const std::array<Sample, 6> expected{10, 15, 20, 25, 35, 5};
+    TEST_ASSERT_EQUAL_INT32_ARRAY(expected.data(), output.data(), expected.size());
+}
+
+//! @test test_filter_ema_converges
+//! @brief Verifies the EMA starts at the first sample and settles on a step.
+void test_filter_ema_converges(void) {
+    ExponentialMovingAverage<2> filter;
+    TEST_ASSERT_EQUAL_INT32(1000, filter.update(1000));
+    TEST_ASSERT_EQUAL_INT32(1250, filter.update(2000));
+    Sample last = 0;
+    for (int i = 0; i < 40; ++i) {
+        last = filter.update(2000);
+    }
+    TEST_ASSERT_INT32_WITHIN(1, 2000, last);
+
+    filter.reset();
+    TEST_ASSERT_EQUAL_INT32(-300, filter.update(-300));
+}
+
+//! @test test_filter_median_rejects_spikes
+//! @brief Verifies a single-sample spike does not reach the median output.
+void test_filter_median_rejects_spikes(void) {
+    MedianFilter<5> filter;
+    TEST_ASSERT_EQUAL_INT32(7, filter.update(7));
+    TEST_ASSERT_EQUAL_INT32(3, filter.update(3));  // Lower middle of {3, 7}
+    TEST_ASSERT_EQUAL_INT32(7, filter.update(9));
+
+    filter.reset();
+    const std::array<Sample, 8> input{2300, 2301, 2299, 9999, 2300, 2302, -5000, 2301};
+    std::array<Sample, 8> output{};
+    filter.process(input.begin(), input.end(), output.begin());
+    for (std::size_t i = 4; i < output.size(); ++i) {
+        TEST_ASSERT_INT32_WITHIN(2, 2300, output[i]);
+    }
+}
+
+//! @test test_filter_kalman_tracks_noisy_constant
+//! @brief Verifies the Kalman estimate converges and its variance shrinks.
+void test_filter_kalman_tracks_noisy_constant(void) {
+    Kalman1D filter(1, 400);
+    const std::array<Sample, 4> noise{-20, 15, 5, -10};
+    Sample estimate = filter.update(2400);
+    for (int i = 0; i < 200; ++i) {
+        estimate = filter.update(2300 + noise[i % noise.size()]);
+    }
+    TEST_ASSERT_INT32_WITHIN(5, 2300, estimate);
+    TEST_ASSERT_TRUE(filter.variance() < 400);
+}
+
+//! @test test_filter_reading_filter_applies_and_clamps
+//! @brief Verifies ReadingFilter replaces raw reading values and clamps humidity.
+void test_filter_reading_filter_applies_and_clamps(void) {
+    MovingAverage<2> temperature;
+    MovingAverage<2> humidity;
+    ReadingFilter smoother(temperature, humidity);
+
+    jenlib::ble::ReadingMsg msg{jenlib::ble::DeviceId(1), jenlib::ble::SessionId(1), 0, 2000, 9990};
+    smoother.apply(msg);
+    msg.temperature_c_centi = 2100;
+    msg.humidity_bp = 10000;
+    smoother.apply(msg);
+
+    TEST_ASSERT_EQUAL_INT16(2050, msg.temperature_c_centi);
+    TEST_ASSERT_EQUAL_UINT16(9995, msg.humidity_bp);
+}
@@ -0,0 +1,143 @@
+//! @file tests/GpioEdgeMonitorTests.cpp
+//! @brief GPIO edge subscription and debounce tests.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include <unity.h>
+#include <vector>
+#include "jenlib/events/EventDispatcher.h"
+#include "jenlib/gpio/GpioEdgeMonitor.h"
+#include "jenlib/gpio/drivers/NativeGpioDriver.h"
+
+using jenlib::events::Event;
+using jenlib::events::EventDispatcher;
+using jenlib::events::EventType;
+using jenlib::gpio::DigitalValue;
+using jenlib::gpio::GpioChange;
+using jenlib::gpio::GpioEdgeMonitor;
+using jenlib::gpio::GpioEdgeRing;
+using jenlib::gpio::InterruptEdge;
+using jenlib::gpio::NativeGpioDriver;
+
+namespace {
+std::vector<Event> g_gpio_events;
+
+void capture_gpio_events() {
+    EventDispatcher::clear_all_callbacks();
+    g_gpio_events.clear();
+    EventDispatcher::register_callback(EventType::kGpioChange,
+                                       [](const Event& event) { g_gpio_events.push_back(event); });
+}
+}  // namespace
+
+//! @test test_gpio_edge_monitor_coalesces_bounces
+//! @brief Verifies a bouncing press settles into a single kGpioChange event.
+//! @details Five edges ending HIGH within 3 ms, debounce 10 ms: nothing until quiet, then one event.
+void test_gpio_edge_monitor_coalesces_bounces(void) {
+    capture_gpio_events();
+    NativeGpioDriver driver;
+    GpioEdgeMonitor monitor(&driver);
+    TEST_ASSERT_TRUE(monitor.subscribe(4, InterruptEdge::CHANGE, 10));
+
+    driver.inject_edge(4, DigitalValue::HIGH, 100);
+    driver.inject_edge(4, DigitalValue::LOW, 101);
+    driver.inject_edge(4, DigitalValue::HIGH, 101);
+    driver.inject_edge(4, DigitalValue::LOW, 102);
+    driver.inject_edge(4, DigitalValue::HIGH, 103);
+
+    TEST_ASSERT_EQUAL(0, monitor.process(105));
+    TEST_ASSERT_EQUAL(1, monitor.process(113));
+    EventDispatcher::process_events();
+
+    TEST_ASSERT_EQUAL(1, g_gpio_events.size());
+    TEST_ASSERT_EQUAL_UINT32(103, g_gpio_events[0].timestamp);
+    const GpioChange change = GpioChange::decode(g_gpio_events[0]);
+    TEST_ASSERT_EQUAL_UINT8(4, change.pin);
+    TEST_ASSERT_TRUE(change.level == DigitalValue::HIGH);
+    TEST_ASSERT_EQUAL_UINT16(5, change.edge_count);
+    TEST_ASSERT_EQUAL_UINT32(5, monitor.consumed_edges());
+}
+
+//! @test test_gpio_edge_monitor_drops_glitch
+//! @brief Verifies a glitch that returns to the stable level posts nothing.
+void test_gpio_edge_monitor_drops_glitch(void) {
+    capture_gpio_events();
+    NativeGpioDriver driver;
+    GpioEdgeMonitor monitor(&driver);
+    TEST_ASSERT_TRUE(monitor.subscribe(5, InterruptEdge::CHANGE, 5));
+
+    driver.inject_edge(5, DigitalValue::HIGH, 10);
+    driver.inject_edge(5, DigitalValue::LOW, 11);
+
+    TEST_ASSERT_EQUAL(0, monitor.process(50));
+    EventDispatcher::process_events();
+    TEST_ASSERT_EQUAL(0, g_gpio_events.size());
+}
+
+//! @test test_gpio_edge_monitor_rising_only
+//! @brief Verifies a RISING subscription ignores falling edges and unsubscribe stops recording.
+void test_gpio_edge_monitor_rising_only(void) {
+    capture_gpio_events();
+    NativeGpioDriver driver;
+    GpioEdgeMonitor monitor(&driver);
+    TEST_ASSERT_TRUE(monitor.subscribe(6, InterruptEdge::RISING, 0));
+
+    driver.inject_edge(6, DigitalValue::HIGH, 1);
+    TEST_ASSERT_EQUAL(1, monitor.process(1));
+    driver.inject_edge(6, DigitalValue::LOW, 2);
+    TEST_ASSERT_EQUAL(0, monitor.process(2));
+    TEST_ASSERT_EQUAL_UINT32(1, monitor.consumed_edges());
+
+    TEST_ASSERT_TRUE(monitor.unsubscribe(6));
+    TEST_ASSERT_FALSE(monitor.unsubscribe(6));
+    driver.inject_edge(6, DigitalValue::HIGH, 3);
+    TEST_ASSERT_EQUAL(0, monitor.process(3));
+    TEST_ASSERT_EQUAL_UINT32(1, monitor.consumed_edges());
+}
+
+//! @test test_gpio_edge_monitor_rising_only_repeats
+//! @brief Verifies every settled rising burst posts an event, not just the first.
+void test_gpio_edge_monitor_rising_only_repeats(void) {
+    capture_gpio_events();
+    NativeGpioDriver driver;
+    GpioEdgeMonitor monitor(&driver);
+    TEST_ASSERT_TRUE(monitor.subscribe(8, InterruptEdge::RISING, 5));
+
+    driver.inject_edge(8, DigitalValue::HIGH, 10);
+    driver.inject_edge(8, DigitalValue::LOW, 11);  // Not recorded
+    driver.inject_edge(8, DigitalValue::HIGH, 12);
+    TEST_ASSERT_EQUAL(1, monitor.process(20));
+    driver.inject_edge(8, DigitalValue::LOW, 50);  // Released; not recorded
+    driver.inject_edge(8, DigitalValue::HIGH, 100);
+    TEST_ASSERT_EQUAL(0, monitor.process(102));
+    TEST_ASSERT_EQUAL(1, monitor.process(110));
+    EventDispatcher::process_events();
+
+    TEST_ASSERT_EQUAL(2, g_gpio_events.size());
+    TEST_ASSERT_EQUAL_UINT16(2, GpioChange::decode(g_gpio_events[0]).edge_count);
+    TEST_ASSERT_EQUAL_UINT32(100, g_gpio_events[1].timestamp);
+    TEST_ASSERT_TRUE(GpioChange::decode(g_gpio_events[1]).level == DigitalValue::HIGH);
+}
+
+//! @test test_gpio_edge_monitor_counts_overflow
+//! @brief Verifies edges beyond the ring capacity are counted as dropped.
+//! @details An even number of queued edges settles back LOW; the next edge is still seen after the drain.
+void test_gpio_edge_monitor_counts_overflow(void) {
+    capture_gpio_events();
+    NativeGpioDriver driver;
+    GpioEdgeMonitor monitor(&driver);
+    TEST_ASSERT_TRUE(monitor.subscribe(7, InterruptEdge::CHANGE, 1));
+
+    const std::uint32_t edges = GpioEdgeRing::kCapacity + 6;
+    for (std::uint32_t i = 0; i < edges; ++i) {
+        driver.inject_edge(7, (i % 2 == 0) ? DigitalValue::HIGH : DigitalValue::LOW, i);
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(6, monitor.dropped_edges());
+    TEST_ASSERT_EQUAL(0, monitor.process(edges + 10));
+    TEST_ASSERT_EQUAL_UINT32(GpioEdgeRing::kCapacity, monitor.consumed_edges());
+
+    driver.inject_edge(7, DigitalValue::HIGH, edges + 20);
+    TEST_ASSERT_EQUAL(1, monitor.process(edges + 30));
+    TEST_ASSERT_EQUAL_UINT32(6, monitor.dropped_edges());
+}
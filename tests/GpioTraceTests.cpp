@@ -0,0 +1,85 @@
+//! @file tests/GpioTraceTests.cpp
+//! @brief Native GPIO driver trace and VCD export tests.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include <unity.h>
+#include <sstream>
+#include <string>
+#include "jenlib/gpio/drivers/NativeGpioDriver.h"
+
+using jenlib::gpio::DigitalValue;
+using jenlib::gpio::GpioTraceOp;
+using jenlib::gpio::NativeGpioDriver;
+using jenlib::gpio::PinMode;
+
+//! @test test_gpio_trace_records_calls_with_virtual_time
+//! @brief Verifies each call is stored with the virtual time at which it happened.
+void test_gpio_trace_records_calls_with_virtual_time(void) {
+    NativeGpioDriver driver;
+    driver.enable_trace(16);
+
+    driver.set_pin_mode(3, PinMode::OUTPUT);
+    driver.digital_write(3, DigitalValue::HIGH);
+    driver.advance_time_us(10);
+    driver.digital_write(3, DigitalValue::LOW);
+    TEST_ASSERT_TRUE(driver.digital_read(3) == DigitalValue::LOW);
+
+    const auto& trace = driver.trace();
+    TEST_ASSERT_EQUAL(4, trace.size());
+    TEST_ASSERT_TRUE(trace[0].op == GpioTraceOp::kSetMode);
+    TEST_ASSERT_TRUE(trace[1].op == GpioTraceOp::kDigitalWrite);
+    TEST_ASSERT_EQUAL_UINT64(0, trace[1].timestamp_ns);
+    TEST_ASSERT_EQUAL_UINT64(10000, trace[2].timestamp_ns);
+    TEST_ASSERT_TRUE(trace[3].op == GpioTraceOp::kDigitalRead);
+    TEST_ASSERT_EQUAL_UINT16(static_cast<std::uint16_t>(DigitalValue::LOW), trace[3].value);
+}
+
+//! @test test_gpio_trace_stats_and_overflow
+//! @brief Verifies per-pin counters keep counting after the buffer is full.
+//! @details Four toggles over 2 us of virtual time (call cost 250 ns) give 2e6 toggles/s.
+void test_gpio_trace_stats_and_overflow(void) {
+    NativeGpioDriver driver;
+    driver.enable_trace(2);
+    driver.set_call_cost_ns(250);
+
+    for (int i = 0; i < 4; ++i) {
+        driver.digital_write(5, (i % 2 == 0) ? DigitalValue::HIGH : DigitalValue::LOW);
+        driver.digital_read(5);
+    }
+
+    TEST_ASSERT_EQUAL(2, driver.trace().size());
+    TEST_ASSERT_EQUAL(6, driver.trace_dropped());
+    const auto stats = driver.pin_stats(5);
+    TEST_ASSERT_EQUAL_UINT32(4, stats.write_calls);
+    TEST_ASSERT_EQUAL_UINT32(4, stats.read_calls);
+    TEST_ASSERT_EQUAL_UINT32(4, stats.toggles);
+    TEST_ASSERT_EQUAL_UINT64(2000, driver.virtual_time_ns());
+    TEST_ASSERT_FLOAT_WITHIN(1.0f, 2e6f, static_cast<float>(driver.toggles_per_second(5)));
+
+    driver.disable_trace();
+    driver.digital_write(5, DigitalValue::HIGH);
+    TEST_ASSERT_EQUAL_UINT32(4, driver.pin_stats(5).write_calls);
+}
+
+//! @test test_gpio_trace_exports_vcd
+//! @brief Verifies the VCD header and value changes for an open-drain style pin.
+void test_gpio_trace_exports_vcd(void) {
+    NativeGpioDriver driver;
+    driver.enable_trace(16);
+
+    driver.set_pin_mode(2, PinMode::OUTPUT);
+    driver.digital_write(2, DigitalValue::LOW);
+    driver.advance_time_us(1);
+    driver.set_pin_mode(2, PinMode::INPUT_PULLUP);
+    driver.advance_time_us(1);
+    driver.set_pin_mode(2, PinMode::INPUT);
+
+    std::ostringstream vcd;
+    driver.export_vcd(vcd);
+    const std::string text = vcd.str();
+
+    TEST_ASSERT_NOT_EQUAL(std::string::npos, text.find("$timescale 1ns $end"));
+    TEST_ASSERT_NOT_EQUAL(std::string::npos, text.find("$var wire 1 ! pin2 $end"));
+    TEST_ASSERT_NOT_EQUAL(std::string::npos, text.find("$end\n0!\n#1000\n1!\n#2000\nz!\n"));
+}
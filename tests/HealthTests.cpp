@@ -0,0 +1,219 @@
+//! @file tests/HealthTests.cpp
+//! @brief Tests for health heartbeats, their delta coding and fleet aggregation
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include <unity.h>
+#include "jenlib/ble/Health.h"
+#include "jenlib/ble/Messages.h"
+#include "jenlib/ble/MultiRadioBroker.h"
+#include "jenlib/ble/Roles.h"
+#include "jenlib/ble/drivers/NativeBleDriver.h"
+#include "jenlib/events/EventContext.h"
+#include "jenlib/state/SensorHealth.h"
+#include "jenlib/time/Time.h"
+#include "jenlib/time/TimeDriver.h"
+#include "jenlib/time/TimerContext.h"
+#include "TestHelpers.h"
+
+using jenlib::ble::BlePayload;
+using jenlib::ble::DeviceId;
+using jenlib::ble::HealthCounters;
+using jenlib::ble::HealthMsg;
+using jenlib::test::ManualTimeDriver;
+
+namespace {
+HealthCounters make_counters(std::uint32_t uptime_s, std::uint32_t evictions, std::uint16_t battery_mv) {
+    HealthCounters c;
+    c.uptime_s = uptime_s;
+    c.event_evictions = evictions;
+    c.inbox_drops = 3;
+    c.loop_overruns = 1;
+    c.retention_permille = 250;
+    c.battery_mv = battery_mv;
+    return c;
+}
+}  // namespace
+
+//! @test test_health_message_roundtrip_and_size
+//! @brief Verifies keyframes and deltas survive serialization and a quiet delta stays a few bytes
+void test_health_message_roundtrip_and_size(void) {
+    //! @section Arrange
+    jenlib::ble::HealthEncoder encoder;
+    const HealthMsg keyframe = encoder.next(DeviceId(0x10), make_counters(100, 7, 3300));
+    const HealthMsg delta = encoder.next(DeviceId(0x10), make_counters(110, 7, 3290));  // Battery falls
+    BlePayload key_payload;
+    BlePayload delta_payload;
+
+    //! @section Act
+    const bool key_ok = HealthMsg::serialize(keyframe, key_payload);
+    const bool delta_ok = HealthMsg::serialize(delta, delta_payload);
+    HealthMsg key_back;
+    HealthMsg delta_back;
+    const bool key_parsed = HealthMsg::deserialize(key_payload, key_back);
+    const bool delta_parsed = HealthMsg::deserialize(delta_payload, delta_back);
+    delta_payload.bytes[7] |= 0x40;  // Reserved flag bit
+    HealthMsg rejected;
+    const bool reserved_parsed = HealthMsg::deserialize(delta_payload, rejected);
+
+    //! @section Assert
+    TEST_ASSERT_TRUE(key_ok && delta_ok && key_parsed && delta_parsed);
+    TEST_ASSERT_FALSE(reserved_parsed);
+    TEST_ASSERT_TRUE(key_back.keyframe);
+    TEST_ASSERT_EQUAL_UINT32(7, key_back.values.event_evictions);
+    TEST_ASSERT_EQUAL_UINT16(3300, key_back.values.battery_mv);
+    TEST_ASSERT_FALSE(delta_back.keyframe);
+    TEST_ASSERT_EQUAL_UINT8(1, delta_back.sequence);
+    TEST_ASSERT_EQUAL_UINT32(10, delta_back.values.uptime_s);
+    TEST_ASSERT_EQUAL_UINT32(0, delta_back.values.event_evictions);
+    TEST_ASSERT_EQUAL_UINT16(static_cast<std::uint16_t>(-10), delta_back.values.battery_mv);
+    TEST_ASSERT_EQUAL(10, delta_payload.size);  // Type, id, sequence, flags, two one-byte varints
+    TEST_ASSERT_LESS_OR_EQUAL(HealthMsg::kMaxSize, key_payload.size);
+}
+
+//! @test test_health_decoder_resyncs_after_lost_delta
+//! @brief Verifies a lost delta desynchronises the decoder until the next keyframe
+void test_health_decoder_resyncs_after_lost_delta(void) {
+    //! @section Arrange
+    jenlib::ble::HealthEncoder encoder(4);
+    jenlib::ble::HealthDecoder decoder;
+    std::uint32_t rejected = 0;
+
+    //! @section Act
+    for (std::uint32_t beat = 0; beat < 9; ++beat) {
+        const HealthMsg msg = encoder.next(DeviceId(0x10), make_counters(beat * 10, beat * beat, 3300));
+        if (beat == 2) {
+            continue;  // Lost on air
+        }
+        if (!decoder.apply(msg)) {
+            ++rejected;
+        }
+        if (beat == 5) {
+            TEST_ASSERT_FALSE(decoder.apply(msg));  // Repeated copy is ignored
+        }
+    }
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL_UINT32(1, rejected);  // Beat 3; beat 4 is a keyframe
+    TEST_ASSERT_TRUE(decoder.synced());
+    TEST_ASSERT_EQUAL_UINT32(1, decoder.lost());
+    TEST_ASSERT_EQUAL_UINT32(1, decoder.resyncs());
+    TEST_ASSERT_EQUAL_UINT32(7, decoder.heartbeats());
+    TEST_ASSERT_EQUAL_UINT32(80, decoder.values().uptime_s);
+    TEST_ASSERT_EQUAL_UINT32(64, decoder.values().event_evictions);
+}
+
+//! @test test_health_decoder_resets_on_sensor_restart
+//! @brief Verifies a reboot's keyframe becomes the new baseline instead of counting as lost heartbeats
+void test_health_decoder_resets_on_sensor_restart(void) {
+    //! @section Arrange
+    jenlib::ble::FleetHealth fleet;
+    jenlib::ble::HealthEncoder before_reboot;
+    jenlib::ble::HealthEncoder after_reboot;
+    for (std::uint32_t beat = 0; beat < 5; ++beat) {
+        fleet.add(before_reboot.next(DeviceId(0x10), make_counters(100 + beat * 10, 4, 3300)), beat * 10000);
+    }
+
+    //! @section Act
+    const bool keyframe_applied = fleet.add(after_reboot.next(DeviceId(0x10), make_counters(2, 0, 3300)), 60000);
+    BlePayload delta;
+    HealthMsg::serialize(after_reboot.next(DeviceId(0x10), make_counters(12, 1, 3290)), delta);
+    BlePayload shimmed;  // As the native driver delivers it, behind a sender shim
+    shimmed.append_u8(jenlib::ble::kSenderIdMarker);
+    shimmed.append_u32le(0x10);
+    shimmed.append_raw(delta.bytes.data(), delta.size);
+    const bool delta_applied = fleet.add(shimmed, 70000);
+    const jenlib::ble::HealthDecoder* decoder = fleet.sensor(DeviceId(0x10));
+    const jenlib::ble::FleetHealthSummary summary = fleet.summary(70000, 20000);
+
+    //! @section Assert
+    TEST_ASSERT_TRUE(keyframe_applied);
+    TEST_ASSERT_TRUE(delta_applied);
+    TEST_ASSERT_NOT_NULL(decoder);
+    TEST_ASSERT_TRUE(decoder->synced());
+    TEST_ASSERT_EQUAL_UINT32(0, decoder->lost());
+    TEST_ASSERT_EQUAL_UINT32(1, decoder->restarts());
+    TEST_ASSERT_EQUAL_UINT32(7, decoder->heartbeats());
+    TEST_ASSERT_EQUAL_UINT32(12, decoder->values().uptime_s);
+    TEST_ASSERT_EQUAL_UINT32(1, decoder->values().event_evictions);
+    TEST_ASSERT_EQUAL_UINT32(0, summary.heartbeats_lost);
+    TEST_ASSERT_EQUAL_UINT32(1, summary.restarts);
+}
+
+//! @test test_health_sampled_from_internal_state
+//! @brief Verifies queue evictions, missed timer periods and inbox drops reach the heartbeat
+void test_health_sampled_from_internal_state(void) {
+    //! @section Arrange
+    jenlib::events::EventContext events;
+    ManualTimeDriver clock;
+    jenlib::time::TimerContext timers(&clock);
+    timers.schedule_callback(100, [] {}, true);
+    jenlib::ble::NativeBleDriver radio(DeviceId(0x10));
+    radio.begin();
+
+    //! @section Act
+    for (std::uint32_t i = 0; i < jenlib::events::EventContext::kMaxEventQueueSize + 5; ++i) {
+        events.dispatch_event(jenlib::events::Event(jenlib::events::EventType::kCustom, 0, i));
+    }
+    clock.now_ms = 450;  // Due at 100; 200, 300 and 400 are skipped
+    timers.process_timers();
+    for (int i = 0; i < 103; ++i) {
+        BlePayload payload;
+        payload.append_u8(0x7E);
+        radio.send_to(DeviceId(0x20), std::move(payload));
+    }
+    const jenlib::state::HealthSources sources{&events, &timers, &radio, nullptr, 3100};
+    const HealthCounters sample = jenlib::state::sample_health(sources, 61999);
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL_UINT32(61, sample.uptime_s);
+    TEST_ASSERT_EQUAL_UINT32(5, sample.event_evictions);
+    TEST_ASSERT_EQUAL_UINT32(3, sample.loop_overruns);
+    TEST_ASSERT_EQUAL_UINT32(3, sample.inbox_drops);
+    TEST_ASSERT_EQUAL_UINT16(0, sample.retention_permille);
+    TEST_ASSERT_EQUAL_UINT16(3100, sample.battery_mv);
+}
+
+//! @test test_broker_aggregates_fleet_health
+//! @brief Verifies heartbeats from several sensors reach the broker's fleet summary
+void test_broker_aggregates_fleet_health(void) {
+    //! @section Arrange
+    ManualTimeDriver clock;
+    jenlib::time::Time::setDriver(&clock);
+    jenlib::ble::NativeBleDriver radio(DeviceId(0));
+    jenlib::ble::MultiRadioBroker broker;
+    broker.add_radio(radio);
+    std::uint32_t generic_messages = 0;
+    broker.configure_callbacks(
+        jenlib::ble::BleCallbacks{.on_generic = [&](DeviceId, const BlePayload&) { ++generic_messages; }});
+    broker.begin();
+    jenlib::ble::Sensor sensor_a(DeviceId(0x10), &radio);
+    jenlib::ble::Sensor sensor_b(DeviceId(0x11), &radio);
+    jenlib::ble::Sensor sensor_c(DeviceId(0x12), &radio);
+    jenlib::ble::HealthEncoder encoder_a;
+    jenlib::ble::HealthEncoder encoder_b;
+    jenlib::ble::HealthEncoder encoder_c;
+
+    //! @section Act
+    clock.now_ms = 1000;
+    sensor_c.broadcast_health(encoder_c.next(DeviceId(0x12), make_counters(1, 0, 3000)));
+    for (std::uint32_t beat = 1; beat <= 3; ++beat) {
+        clock.now_ms = 1000 + beat * 10000;
+        sensor_a.broadcast_health(encoder_a.next(DeviceId(0x10), make_counters(beat * 10, beat, 3300)));
+        sensor_b.broadcast_health(encoder_b.next(DeviceId(0x11), make_counters(beat * 10, 2 * beat, 2900)));
+    }
+    const jenlib::ble::FleetHealthSummary summary = broker.fleet_health().summary(clock.now_ms, 20000);
+    jenlib::time::Time::setDriver(nullptr);
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL_UINT32(7, generic_messages);
+    TEST_ASSERT_EQUAL_UINT32(3, summary.sensors);
+    TEST_ASSERT_EQUAL_UINT32(1, summary.stale);  // Sensor C went quiet 30 s ago
+    TEST_ASSERT_EQUAL_UINT64(9, summary.event_evictions);
+    TEST_ASSERT_EQUAL_UINT64(6, summary.inbox_drops);
+    TEST_ASSERT_EQUAL_UINT16(2900, summary.min_battery_mv);
+    TEST_ASSERT_EQUAL_UINT32(0x11, summary.weakest_sensor.value());
+    TEST_ASSERT_EQUAL_UINT16(250, summary.max_retention_permille);
+    TEST_ASSERT_EQUAL_UINT32(31000, broker.fleet_health().last_seen_ms(DeviceId(0x10)));
+    TEST_ASSERT_NULL(broker.fleet_health().sensor(DeviceId(0x99)));
+}
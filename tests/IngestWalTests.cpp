@@ -0,0 +1,237 @@
+//! @file tests/IngestWalTests.cpp
+//! @brief Tests for the broker's group-commit ingest log
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include <unity.h>
+
+#if defined(__linux__)
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+#include "jenlib/storage/IngestWal.h"
+#include "jenlib/time/Time.h"
+#include "TestHelpers.h"
+
+using jenlib::ble::DeviceId;
+using jenlib::ble::ReceiptMsg;
+using jenlib::ble::SessionId;
+using jenlib::storage::IngestWal;
+using jenlib::test::ManualTimeDriver;
+using jenlib::test::make_reading;
+using jenlib::test::remove_scratch;
+
+namespace {
+constexpr SessionId kSession(7);
+
+struct Receipt {
+    std::uint32_t sensor;
+    std::uint32_t session;
+    std::uint32_t offset_ms;
+};
+
+std::string wal_path() {
+    return jenlib::test::scratch_path("wal");
+}
+
+void collect_receipts(IngestWal& wal, std::vector<Receipt>& receipts) {
+    wal.set_durable_callback([&receipts](DeviceId sensor, const ReceiptMsg& receipt) {
+        receipts.push_back(Receipt{sensor.value(), receipt.session_id.value(), receipt.up_to_offset_ms});
+    });
+}
+}  // namespace
+
+//! @test test_ingest_wal_commits_full_batch
+//! @brief Verifies nothing is durable or acknowledged until max_records readings are buffered
+void test_ingest_wal_commits_full_batch(void) {
+    //! @section Arrange
+    remove_scratch(wal_path());
+    IngestWal wal({4, 1000});
+    TEST_ASSERT_TRUE(wal.open(wal_path().c_str()));
+    std::vector<Receipt> receipts;
+    collect_receipts(wal, receipts);
+    std::uint32_t offset_ms = 0;
+
+    //! @section Act
+    for (std::uint32_t i = 0; i < 3; ++i) {
+        wal.append(make_reading(DeviceId(0x10), kSession, i * 1000));
+    }
+    const bool durable_before = wal.durable_offset(DeviceId(0x10), kSession, offset_ms);
+    const std::size_t receipts_before = receipts.size();
+    wal.append(make_reading(DeviceId(0x10), kSession, 3000));
+
+    //! @section Assert
+    TEST_ASSERT_FALSE(durable_before);
+    TEST_ASSERT_EQUAL(0, receipts_before);
+    TEST_ASSERT_EQUAL(1, receipts.size());
+    TEST_ASSERT_EQUAL_UINT32(0x10, receipts[0].sensor);
+    TEST_ASSERT_EQUAL_UINT32(7, receipts[0].session);
+    TEST_ASSERT_EQUAL_UINT32(3000, receipts[0].offset_ms);
+    TEST_ASSERT_TRUE(wal.durable_offset(DeviceId(0x10), kSession, offset_ms));
+    TEST_ASSERT_EQUAL_UINT32(3000, offset_ms);
+    TEST_ASSERT_EQUAL(1, wal.commit_count());
+    TEST_ASSERT_EQUAL(0, wal.pending_records());
+    wal.close();
+    remove_scratch(wal_path());
+}
+
+//! @test test_ingest_wal_commits_after_delay
+//! @brief Verifies poll() commits a partial batch once its oldest record waited max_delay_ms
+void test_ingest_wal_commits_after_delay(void) {
+    //! @section Arrange
+    remove_scratch(wal_path());
+    ManualTimeDriver clock;
+    jenlib::time::Time::setDriver(&clock);
+    IngestWal wal({64, 10});
+    wal.open(wal_path().c_str());
+    std::vector<Receipt> receipts;
+    collect_receipts(wal, receipts);
+
+    //! @section Act
+    wal.append(make_reading(DeviceId(0x10), kSession, 0));
+    wal.append(make_reading(DeviceId(0x20), kSession, 0));
+    clock.now_ms = 9;
+    wal.poll();
+    const std::size_t receipts_early = receipts.size();
+    clock.now_ms = 10;
+    wal.poll();
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL(0, receipts_early);
+    TEST_ASSERT_EQUAL(2, receipts.size());
+    TEST_ASSERT_EQUAL(1, wal.commit_count());
+    TEST_ASSERT_EQUAL(2, wal.durable_records());
+    wal.close();
+    jenlib::time::Time::setDriver(nullptr);
+    remove_scratch(wal_path());
+}
+
+//! @test test_ingest_wal_recovers_and_cuts_torn_tail
+//! @brief Verifies reopening keeps committed records, drops a torn tail and restores durable offsets
+void test_ingest_wal_recovers_and_cuts_torn_tail(void) {
+    //! @section Arrange
+    remove_scratch(wal_path());
+    {
+        IngestWal wal({1, 0});
+        wal.open(wal_path().c_str());
+        for (std::uint32_t i = 0; i < 5; ++i) {
+            wal.append(make_reading(DeviceId(0x10), kSession, i * 1000));
+        }
+    }
+    // A crash in the middle of writing the next batch
+    const int fd = ::open(wal_path().c_str(), O_WRONLY | O_APPEND);
+    const std::uint8_t partial[7] = {0x10, 0, 0, 0, 7, 0, 0};
+    TEST_ASSERT_EQUAL(sizeof(partial), ::write(fd, partial, sizeof(partial)));
+    ::close(fd);
+
+    //! @section Act
+    IngestWal wal({1, 0});
+    const bool opened = wal.open(wal_path().c_str());
+    std::uint32_t offset_ms = 0;
+    const bool durable = wal.durable_offset(DeviceId(0x10), kSession, offset_ms);
+    wal.append(make_reading(DeviceId(0x10), kSession, 5000));
+    wal.close();
+    IngestWal reopened;
+    reopened.open(wal_path().c_str());
+
+    //! @section Assert
+    TEST_ASSERT_TRUE(opened);
+    TEST_ASSERT_EQUAL(7, wal.truncated_bytes());
+    TEST_ASSERT_TRUE(durable);
+    TEST_ASSERT_EQUAL_UINT32(4000, offset_ms);
+    TEST_ASSERT_EQUAL(6, reopened.durable_records());
+    TEST_ASSERT_EQUAL(0, reopened.truncated_bytes());
+    remove_scratch(wal_path());
+}
+
+//! @test test_ingest_wal_clear_keeps_offsets
+//! @brief Verifies clear() empties the file but durable offsets still answer receipts
+void test_ingest_wal_clear_keeps_offsets(void) {
+    //! @section Arrange
+    remove_scratch(wal_path());
+    IngestWal wal({2, 1000});
+    wal.open(wal_path().c_str());
+    wal.append(make_reading(DeviceId(0x10), kSession, 0));
+    wal.append(make_reading(DeviceId(0x10), kSession, 1000));
+    wal.append(make_reading(DeviceId(0x10), kSession, 2000));
+
+    //! @section Act
+    const bool cleared = wal.clear();
+    std::uint32_t offset_ms = 0;
+    const bool durable = wal.durable_offset(DeviceId(0x10), kSession, offset_ms);
+
+    //! @section Assert
+    TEST_ASSERT_TRUE(cleared);
+    TEST_ASSERT_EQUAL(0, wal.durable_records());
+    TEST_ASSERT_EQUAL(0, wal.pending_records());
+    TEST_ASSERT_TRUE(durable);
+    TEST_ASSERT_EQUAL_UINT32(2000, offset_ms);
+    wal.close();
+    remove_scratch(wal_path());
+}
+
+//! @test test_ingest_wal_fails_when_rollback_fails
+//! @brief Verifies a commit that cannot be rolled back fails the log and evicts no pending stream
+void test_ingest_wal_fails_when_rollback_fails(void) {
+    //! @section Arrange
+    // Writes to /dev/full fail with ENOSPC and it cannot be truncated
+    IngestWal wal({IngestWal::kMaxBatchRecords, 1000});
+    if (!wal.open("/dev/full")) {
+        TEST_IGNORE();
+    }
+    for (std::uint32_t sensor = 0; sensor < IngestWal::kMaxStreams; ++sensor) {
+        wal.append(make_reading(DeviceId(0x100 + sensor), kSession, 0));
+    }
+
+    //! @section Act
+    const bool evicting_append = wal.append(make_reading(DeviceId(0x10), kSession, 0));
+    const bool committed = wal.commit();
+    const bool later_append = wal.append(make_reading(DeviceId(0x100), kSession, 1000));
+
+    //! @section Assert
+    TEST_ASSERT_FALSE(evicting_append);
+    TEST_ASSERT_FALSE(committed);
+    TEST_ASSERT_FALSE(later_append);
+    TEST_ASSERT_TRUE(wal.failed());
+    TEST_ASSERT_EQUAL(IngestWal::kMaxStreams, wal.pending_records());
+    TEST_ASSERT_EQUAL(0, wal.commit_count());
+}
+
+//! @test test_ingest_wal_fails_when_sync_fails
+//! @brief Verifies a failed fdatasync fails the log and sends no receipt, even for a later retry
+void test_ingest_wal_fails_when_sync_fails(void) {
+    //! @section Arrange
+    // Writes to /dev/null succeed, but it cannot be synced
+    IngestWal wal({IngestWal::kMaxBatchRecords, 1000});
+    if (!wal.open("/dev/null")) {
+        TEST_IGNORE();
+    }
+    std::vector<Receipt> receipts;
+    collect_receipts(wal, receipts);
+    wal.append(make_reading(DeviceId(0x10), kSession, 0));
+
+    //! @section Act
+    const bool committed = wal.commit();
+    const bool retried = wal.commit();
+
+    //! @section Assert
+    TEST_ASSERT_FALSE(committed);
+    TEST_ASSERT_FALSE(retried);
+    TEST_ASSERT_TRUE(wal.failed());
+    TEST_ASSERT_EQUAL(0, receipts.size());
+    TEST_ASSERT_EQUAL(0, wal.durable_records());
+    TEST_ASSERT_EQUAL(0, wal.commit_count());
+}
+
+#else
+
+void test_ingest_wal_commits_full_batch(void) { TEST_IGNORE(); }
+void test_ingest_wal_commits_after_delay(void) { TEST_IGNORE(); }
+void test_ingest_wal_recovers_and_cuts_torn_tail(void) { TEST_IGNORE(); }
+void test_ingest_wal_clear_keeps_offsets(void) { TEST_IGNORE(); }
+void test_ingest_wal_fails_when_rollback_fails(void) { TEST_IGNORE(); }
+void test_ingest_wal_fails_when_sync_fails(void) { TEST_IGNORE(); }
+
+#endif  // __linux__
@@ -0,0 +1,186 @@
+//! @file tests/LinkQualityTests.cpp
+//! @brief Tests for per-session link-quality telemetry
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include <unity.h>
+#include "jenlib/ble/MultiRadioBroker.h"
+#include "jenlib/ble/Roles.h"
+#include "jenlib/ble/drivers/NativeBleDriver.h"
+#include "jenlib/measurement/LinkQuality.h"
+#include "jenlib/state/BrokerStateMachine.h"
+#include "jenlib/time/Time.h"
+#include "jenlib/time/TimeDriver.h"
+#include "TestHelpers.h"
+
+using jenlib::ble::DeviceId;
+using jenlib::ble::SessionId;
+using jenlib::measurement::LinkQuality;
+using jenlib::test::ManualTimeDriver;
+using jenlib::test::make_reading;
+
+//! @test test_link_quality_counts_loss_and_gaps
+//! @brief Verifies expected readings follow the offset grid and missing streaks are recorded
+void test_link_quality_counts_loss_and_gaps(void) {
+    //! @section Arrange
+    LinkQuality link(1000);
+
+    //! @section Act
+    // Slots 5..20 with 7, 8 and 12..15 missing; arrivals exactly on time
+    for (std::uint32_t slot = 5; slot <= 20; ++slot) {
+        if (slot == 7 || slot == 8 || (slot >= 12 && slot <= 15)) {
+            continue;
+        }
+        TEST_ASSERT_TRUE(link.add(slot * 1000 + 3, 100000 + slot * 1000));  // Offsets may drift off the grid
+    }
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL_UINT32(16, link.expected());
+    TEST_ASSERT_EQUAL_UINT32(10, link.received());
+    TEST_ASSERT_EQUAL_UINT32(6, link.lost());
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.375f, link.loss_ratio());
+    TEST_ASSERT_EQUAL_UINT32(2, link.gaps());
+    TEST_ASSERT_EQUAL_UINT32(4, link.longest_gap());
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f, link.jitter_ms());
+    TEST_ASSERT_EQUAL_UINT32(0, link.missing_since_newest(120999));
+    TEST_ASSERT_EQUAL_UINT32(3, link.missing_since_newest(123500));
+}
+
+//! @test test_link_quality_separates_late_and_duplicate_readings
+//! @brief Verifies a late reading fills its hole, a repeat is a duplicate and readings past the window are rejected
+void test_link_quality_separates_late_and_duplicate_readings(void) {
+    //! @section Arrange
+    LinkQuality link(500);
+    link.add(0, 0);
+    link.add(1500, 1500);  // Slots 1 and 2 missing
+
+    //! @section Act
+    const bool late = link.add(500, 1600);
+    const bool duplicate = link.add(500, 1700);
+    const bool retransmitted = link.add(1500, 1800);
+    link.add(500 * (LinkQuality::kWindowSlots + 3), 40000);
+    const bool too_old = link.add(1000, 40100);
+
+    //! @section Assert
+    TEST_ASSERT_TRUE(late);
+    TEST_ASSERT_FALSE(duplicate);
+    TEST_ASSERT_FALSE(retransmitted);
+    TEST_ASSERT_FALSE(too_old);
+    TEST_ASSERT_EQUAL_UINT32(1, link.late());
+    TEST_ASSERT_EQUAL_UINT32(2, link.duplicates());
+    TEST_ASSERT_EQUAL_UINT32(4, link.received());
+    TEST_ASSERT_EQUAL_UINT32(LinkQuality::kWindowSlots + 4, link.expected());
+    TEST_ASSERT_EQUAL_UINT32(2, link.gaps());
+    TEST_ASSERT_EQUAL_UINT32(LinkQuality::kWindowSlots - 1, link.longest_gap());
+}
+
+//! @test test_link_quality_jitter_and_interval_change
+//! @brief Verifies the RFC 3550 jitter estimate and that an interval change keeps the counts so far
+void test_link_quality_jitter_and_interval_change(void) {
+    //! @section Arrange
+    LinkQuality steady(1000);
+    LinkQuality adaptive(1000);
+
+    //! @section Act
+    // Arrivals alternate 20 ms early and late, so every spacing differs by 40 ms
+    for (std::uint32_t i = 0; i < 200; ++i) {
+        steady.add(i * 1000, i * 1000 + (i % 2 ? 20 : 0));
+    }
+    for (std::uint32_t i = 0; i <= 10; ++i) {
+        adaptive.add(i * 1000, i * 1000);
+    }
+    adaptive.set_interval_ms(5000);
+    for (std::uint32_t i = 1; i <= 4; ++i) {
+        adaptive.add(10000 + i * 5000, 10000 + i * 5000);
+    }
+
+    //! @section Assert
+    TEST_ASSERT_FLOAT_WITHIN(1.0f, 20.0f, steady.jitter_ms());  // 1/16 ms fixed point rounds down
+    TEST_ASSERT_EQUAL_UINT32(15, adaptive.expected());
+    TEST_ASSERT_EQUAL_UINT32(15, adaptive.received());
+    TEST_ASSERT_EQUAL_UINT32(0, adaptive.gaps());
+    TEST_ASSERT_EQUAL_UINT32(5000, adaptive.interval_ms());
+}
+
+//! @test test_brokers_track_link_quality_per_session
+//! @brief Verifies both brokers feed link quality from accepted readings and reset it on a new session
+void test_brokers_track_link_quality_per_session(void) {
+    //! @section Arrange
+    ManualTimeDriver clock;
+    jenlib::time::Time::setDriver(&clock);
+    jenlib::state::BrokerStateMachine broker_sm;
+    broker_sm.handle_start_command(DeviceId(0x10), SessionId(7));
+    jenlib::ble::NativeBleDriver radio(DeviceId(0));
+    jenlib::ble::MultiRadioBroker broker;
+    broker.add_radio(radio);
+    broker.set_expected_interval_ms(2000);
+    broker.begin();
+    jenlib::ble::Sensor sensor(DeviceId(0x10), &radio);
+
+    //! @section Act
+    for (const std::uint32_t offset_ms : {0u, 2000u, 8000u}) {
+        clock.now_ms = 50000 + offset_ms;
+        broker_sm.handle_reading(DeviceId(0x10), make_reading(DeviceId(0x10), SessionId(7), offset_ms));
+        sensor.broadcast_reading(make_reading(DeviceId(0x10), SessionId(7), offset_ms));
+    }
+    const std::uint32_t first_session_lost = broker.link_quality(DeviceId(0x10))->lost();
+    sensor.broadcast_reading(make_reading(DeviceId(0x10), SessionId(8), 0));
+    jenlib::time::Time::setDriver(nullptr);
+
+    //! @section Assert
+    const LinkQuality& session = broker_sm.get_link_quality();
+    TEST_ASSERT_EQUAL_UINT32(9, session.expected());
+    TEST_ASSERT_EQUAL_UINT32(3, session.received());
+    TEST_ASSERT_EQUAL_UINT32(5, session.longest_gap());
+    TEST_ASSERT_EQUAL_UINT32(2, first_session_lost);
+    const LinkQuality* link = broker.link_quality(DeviceId(0x10));
+    TEST_ASSERT_NOT_NULL(link);
+    TEST_ASSERT_EQUAL_UINT32(1, link->expected());
+    TEST_ASSERT_EQUAL_UINT32(2000, link->interval_ms());
+    TEST_ASSERT_NULL(broker.link_quality(DeviceId(0x99)));
+}
+
+//! @test test_broker_scores_each_sensor_on_its_own_cadence
+//! @brief Verifies adaptive and send-on-delta sensors are not charged for intervals they skipped
+void test_broker_scores_each_sensor_on_its_own_cadence(void) {
+    //! @section Arrange
+    ManualTimeDriver clock;
+    jenlib::time::Time::setDriver(&clock);
+    jenlib::ble::NativeBleDriver radio(DeviceId(0));
+    jenlib::ble::MultiRadioBroker broker;
+    broker.add_radio(radio);
+    broker.begin();
+    jenlib::ble::Sensor adaptive(DeviceId(0x21), &radio);
+    jenlib::ble::Sensor on_delta(DeviceId(0x22), &radio);
+    broker.send_start(DeviceId(0x21), jenlib::ble::StartBroadcastMsg{DeviceId(0x21), SessionId(7)});
+    broker.send_start(DeviceId(0x22), jenlib::ble::StartBroadcastMsg{DeviceId(0x22), SessionId(7)});
+
+    //! @section Act
+    broker.send_sampling_config(DeviceId(0x21), jenlib::ble::SamplingConfigMsg{SessionId(7), 1000, 8000});
+    broker.set_send_on_delta(DeviceId(0x22), true, 60000);
+    // The adaptive sensor backs off from 1 s to 8 s; the other sends two changes, then a heartbeat
+    for (const std::uint32_t offset_ms : {0u, 1000u, 3000u, 7000u, 15000u}) {
+        clock.now_ms = 10000 + offset_ms;
+        adaptive.broadcast_reading(make_reading(DeviceId(0x21), SessionId(7), offset_ms));
+    }
+    for (const std::uint32_t offset_ms : {0u, 4000u, 64000u, 184000u}) {  // 124000 heartbeat lost
+        clock.now_ms = 10000 + offset_ms;
+        on_delta.broadcast_reading(make_reading(DeviceId(0x22), SessionId(7), offset_ms));
+    }
+    on_delta.broadcast_reading(make_reading(DeviceId(0x22), SessionId(7), 184000));
+    jenlib::time::Time::setDriver(nullptr);
+
+    //! @section Assert
+    const LinkQuality* adaptive_link = broker.link_quality(DeviceId(0x21));
+    TEST_ASSERT_EQUAL_UINT32(8000, adaptive_link->interval_ms());
+    TEST_ASSERT_TRUE(adaptive_link->cadence() == LinkQuality::Cadence::kAtMost);
+    TEST_ASSERT_EQUAL_UINT32(5, adaptive_link->received());
+    TEST_ASSERT_EQUAL_UINT32(0, adaptive_link->lost());
+    TEST_ASSERT_EQUAL_UINT32(0, adaptive_link->gaps());
+    const LinkQuality* delta_link = broker.link_quality(DeviceId(0x22));
+    TEST_ASSERT_EQUAL_UINT32(60000, delta_link->interval_ms());
+    TEST_ASSERT_EQUAL_UINT32(4, delta_link->expected());
+    TEST_ASSERT_EQUAL_UINT32(1, delta_link->lost());
+    TEST_ASSERT_EQUAL_UINT32(1, delta_link->duplicates());
+    TEST_ASSERT_FALSE(broker.set_send_on_delta(DeviceId(0x99), true, 60000));
+}
@@ -0,0 +1,139 @@
+//! @file tests/MultiRadioBrokerTests.cpp
+//! @brief Tests for driver-bound roles and the multi-radio broker
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include <unity.h>
+#include <deque>
+#include <vector>
+#include "jenlib/ble/Ble.h"
+#include "jenlib/ble/MultiRadioBroker.h"
+#include "jenlib/ble/Roles.h"
+#include "jenlib/ble/drivers/NativeBleDriver.h"
+#include "TestHelpers.h"
+
+using jenlib::ble::BlePayload;
+using jenlib::ble::DeviceId;
+using jenlib::ble::MultiRadioBroker;
+using jenlib::ble::NativeBleDriver;
+using jenlib::ble::ReadingMsg;
+using jenlib::ble::SessionId;
+using jenlib::test::make_reading;
+
+//! @test test_multi_radio_broker_balances_sensors
+//! @brief Verifies start messages spread sensors evenly and go out on the assigned radio
+void test_multi_radio_broker_balances_sensors(void) {
+    //! @section Arrange
+    NativeBleDriver radio_a(DeviceId(0));
+    NativeBleDriver radio_b(DeviceId(0));
+    MultiRadioBroker broker;
+    TEST_ASSERT_TRUE(broker.add_radio(radio_a));
+    TEST_ASSERT_TRUE(broker.add_radio(radio_b));
+    TEST_ASSERT_TRUE(broker.begin());
+
+    //! @section Act
+    for (std::uint32_t id = 1; id <= 4; ++id) {
+        TEST_ASSERT_TRUE(broker.send_start(DeviceId(id), jenlib::ble::StartBroadcastMsg{DeviceId(id), SessionId(id)}));
+    }
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL(2, broker.sensor_count(0));
+    TEST_ASSERT_EQUAL(2, broker.sensor_count(1));
+    for (std::uint32_t id = 1; id <= 4; ++id) {
+        NativeBleDriver& assigned = broker.radio_for(DeviceId(id)) == 0 ? radio_a : radio_b;
+        NativeBleDriver& other = broker.radio_for(DeviceId(id)) == 0 ? radio_b : radio_a;
+        BlePayload payload;
+        TEST_ASSERT_TRUE(assigned.receive(DeviceId(id), payload));
+        TEST_ASSERT_FALSE(other.receive(DeviceId(id), payload));
+    }
+}
+
+//! @test test_multi_radio_broker_merges_readings
+//! @brief Verifies readings heard on any radio reach one callback and receipts follow the sensor
+void test_multi_radio_broker_merges_readings(void) {
+    //! @section Arrange
+    NativeBleDriver radio_a(DeviceId(0));
+    NativeBleDriver radio_b(DeviceId(0));
+    MultiRadioBroker broker;
+    broker.add_radio(radio_a);
+    broker.add_radio(radio_b);
+    std::vector<std::uint32_t> senders;
+    broker.configure_callbacks(jenlib::ble::BleCallbacks{
+        .on_reading = [&senders](DeviceId sender, const ReadingMsg&) { senders.push_back(sender.value()); },
+    });
+    broker.begin();
+    jenlib::ble::Sensor sensor_a(DeviceId(0x10), &radio_a);
+    jenlib::ble::Sensor sensor_b(DeviceId(0x20), &radio_b);
+
+    //! @section Act
+    sensor_a.broadcast_reading(make_reading(DeviceId(0x10), SessionId(1), 0));
+    sensor_b.broadcast_reading(make_reading(DeviceId(0x20), SessionId(1), 0));
+    sensor_b.broadcast_reading(make_reading(DeviceId(0x20), SessionId(1), 1000));
+    broker.process_events();
+    const bool receipt_sent = broker.send_receipt(DeviceId(0x20), jenlib::ble::ReceiptMsg{SessionId(1), 1000});
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL(3, senders.size());
+    TEST_ASSERT_EQUAL(0x10, senders[0]);
+    TEST_ASSERT_EQUAL(0x20, senders[1]);
+    TEST_ASSERT_EQUAL(1, broker.readings_received(0));
+    TEST_ASSERT_EQUAL(2, broker.readings_received(1));
+    TEST_ASSERT_EQUAL(0, broker.radio_for(DeviceId(0x10)));
+    TEST_ASSERT_EQUAL(1, broker.radio_for(DeviceId(0x20)));
+    TEST_ASSERT_TRUE(receipt_sent);
+    BlePayload payload;
+    TEST_ASSERT_TRUE(radio_b.receive(DeviceId(0x20), payload));
+    TEST_ASSERT_FALSE(broker.send_receipt(DeviceId(0x30), jenlib::ble::ReceiptMsg{SessionId(1), 0}));
+}
+
+//! @test test_roles_bound_to_driver_ignore_global_driver
+//! @brief Verifies a role bound to a driver uses it while unbound roles follow BLE::driver()
+void test_roles_bound_to_driver_ignore_global_driver(void) {
+    //! @section Arrange
+    NativeBleDriver global_radio(DeviceId(0));
+    NativeBleDriver bound_radio(DeviceId(0));
+    global_radio.begin();
+    bound_radio.begin();
+    jenlib::ble::BLE::set_driver(&global_radio);
+    jenlib::ble::Broker bound_broker(&bound_radio);
+    jenlib::ble::Broker global_broker;
+
+    //! @section Act
+    bound_broker.send_start(DeviceId(0x42), jenlib::ble::StartBroadcastMsg{DeviceId(0x42), SessionId(7)});
+    global_broker.send_start(DeviceId(0x43), jenlib::ble::StartBroadcastMsg{DeviceId(0x43), SessionId(8)});
+
+    //! @section Assert
+    BlePayload payload;
+    TEST_ASSERT_TRUE(bound_radio.receive(DeviceId(0x42), payload));
+    TEST_ASSERT_FALSE(global_radio.receive(DeviceId(0x42), payload));
+    TEST_ASSERT_TRUE(global_radio.receive(DeviceId(0x43), payload));
+    TEST_ASSERT_EQUAL_PTR(&bound_radio, bound_broker.driver());
+    TEST_ASSERT_EQUAL_PTR(&global_radio, global_broker.driver());
+    jenlib::ble::BLE::set_driver(nullptr);
+}
+
+//! @test test_multi_radio_broker_limits
+//! @brief Verifies the radio limit and that nothing is sent without a radio
+void test_multi_radio_broker_limits(void) {
+    //! @section Arrange
+    std::deque<NativeBleDriver> radios;
+    for (std::size_t i = 0; i <= MultiRadioBroker::kMaxRadios; ++i) {
+        radios.emplace_back(DeviceId(0));
+    }
+    MultiRadioBroker empty;
+    MultiRadioBroker full;
+
+    //! @section Act
+    const bool start_without_radio = empty.send_start(DeviceId(1), jenlib::ble::StartBroadcastMsg{});
+    for (std::size_t i = 0; i < MultiRadioBroker::kMaxRadios; ++i) {
+        TEST_ASSERT_TRUE(full.add_radio(radios[i]));
+    }
+    const bool extra_radio = full.add_radio(radios.back());
+
+    //! @section Assert
+    TEST_ASSERT_FALSE(start_without_radio);
+    TEST_ASSERT_FALSE(empty.begin());
+    TEST_ASSERT_FALSE(extra_radio);
+    TEST_ASSERT_EQUAL(MultiRadioBroker::kMaxRadios, full.radio_count());
+    TEST_ASSERT_EQUAL(MultiRadioBroker::kNoRadio, full.radio_for(DeviceId(1)));
+}
@@ -0,0 +1,189 @@
+//! @file tests/NativeReactorTests.cpp
+//! @brief Tests for the epoll/timerfd run loop
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include <unity.h>
+
+#if defined(__linux__)
+
+#include <sys/epoll.h>
+#include <unistd.h>
+#include <chrono>
+#include <string>
+#include <thread>
+#include "jenlib/ble/Messages.h"
+#include "jenlib/ble/drivers/NativeBleDriver.h"
+#include "jenlib/ble/drivers/ShmBleTransport.h"
+#include "jenlib/events/EventContext.h"
+#include "jenlib/events/EventDispatcher.h"
+#include "jenlib/events/NativeReactor.h"
+#include "jenlib/time/Time.h"
+#include "jenlib/time/TimerContext.h"
+#include "jenlib/time/drivers/NativeTimeDriver.h"
+#include "TestHelpers.h"
+
+using jenlib::events::NativeReactor;
+using jenlib::test::ManualTimeDriver;
+
+namespace {
+std::int64_t elapsed_ms(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+}
+}  // namespace
+
+//! @test test_reactor_sleeps_until_timer_deadline
+//! @brief Verifies run_once blocks on the timerfd until the next Time deadline
+void test_reactor_sleeps_until_timer_deadline(void) {
+    //! @section Arrange
+    jenlib::time::NativeTimeDriver time_driver;
+    jenlib::time::Time::setDriver(&time_driver);
+    jenlib::time::Time::clear_all_timers();
+    NativeReactor reactor;
+    TEST_ASSERT_TRUE(reactor.open());
+    bool fired = false;
+    jenlib::time::schedule_one_shot(30, [&fired]() { fired = true; });
+    const auto start = std::chrono::steady_clock::now();
+
+    //! @section Act
+    while (!fired && elapsed_ms(start) < 1000) {
+        reactor.run_once(-1);
+    }
+
+    //! @section Assert
+    TEST_ASSERT_TRUE(fired);
+    TEST_ASSERT_GREATER_OR_EQUAL(29, elapsed_ms(start));
+    TEST_ASSERT_LESS_OR_EQUAL(5, reactor.wakeups());  // Slept rather than spun
+    reactor.close();
+    jenlib::time::Time::clear_all_timers();
+    jenlib::time::Time::setDriver(nullptr);
+}
+
+//! @test test_reactor_does_not_sleep_on_deadline_past_clock_wrap
+//! @brief Verifies a deadline just before the 32-bit millisecond wrap counts as due once the clock has wrapped
+void test_reactor_does_not_sleep_on_deadline_past_clock_wrap(void) {
+    //! @section Arrange
+    ManualTimeDriver clock;
+    clock.now_ms = 0xFFFFFFF0u;
+    jenlib::events::EventContext events;
+    jenlib::time::TimerContext timers(&clock);
+    NativeReactor reactor(events, timers);
+    TEST_ASSERT_TRUE(reactor.open());
+    timers.schedule_callback(10, []() {});
+    clock.now_ms = 5;  // 21 ms later, past the deadline at 0xFFFFFFFA
+    const auto start = std::chrono::steady_clock::now();
+
+    //! @section Act
+    reactor.run_once(500);
+
+    //! @section Assert
+    TEST_ASSERT_LESS_THAN(250, elapsed_ms(start));
+    reactor.close();
+}
+
+//! @test test_reactor_dispatches_ready_fd
+//! @brief Verifies a descriptor written by another thread wakes the reactor and runs its callback
+void test_reactor_dispatches_ready_fd(void) {
+    //! @section Arrange
+    NativeReactor reactor;
+    TEST_ASSERT_TRUE(reactor.open());
+    int fds[2];
+    TEST_ASSERT_EQUAL(0, pipe(fds));
+    char received = 0;
+    TEST_ASSERT_TRUE(reactor.add_fd(fds[0], EPOLLIN, [&](std::uint32_t) { (void)read(fds[0], &received, 1); }));
+    std::thread writer([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        (void)write(fds[1], "x", 1);
+    });
+
+    //! @section Act
+    const std::size_t work = reactor.run_once(2000);
+    writer.join();
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL(1, work);
+    TEST_ASSERT_EQUAL('x', received);
+    TEST_ASSERT_TRUE(reactor.remove_fd(fds[0]));
+    ::close(fds[0]);
+    ::close(fds[1]);
+}
+
+//! @test test_reactor_wakes_on_dispatch_and_stop
+//! @brief Verifies dispatch_event wakes a sleeping reactor and stop() ends run()
+void test_reactor_wakes_on_dispatch_and_stop(void) {
+    //! @section Arrange
+    jenlib::events::EventDispatcher::clear_all_callbacks();
+    NativeReactor reactor;
+    TEST_ASSERT_TRUE(reactor.open());
+    int handled = 0;
+    jenlib::events::EventDispatcher::register_callback(jenlib::events::EventType::kCustom,
+        [&](const jenlib::events::Event&) {
+            ++handled;
+            reactor.stop();
+        });
+    std::thread producer([]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        const jenlib::events::Event event(jenlib::events::EventType::kCustom, 0, 1);
+        jenlib::events::EventDispatcher::dispatch_event(event);
+    });
+    const auto start = std::chrono::steady_clock::now();
+
+    //! @section Act
+    reactor.run();
+    producer.join();
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL(1, handled);
+    TEST_ASSERT_LESS_THAN(1000, elapsed_ms(start));
+    reactor.close();
+    jenlib::events::EventDispatcher::clear_all_callbacks();
+}
+
+//! @test test_reactor_wakes_on_shm_transport
+//! @brief Verifies a message arriving in a watched shared-memory ring is dispatched by the driver that reads it,
+//! with no driver installed in BLE
+void test_reactor_wakes_on_shm_transport(void) {
+    //! @section Arrange
+    const std::string name = "/jenlib-test-reactor-" + std::to_string(getpid());
+    jenlib::ble::ShmBleTransport broker_transport;
+    jenlib::ble::ShmBleTransport sensor_transport;
+    TEST_ASSERT_TRUE(broker_transport.open(name.c_str(), true));
+    TEST_ASSERT_TRUE(sensor_transport.open(name.c_str(), false));
+    jenlib::ble::NativeBleDriver broker(jenlib::ble::DeviceId(0));
+    broker.set_transport(&broker_transport);
+    broker.begin();
+    int readings = 0;
+    broker.set_reading_callback([&](jenlib::ble::DeviceId, const jenlib::ble::ReadingMsg&) { ++readings; });
+    NativeReactor reactor;
+    TEST_ASSERT_TRUE(reactor.open());
+    TEST_ASSERT_TRUE(reactor.watch_transport(broker_transport, broker));
+    std::thread sensor([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        jenlib::ble::BlePayload payload;
+        jenlib::ble::ReadingMsg::serialize(jenlib::ble::ReadingMsg{jenlib::ble::DeviceId(0x1234),
+                                           jenlib::ble::SessionId(1), 0, 2100, 4000}, payload);
+        sensor_transport.send(jenlib::ble::DeviceId(0), payload);
+    });
+
+    //! @section Act
+    const auto start = std::chrono::steady_clock::now();
+    while (readings == 0 && elapsed_ms(start) < 2000) {
+        reactor.run_once(2000);
+    }
+    sensor.join();
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL(1, readings);
+    reactor.close();
+    TEST_ASSERT_TRUE(jenlib::ble::ShmBleTransport::unlink(name.c_str()));
+}
+
+#else
+
+void test_reactor_sleeps_until_timer_deadline(void) { TEST_IGNORE(); }
+void test_reactor_does_not_sleep_on_deadline_past_clock_wrap(void) { TEST_IGNORE(); }
+void test_reactor_dispatches_ready_fd(void) { TEST_IGNORE(); }
+void test_reactor_wakes_on_dispatch_and_stop(void) { TEST_IGNORE(); }
+void test_reactor_wakes_on_shm_transport(void) { TEST_IGNORE(); }
+
+#endif  // __linux__
@@ -0,0 +1,111 @@
+//! @file tests/OneWireBackendTests.cpp
+//! @brief OneWire backend and bus framing tests.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include <unity.h>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+#include "jenlib/onewire/OneWireBus.h"
+#include "jenlib/onewire/drivers/GpioOneWireBackend.h"
+#include "jenlib/onewire/drivers/NativeOneWireBackend.h"
+
+using jenlib::onewire::GpioOneWireBackend;
+using jenlib::onewire::NativeOneWireBackend;
+using jenlib::onewire::OneWireBus;
+
+//! @test test_onewire_backend_write_bytes_chunked
+//! @brief Verifies write_bytes hands whole chunks to the backend, LSB first.
+//! @details Writes 10 bytes and expects two transfers (8 + 2) with the bytes intact.
+void test_onewire_backend_write_bytes_chunked(void) {
+    NativeOneWireBackend backend;
+    OneWireBus bus(backend);
+    bus.begin();
+
+    const std::array<std::uint8_t, 10> data{0x01, 0x80, 0xA5, 0x5A, 0xFF, 0x00, 0x12, 0x34, 0x56, 0x78};
+    TEST_ASSERT_EQUAL(10, bus.write_bytes(data.begin(), data.end()));
+    TEST_ASSERT_EQUAL(2, backend.transfer_count());
+
+    const auto written = backend.written_bytes();
+    TEST_ASSERT_EQUAL(data.size(), written.size());
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(data.data(), written.data(), data.size());
+}
+
+//! @test test_onewire_backend_read_rom_from_device
+//! @brief Verifies read_rom returns scripted device bytes with a valid CRC.
+//! @details The device answers after the READ ROM command, which reads back unchanged.
+void test_onewire_backend_read_rom_from_device(void) {
+    NativeOneWireBackend backend;
+    OneWireBus bus(backend);
+    bus.begin();
+
+    // Bits clocked during the command are not pulled low by the device
+    const std::uint8_t command_slots = 0xFF;
+    std::array<std::uint8_t, 8> rom{0x28, 0xFF, 0x4C, 0x60, 0x91, 0x16, 0x04, 0x00};
+    rom[7] = OneWireBus::crc8(rom.begin(), rom.begin() + 7);
+    backend.queue_device_bytes(&command_slots, 1);
+    backend.queue_device_bytes(rom.data(), rom.size());
+
+    OneWireBus::rom_code_t out{};
+    TEST_ASSERT_TRUE(bus.read_rom(out));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(rom.data(), out.data(), rom.size());
+    TEST_ASSERT_EQUAL_UINT8(0, OneWireBus::crc8(out.begin(), out.end()));
+    TEST_ASSERT_EQUAL(1, backend.reset_count());
+}
+
+//! @test test_onewire_backend_match_rom_single_transfer
+//! @brief Verifies MATCH ROM sends command and address in one backend operation.
+void test_onewire_backend_match_rom_single_transfer(void) {
+    NativeOneWireBackend backend;
+    OneWireBus bus(backend);
+    bus.begin();
+
+    const OneWireBus::rom_code_t rom{0x10, 0x20, 0x30, 0x40, 0x50, 0x60, 0x70, 0x80};
+    bus.match_rom(rom);
+
+    TEST_ASSERT_EQUAL(1, backend.transfer_count());
+    const auto written = backend.written_bytes();
+    TEST_ASSERT_EQUAL(9, written.size());
+    TEST_ASSERT_EQUAL_UINT8(static_cast<std::uint8_t>(OneWireBus::Command::MatchRom), written[0]);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(rom.data(), written.data() + 1, rom.size());
+}
+
+//! @test test_onewire_backend_presence_and_lifecycle
+//! @brief Verifies reset reports presence and the bus is inert before begin().
+void test_onewire_backend_presence_and_lifecycle(void) {
+    NativeOneWireBackend backend;
+    OneWireBus bus(backend);
+
+    TEST_ASSERT_FALSE(bus.reset());
+    bus.write_byte(0xAA);
+    TEST_ASSERT_EQUAL(0, backend.transfer_count());
+
+    bus.begin();
+    TEST_ASSERT_TRUE(bus.reset());
+    backend.set_device_present(false);
+    TEST_ASSERT_FALSE(bus.reset());
+
+    bus.end();
+    TEST_ASSERT_FALSE(bus.reset());
+}
+
+//! @test test_onewire_pin_constructors_time_slots
+//! @brief Verifies the pin constructors build a GPIO backend timed with platform_delay_us().
+//! @details An untimed bit-banged bus cannot meet the AN126 slot timings on hardware.
+//! The OneWirePin constructor delegates to the raw-pin one.
+void test_onewire_pin_constructors_time_slots(void) {
+    OneWireBus gpio_bus(GPIO::Pin(5));
+    OneWireBus raw_bus(static_cast<std::uint8_t>(6));
+
+    for (OneWireBus* bus : {&gpio_bus, &raw_bus}) {
+        const auto& backend = static_cast<const GpioOneWireBackend&>(bus->backend());
+        TEST_ASSERT_TRUE(backend.delay_us() == &jenlib::onewire::platform_delay_us);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    jenlib::onewire::platform_delay_us(480);
+    const auto waited = std::chrono::steady_clock::now() - start;
+    TEST_ASSERT_TRUE(waited >= std::chrono::microseconds(480));
+}
@@ -0,0 +1,134 @@
+//! @file tests/PacketiserTests.cpp
+//! @brief Measurement packetiser and packet reader tests.
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include <unity.h>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "jenlib/measurement/MeasurementPacketiser.h"
+
+using jenlib::ble::BlePayload;
+using jenlib::measurement::Measurement;
+using jenlib::measurement::MeasurementPacketiser;
+using jenlib::measurement::MeasurementPacketReader;
+
+namespace {
+std::vector<Measurement> make_series(std::size_t n) {
+    std::vector<Measurement> series;
+    for (std::size_t i = 0; i < n; ++i) {
+        const float wobble = static_cast<float>(static_cast<int>(i % 7) - 3) * 0.01f;
+        series.push_back(Measurement{static_cast<std::uint32_t>(1000 * i), 22.5f + wobble, 45.0f - wobble});
+    }
+    return series;
+}
+}  // namespace
+
+//! @test test_packetiser_roundtrip_across_packets
+//! @brief Verifies a long series splits over several full payloads and decodes back in order.
+void test_packetiser_roundtrip_across_packets(void) {
+    const auto series = make_series(100);
+    MeasurementPacketiser packetiser;
+    std::vector<BlePayload> packets;
+    const std::size_t produced = packetiser.packetise(series.begin(), series.end(), [&](BlePayload&& packet) {
+        packets.push_back(std::move(packet));
+    });
+    TEST_ASSERT_EQUAL(produced, packets.size());
+    TEST_ASSERT_TRUE(produced < 100 / 8);  // Better than one 8-byte measurement per 8 bytes
+
+    std::size_t index = 0;
+    for (const auto& packet : packets) {
+        MeasurementPacketReader reader(packet);
+        for (const auto& m : reader) {
+            TEST_ASSERT_EQUAL_UINT32(series[index].timestamp_ms, m.timestamp_ms);
+            TEST_ASSERT_FLOAT_WITHIN(0.005f, series[index].temperature_c, m.temperature_c);
+            TEST_ASSERT_FLOAT_WITHIN(0.005f, series[index].humidity_bp, m.humidity_bp);
+            ++index;
+        }
+        TEST_ASSERT_TRUE(reader.ok());
+    }
+    TEST_ASSERT_EQUAL(series.size(), index);
+}
+
+//! @test test_packetiser_large_and_negative_deltas
+//! @brief Verifies big jumps, negative temperatures and out-of-order timestamps survive.
+void test_packetiser_large_and_negative_deltas(void) {
+    const std::vector<Measurement> series{
+        {4000000000u, -40.0f, 0.0f}, {5u, 85.0f, 100.0f}, {10u, -0.01f, 50.0f}};
+    BlePayload packet;
+    MeasurementPacketiser packetiser;
+    TEST_ASSERT_TRUE(packetiser.pack(series.begin(), series.end(), packet) == series.end());
+
+    MeasurementPacketReader reader(packet);
+    TEST_ASSERT_EQUAL(3, reader.count());
+    Measurement m{};
+    for (const auto& expected : series) {
+        TEST_ASSERT_TRUE(reader.next(m));
+        TEST_ASSERT_EQUAL_UINT32(expected.timestamp_ms, m.timestamp_ms);
+        TEST_ASSERT_FLOAT_WITHIN(0.005f, expected.temperature_c, m.temperature_c);
+        TEST_ASSERT_FLOAT_WITHIN(0.005f, expected.humidity_bp, m.humidity_bp);
+    }
+    TEST_ASSERT_FALSE(reader.next(m));
+    TEST_ASSERT_TRUE(reader.ok());
+}
+
+//! @test test_packetiser_rejects_malformed_packets
+//! @brief Verifies wrong tags and truncated deltas stop decoding and report an error.
+void test_packetiser_rejects_malformed_packets(void) {
+    const auto series = make_series(5);
+    BlePayload packet;
+    MeasurementPacketiser().pack(series.begin(), series.end(), packet);
+
+    packet.size -= 1;  // Cut the last delta short
+    MeasurementPacketReader truncated(packet);
+    Measurement m{};
+    std::size_t decoded = 0;
+    while (truncated.next(m)) {
+        ++decoded;
+    }
+    TEST_ASSERT_EQUAL(4, decoded);
+    TEST_ASSERT_FALSE(truncated.ok());
+
+    packet.bytes[0] = 0x00;
+    MeasurementPacketReader wrong_tag(packet);
+    TEST_ASSERT_FALSE(wrong_tag.ok());
+    TEST_ASSERT_FALSE(wrong_tag.next(m));
+
+    BlePayload empty;
+    TEST_ASSERT_TRUE(MeasurementPacketiser().pack(series.begin(), series.begin(), empty) == series.begin());
+    TEST_ASSERT_EQUAL(0, empty.size);
+}
+
+//! @test test_varint_codec_bounds
+//! @brief Verifies the shared codec round-trips extremes and rejects truncated or oversized varints.
+void test_varint_codec_bounds(void) {
+    using jenlib::storage::get_varint;
+    using jenlib::storage::put_varint;
+    using jenlib::storage::unzigzag;
+    using jenlib::storage::zigzag;
+
+    TEST_ASSERT_EQUAL_UINT32(19u, zigzag(-10));
+    TEST_ASSERT_EQUAL_INT32(INT32_MIN, unzigzag(zigzag(INT32_MIN)));
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, unzigzag(zigzag(INT32_MAX)));
+
+    std::uint8_t bytes[jenlib::storage::kMaxVarintSize];
+    const std::size_t len = put_varint(0xFFFFFFFFu, bytes);
+    TEST_ASSERT_EQUAL(jenlib::storage::kMaxVarintSize, len);
+    const std::uint8_t* it = bytes;
+    std::uint32_t value = 0;
+    TEST_ASSERT_TRUE(get_varint(it, it + len, value));
+    TEST_ASSERT_EQUAL_UINT32(0xFFFFFFFFu, value);
+    TEST_ASSERT_TRUE(it == bytes + len);
+
+    it = bytes;
+    TEST_ASSERT_FALSE(get_varint(it, it + len - 1, value));  // Truncated
+
+    const std::uint8_t too_wide[] = {0xFF, 0xFF, 0xFF, 0xFF, 0x1F};
+    it = too_wide;
+    TEST_ASSERT_FALSE(get_varint(it, too_wide + sizeof(too_wide), value));
+
+    const std::uint8_t too_long[] = {0x80, 0x80, 0x80, 0x80, 0x80, 0x00};
+    it = too_long;
+    TEST_ASSERT_FALSE(get_varint(it, too_long + sizeof(too_long), value));
+}
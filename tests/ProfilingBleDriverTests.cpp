@@ -0,0 +1,131 @@
+//! @file tests/ProfilingBleDriverTests.cpp
+//! @brief Tests for the profiling BLE driver decorator
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include <unity.h>
+#include "jenlib/ble/Messages.h"
+#include "jenlib/ble/Roles.h"
+#include "jenlib/ble/drivers/NativeBleDriver.h"
+#include "jenlib/ble/drivers/ProfilingBleDriver.h"
+#include "TestHelpers.h"
+
+using jenlib::ble::BleCallbackKind;
+using jenlib::ble::BleCallbackTiming;
+using jenlib::ble::BlePayload;
+using jenlib::ble::BleProfileSnapshot;
+using jenlib::ble::DeviceId;
+using jenlib::ble::MessageType;
+using jenlib::ble::NativeBleDriver;
+using jenlib::ble::ProfilingBleDriver;
+using jenlib::ble::ReadingMsg;
+using jenlib::ble::SessionId;
+using jenlib::test::make_reading;
+
+namespace {
+std::uint32_t fake_now_us = 0;
+
+std::uint32_t fake_clock_us() {
+    return fake_now_us;
+}
+}  // namespace
+
+//! @test test_profiling_driver_counts_traffic_by_direction_and_type
+//! @brief Verifies messages and bytes are counted per direction and message type while being forwarded
+void test_profiling_driver_counts_traffic_by_direction_and_type(void) {
+    //! @section Arrange
+    NativeBleDriver radio(DeviceId(0));
+    ProfilingBleDriver profiled(radio);
+    std::uint32_t readings = 0;
+    profiled.set_reading_callback([&readings](DeviceId, const ReadingMsg&) { ++readings; });
+    profiled.begin();
+    jenlib::ble::Sensor sensor(DeviceId(0x10), &profiled);
+    BlePayload reading_bytes;
+    ReadingMsg::serialize(make_reading(DeviceId(0x10), SessionId(1), 0), reading_bytes);
+
+    //! @section Act
+    sensor.broadcast_reading(make_reading(DeviceId(0x10), SessionId(1), 0));
+    sensor.broadcast_reading(make_reading(DeviceId(0x10), SessionId(1), 1000));
+    jenlib::ble::Broker(&profiled).send_receipt(DeviceId(0x10), jenlib::ble::ReceiptMsg{SessionId(1), 1000});
+    BlePayload receipt;
+    const bool received = profiled.receive(DeviceId(0x10), receipt);
+    const BleProfileSnapshot stats = profiled.snapshot();
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL(2, readings);
+    TEST_ASSERT_TRUE(received);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.outbound.messages);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.outbound.count(MessageType::Reading));
+    TEST_ASSERT_EQUAL_UINT32(1, stats.outbound.count(MessageType::Receipt));
+    TEST_ASSERT_EQUAL_UINT64(2 * reading_bytes.size + receipt.size, stats.outbound.bytes);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.inbound.messages);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.inbound.count(MessageType::Reading));
+    TEST_ASSERT_EQUAL_UINT32(1, stats.inbound.count(MessageType::Receipt));
+    TEST_ASSERT_EQUAL_UINT64(2 * reading_bytes.size + receipt.size, stats.inbound.bytes);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.callback(BleCallbackKind::Reading).calls);
+    profiled.reset();
+    TEST_ASSERT_EQUAL_UINT32(0, profiled.snapshot().outbound.messages);
+}
+
+//! @test test_profiling_driver_times_callbacks
+//! @brief Verifies callback durations land in the log2 histogram with total and maximum
+void test_profiling_driver_times_callbacks(void) {
+    //! @section Arrange
+    NativeBleDriver radio(DeviceId(0));
+    ProfilingBleDriver profiled(radio, fake_clock_us);
+    std::uint32_t next_cost_us = 0;
+    profiled.set_reading_callback([&next_cost_us](DeviceId, const ReadingMsg&) { fake_now_us += next_cost_us; });
+    profiled.set_connection_callback([](bool) { fake_now_us += 3; });
+    profiled.begin();
+    jenlib::ble::Sensor sensor(DeviceId(0x10), &profiled);
+
+    //! @section Act
+    for (const std::uint32_t cost : {0u, 1u, 5u, 5u, 40000u}) {
+        next_cost_us = cost;
+        sensor.broadcast_reading(make_reading(DeviceId(0x10), SessionId(1), cost));
+    }
+    const BleCallbackTiming reading = profiled.snapshot().callback(BleCallbackKind::Reading);
+    const BleCallbackTiming connection = profiled.snapshot().callback(BleCallbackKind::Connection);
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL_UINT32(5, reading.calls);
+    TEST_ASSERT_EQUAL_UINT64(40011, reading.total_us);
+    TEST_ASSERT_EQUAL_UINT32(40000, reading.max_us);
+    TEST_ASSERT_EQUAL_UINT32(1, reading.histogram[0]);
+    TEST_ASSERT_EQUAL_UINT32(1, reading.histogram[1]);
+    TEST_ASSERT_EQUAL_UINT32(2, reading.histogram[3]);
+    TEST_ASSERT_EQUAL_UINT32(1, reading.histogram[BleCallbackTiming::kBuckets - 1]);
+    TEST_ASSERT_EQUAL_UINT32(8, reading.quantile_upper_us(0.8f));
+    TEST_ASSERT_EQUAL_UINT32(40000, reading.quantile_upper_us(1.0f));
+    TEST_ASSERT_EQUAL_UINT32(1, connection.calls);
+    TEST_ASSERT_EQUAL_UINT32(1, connection.histogram[2]);
+}
+
+//! @test test_profiling_driver_tracks_inbox_high_water
+//! @brief Verifies the deepest inbox seen by poll() and receive() is kept after it drains
+void test_profiling_driver_tracks_inbox_high_water(void) {
+    //! @section Arrange
+    NativeBleDriver radio(DeviceId(0));
+    ProfilingBleDriver profiled(radio);
+    profiled.begin();
+    jenlib::ble::Sensor sensor(DeviceId(0x10), &profiled);
+    for (std::uint32_t i = 0; i < 5; ++i) {
+        sensor.broadcast_reading(make_reading(DeviceId(0x10), SessionId(1), i));
+    }
+
+    //! @section Act
+    profiled.poll();
+    BlePayload payload;
+    std::uint32_t drained = 0;
+    while (profiled.receive(DeviceId(0), payload)) {
+        ++drained;
+    }
+    const BleProfileSnapshot stats = profiled.snapshot();
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL_UINT32(5, drained);
+    TEST_ASSERT_EQUAL_UINT32(5, stats.inbox_high_water);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.inbox_depth);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.poll.calls);
+    TEST_ASSERT_EQUAL_UINT32(5, stats.inbound.count(MessageType::Reading));
+}
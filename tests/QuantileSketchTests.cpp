@@ -0,0 +1,157 @@
+//! @file tests/QuantileSketchTests.cpp
+//! @brief Tests for the KLL quantile sketch
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include <unity.h>
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+#include <jenlib/measurement/QuantileSketch.h>
+#include <jenlib/state/BrokerStateMachine.h>
+
+using jenlib::measurement::QuantileSketch;
+
+namespace {
+//! @brief Deterministic pseudo-random values in [-2000, 2000).
+std::int16_t next_value(std::uint32_t& state) {
+    state = state * 1664525u + 1013904223u;
+    return static_cast<std::int16_t>(static_cast<std::int32_t>((state >> 8) % 4000) - 2000);
+}
+
+//! @brief Fraction of @p sorted values below the sketch's answer, minus @p q.
+float rank_error(const std::vector<std::int16_t>& sorted, std::int16_t answer, float q) {
+    const auto below = std::lower_bound(sorted.begin(), sorted.end(), answer) - sorted.begin();
+    const auto at_or_below = std::upper_bound(sorted.begin(), sorted.end(), answer) - sorted.begin();
+    const float n = static_cast<float>(sorted.size());
+    const float target = q * n;
+    if (target >= static_cast<float>(below) && target <= static_cast<float>(at_or_below)) {
+        return 0.0f;  // The answer covers the target rank
+    }
+    const float distance = std::min(std::abs(static_cast<float>(below) - target),
+                                    std::abs(static_cast<float>(at_or_below) - target));
+    return distance / n;
+}
+}  // namespace
+
+//! @test test_quantile_sketch_exact_while_small
+//! @brief Verifies quantiles are exact before the first compaction and the broker feeds its sketches
+void test_quantile_sketch_exact_while_small(void) {
+    //! @section Arrange
+    QuantileSketch<32> sketch;
+    jenlib::state::BrokerStateMachine broker_sm;
+    broker_sm.handle_start_command(jenlib::ble::DeviceId(0x1234), jenlib::ble::SessionId(0x5678));
+
+    //! @section Act
+    for (std::int16_t value = 100; value >= 1; --value) {
+        sketch.add(value);
+        broker_sm.handle_reading(jenlib::ble::DeviceId(0x1234),
+                                 jenlib::ble::ReadingMsg{jenlib::ble::DeviceId(0x1234), jenlib::ble::SessionId(0x5678),
+                                                         static_cast<std::uint32_t>(value) * 1000u, value, 4000});
+    }
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL_UINT32(100, sketch.count());
+    TEST_ASSERT_EQUAL(100, sketch.retained());
+    TEST_ASSERT_EQUAL_INT16(1, sketch.quantile(0.0f));
+    TEST_ASSERT_EQUAL_INT16(50, sketch.quantile(0.5f));
+    TEST_ASSERT_EQUAL_INT16(95, sketch.quantile(0.95f));
+    TEST_ASSERT_EQUAL_INT16(100, sketch.quantile(1.0f));
+    TEST_ASSERT_EQUAL_UINT64(10, sketch.rank(10));
+    TEST_ASSERT_EQUAL_UINT32(100, broker_sm.get_quantiles().temperature_c_centi.count());
+    TEST_ASSERT_EQUAL_INT16(99, broker_sm.get_quantiles().temperature_c_centi.quantile(0.99f));
+    TEST_ASSERT_EQUAL_INT16(4000, broker_sm.get_quantiles().humidity_bp.quantile(0.5f));
+    TEST_ASSERT_EQUAL_INT16(0, QuantileSketch<32>{}.quantile(0.5f));
+}
+
+//! @test test_quantile_sketch_bounded_memory_and_error
+//! @brief Verifies a long stream stays within kCapacity items and the rank error stays small
+void test_quantile_sketch_bounded_memory_and_error(void) {
+    //! @section Arrange
+    QuantileSketch<128> sketch;
+    std::vector<std::int16_t> values;
+    std::uint32_t state = 7;
+
+    //! @section Act
+    for (std::uint32_t i = 0; i < 200000; ++i) {
+        values.push_back(next_value(state));
+        sketch.add(values.back());
+    }
+    std::sort(values.begin(), values.end());
+
+    //! @section Assert
+    TEST_ASSERT_LESS_OR_EQUAL(QuantileSketch<128>::kCapacity, sketch.retained());
+    TEST_ASSERT_EQUAL_UINT32(200000, sketch.count());
+    TEST_ASSERT_EQUAL_INT16(values.front(), sketch.min());
+    TEST_ASSERT_EQUAL_INT16(values.back(), sketch.max());
+    for (const float q : {0.01f, 0.25f, 0.5f, 0.95f, 0.99f}) {
+        TEST_ASSERT_FLOAT_WITHIN(0.03f, 0.0f, rank_error(values, sketch.quantile(q), q));
+    }
+}
+
+//! @test test_quantile_sketch_merge_matches_combined_stream
+//! @brief Verifies merged shard sketches answer for the union of their streams
+void test_quantile_sketch_merge_matches_combined_stream(void) {
+    //! @section Arrange
+    QuantileSketch<128> shards[4];
+    std::vector<std::int16_t> values;
+    std::uint32_t state = 11;
+    for (std::uint32_t i = 0; i < 80000; ++i) {
+        // Shards see different ranges, so a bad merge would skew the quantiles
+        const std::int16_t value = static_cast<std::int16_t>(next_value(state) / 4 + 1000 * static_cast<int>(i % 4));
+        values.push_back(value);
+        shards[i % 4].add(value);
+    }
+    std::sort(values.begin(), values.end());
+
+    //! @section Act
+    QuantileSketch<128> fleet;
+    for (const auto& shard : shards) {
+        fleet.merge(shard);
+    }
+    fleet.merge(QuantileSketch<128>{});  // Empty sketches change nothing
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL_UINT32(80000, fleet.count());
+    TEST_ASSERT_LESS_OR_EQUAL(QuantileSketch<128>::kCapacity, fleet.retained());
+    TEST_ASSERT_EQUAL_INT16(values.front(), fleet.min());
+    TEST_ASSERT_EQUAL_INT16(values.back(), fleet.max());
+    TEST_ASSERT_EQUAL_UINT64(80000, fleet.rank(values.back()));
+    for (const float q : {0.1f, 0.5f, 0.9f, 0.99f}) {
+        TEST_ASSERT_FLOAT_WITHIN(0.03f, 0.0f, rank_error(values, fleet.quantile(q), q));
+    }
+}
+
+//! @test test_quantile_sketch_serialize_round_trip
+//! @brief Verifies a serialized sketch reads back identically and malformed images are rejected
+void test_quantile_sketch_serialize_round_trip(void) {
+    //! @section Arrange
+    jenlib::measurement::ReadingQuantiles<64> quantiles;
+    for (std::uint32_t i = 0; i < 5000; ++i) {
+        quantiles.add(jenlib::ble::ReadingMsg{jenlib::ble::DeviceId(1), jenlib::ble::SessionId(1), i * 1000,
+                                              static_cast<std::int16_t>(2000 + i % 300),
+                                              static_cast<std::uint16_t>(4000 + i % 50)});
+    }
+    std::vector<std::uint8_t> image(jenlib::measurement::ReadingQuantiles<64>::kMaxSerializedSize);
+
+    //! @section Act
+    const std::size_t written = quantiles.serialize(image.data(), image.size());
+    jenlib::measurement::ReadingQuantiles<64> decoded;
+    const std::size_t read = decoded.deserialize(image.data(), written);
+    QuantileSketch<128> other_k;
+    const std::size_t wrong_k = other_k.deserialize(image.data(), written);
+    image[4] ^= 0x01;  // Count no longer matches the level weights
+    const std::size_t corrupt = decoded.temperature_c_centi.deserialize(image.data(), written);
+
+    //! @section Assert
+    TEST_ASSERT_GREATER_THAN(0, written);
+    TEST_ASSERT_EQUAL(written, read);
+    TEST_ASSERT_EQUAL(0, wrong_k);
+    TEST_ASSERT_EQUAL(0, corrupt);
+    TEST_ASSERT_EQUAL_UINT32(5000, decoded.humidity_bp.count());
+    for (const float q : {0.0f, 0.5f, 0.99f, 1.0f}) {
+        TEST_ASSERT_EQUAL_INT16(quantiles.temperature_c_centi.quantile(q), decoded.temperature_c_centi.quantile(q));
+        TEST_ASSERT_EQUAL_INT16(quantiles.humidity_bp.quantile(q), decoded.humidity_bp.quantile(q));
+    }
+    TEST_ASSERT_EQUAL(0, quantiles.serialize(image.data(), 16));
+}
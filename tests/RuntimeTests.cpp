@@ -0,0 +1,170 @@
+//! @file tests/RuntimeTests.cpp
+//! @brief Tests for the cooperative runtime: phase ordering, per-pass limits and profiling
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include <unity.h>
+#include <string>
+#include <vector>
+#include "jenlib/ble/Messages.h"
+#include "jenlib/ble/drivers/ReplayBleDriver.h"
+#include "jenlib/events/EventContext.h"
+#include "jenlib/events/Runtime.h"
+#include "jenlib/time/TimeDriver.h"
+#include "jenlib/time/TimerContext.h"
+#include "TestHelpers.h"
+
+using jenlib::events::Event;
+using jenlib::events::EventContext;
+using jenlib::events::EventType;
+using jenlib::events::PhaseConfig;
+using jenlib::events::PhaseStats;
+using jenlib::events::Runtime;
+using jenlib::test::ManualTimeDriver;
+
+namespace {
+PhaseConfig limits(std::size_t max_items, std::uint32_t budget_ms, std::uint8_t priority) {
+    PhaseConfig config;
+    config.max_items = max_items;
+    config.budget_ms = budget_ms;
+    config.priority = priority;
+    return config;
+}
+
+jenlib::ble::BleTraceRecord reading_record(std::uint32_t sender) {
+    jenlib::ble::BleTraceRecord record;
+    record.device = jenlib::ble::DeviceId(sender);
+    jenlib::ble::ReadingMsg::serialize(
+        jenlib::test::make_reading(jenlib::ble::DeviceId(sender), jenlib::ble::SessionId(1), 0), record.payload);
+    return record;
+}
+}  // namespace
+
+//! @test test_runtime_orders_phases_by_priority_and_rotates_ties
+//! @brief Verifies lower priorities run first and equal priorities take turns going first
+void test_runtime_orders_phases_by_priority_and_rotates_ties(void) {
+    //! @section Arrange
+    Runtime runtime(nullptr);
+    std::string order;
+    const auto step = [&order](char name) {
+        return [&order, name](const PhaseConfig&) {
+            order.push_back(name);
+            return std::size_t{1};
+        };
+    };
+    runtime.add_phase("ble", step('b'), limits(4, 0, 1));
+    runtime.add_phase("timers", step('t'), limits(4, 0, 0));
+    runtime.add_phase("events", step('e'), limits(4, 0, 1));
+
+    //! @section Act
+    const std::size_t handled = runtime.run_once();
+    order.push_back('|');
+    runtime.run_once();
+    order.push_back('|');
+    runtime.run_once();
+    while (runtime.get_phase_count() < Runtime::kMaxPhases) {
+        runtime.add_phase("filler", step('f'), PhaseConfig{});
+    }
+    const auto rejected = runtime.add_phase("extra", step('x'), PhaseConfig{});
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL(3, handled);
+    TEST_ASSERT_EQUAL_STRING("tbe|teb|tbe", order.c_str());
+    TEST_ASSERT_EQUAL_UINT8(jenlib::events::kInvalidPhaseId, rejected);
+    TEST_ASSERT_FALSE(runtime.set_phase_config(jenlib::events::kInvalidPhaseId, PhaseConfig{}));
+    TEST_ASSERT_EQUAL_UINT32(3, runtime.get_loop_stats().calls);
+}
+
+//! @test test_runtime_bounds_events_and_timers_per_pass
+//! @brief Verifies event and timer phases handle at most their limit and leave the rest for later passes
+void test_runtime_bounds_events_and_timers_per_pass(void) {
+    //! @section Arrange
+    ManualTimeDriver clock;
+    EventContext events;
+    jenlib::time::TimerContext timers(&clock);
+    std::vector<std::uint32_t> handled_events;
+    events.register_callback(EventType::kCustom, [&](const Event& event) { handled_events.push_back(event.data); });
+    std::uint32_t fired = 0;
+    for (int i = 0; i < 3; ++i) {
+        timers.schedule_callback(10, [&fired] { ++fired; }, false);
+    }
+    Runtime runtime(&clock);
+    const auto timer_phase = runtime.add_timers(timers, limits(1, 0, 0));
+    const auto event_phase = runtime.add_events(events, limits(2, 0, 1));
+    for (std::uint32_t i = 0; i < 5; ++i) {
+        events.dispatch_event(Event(EventType::kCustom, 0, i));
+    }
+    clock.now_ms = 10;
+
+    //! @section Act
+    const std::size_t first = runtime.run_once();
+    const std::uint32_t fired_after_first = fired;
+    runtime.run_once();
+    runtime.run_once();
+    runtime.run_once();
+    PhaseStats event_stats;
+    PhaseStats timer_stats;
+    runtime.get_phase_stats(event_phase, event_stats);
+    runtime.get_phase_stats(timer_phase, timer_stats);
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL(3, first);  // One timer, two events
+    TEST_ASSERT_EQUAL_UINT32(1, fired_after_first);
+    TEST_ASSERT_EQUAL_UINT32(3, fired);
+    TEST_ASSERT_EQUAL(5, handled_events.size());
+    TEST_ASSERT_EQUAL_UINT32(4, handled_events.back());
+    TEST_ASSERT_EQUAL_UINT64(5, event_stats.items);
+    TEST_ASSERT_EQUAL_UINT32(1, event_stats.idle_passes);
+    TEST_ASSERT_EQUAL_UINT64(3, timer_stats.items);
+    TEST_ASSERT_EQUAL_UINT32(2, timers.get_deferred_passes());
+    TEST_ASSERT_EQUAL_UINT32(2, events.get_deferred_passes());
+    TEST_ASSERT_EQUAL_PTR(&clock, events.time_driver());
+}
+
+//! @test test_runtime_bounds_ble_intake_and_profiles_phases
+//! @brief Verifies a burst of BLE messages is taken in bounded slices and every pass reaches the profiling hook
+void test_runtime_bounds_ble_intake_and_profiles_phases(void) {
+    //! @section Arrange
+    ManualTimeDriver clock;
+    EventContext events;
+    std::vector<jenlib::ble::BleTraceRecord> records;
+    for (std::uint32_t i = 0; i < 10; ++i) {
+        records.push_back(reading_record(0x10 + i));
+    }
+    jenlib::ble::ReplayBleDriver radio(jenlib::ble::DeviceId(0), std::move(records));
+    radio.set_reading_callback([&](jenlib::ble::DeviceId sender, const jenlib::ble::ReadingMsg&) {
+        events.dispatch_event(Event(EventType::kBleMessage, clock.now_ms, sender.value()));
+    });
+    radio.begin();
+    events.register_callback(EventType::kBleMessage, [&](const Event&) { clock.delay(2); });
+    Runtime runtime(&clock);
+    const auto ble_phase = runtime.add_ble_intake(radio, limits(3, 0, 0));
+    const auto event_phase = runtime.add_events(events, limits(jenlib::time::kNoPassLimit, 5, 1));
+    runtime.set_loop_budget_ms(5);
+    std::vector<jenlib::events::PhaseSample> samples;
+    runtime.set_profile_hook([&samples](const jenlib::events::PhaseSample& sample) { samples.push_back(sample); });
+
+    //! @section Act
+    std::size_t iterations = 0;
+    while (!radio.finished() || events.get_pending_event_count() > 0) {
+        runtime.run_once();
+        ++iterations;
+    }
+    PhaseStats ble_stats;
+    PhaseStats event_stats;
+    runtime.get_phase_stats(ble_phase, ble_stats);
+    runtime.get_phase_stats(event_phase, event_stats);
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL(4, iterations);  // 3 + 3 + 3 + 1 messages
+    TEST_ASSERT_EQUAL_UINT64(10, ble_stats.items);
+    TEST_ASSERT_EQUAL_UINT64(10, event_stats.items);
+    TEST_ASSERT_EQUAL_UINT32(6, event_stats.timing.worst_ms);
+    TEST_ASSERT_EQUAL_UINT32(3, event_stats.timing.overruns);
+    TEST_ASSERT_EQUAL_UINT32(3, runtime.get_loop_stats().overruns);
+    TEST_ASSERT_EQUAL(2 * iterations, samples.size());
+    TEST_ASSERT_EQUAL_STRING("ble", samples[0].name);
+    TEST_ASSERT_EQUAL_STRING("events", samples[1].name);
+    TEST_ASSERT_EQUAL(3, samples[1].items);
+    TEST_ASSERT_EQUAL_UINT32(6, samples[1].elapsed_ms);
+}
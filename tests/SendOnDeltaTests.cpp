@@ -0,0 +1,107 @@
+//! @file tests/SendOnDeltaTests.cpp
+//! @brief Tests for send-on-delta reporting and step-hold reconstruction
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include <unity.h>
+#include <array>
+#include <jenlib/measurement/SendOnDelta.h>
+#include <jenlib/state/BrokerStateMachine.h>
+#include <jenlib/state/SensorStateMachine.h>
+#include "TestHelpers.h"
+
+using jenlib::test::make_reading;
+
+namespace {
+constexpr jenlib::ble::DeviceId kSensor(0x1234);
+constexpr jenlib::ble::SessionId kSession(0x5678);
+}  // namespace
+
+//! @test test_send_on_delta_deadband_and_heartbeat
+//! @brief Verifies readings inside the deadband are held back until the heartbeat expires
+void test_send_on_delta_deadband_and_heartbeat(void) {
+    //! @section Arrange
+    jenlib::measurement::SendOnDeltaFilter filter({10, 50, 5000});
+
+    //! @section Act / Assert
+    TEST_ASSERT_TRUE(filter.should_send(make_reading(kSensor, kSession, 0, 2000, 4000)));      // First reading
+    TEST_ASSERT_FALSE(filter.should_send(make_reading(kSensor, kSession, 1000, 2010, 4050)));  // On the deadband edge
+    TEST_ASSERT_TRUE(filter.should_send(make_reading(kSensor, kSession, 2000, 2011, 4000)));   // Temperature beyond
+    TEST_ASSERT_TRUE(filter.should_send(make_reading(kSensor, kSession, 3000, 2011, 3949)));   // Humidity beyond
+    TEST_ASSERT_FALSE(filter.should_send(make_reading(kSensor, kSession, 7999, 2011, 3949)));
+    TEST_ASSERT_TRUE(filter.should_send(make_reading(kSensor, kSession, 8000, 2011, 3949)));   // Heartbeat
+    TEST_ASSERT_EQUAL_UINT32(4, filter.sent_count());
+    TEST_ASSERT_EQUAL_UINT32(2, filter.suppressed_count());
+}
+
+//! @test test_sensor_should_broadcast_by_reporting_mode
+//! @brief Verifies periodic mode sends every reading and send-on-delta filters per session
+void test_sensor_should_broadcast_by_reporting_mode(void) {
+    //! @section Arrange
+    jenlib::state::SensorStateMachine sensor_sm;
+    const jenlib::ble::StartBroadcastMsg start_msg{kSensor, kSession};
+    TEST_ASSERT_FALSE(sensor_sm.should_broadcast(make_reading(kSensor, kSession, 0, 2000, 4000)));  // Not running yet
+    sensor_sm.handle_connection_change(true);
+    sensor_sm.handle_start_broadcast(kSensor, start_msg);
+
+    //! @section Act / Assert
+    TEST_ASSERT_EQUAL(jenlib::state::ReportingMode::kPeriodic, sensor_sm.get_reporting_mode());
+    TEST_ASSERT_TRUE(sensor_sm.should_broadcast(make_reading(kSensor, kSession, 0, 2000, 4000)));
+    TEST_ASSERT_TRUE(sensor_sm.should_broadcast(make_reading(kSensor, kSession, 1000, 2000, 4000)));
+
+    sensor_sm.set_send_on_delta_reporting({10, 50, 0});
+    TEST_ASSERT_TRUE(sensor_sm.should_broadcast(make_reading(kSensor, kSession, 2000, 2000, 4000)));
+    TEST_ASSERT_FALSE(sensor_sm.should_broadcast(make_reading(kSensor, kSession, 3000, 2005, 4000)));
+    TEST_ASSERT_EQUAL_UINT32(1, sensor_sm.get_suppressed_reading_count());
+
+    // A new session always starts with a reading on the wire
+    sensor_sm.handle_session_end();
+    sensor_sm.handle_start_broadcast(kSensor, start_msg);
+    TEST_ASSERT_TRUE(sensor_sm.should_broadcast(make_reading(kSensor, kSession, 0, 2005, 4000)));
+    TEST_ASSERT_EQUAL_UINT32(0, sensor_sm.get_suppressed_reading_count());
+}
+
+//! @test test_broker_step_hold_reconstruction
+//! @brief Verifies the broker holds each received value until the next reading
+void test_broker_step_hold_reconstruction(void) {
+    //! @section Arrange
+    jenlib::state::BrokerStateMachine broker_sm;
+    broker_sm.handle_start_command(kSensor, kSession);
+
+    //! @section Act
+    broker_sm.handle_reading(kSensor, make_reading(kSensor, kSession, 0, 2000, 4000));
+    broker_sm.handle_reading(kSensor, make_reading(kSensor, kSession, 5000, 2050, 4100));
+    broker_sm.handle_reading(kSensor, make_reading(kSensor, kSession, 9000, 2100, 4200));
+
+    //! @section Assert
+    const auto& series = broker_sm.get_series();
+    TEST_ASSERT_EQUAL(3, series.size());
+    std::array<jenlib::measurement::SeriesPoint, 10> grid{};
+    TEST_ASSERT_EQUAL(10, series.resample(0, 1000, grid.size(), grid.begin()));
+    TEST_ASSERT_EQUAL_INT16(2000, grid[4].temperature_c_centi);
+    TEST_ASSERT_EQUAL_INT16(2050, grid[5].temperature_c_centi);
+    TEST_ASSERT_EQUAL_UINT16(4100, grid[8].humidity_bp);
+    TEST_ASSERT_EQUAL_UINT32(8000, grid[8].offset_ms);
+    TEST_ASSERT_EQUAL_INT16(2100, grid[9].temperature_c_centi);
+}
+
+//! @test test_step_hold_series_ring_and_order
+//! @brief Verifies the series evicts the oldest readings and rejects late ones
+void test_step_hold_series_ring_and_order(void) {
+    //! @section Arrange
+    jenlib::measurement::StepHoldSeries<3> series;
+
+    //! @section Act
+    for (std::uint32_t i = 0; i < 5; ++i) {
+        TEST_ASSERT_TRUE(series.append(make_reading(kSensor, kSession, i * 100, static_cast<std::int16_t>(i), 0)));
+    }
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL(3, series.size());
+    TEST_ASSERT_EQUAL_UINT32(200, series.at(0).offset_ms);
+    jenlib::measurement::SeriesPoint point{};
+    TEST_ASSERT_FALSE(series.value_at(199, point));
+    TEST_ASSERT_TRUE(series.value_at(350, point));
+    TEST_ASSERT_EQUAL_INT16(3, point.temperature_c_centi);
+    TEST_ASSERT_FALSE(series.append(make_reading(kSensor, kSession, 50, 9, 0)));
+}
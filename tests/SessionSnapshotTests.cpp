@@ -0,0 +1,205 @@
+//! @file tests/SessionSnapshotTests.cpp
+//! @brief Tests for session snapshots and fast sensor resume
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include <unity.h>
+#include <string>
+#include <jenlib/ble/Messages.h>
+#include <jenlib/state/SensorStateMachine.h>
+#include <jenlib/state/SessionSnapshot.h>
+#include <jenlib/storage/Crc32.h>
+#include <jenlib/storage/drivers/FileSnapshotStore.h>
+#include <jenlib/time/Time.h>
+#include "TestHelpers.h"
+
+using jenlib::ble::DeviceId;
+using jenlib::ble::SessionId;
+using jenlib::state::SensorState;
+using jenlib::state::SensorStateMachine;
+using jenlib::state::SessionSnapshot;
+using jenlib::test::ManualTimeDriver;
+
+namespace {
+SessionSnapshot make_snapshot() {
+    SessionSnapshot snapshot;
+    snapshot.session_id = SessionId(0x5678);
+    snapshot.broker_id = DeviceId(0xB0);
+    snapshot.measurement_interval_ms = 1000;
+    snapshot.session_offset_ms = 12300;
+    snapshot.next_measurement_offset_ms = 13000;
+    snapshot.last_sent_offset_ms = 12000;
+    snapshot.acked_offset_ms = 11000;
+    snapshot.flags = SessionSnapshot::kFlagHasSent | SessionSnapshot::kFlagHasAck;
+    return snapshot;
+}
+}  // namespace
+
+//! @test test_session_snapshot_round_trip
+//! @brief Verifies every field survives encoding and the CRC matches the standard check value
+void test_session_snapshot_round_trip(void) {
+    //! @section Arrange
+    const SessionSnapshot snapshot = make_snapshot();
+    const std::uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+    //! @section Act
+    SessionSnapshot::Buffer buffer{};
+    TEST_ASSERT_TRUE(SessionSnapshot::serialize(snapshot, buffer));
+    SessionSnapshot decoded;
+    const bool ok = SessionSnapshot::deserialize(buffer.data(), buffer.size(), decoded);
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926, jenlib::storage::crc32(check, sizeof(check)));
+    TEST_ASSERT_TRUE(ok);
+    TEST_ASSERT_TRUE(decoded.session_id == snapshot.session_id);
+    TEST_ASSERT_TRUE(decoded.broker_id == snapshot.broker_id);
+    TEST_ASSERT_EQUAL_UINT32(1000, decoded.measurement_interval_ms);
+    TEST_ASSERT_EQUAL_UINT32(12300, decoded.session_offset_ms);
+    TEST_ASSERT_EQUAL_UINT32(13000, decoded.next_measurement_offset_ms);
+    TEST_ASSERT_EQUAL_UINT32(12000, decoded.last_sent_offset_ms);
+    TEST_ASSERT_EQUAL_UINT32(11000, decoded.acked_offset_ms);
+    TEST_ASSERT_EQUAL_UINT8(snapshot.flags, decoded.flags);
+}
+
+//! @test test_session_snapshot_rejects_corruption
+//! @brief Verifies a flipped bit, a wrong length or a wrong version is rejected
+void test_session_snapshot_rejects_corruption(void) {
+    //! @section Arrange
+    SessionSnapshot::Buffer buffer{};
+    SessionSnapshot::serialize(make_snapshot(), buffer);
+    SessionSnapshot::Buffer flipped = buffer;
+    flipped[17] ^= 0x04;
+    SessionSnapshot::Buffer other_version = buffer;
+    other_version[2] = SessionSnapshot::kVersion + 1;
+
+    //! @section Act
+    SessionSnapshot decoded;
+    const bool flipped_ok = SessionSnapshot::deserialize(flipped.data(), flipped.size(), decoded);
+    const bool short_ok = SessionSnapshot::deserialize(buffer.data(), buffer.size() - 1, decoded);
+    const bool version_ok = SessionSnapshot::deserialize(other_version.data(), other_version.size(), decoded);
+
+    //! @section Assert
+    TEST_ASSERT_FALSE(flipped_ok);
+    TEST_ASSERT_FALSE(short_ok);
+    TEST_ASSERT_FALSE(version_ok);
+}
+
+//! @test test_sensor_resumes_session_without_start_broadcast
+//! @brief Verifies a rebooted sensor restored from a snapshot runs on reconnect and keeps its timeline
+void test_sensor_resumes_session_without_start_broadcast(void) {
+    //! @section Arrange
+    ManualTimeDriver clock;
+    clock.now_ms = 5000;
+    jenlib::time::Time::setDriver(&clock);
+    SensorStateMachine before_reboot;
+    before_reboot.handle_connection_change(true);
+    before_reboot.handle_start_broadcast(DeviceId(0xB0), jenlib::ble::StartBroadcastMsg{DeviceId(0xB0), SessionId(7)});
+    const jenlib::time::TimerId timer = jenlib::time::Time::schedule_callback(1000, []() {}, true);
+    for (const std::uint32_t step : {1000, 1000, 400}) {
+        clock.now_ms += step;
+        jenlib::time::Time::process_timers();
+    }
+    before_reboot.should_broadcast(jenlib::test::make_reading(DeviceId(0x10), SessionId(7), 2000));
+    before_reboot.handle_receipt(DeviceId(0xB0), jenlib::ble::ReceiptMsg{SessionId(7), 1000});
+    SessionSnapshot snapshot;
+    TEST_ASSERT_TRUE(before_reboot.snapshot(snapshot, timer));
+    jenlib::time::Time::cancel_callback(timer);
+
+    //! @section Act
+    clock.now_ms = 100;  // Clock restarts after the reset
+    SensorStateMachine after_reboot;
+    const bool restored = after_reboot.restore(snapshot, 300);
+    const bool pending = after_reboot.is_resume_pending();
+    const bool connected = after_reboot.handle_connection_change(true);
+
+    //! @section Assert
+    TEST_ASSERT_TRUE(restored);
+    TEST_ASSERT_TRUE(pending);
+    TEST_ASSERT_TRUE(connected);
+    TEST_ASSERT_TRUE(after_reboot.is_in_state(SensorState::kRunning));
+    TEST_ASSERT_FALSE(after_reboot.is_resume_pending());
+    TEST_ASSERT_TRUE(after_reboot.get_current_session_id() == SessionId(7));
+    TEST_ASSERT_EQUAL_UINT32(2000, after_reboot.get_last_sent_offset_ms());
+    TEST_ASSERT_EQUAL_UINT32(1000, after_reboot.get_acked_offset_ms());
+    // Snapshot at session time 2400, 300 ms of downtime, next tick due at 3000
+    TEST_ASSERT_EQUAL_UINT32(300, after_reboot.get_resume_delay_ms());
+    const jenlib::ble::StartBroadcastMsg start{DeviceId(0xB0), SessionId(7)};
+    TEST_ASSERT_FALSE(after_reboot.handle_start_broadcast(DeviceId(0xB0), start));
+    TEST_ASSERT_FALSE(SensorStateMachine().snapshot(snapshot));
+    jenlib::time::Time::setDriver(nullptr);
+}
+
+//! @test test_sensor_restore_keeps_adaptive_sampling
+//! @brief Verifies adaptive sampling and its interval survive a snapshot round trip through a reboot
+void test_sensor_restore_keeps_adaptive_sampling(void) {
+    //! @section Arrange
+    ManualTimeDriver clock;
+    jenlib::time::Time::setDriver(&clock);
+    const jenlib::measurement::AdaptiveSamplingConfig config{1000, 60000, 10, 50};
+    const jenlib::ble::ReadingMsg steady{DeviceId(0x10), SessionId(7), 0, 2100, 4000};
+    SensorStateMachine before_reboot;
+    before_reboot.set_adaptive_sampling(config);
+    before_reboot.handle_connection_change(true);
+    before_reboot.handle_start_broadcast(DeviceId(0xB0), jenlib::ble::StartBroadcastMsg{DeviceId(0x10), SessionId(7)});
+    for (int i = 0; i < 3; ++i) {
+        before_reboot.update_measurement_interval(steady);  // Backs off 1000 -> 2000 -> 4000
+    }
+    SessionSnapshot snapshot;
+    TEST_ASSERT_TRUE(before_reboot.snapshot(snapshot));
+    SessionSnapshot::Buffer buffer{};
+    TEST_ASSERT_TRUE(SessionSnapshot::serialize(snapshot, buffer));
+    SessionSnapshot decoded;
+    TEST_ASSERT_TRUE(SessionSnapshot::deserialize(buffer.data(), buffer.size(), decoded));
+
+    //! @section Act
+    SensorStateMachine after_reboot;
+    after_reboot.set_measurement_interval_ms(1500);
+    after_reboot.set_adaptive_sampling(config);  // Boot configuration, starting at the minimum
+    const bool restored = after_reboot.restore(decoded);
+    const std::uint32_t restored_interval = after_reboot.get_measurement_interval_ms();
+    after_reboot.handle_connection_change(true);
+    SessionSnapshot resaved;
+    TEST_ASSERT_TRUE(after_reboot.snapshot(resaved));
+    after_reboot.update_measurement_interval(steady);  // First reading after reboot only seeds the history
+    const bool adapted = after_reboot.update_measurement_interval(steady);
+    SensorStateMachine fixed_boot;
+    fixed_boot.set_measurement_interval_ms(1500);
+    fixed_boot.restore(decoded);
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL_UINT32(4000, snapshot.measurement_interval_ms);
+    TEST_ASSERT_TRUE(decoded.flags & SessionSnapshot::kFlagAdaptiveSampling);
+    TEST_ASSERT_TRUE(restored);
+    TEST_ASSERT_TRUE(after_reboot.is_adaptive_sampling());
+    TEST_ASSERT_EQUAL_UINT32(4000, restored_interval);
+    TEST_ASSERT_EQUAL_UINT8(decoded.flags, resaved.flags);
+    TEST_ASSERT_TRUE(adapted);
+    TEST_ASSERT_EQUAL_UINT32(8000, after_reboot.get_measurement_interval_ms());  // Carries on from 4000
+    TEST_ASSERT_TRUE(fixed_boot.is_adaptive_sampling());
+    TEST_ASSERT_EQUAL_UINT32(4000, fixed_boot.get_measurement_interval_ms());
+    fixed_boot.set_fixed_sampling();
+    TEST_ASSERT_EQUAL_UINT32(1500, fixed_boot.get_measurement_interval_ms());
+    jenlib::time::Time::setDriver(nullptr);
+}
+
+//! @test test_file_snapshot_store_save_load_clear
+//! @brief Verifies the file store round-trips a snapshot and clear() removes it
+void test_file_snapshot_store_save_load_clear(void) {
+    //! @section Arrange
+    const std::string path = jenlib::test::scratch_path("snapshot");
+    jenlib::storage::FileSnapshotStore store(path);
+    SessionSnapshot loaded;
+
+    //! @section Act
+    const bool saved = SessionSnapshot::save(store, make_snapshot());
+    const bool loaded_ok = SessionSnapshot::load(store, loaded);
+    const bool cleared = store.clear();
+    const bool loaded_after_clear = SessionSnapshot::load(store, loaded);
+
+    //! @section Assert
+    TEST_ASSERT_TRUE(saved);
+    TEST_ASSERT_TRUE(loaded_ok);
+    TEST_ASSERT_EQUAL_UINT32(12300, loaded.session_offset_ms);
+    TEST_ASSERT_TRUE(cleared);
+    TEST_ASSERT_FALSE(loaded_after_clear);
+}
@@ -0,0 +1,201 @@
+//! @file tests/ShmBleTransportTests.cpp
+//! @brief Tests for the shared-memory BLE transport
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#include <unity.h>
+
+#if defined(__linux__)
+
+#include <sys/wait.h>
+#include <unistd.h>
+#include <string>
+#include "jenlib/ble/Messages.h"
+#include "jenlib/ble/drivers/NativeBleDriver.h"
+#include "jenlib/ble/drivers/ShmBleTransport.h"
+
+using jenlib::ble::BlePayload;
+using jenlib::ble::DeviceId;
+using jenlib::ble::ShmBleTransport;
+
+namespace {
+std::string segment_name(const char* test) {
+    return std::string("/jenlib-test-") + test + "-" + std::to_string(getpid());
+}
+}  // namespace
+
+//! @test test_shm_transport_round_trip_between_mappings
+//! @brief Verifies messages written in place through one mapping are read in order through another
+void test_shm_transport_round_trip_between_mappings(void) {
+    //! @section Arrange
+    const std::string name = segment_name("mappings");
+    ShmBleTransport producer;
+    ShmBleTransport consumer;
+    TEST_ASSERT_TRUE(producer.open(name.c_str(), true));
+    TEST_ASSERT_TRUE(consumer.open(name.c_str(), false));
+
+    //! @section Act
+    for (std::uint8_t i = 1; i <= 3; ++i) {
+        TEST_ASSERT_TRUE(producer.send_in_place(DeviceId(7), [i](BlePayload& slot) {
+            return slot.append_u8(i) && slot.append_u32le(0xCAFE0000u + i);
+        }));
+    }
+    TEST_ASSERT_FALSE(producer.send_in_place(DeviceId(7), [](BlePayload&) { return false; }));
+
+    //! @section Assert
+    std::uint8_t expected = 1;
+    const std::size_t handled = consumer.consume(DeviceId(7), [&expected](const BlePayload& payload) {
+        std::size_t i = 0;
+        std::uint8_t tag = 0;
+        std::uint32_t value = 0;
+        if (jenlib::ble::read_u8(payload, i, tag) && jenlib::ble::read_u32le(payload, i, value) &&
+            tag == expected && value == 0xCAFE0000u + expected) {
+            ++expected;
+        }
+    });
+    TEST_ASSERT_EQUAL(3, handled);
+    TEST_ASSERT_EQUAL_UINT8(4, expected);
+    BlePayload out;
+    TEST_ASSERT_FALSE(consumer.receive(DeviceId(7), out));  // The refused fill was skipped
+    TEST_ASSERT_FALSE(consumer.wait(DeviceId(7), 1));
+    TEST_ASSERT_TRUE(ShmBleTransport::unlink(name.c_str()));
+}
+
+//! @test test_shm_transport_full_ring_drops_newest
+//! @brief Verifies a full ring refuses messages and counts them
+void test_shm_transport_full_ring_drops_newest(void) {
+    //! @section Arrange
+    const std::string name = segment_name("full");
+    ShmBleTransport transport;
+    TEST_ASSERT_TRUE(transport.open(name.c_str(), true));
+    BlePayload payload;
+    payload.append_u8(0x42);
+
+    //! @section Act
+    for (std::size_t i = 0; i < ShmBleTransport::kRingSlots; ++i) {
+        TEST_ASSERT_TRUE(transport.send(DeviceId(1), payload));
+    }
+    const bool overflow_sent = transport.send(DeviceId(1), payload);
+
+    //! @section Assert
+    TEST_ASSERT_FALSE(overflow_sent);
+    TEST_ASSERT_EQUAL_UINT64(1, transport.dropped(DeviceId(1)));
+    TEST_ASSERT_EQUAL_UINT64(0, transport.dropped(DeviceId(2)));
+    BlePayload out;
+    TEST_ASSERT_TRUE(transport.receive(DeviceId(1), out));
+    TEST_ASSERT_TRUE(transport.send(DeviceId(1), payload));  // Room again once consumed
+    TEST_ASSERT_TRUE(ShmBleTransport::unlink(name.c_str()));
+}
+
+//! @test test_shm_transport_across_processes
+//! @brief Verifies a forked producer process delivers every message in order and wakes the consumer
+void test_shm_transport_across_processes(void) {
+    //! @section Arrange
+    constexpr std::uint32_t kMessages = 5000;
+    const std::string name = segment_name("fork");
+    ShmBleTransport consumer;
+    TEST_ASSERT_TRUE(consumer.open(name.c_str(), true));
+
+    //! @section Act
+    const pid_t child = fork();
+    TEST_ASSERT_TRUE(child >= 0);
+    if (child == 0) {
+        ShmBleTransport producer;
+        if (!producer.open(name.c_str(), false)) {
+            _exit(1);
+        }
+        for (std::uint32_t i = 0; i < kMessages; ++i) {
+            while (!producer.send_in_place(DeviceId(0), [i](BlePayload& slot) { return slot.append_u32le(i); })) {
+                usleep(50);  // Ring full: let the consumer catch up
+            }
+        }
+        _exit(0);
+    }
+
+    std::uint32_t next = 0;
+    bool in_order = true;
+    for (int idle = 0; next < kMessages && idle < 100; ) {
+        if (!consumer.wait(DeviceId(0), 20)) {
+            ++idle;
+            continue;
+        }
+        consumer.consume(DeviceId(0), [&](const BlePayload& payload) {
+            std::size_t i = 0;
+            std::uint32_t value = 0;
+            in_order = in_order && jenlib::ble::read_u32le(payload, i, value) && value == next;
+            ++next;
+        });
+    }
+    int status = 0;
+    waitpid(child, &status, 0);
+
+    //! @section Assert
+    TEST_ASSERT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    TEST_ASSERT_EQUAL_UINT32(kMessages, next);
+    TEST_ASSERT_TRUE(in_order);
+    TEST_ASSERT_TRUE(ShmBleTransport::unlink(name.c_str()));
+}
+
+//! @test test_native_driver_over_shm_transport
+//! @brief Verifies two NativeBleDrivers exchange typed messages, directed and advertised, through separate mappings
+void test_native_driver_over_shm_transport(void) {
+    //! @section Arrange
+    const std::string name = segment_name("driver");
+    ShmBleTransport broker_transport;
+    ShmBleTransport sensor_transport;
+    TEST_ASSERT_TRUE(broker_transport.open(name.c_str(), true));
+    TEST_ASSERT_TRUE(sensor_transport.open(name.c_str(), false));
+    jenlib::ble::NativeBleDriver broker(DeviceId(0));
+    jenlib::ble::NativeBleDriver sensor(DeviceId(0x1234));
+    broker.set_transport(&broker_transport);
+    sensor.set_transport(&sensor_transport);
+    broker.begin();
+    sensor.begin();
+    int readings = 0;
+    std::int16_t last_temperature = 0;
+    DeviceId last_sender(0);
+    broker.set_reading_callback([&](DeviceId sender, const jenlib::ble::ReadingMsg& msg) {
+        ++readings;
+        last_temperature = msg.temperature_c_centi;
+        last_sender = sender;
+    });
+
+    //! @section Act
+    BlePayload reading_payload;
+    jenlib::ble::ReadingMsg::serialize(jenlib::ble::ReadingMsg{DeviceId(0x1234), jenlib::ble::SessionId(9), 1000,
+                                                               2345, 4000}, reading_payload);
+    sensor.send_to(DeviceId(0), std::move(reading_payload));
+    BlePayload start_payload;
+    jenlib::ble::StartBroadcastMsg::serialize(
+        jenlib::ble::StartBroadcastMsg{DeviceId(0x1234), jenlib::ble::SessionId(9)}, start_payload);
+    broker.send_to(DeviceId(0x1234), std::move(start_payload));
+    TEST_ASSERT_EQUAL(0, readings);  // Nothing is delivered until the receiver polls
+    broker.poll();
+    const int directed_readings = readings;
+    BlePayload advertised_payload;
+    jenlib::ble::ReadingMsg::serialize(jenlib::ble::ReadingMsg{DeviceId(0x1234), jenlib::ble::SessionId(9), 2000,
+                                                               2400, 4000}, advertised_payload);
+    sensor.advertise(DeviceId(0x1234), std::move(advertised_payload));  // Shim header written into the slot
+    broker.poll();
+
+    //! @section Assert
+    TEST_ASSERT_EQUAL(1, directed_readings);
+    TEST_ASSERT_EQUAL(2, readings);
+    TEST_ASSERT_EQUAL_INT16(2400, last_temperature);
+    TEST_ASSERT_EQUAL_UINT32(0x1234, last_sender.value());
+    BlePayload received;
+    jenlib::ble::StartBroadcastMsg start_msg;
+    TEST_ASSERT_TRUE(sensor.receive(DeviceId(0x1234), received));
+    TEST_ASSERT_TRUE(jenlib::ble::StartBroadcastMsg::deserialize(received, start_msg));
+    TEST_ASSERT_EQUAL_UINT32(9, start_msg.session_id.value());
+    TEST_ASSERT_TRUE(ShmBleTransport::unlink(name.c_str()));
+}
+
+#else
+
+void test_shm_transport_round_trip_between_mappings(void) { TEST_IGNORE(); }
+void test_shm_transport_full_ring_drops_newest(void) { TEST_IGNORE(); }
+void test_shm_transport_across_processes(void) { TEST_IGNORE(); }
+void test_native_driver_over_shm_transport(void) { TEST_IGNORE(); }
+
+#endif  // __linux__
@@ -0,0 +1,67 @@
+//! @file tests/TestHelpers.h
+//! @brief Reading factory, manual clock and scratch paths shared by the test files
+//! @copyright 2025 Jennifer Gott, released under the MIT License.
+//! @author Jennifer Gott (jennifer.gott@chasacademy.se)
+
+#ifndef TESTS_TESTHELPERS_H_
+#define TESTS_TESTHELPERS_H_
+
+#include <cstdint>
+#include "jenlib/ble/Ids.h"
+#include "jenlib/ble/Messages.h"
+#include "jenlib/time/TimeDriver.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <ftw.h>
+#include <unistd.h>
+#include <cstdio>
+#include <string>
+#endif
+
+namespace jenlib::test {
+
+//! @brief Temperature of a reading when the test does not care (21.00 °C)
+constexpr std::int16_t kTemperatureCenti = 2100;
+
+//! @brief Humidity of a reading when the test does not care (40.00 %)
+constexpr std::uint16_t kHumidityBp = 4000;
+
+//! @brief Time driver whose clock only moves when told to
+class ManualTimeDriver : public jenlib::time::TimeDriver {
+ public:
+    std::uint32_t now() override { return now_ms; }
+    void delay(std::uint32_t delay_ms) override { now_ms += delay_ms; }
+    bool has_overflowed(std::uint32_t) noexcept override { return false; }
+    std::uint32_t time_difference(std::uint32_t current, std::uint32_t previous) noexcept override {
+        return current - previous;
+    }
+
+    std::uint32_t now_ms{0};
+};
+
+//! @brief Build a reading; fields are in ReadingMsg order
+inline jenlib::ble::ReadingMsg make_reading(jenlib::ble::DeviceId sensor, jenlib::ble::SessionId session,
+                                            std::uint32_t offset_ms,
+                                            std::int16_t temperature_c_centi = kTemperatureCenti,
+                                            std::uint16_t humidity_bp = kHumidityBp) {
+    return jenlib::ble::ReadingMsg{sensor, session, offset_ms, temperature_c_centi, humidity_bp};
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+
+//! @brief Path under /tmp private to this test process, e.g. /tmp/jenlib-wal-1234
+inline std::string scratch_path(const char* name) {
+    return std::string("/tmp/jenlib-") + name + "-" + std::to_string(getpid());
+}
+
+//! @brief Remove a scratch file, or a directory with everything in it; a missing path is fine
+inline void remove_scratch(const std::string& path) {
+    nftw(path.c_str(), [](const char* entry, const struct stat*, int, struct FTW*) { return std::remove(entry); },
+         8, FTW_DEPTH | FTW_PHYS);
+}
+
+#endif  // __unix__ || __APPLE__
+
+}  // namespace jenlib::test
+
+#endif  // TESTS_TESTHELPERS_H_
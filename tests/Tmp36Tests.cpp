@@ -5,6 +5,8 @@
 
 #include <unity.h>
 #include <cstdint>
+#include "jenlib/gpio/drivers/NativeGpioDriver.h"
+#include "jenlib/sensors/Tmp36.h"
 
 
 // Local conversion function (example-style) to avoid embedding sensor logic in the lib
@@ -38,3 +40,53 @@ void test_tmp36_conversion_12bit_3v3(void) {
     float c = tmp36_celsius_from_code_local(code, bits, static_cast<float>(vref));
     TEST_ASSERT_FLOAT_WITHIN(1.0f, 30.0f, c);
 }
+
+//! @test test_tmp36_lut_matches_float_conversion
+//! @brief Verifies every table entry agrees with the float formula to within rounding.
+//! @details Codes above the int16 range saturate; the check covers the rest. Also
+//! checks the table is usable in constant expressions.
+void test_tmp36_lut_matches_float_conversion(void) {
+    using Sensor = jenlib::sensors::Tmp36<10, 5000>;
+    static_assert(Sensor::centi_from_code(0) == -5000, "0 V is -50 C");
+    static_assert(Sensor::centi_from_code(153) == 2478, "0.748 V is 24.78 C");
+
+    for (std::uint16_t code = 0; code < Sensor::kCodes; ++code) {
+        const float expected = tmp36_celsius_from_code_local(code, 10, 5.0f) * 100.0f;
+        if (expected > 32767.0f) {
+            TEST_ASSERT_EQUAL_INT16(32767, Sensor::centi_from_code(code));
+            continue;
+        }
+        TEST_ASSERT_FLOAT_WITHIN(0.51f, expected, static_cast<float>(Sensor::centi_from_code(code)));
+    }
+}
+
+//! @test test_tmp36_oversampling_interpolates
+//! @brief Verifies an oversampled sum lands between neighbouring table entries.
+void test_tmp36_oversampling_interpolates(void) {
+    using Sensor = jenlib::sensors::Tmp36<12, 3300, 2>;
+    const std::int16_t low = Sensor::centi_from_code(993);
+    const std::int16_t high = Sensor::centi_from_code(994);
+
+    TEST_ASSERT_EQUAL_INT16(low, Sensor::centi_from_sum(993 * 4));
+    TEST_ASSERT_EQUAL_INT16(high, Sensor::centi_from_sum(994 * 4));
+    const std::int16_t middle = Sensor::centi_from_sum(993 * 4 + 2);
+    TEST_ASSERT_TRUE(middle > low && middle < high);
+    TEST_ASSERT_EQUAL_INT16(Sensor::centi_from_code(4095), Sensor::centi_from_sum(4095 * 4 + 3));
+}
+
+//! @test test_tmp36_driver_reads_native_pin
+//! @brief Verifies begin() configures the ADC and read_centi() converts the pin voltage.
+void test_tmp36_driver_reads_native_pin(void) {
+    jenlib::gpio::NativeGpioDriver driver;
+    driver.set_reference_voltage(3.3f);
+    GPIO::setDriver(&driver);
+
+    jenlib::sensors::Tmp36<12, 3300, 4> sensor(GPIO::Pin(5));
+    TEST_ASSERT_TRUE(sensor.begin());
+    TEST_ASSERT_EQUAL_UINT8(12, driver.get_analog_read_resolution());
+
+    driver.set_pin_voltage(5, 0.75f);  // 25 C
+    TEST_ASSERT_INT16_WITHIN(5, 2500, sensor.read_centi());
+
+    GPIO::setDriver(nullptr);
+}